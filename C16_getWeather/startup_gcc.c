@@ -27,6 +27,7 @@ static void IntDefaultHandler(void);
 //
 //*****************************************************************************
 extern void GPIOB_intHandler(void);
+extern void WideTimer5B_Handler(void);
 extern void UARTStdioIntHandler(void);
 
 //*****************************************************************************
@@ -174,7 +175,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Wide Timer 4 subtimer A
     IntDefaultHandler,                      // Wide Timer 4 subtimer B
     IntDefaultHandler,                      // Wide Timer 5 subtimer A
-    IntDefaultHandler,                      // Wide Timer 5 subtimer B
+    WideTimer5B_Handler,                    // Wide Timer 5 subtimer B
     IntDefaultHandler,                      // FPU
     0,                                      // Reserved
     0,                                      // Reserved
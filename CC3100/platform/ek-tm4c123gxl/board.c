@@ -34,6 +34,7 @@
  *
 */
 
+#include <stdint.h>                  /* timer.h needs uint64_t */
 #include "simplelink.h"
 #include "tm4c123gh6pm.h"
 #include "inc/hw_memmap.h"
@@ -45,6 +46,9 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/fpu.h"
 #include "driverlib/uart.h"
+#include "driverlib/timer.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/cpu.h"
 #include "board.h"
 
 
@@ -52,6 +56,9 @@ P_EVENT_HANDLER        pIrqEventHandler = 0;
 
 BOOLEAN IntIsMasked;
 
+/* Wide timer 5: A counts microseconds, B times the non-os main loop's sleeps */
+static BOOLEAN TimeBaseUp;
+
 
 void initClk(){
     /*The FPU should be enabled because some compilers will use floating-
@@ -122,6 +129,67 @@ void Delay(unsigned long interval)
 	ROM_SysCtlDelay( (ROM_SysCtlClockGet()/(3*1000))*interval );
 }
 
+void WideTimer5B_Handler(void)
+{
+    /* Waking the processor is all it is for */
+    TimerIntClear(WTIMER5_BASE, TIMER_TIMB_TIMEOUT);
+}
+
+static void TimeBaseInit(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER5);
+    TimerConfigure(WTIMER5_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC
+            | TIMER_CFG_B_ONE_SHOT);
+    TimerPrescaleSet(WTIMER5_BASE, TIMER_BOTH, SysCtlClockGet()/1000000 - 1);
+    TimerLoadSet(WTIMER5_BASE, TIMER_A, 0xFFFFFFFF);
+    TimerIntEnable(WTIMER5_BASE, TIMER_TIMB_TIMEOUT);
+    IntEnable(INT_WTIMER5B);
+    TimerEnable(WTIMER5_BASE, TIMER_A);
+    TimeBaseUp = TRUE;
+}
+
+unsigned long CC3100_TimeUs(void)
+{
+    if(!TimeBaseUp)
+    {
+        TimeBaseInit();
+    }
+
+    /* Timer A counts down */
+    return 0xFFFFFFFF - TimerValueGet(WTIMER5_BASE, TIMER_A);
+}
+
+void CC3100_Sleep(unsigned long ulUs)
+{
+    if(!TimeBaseUp)
+    {
+        TimeBaseInit();
+    }
+    if(ulUs)
+    {
+        TimerLoadSet(WTIMER5_BASE, TIMER_B, ulUs);
+        TimerEnable(WTIMER5_BASE, TIMER_B);
+    }
+
+    /* With interrupts masked, a pending one still ends the WFI */
+    CPUwfi();
+
+    TimerDisable(WTIMER5_BASE, TIMER_B);
+}
+
+unsigned long CC3100_IrqSave(void)
+{
+    return CPUcpsid();
+}
+
+void CC3100_IrqRestore(unsigned long ulState)
+{
+    if(!ulState)
+    {
+        CPUcpsie();
+    }
+}
+
 void GPIOB_intHandler()
 {
     unsigned long intStatus;
@@ -75,6 +75,22 @@ int registerInterruptHandler(P_EVENT_HANDLER InterruptHdl , void* pValue);
 */
 void GPIOB_intHandler(void);
 
+/*!
+    \brief          Wide Timer 5B interrupt handler
+
+    \param[in]      none
+
+    \return         none
+
+    \note           Only wakes the processor out of the CC3100_TimeUs()
+                    time base; it is named in the startup vector table
+                    rather than registered at run time so the table can
+                    stay in flash
+
+    \warning
+*/
+void WideTimer5B_Handler(void);
+
 /*!
     \brief             Enables the CC3100
 
@@ -201,4 +217,61 @@ void UART1_intHandler(void);
 */
 void Delay(unsigned long interval);
 
+/*!
+    \brief     Reads the free running microsecond count used by the non-os
+               main loop
+
+    \param[in]         none
+
+    \return            microseconds since the time base started, wrapping
+                       at the width of unsigned long
+
+    \note              The time base is started by the first call
+
+    \warning
+*/
+unsigned long CC3100_TimeUs(void);
+
+/*!
+    \brief     Sleeps until an interrupt or for a number of microseconds
+
+    \param[in]         ulUs - the longest to sleep, or 0 to sleep until an
+                       interrupt
+
+    \return            none
+
+    \note              Called with interrupts masked by CC3100_IrqSave, so an
+                       interrupt that arrives first ends the sleep at once and
+                       is taken once they are unmasked
+
+    \warning
+*/
+void CC3100_Sleep(unsigned long ulUs);
+
+/*!
+    \brief     Masks interrupts
+
+    \param[in]         none
+
+    \return            the previous state, for CC3100_IrqRestore
+
+    \note
+
+    \warning
+*/
+unsigned long CC3100_IrqSave(void);
+
+/*!
+    \brief     Restores the interrupt mask saved by CC3100_IrqSave
+
+    \param[in]         ulState - what CC3100_IrqSave returned
+
+    \return            none
+
+    \note
+
+    \warning
+*/
+void CC3100_IrqRestore(unsigned long ulState);
+
 #endif
@@ -34,6 +34,7 @@
  *
 */
 
+
 #ifndef SL_IF_TYPE_UART
 #include "simplelink.h"
 #include "board.h"
@@ -41,10 +42,12 @@
 #include "inc/hw_memmap.h"
 #include "inc/hw_ssi.h"
 #include "inc/hw_gpio.h"
+#include "inc/hw_nvic.h"
 #include "inc/hw_types.h"
 #include "driverlib/pin_map.h"
 #include "inc/hw_ints.h"
 #include "driverlib/ssi.h"
+#include "driverlib/udma.h"
 #include "driverlib/rom.h"
 #include "driverlib/gpio.h"
 #include "driverlib/sysctl.h"
@@ -55,6 +58,63 @@
 #define ASSERT_CS()         GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_0, PIN_LOW)
 #define DEASSERT_CS()       GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_0, PIN_HIGH)
 
+/* Depth of the SSI transmit and receive FIFOs */
+#define SPI_FIFO_DEPTH      8
+
+/* Most bytes one basic mode uDMA transfer can move */
+#define SPI_DMA_MAX         1024
+
+#define SPI_DMA_RX          UDMA_CH12_SSI2RX
+#define SPI_DMA_TX          UDMA_CH13_SSI2TX
+
+/*
+ * Registers are read directly in the transfer loops; the host model
+ * supplies them, and the cycle count, when built with HEADLESS.
+ */
+#ifdef HEADLESS
+#define SPI_STATUS()        SpiModelStatus()
+#define SPI_DATA_PUT(d)     SpiModelDataPut(d)
+#define SPI_DATA_GET()      SpiModelDataGet()
+#define SPI_CYCLES()        SpiModelCycles()
+#define SPI_DMA_REACHES(p)  1
+#else
+#define DWT_CTRL            0xE0001000  /* DWT Control */
+#define DWT_CYCCNT          0xE0001004  /* DWT Cycle Count */
+#define DWT_CTRL_CYCCNTENA  0x00000001  /* Enable the cycle counter */
+#define NVIC_DBG_INT_TRCENA 0x01000000  /* Enable the DWT and ITM */
+#define SPI_STATUS()        HWREG(SSI2_BASE + SSI_O_SR)
+#define SPI_DATA_PUT(d)     (HWREG(SSI2_BASE + SSI_O_DR) = (d))
+#define SPI_DATA_GET()      HWREG(SSI2_BASE + SSI_O_DR)
+#define SPI_CYCLES()        HWREG(DWT_CYCCNT)
+/* The uDMA is only given buffers in SRAM; anything else goes by the FIFO */
+#define SPI_DMA_REACHES(p)  (((unsigned long)(p) & 0xF0000000) == 0x20000000)
+#endif
+
+/*
+ * The uDMA control table, unless the application has set one up already.
+ * Once installed it is the table every other driver finds through
+ * uDMAControlBaseGet(), so it is full size: primary and alternate
+ * structures for all 32 channels, 16 bytes each.
+ */
+#define SPI_DMA_TABLE_SIZE  1024
+#if defined(ewarm)
+#pragma data_alignment=1024
+static unsigned char g_ucSpiDmaTable[SPI_DMA_TABLE_SIZE];
+#elif defined(ccs)
+#pragma DATA_ALIGN(g_ucSpiDmaTable, 1024)
+static unsigned char g_ucSpiDmaTable[SPI_DMA_TABLE_SIZE];
+#else
+static unsigned char g_ucSpiDmaTable[SPI_DMA_TABLE_SIZE] __attribute__ ((aligned(1024)));
+#endif
+
+/* What is sent while reading, and where what is received while writing goes */
+static unsigned char g_ucSpiFill = 0xFF;
+static unsigned char g_ucSpiSink;
+
+static unsigned long g_ulSpiDmaThreshold = SPI_DMA_THRESHOLD;
+static unsigned long g_ulSpiClock;
+static SpiStats_t g_SpiStats[2];
+
 
 int spi_Close(Fd_t fd)
 {
@@ -68,9 +128,9 @@ Fd_t spi_Open(char *ifName, unsigned long flags)
 {
     /* Configure CS (PE0) and nHIB (PE4) lines */
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
-    ROM_GPIOPinTypeGPIOOutput(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_4);
-    ROM_GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_4, PIN_LOW);
-    ROM_GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_0, PIN_HIGH);
+    GPIOPinTypeGPIOOutput(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_4);
+    GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_4, PIN_LOW);
+    GPIOPinWrite(GPIO_PORTE_BASE,GPIO_PIN_0, PIN_HIGH);
 
     SysCtlPeripheralEnable(SYSCTL_PERIPH_SSI2);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
@@ -90,6 +150,28 @@ Fd_t spi_Open(char *ifName, unsigned long flags)
 
     SSIEnable(SSI2_BASE);
 
+    /* SSI2 receive and transmit on uDMA channels 12 and 13 */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    uDMAEnable();
+    if(uDMAControlBaseGet() == 0)
+    {
+        uDMAControlBaseSet(g_ucSpiDmaTable);
+    }
+    uDMAChannelAssign(SPI_DMA_RX);
+    uDMAChannelAssign(SPI_DMA_TX);
+    uDMAChannelAttributeDisable(SPI_DMA_RX, UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(SPI_DMA_TX, UDMA_ATTR_ALL);
+
+    /* Receive first, so the receive FIFO is never left to overrun */
+    uDMAChannelAttributeEnable(SPI_DMA_RX, UDMA_ATTR_HIGH_PRIORITY);
+
+    /* Transfers are timed with the cycle counter */
+#ifndef HEADLESS
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+#endif
+    g_ulSpiClock = SysCtlClockGet();
+
     /* configure host IRQ line */
     GPIOPinTypeGPIOInput(GPIO_PORTB_BASE, GPIO_PIN_2);
     GPIOPadConfigSet(GPIO_PORTB_BASE, GPIO_PIN_2, GPIO_STRENGTH_2MA,
@@ -101,7 +183,7 @@ Fd_t spi_Open(char *ifName, unsigned long flags)
     IntMasterEnable();
 
     /* 1 ms delay */
-    ROM_SysCtlDelay( (ROM_SysCtlClockGet()/(3*1000))*1 );
+    SysCtlDelay( (SysCtlClockGet()/(3*1000))*1 );
 
     /* Enable WLAN interrupt */
     CC3100_InterruptEnable();
@@ -110,41 +192,219 @@ Fd_t spi_Open(char *ifName, unsigned long flags)
 }
 
 
+/*
+ * Keeps up to a FIFO's worth of bytes in flight: with no more than that
+ * between the transmit FIFO, the shift register and the receive FIFO,
+ * the transmit FIFO always has room and the receive FIFO cannot overrun,
+ * so only the receive side needs to be polled.
+ */
+static void spi_WriteFifo(unsigned char *pBuff, int len)
+{
+    int tx = 0;
+    int rx = 0;
+
+    while(rx < len)
+    {
+        while((tx < len) && (tx - rx < SPI_FIFO_DEPTH))
+        {
+            SPI_DATA_PUT(pBuff[tx]);
+            tx++;
+        }
+        while(SPI_STATUS() & SSI_SR_RNE)
+        {
+            (void)SPI_DATA_GET();
+            rx++;
+        }
+    }
+}
+
+
+static void spi_ReadFifo(unsigned char *pBuff, int len)
+{
+    int tx = 0;
+    int rx = 0;
+
+    while(rx < len)
+    {
+        while((tx < len) && (tx - rx < SPI_FIFO_DEPTH))
+        {
+            SPI_DATA_PUT(0xFF);
+            tx++;
+        }
+        while(SPI_STATUS() & SSI_SR_RNE)
+        {
+            pBuff[rx] = (unsigned char)SPI_DATA_GET();
+            rx++;
+        }
+    }
+}
+
+
+/*
+ * Moves len bytes by uDMA, SPI_DMA_MAX at a time: transmit from pTx, or
+ * the fill byte when it is 0, and receive into pRx, or the sink when it
+ * is 0.  Returns the cycles spent waiting for the uDMA.
+ */
+static unsigned long spi_TransferDma(unsigned char *pTx, unsigned char *pRx,
+        int len)
+{
+    unsigned long ulChunk;
+    unsigned long ulStart;
+    unsigned long ulWait = 0;
+
+    SSIDMAEnable(SSI2_BASE, SSI_DMA_RX | SSI_DMA_TX);
+    while(len)
+    {
+        ulChunk = (len > SPI_DMA_MAX) ? SPI_DMA_MAX : len;
+
+        uDMAChannelControlSet(SPI_DMA_RX | UDMA_PRI_SELECT, UDMA_SIZE_8 |
+                UDMA_SRC_INC_NONE | (pRx ? UDMA_DST_INC_8 : UDMA_DST_INC_NONE) |
+                UDMA_ARB_4);
+        uDMAChannelTransferSet(SPI_DMA_RX | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                (void *)(unsigned long)(SSI2_BASE + SSI_O_DR),
+                pRx ? pRx : &g_ucSpiSink, ulChunk);
+
+        uDMAChannelControlSet(SPI_DMA_TX | UDMA_PRI_SELECT, UDMA_SIZE_8 |
+                (pTx ? UDMA_SRC_INC_8 : UDMA_SRC_INC_NONE) | UDMA_DST_INC_NONE |
+                UDMA_ARB_4);
+        uDMAChannelTransferSet(SPI_DMA_TX | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                pTx ? pTx : &g_ucSpiFill,
+                (void *)(unsigned long)(SSI2_BASE + SSI_O_DR), ulChunk);
+
+        uDMAChannelEnable(SPI_DMA_RX);
+        uDMAChannelEnable(SPI_DMA_TX);
+
+        /* The last byte received is the end of the chunk on the wire */
+        ulStart = SPI_CYCLES();
+        while(uDMAChannelIsEnabled(SPI_DMA_RX))
+        {
+        }
+        ulWait += SPI_CYCLES() - ulStart;
+
+        if(pTx)
+        {
+            pTx += ulChunk;
+        }
+        if(pRx)
+        {
+            pRx += ulChunk;
+        }
+        len -= ulChunk;
+    }
+    SSIDMADisable(SSI2_BASE, SSI_DMA_RX | SSI_DMA_TX);
+
+    return ulWait;
+}
+
+
+static void spi_Account(unsigned long ulMode, int len, unsigned long ulStart,
+        unsigned long ulWait)
+{
+    unsigned long ulCycles = SPI_CYCLES() - ulStart;
+
+    g_SpiStats[ulMode].ulTransfers++;
+    g_SpiStats[ulMode].ullBytes += len;
+    g_SpiStats[ulMode].ullCycles += ulCycles;
+    g_SpiStats[ulMode].ullCpuCycles += ulCycles - ulWait;
+}
+
+
 int spi_Write(Fd_t fd, unsigned char *pBuff, int len)
 {
-    int len_to_return = len;
-    unsigned long ulDummy;
+    unsigned long ulStart = SPI_CYCLES();
+    unsigned long ulWait;
 
     ASSERT_CS();
 
-    while(len)
+    if(g_ulSpiDmaThreshold && ((unsigned long)len >= g_ulSpiDmaThreshold) &&
+            SPI_DMA_REACHES(pBuff))
+    {
+        ulWait = spi_TransferDma(pBuff, 0, len);
+        DEASSERT_CS();
+        spi_Account(SPI_MODE_DMA, len, ulStart, ulWait);
+    }
+    else
     {
-        while(SSIDataPutNonBlocking(SSI2_BASE, (unsigned long)*pBuff) != TRUE);
-        while(SSIDataGetNonBlocking(SSI2_BASE, &ulDummy) != TRUE);
-        pBuff++;
-        len--;
+        spi_WriteFifo(pBuff, len);
+        DEASSERT_CS();
+        spi_Account(SPI_MODE_FIFO, len, ulStart, 0);
     }
-    DEASSERT_CS();
 
-    return len_to_return;
+    return len;
 }
 
 
 int spi_Read(Fd_t fd, unsigned char *pBuff, int len)
 {
-    int i = 0;
-    unsigned long ulBuff;
+    unsigned long ulStart = SPI_CYCLES();
+    unsigned long ulWait;
 
     ASSERT_CS();
 
-    for(i=0; i< len; i++)
+    if(g_ulSpiDmaThreshold && ((unsigned long)len >= g_ulSpiDmaThreshold) &&
+            SPI_DMA_REACHES(pBuff))
+    {
+        ulWait = spi_TransferDma(0, pBuff, len);
+        DEASSERT_CS();
+        spi_Account(SPI_MODE_DMA, len, ulStart, ulWait);
+    }
+    else
     {
-        while(SSIDataPutNonBlocking(SSI2_BASE, 0xFF) != TRUE);
-        while(SSIDataGetNonBlocking(SSI2_BASE, &ulBuff) != TRUE);
-        pBuff[i] = (unsigned char)ulBuff;
+        spi_ReadFifo(pBuff, len);
+        DEASSERT_CS();
+        spi_Account(SPI_MODE_FIFO, len, ulStart, 0);
     }
-    DEASSERT_CS();
 
     return len;
 }
+
+
+void spi_DmaThresholdSet(unsigned long ulBytes)
+{
+    g_ulSpiDmaThreshold = ulBytes;
+}
+
+
+void spi_StatsGet(unsigned long ulMode, SpiStats_t *pStats)
+{
+    *pStats = g_SpiStats[ulMode];
+}
+
+
+void spi_StatsClear(void)
+{
+    memset(g_SpiStats, 0, sizeof(g_SpiStats));
+}
+
+
+void spi_StatsReport(P_SPI_PRINTF pfnPrintf)
+{
+    static const char * const pcMode[2] = { "fifo", "udma" };
+    SpiStats_t *pStats;
+    unsigned long ulMode;
+    unsigned long ulRate;
+    unsigned long ulCpuPerKB;
+    unsigned long ulBusy;
+
+    pfnPrintf("spi   transfers      bytes     B/s  cpu cyc/KB  cpu us/KB  busy\n");
+    for(ulMode = 0; ulMode < 2; ulMode++)
+    {
+        pStats = &g_SpiStats[ulMode];
+        if((pStats->ullBytes == 0) || (pStats->ullCycles == 0))
+        {
+            pfnPrintf("%s  %9u          0\n", pcMode[ulMode],
+                    pStats->ulTransfers);
+            continue;
+        }
+        ulRate = (unsigned long)((pStats->ullBytes * g_ulSpiClock) /
+                pStats->ullCycles);
+        ulCpuPerKB = (unsigned long)((pStats->ullCpuCycles * 1024) /
+                pStats->ullBytes);
+        ulBusy = (unsigned long)((pStats->ullCpuCycles * 100) /
+                pStats->ullCycles);
+        pfnPrintf("%s  %9u %10u %7u %11u %10u  %3u%%\n", pcMode[ulMode],
+                pStats->ulTransfers, (unsigned long)pStats->ullBytes, ulRate,
+                ulCpuPerKB, ulCpuPerKB / (g_ulSpiClock / 1000000), ulBusy);
+    }
+}
 #endif /* SL_IF_TYPE_UART */
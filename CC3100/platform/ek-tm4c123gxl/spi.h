@@ -50,6 +50,40 @@ extern "C" {
 */
 typedef unsigned int Fd_t;
 
+/*!
+    \brief   transfers of at least this many bytes go by uDMA rather than
+             through the FIFO loop; 0 keeps every transfer on the FIFO loop.
+             Can be changed at run time with spi_DmaThresholdSet
+*/
+#ifndef SPI_DMA_THRESHOLD
+#define SPI_DMA_THRESHOLD   32
+#endif
+
+/*!
+    \brief   the two ways a transfer can go, as passed to spi_StatsGet
+*/
+#define SPI_MODE_FIFO       0
+#define SPI_MODE_DMA        1
+
+/*!
+    \brief   transfer statistics for one mode, kept from spi_Open or the last
+             spi_StatsClear. Times are in processor cycles; ullCpuCycles
+             leaves out the time spent waiting for the uDMA to finish
+*/
+typedef struct
+{
+    unsigned long       ulTransfers;
+    unsigned long long  ullBytes;
+    unsigned long long  ullCycles;
+    unsigned long long  ullCpuCycles;
+}SpiStats_t;
+
+/*!
+    \brief   the function the statistics are printed with, for example
+             UARTprintf
+*/
+typedef void (*P_SPI_PRINTF)(const char *pcString, ...);
+
 
 /*!
     \brief open spi communication port to be used for communicating with a
@@ -139,6 +173,72 @@ int spi_Read(Fd_t fd, unsigned char *pBuff, int len);
 */
 int spi_Write(Fd_t fd, unsigned char *pBuff, int len);
 
+/*!
+    \brief sets the size from which transfers go by uDMA
+
+    \param[in]      ulBytes   -    the smallest transfer to move by uDMA, or
+                    0 to move every transfer through the FIFO loop
+
+    \return         none
+
+    \sa             spi_Read , spi_Write
+    \note           Buffers outside SRAM always go through the FIFO loop
+    \warning
+*/
+void spi_DmaThresholdSet(unsigned long ulBytes);
+
+/*!
+    \brief gets the transfer statistics for one mode
+
+    \param[in]      ulMode    -    SPI_MODE_FIFO or SPI_MODE_DMA
+
+    \param[out]     pStats    -    receives the statistics
+
+    \return         none
+
+    \sa             spi_StatsClear , spi_StatsReport
+    \note
+    \warning
+*/
+void spi_StatsGet(unsigned long ulMode, SpiStats_t *pStats);
+
+/*!
+    \brief clears the transfer statistics
+
+    \return         none
+
+    \sa             spi_StatsGet , spi_StatsReport
+    \note
+    \warning
+*/
+void spi_StatsClear(void);
+
+/*!
+    \brief prints the transfers, bytes, bytes per second, CPU cycles and
+           microseconds per KB and CPU share of each mode
+
+    \param[in]      pfnPrintf -    the function to print with, for example
+                    UARTprintf
+
+    \return         none
+
+    \sa             spi_StatsGet , spi_StatsClear
+    \note
+    \warning
+*/
+void spi_StatsReport(P_SPI_PRINTF pfnPrintf);
+
+#ifdef HEADLESS
+/*
+ * Host model only: the SSI2 status and data registers and the processor
+ * cycle count, supplied by the model.
+ */
+extern unsigned long SpiModelStatus(void);
+extern void SpiModelDataPut(unsigned long ulData);
+extern unsigned long SpiModelDataGet(void);
+extern unsigned long SpiModelCycles(void);
+#endif
+
 #ifdef  __cplusplus
 }
 #endif /* __cplusplus */
@@ -934,6 +934,24 @@ typedef P_EVENT_HANDLER                         SL_P_EVENT_HANDLER;
 #define sl_Spawn(pEntry,pValue,flags)               
 #endif
 
+/*!
+	\brief 	the time base and sleep of the non-os main loop
+
+	With these bound, a wait sleeps until the IRQ posts work to the main loop
+	or its timeout passes, and timeouts are in mSec rather than passes of the
+	loop. sl_NonOsTimeUs returns a free running microsecond count.
+	sl_NonOsSleep(us) is entered with interrupts masked by sl_NonOsIrqSave
+	and returns on any interrupt or after us microseconds; 0 means no limit.
+
+    \note       belongs to \ref porting_sec
+*/
+#ifndef SL_PLATFORM_MULTI_THREADED
+#define sl_NonOsTimeUs()                            CC3100_TimeUs()
+#define sl_NonOsSleep(ulUs)                         CC3100_Sleep(ulUs)
+#define sl_NonOsIrqSave()                           CC3100_IrqSave()
+#define sl_NonOsIrqRestore(ulState)                 CC3100_IrqRestore(ulState)
+#endif
+
 /*!
 
  Close the Doxygen group.
@@ -0,0 +1,212 @@
+/*
+ * board.c - Linux host port, network processor emulator wiring
+ *
+ * The IRQ line is the read side of the IRQ/nHIB socketpair, switched
+ * to O_ASYNC so every edge the emulator sends raises SIGIO in this
+ * process.  The SIGIO handler runs on top of whatever the main loop is
+ * doing, exactly as the GPIO interrupt does on the LaunchPad, so the
+ * non-OS driver sees the same concurrency it sees on the target.
+ *
+*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+/* not simplelink.h: the BSD names in socket.h would capture close() and write() */
+#include "datatypes.h"
+#include "user.h"
+#include "board.h"
+
+
+P_EVENT_HANDLER        pIrqEventHandler = 0;
+
+BOOLEAN IntIsMasked;
+
+static int g_LinesFd = -1;
+static BOOLEAN g_IrqEnabled;
+static volatile sig_atomic_t g_IrqPending;
+
+
+static void IrqDeliver(void)
+{
+    while(g_IrqEnabled && g_IrqPending)
+    {
+        g_IrqPending--;
+        if(pIrqEventHandler)
+        {
+            pIrqEventHandler(0);
+        }
+    }
+}
+
+static void IrqSignalHandler(int sig)
+{
+    int savedErrno = errno;
+    unsigned char line;
+
+    (void)sig;
+    while((g_LinesFd >= 0) && (read(g_LinesFd, &line, 1) == 1))
+    {
+        if(line == BOARD_LINE_IRQ)
+        {
+            g_IrqPending++;
+        }
+    }
+    IrqDeliver();
+    errno = savedErrno;
+}
+
+static void IrqBlock(sigset_t *pOld)
+{
+    sigset_t set;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGIO);
+    sigprocmask(SIG_BLOCK, &set, pOld);
+}
+
+void initClk(){
+}
+
+void stopWDT(){
+}
+
+int registerInterruptHandler(P_EVENT_HANDLER InterruptHdl , void* pValue)
+{
+    pIrqEventHandler = InterruptHdl;
+
+    return 0;
+}
+
+int CC3100_LinesAttach(int fd)
+{
+    struct sigaction sa;
+
+    sa.sa_handler = IrqSignalHandler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    if(sigaction(SIGIO, &sa, 0) < 0)
+    {
+        return -1;
+    }
+
+    g_IrqPending = 0;
+    g_IrqEnabled = FALSE;
+    g_LinesFd = fd;
+    if((fcntl(fd, F_SETOWN, getpid()) < 0) ||
+       (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK | O_ASYNC) < 0))
+    {
+        g_LinesFd = -1;
+        return -1;
+    }
+
+    return 0;
+}
+
+void CC3100_LinesDetach(void)
+{
+    sigset_t old;
+
+    IrqBlock(&old);
+    if(g_LinesFd >= 0)
+    {
+        close(g_LinesFd);
+    }
+    g_LinesFd = -1;
+    g_IrqEnabled = FALSE;
+    g_IrqPending = 0;
+    sigprocmask(SIG_SETMASK, &old, 0);
+}
+
+static void LineWrite(unsigned char line)
+{
+    if(g_LinesFd >= 0)
+    {
+        while((write(g_LinesFd, &line, 1) < 0) && (errno == EINTR));
+    }
+}
+
+void CC3100_disable()
+{
+    LineWrite(BOARD_LINE_NHIB_LOW);
+}
+
+void CC3100_enable()
+{
+    LineWrite(BOARD_LINE_NHIB_HIGH);
+}
+
+void CC3100_InterruptEnable()
+{
+    sigset_t old;
+
+    IrqBlock(&old);
+    g_IrqEnabled = TRUE;
+    IrqDeliver();
+    sigprocmask(SIG_SETMASK, &old, 0);
+}
+
+void CC3100_InterruptDisable()
+{
+    g_IrqEnabled = FALSE;
+}
+
+void MaskIntHdlr()
+{
+	IntIsMasked = TRUE;
+}
+
+void UnMaskIntHdlr()
+{
+	IntIsMasked = FALSE;
+}
+
+void Delay(unsigned long interval)
+{
+    usleep(interval*1000);
+}
+
+unsigned long CC3100_TimeUs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long)t.tv_sec*1000000 + t.tv_nsec/1000;
+}
+
+void CC3100_Sleep(unsigned long ulUs)
+{
+    sigset_t wake;
+    struct timespec t;
+
+    /* SIGIO is blocked by CC3100_IrqSave; pselect lets it in for the sleep */
+    sigprocmask(SIG_BLOCK, 0, &wake);
+    sigdelset(&wake, SIGIO);
+    t.tv_sec = ulUs/1000000;
+    t.tv_nsec = (ulUs%1000000)*1000;
+    pselect(0, 0, 0, 0, ulUs ? &t : 0, &wake);
+}
+
+unsigned long CC3100_IrqSave(void)
+{
+    sigset_t old;
+
+    IrqBlock(&old);
+    return sigismember(&old, SIGIO);
+}
+
+void CC3100_IrqRestore(unsigned long ulState)
+{
+    sigset_t set;
+
+    if(!ulState)
+    {
+        sigemptyset(&set);
+        sigaddset(&set, SIGIO);
+        sigprocmask(SIG_UNBLOCK, &set, 0);
+    }
+}
@@ -0,0 +1,235 @@
+/*
+ * board.h - Linux host port, network processor emulator wiring
+ *
+ * The "board" is a pair of socketpairs to the CC3100 emulator process
+ * started by spi_Open(): one carries the SPI byte stream, the other
+ * carries the nHIB line to the emulator and the host IRQ line back.
+ * A rising edge on the IRQ line arrives as SIGIO, whose handler plays
+ * the part of GPIOB_intHandler() on the LaunchPad.
+ *
+*/
+
+#ifndef _BOARD_H
+#define    _BOARD_H
+
+
+#define PIN_HIGH                              0xFF
+#define PIN_LOW                              (!PIN_HIGH)
+
+/* Bytes on the IRQ/nHIB socketpair */
+#define BOARD_LINE_IRQ                        'I'   /* emulator -> host */
+#define BOARD_LINE_NHIB_HIGH                  'E'   /* host -> emulator */
+#define BOARD_LINE_NHIB_LOW                   'H'   /* host -> emulator */
+
+typedef void (*P_EVENT_HANDLER)(void* pValue);
+
+/*!
+    \brief register an interrupt handler for the host IRQ
+
+    \param[in]      InterruptHdl    -    pointer to interrupt handler function
+
+    \param[in]      pValue          -    pointer to a memory strcuture that is 
+                    passed to the interrupt handler.
+
+    \return         upon successful registration, the function shall return 0.
+                    Otherwise, -1 shall be returned
+
+    \sa
+    \note           If there is already registered interrupt handler, the 
+                    function should overwrite the old handler with the new one
+
+    \warning
+*/
+int registerInterruptHandler(P_EVENT_HANDLER InterruptHdl , void* pValue);
+
+/*!
+    \brief          Connects the IRQ and nHIB lines to an emulator
+
+    \param[in]      fd  -   host end of the IRQ/nHIB socketpair
+
+    \return         upon success 0, otherwise -1
+
+    \note           Called by spi_Open(). Edges on the IRQ line are
+                    delivered as SIGIO.
+
+    \warning
+*/
+int CC3100_LinesAttach(int fd);
+
+/*!
+    \brief          Disconnects the IRQ and nHIB lines
+
+    \param[in]      none
+
+    \return         none
+
+    \note           Called by spi_Close()
+
+    \warning
+*/
+void CC3100_LinesDetach(void);
+
+/*!
+    \brief             Enables the CC3100
+    \param[in]         none
+    \return            none
+    \note
+    \warning
+*/
+void CC3100_enable(void);
+
+/*!
+    \brief             Disables the CC3100
+    \param[in]         none
+    \return            none
+    \note
+    \warning
+*/
+void CC3100_disable(void);
+
+/*!
+    \brief          Enables the interrupt from the CC3100
+
+    \param[in]      none
+
+    \return         none
+
+    \note           Edges that arrived while the interrupt was disabled
+                    are delivered now, as a latched GPIO interrupt would be
+
+    \warning
+*/
+void CC3100_InterruptEnable(void);
+
+/*!
+    \brief          Disables the interrupt from the CC3100
+
+    \param[in]      none
+
+    \return         none
+
+    \note
+
+    \warning
+*/
+void CC3100_InterruptDisable(void);
+
+/*!
+    \brief          Stops the Watch Dog timer
+
+    \param[in]      none
+
+    \return         none
+
+    \note
+
+    \warning
+*/
+void stopWDT(void);
+
+/*!
+    \brief          Initialize the system clock of MCU
+
+    \param[in]      none
+
+    \return         none
+
+    \note
+
+    \warning
+*/
+void initClk(void);
+
+/*!
+    \brief      Masks the Host IRQ
+
+	\param[in]      none
+
+    \return         none
+
+    \warning
+*/
+void MaskIntHdlr(void);
+
+/*!
+    \brief     Unmasks the Host IRQ
+	
+	\param[in]      none
+
+    \return         none
+
+    \warning
+*/
+void UnMaskIntHdlr(void);
+
+/*!
+    \brief     Produce delay in ms
+
+    \param[in]         interval - Time in ms
+
+    \return            none
+
+    \note
+
+    \warning
+*/
+void Delay(unsigned long interval);
+
+/*!
+    \brief     Reads the free running microsecond count used by the non-os
+               main loop
+
+    \param[in]         none
+
+    \return            microseconds since the time base started, wrapping
+                       at the width of unsigned long
+
+    \note              The time base is started by the first call
+
+    \warning
+*/
+unsigned long CC3100_TimeUs(void);
+
+/*!
+    \brief     Sleeps until an interrupt or for a number of microseconds
+
+    \param[in]         ulUs - the longest to sleep, or 0 to sleep until an
+                       interrupt
+
+    \return            none
+
+    \note              Called with interrupts masked by CC3100_IrqSave, so an
+                       interrupt that arrives first ends the sleep at once and
+                       is taken once they are unmasked
+
+    \warning
+*/
+void CC3100_Sleep(unsigned long ulUs);
+
+/*!
+    \brief     Masks interrupts
+
+    \param[in]         none
+
+    \return            the previous state, for CC3100_IrqRestore
+
+    \note
+
+    \warning
+*/
+unsigned long CC3100_IrqSave(void);
+
+/*!
+    \brief     Restores the interrupt mask saved by CC3100_IrqSave
+
+    \param[in]         ulState - what CC3100_IrqSave returned
+
+    \return            none
+
+    \note
+
+    \warning
+*/
+void CC3100_IrqRestore(unsigned long ulState);
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * spi.c - Linux host port, SPI channel to the network processor emulator
+ *
+ * spi_Open() starts the emulator with a shell, handing it one end of
+ * two socketpairs: fd 3 is the SPI byte stream and fd 4 carries the
+ * nHIB and IRQ lines (see board.c).  spi_Read() and spi_Write() move
+ * exactly the bytes the driver clocks over the real bus, so the
+ * emulator sees the same sync words, headers and padding the CC3100
+ * does.
+ *
+*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+/* not simplelink.h: the BSD names in socket.h would capture close() and write() */
+#include "user.h"
+#include "board.h"
+#include "spi.h"
+
+
+#define SPI_EMU_DEFAULT     "./NwpEmu"
+#define SPI_EMU_FD          3
+#define SPI_LINES_FD        4
+
+unsigned long g_ulSpiBytesWritten;
+unsigned long g_ulSpiBytesRead;
+
+static pid_t g_EmuPid = -1;
+
+
+int spi_Close(Fd_t fd)
+{
+    int status;
+
+    /* Disable WLAN Interrupt ... */
+    CC3100_InterruptDisable();
+    CC3100_LinesDetach();
+
+    close((int)fd);
+    if(g_EmuPid > 0)
+    {
+        while((waitpid(g_EmuPid, &status, 0) < 0) && (errno == EINTR));
+    }
+    g_EmuPid = -1;
+
+    return 0;
+}
+
+Fd_t spi_Open(char *ifName, unsigned long flags)
+{
+    int spi[2];
+    int lines[2];
+    char *pEmu = ifName;
+
+    (void)flags;
+
+    if(0 == pEmu)
+    {
+        pEmu = getenv("CC3100_EMU");
+    }
+    if(0 == pEmu)
+    {
+        pEmu = SPI_EMU_DEFAULT;
+    }
+
+    /* a dead emulator shows up as a short read or write, not a signal */
+    signal(SIGPIPE, SIG_IGN);
+
+    if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, spi) < 0)
+    {
+        return (Fd_t)-1;
+    }
+    if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, lines) < 0)
+    {
+        close(spi[0]);
+        close(spi[1]);
+        return (Fd_t)-1;
+    }
+
+    g_EmuPid = fork();
+    if(0 == g_EmuPid)
+    {
+        /* move both ends clear of 3 and 4 before placing them there;
+           dup2 leaves the copies open across exec */
+        int emu = fcntl(spi[1], F_DUPFD_CLOEXEC, 10);
+        int emuLines = fcntl(lines[1], F_DUPFD_CLOEXEC, 10);
+
+        dup2(emu, SPI_EMU_FD);
+        dup2(emuLines, SPI_LINES_FD);
+        execl("/bin/sh", "sh", "-c", pEmu, (char *)0);
+        _exit(127);
+    }
+    close(spi[1]);
+    close(lines[1]);
+    if(g_EmuPid < 0)
+    {
+        close(spi[0]);
+        close(lines[0]);
+        return (Fd_t)-1;
+    }
+
+    g_ulSpiBytesWritten = 0;
+    g_ulSpiBytesRead = 0;
+
+    /* configure host IRQ line */
+    if(CC3100_LinesAttach(lines[0]) < 0)
+    {
+        close(lines[0]);
+        spi_Close((Fd_t)spi[0]);
+        return (Fd_t)-1;
+    }
+
+    /* Enable WLAN interrupt */
+    CC3100_InterruptEnable();
+
+    return (Fd_t)spi[0];
+}
+
+
+int spi_Write(Fd_t fd, unsigned char *pBuff, int len)
+{
+    int done = 0;
+    int n;
+
+    while(done < len)
+    {
+        n = write((int)fd, pBuff + done, len - done);
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        done += n;
+    }
+    g_ulSpiBytesWritten += len;
+
+    return len;
+}
+
+
+int spi_Read(Fd_t fd, unsigned char *pBuff, int len)
+{
+    int done = 0;
+    int n;
+
+    while(done < len)
+    {
+        n = read((int)fd, pBuff + done, len - done);
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if(0 == n)
+        {
+            /* emulator gone */
+            return -1;
+        }
+        done += n;
+    }
+    g_ulSpiBytesRead += len;
+
+    return len;
+}
@@ -0,0 +1,122 @@
+/*
+ * spi.h - Linux host port, SPI channel to the network processor emulator
+ *
+*/
+
+#ifndef __SPI_H__
+#define __SPI_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+    \brief   type definition for the spi channel file descriptor
+    
+    \note    On each porting or platform the type could be whatever is needed 
+            - integer, pointer to structure etc.
+*/
+typedef unsigned int Fd_t;
+
+
+/*!
+    \brief open spi communication port to be used for communicating with a
+           SimpleLink device
+
+    Given an interface name and option flags, this function opens the spi
+    communication port and creates a file descriptor. This file descriptor can
+    be used afterwards to read and write data from and to this specific spi
+    channel.
+    On this port the channel is a socketpair to a network processor
+    emulator, which is started here and stopped by spi_Close.
+
+    \param[in]      ifName    -    shell command that starts the emulator,
+                    run with the SPI stream on fd 3 and the IRQ/nHIB lines on
+                    fd 4. When NULL the CC3100_EMU environment variable is
+                    used, and failing that "./NwpEmu".
+    \param[in]      flags     -    option flags
+
+    \return         upon successful completion, the function shall open the spi
+                    channel and return a non-negative integer representing the
+                    file descriptor. Otherwise, -1 shall be returned
+
+    \sa             spi_Close , spi_Read , spi_Write
+    \note
+    \warning
+*/
+
+Fd_t spi_Open(char *ifName, unsigned long flags);
+
+/*!
+    \brief closes an opened spi communication port
+
+    \param[in]      fd    -     file descriptor of an opened SPI channel
+
+    \return         upon successful completion, the function shall return 0.
+                    Otherwise, -1 shall be returned
+
+    \sa             spi_Open
+    \note
+    \warning
+*/
+int spi_Close(Fd_t fd);
+
+/*!
+    \brief attempts to read up to len bytes from SPI channel into a buffer 
+           starting at pBuff.
+
+    \param[in]      fd     -    file descriptor of an opened SPI channel
+
+    \param[in]      pBuff  -    points to first location to start writing the 
+                    data
+
+    \param[in]      len    -    number of bytes to read from the SPI channel
+
+    \return         upon successful completion, the function shall return 0.
+                    Otherwise, -1 shall be returned
+
+    \sa             spi_Open , spi_Write
+    \note
+    \warning
+*/
+int spi_Read(Fd_t fd, unsigned char *pBuff, int len);
+
+/*!
+    \brief attempts to write up to len bytes to the SPI channel
+
+    \param[in]      fd        -    file descriptor of an opened SPI channel
+
+    \param[in]      pBuff     -    points to first location to start getting the
+                    data from
+
+    \param[in]      len       -    number of bytes to write to the SPI channel
+
+    \return         upon successful completion, the function shall return 0.
+                    Otherwise, -1 shall be returned
+
+    \sa             spi_Open , spi_Read
+    \note           This function could be implemented as zero copy and return 
+                    only upon successful completion of writing the whole buffer,
+                    but in cases that memory allocation is not too tight, the
+                    function could copy the data to internal buffer, return 
+                    back and complete the write in parallel to other activities
+                    as long as the other SPI activities would be blocked until
+                    the entire buffer write would be completed
+    \warning
+*/
+int spi_Write(Fd_t fd, unsigned char *pBuff, int len);
+
+/*!
+    \brief bytes moved over the SPI channel since spi_Open
+
+    Counted in both directions, including sync words, headers and
+    alignment padding, so dividing application payload by the total gives
+    the protocol efficiency of a transfer.
+*/
+extern unsigned long g_ulSpiBytesWritten;
+extern unsigned long g_ulSpiBytesRead;
+
+#ifdef  __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __SPI_H__ */
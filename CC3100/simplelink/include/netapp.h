@@ -221,6 +221,13 @@ typedef struct
     unsigned long    max_time;       /* Announcing max time                                                        */
 }SlNetAppServiceAdvertiseTimingParameters_t;
 
+typedef struct
+{
+    unsigned long   Rsp[5];          /* The NWP's answer, written in by the driver when it arrives  */
+    unsigned char   ObjIdx;          /* Driver action object held until the answer is collected     */
+    unsigned char   family;          /* SL_AF_INET or SL_AF_INET6                                   */
+}SlNetAppDnsRequest_t;
+
 #define SL_NET_APP_MASK_IPP_TYPE_OF_SERVICE    			0x00000001
 #define SL_NET_APP_MASK_DEVICE_INFO_TYPE_OF_SERVICE		0x00000002
 #define SL_NET_APP_MASK_HTTP_TYPE_OF_SERVICE			0x00000004
@@ -399,6 +406,66 @@ int sl_NetAppStop(unsigned long AppBitMap);
 int sl_NetAppDnsGetHostByName(char * hostname, unsigned short usNameLen, unsigned long* out_ip_addr,unsigned char family );
 #endif
 
+/*!
+    \brief Start getting host IP by name, without waiting for the answer
+
+    Sends the same query as sl_NetAppDnsGetHostByName and returns as soon as
+    the device has accepted it. The answer is collected later with
+    sl_NetAppDnsGetHostByNameResult.
+
+    \param[in]  hostname        host name
+    \param[in]  usNameLen       name length
+    \param[in]  family          protocol family
+    \param[out] pReq            request to pass to sl_NetAppDnsGetHostByNameResult.
+                                It must stay in place until the result is collected.
+
+    \return                     Zero when the query is in flight, otherwise negative:
+                                - SL_EALREADY if another lookup is already in flight
+                                - SL_POOL_IS_EMPTY if there are no resources in the system
+                                - an error the device gave for the query
+
+    \sa                         sl_NetAppDnsGetHostByNameResult
+    \note   Only one lookup can be in flight at a time. Rather than wait for the
+            other one to finish, this call returns SL_EALREADY.
+    \warning
+    \par  Example:
+    \code
+    SlNetAppDnsRequest_t Req;
+    unsigned long DestinationIP;
+    int Status;
+
+    sl_NetAppDnsGetHostByNameAsync("www.google.com", strlen("www.google.com"), SL_AF_INET, &Req);
+    do
+    {
+        sl_Task();
+        ... other work ...
+        Status = sl_NetAppDnsGetHostByNameResult(&Req, &DestinationIP);
+    }while(SL_EAGAIN == Status);
+    \endcode
+*/
+#if _SL_INCLUDE_FUNC(sl_NetAppDnsGetHostByNameAsync)
+int sl_NetAppDnsGetHostByNameAsync(char * hostname, unsigned short usNameLen, unsigned char family, SlNetAppDnsRequest_t *pReq);
+#endif
+
+/*!
+    \brief Collect the answer to sl_NetAppDnsGetHostByNameAsync
+
+    \param[in]  pReq            request given to sl_NetAppDnsGetHostByNameAsync
+    \param[out] out_ip_addr     filled in with the host IP address on success
+
+    \return                     SL_EAGAIN while the answer has not arrived. Otherwise
+                                the lookup is finished: zero on success or one of the
+                                sl_NetAppDnsGetHostByName error codes.
+
+    \sa                         sl_NetAppDnsGetHostByNameAsync
+    \note   The answer is taken in by the driver's event handling, which runs from
+            sl_Task() in a non-OS build and during any other SimpleLink call.
+    \warning
+*/
+#if _SL_INCLUDE_FUNC(sl_NetAppDnsGetHostByNameResult)
+int sl_NetAppDnsGetHostByNameResult(SlNetAppDnsRequest_t *pReq, unsigned long* out_ip_addr);
+#endif
+
 
 /*!
         \brief Return service attributes like IP address, port and text according to service name
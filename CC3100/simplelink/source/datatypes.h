@@ -84,7 +84,7 @@ typedef unsigned short  UINT16;
 typedef unsigned char   BOOLEAN;
 #endif
 
-#ifdef _WIN32
+#if defined(_WIN32) || defined(__LP64__)
     typedef unsigned int    UINT32, *PUINT32;
     typedef signed   int    INT32, *PINT32;
 #else
@@ -906,6 +906,100 @@ int sl_NetAppDnsGetHostByName(char * hostname, unsigned short usNameLen, unsigne
     return Msg.Rsp.status;
 }
 #endif
+
+/******************************************************************************/
+/*  sl_NetAppDnsGetHostByNameAsync */
+/******************************************************************************/
+#if _SL_INCLUDE_FUNC(sl_NetAppDnsGetHostByNameAsync)
+int sl_NetAppDnsGetHostByNameAsync(char * hostname, unsigned short usNameLen, unsigned char family, SlNetAppDnsRequest_t *pReq)
+{
+    _SlGetHostByNameMsg_u           Msg;
+    _SlCmdExt_t                     ExtCtrl;
+	UINT8 pObjIdx = MAX_CONCURRENT_ACTIONS;
+	UINT8 Busy;
+
+    pReq->ObjIdx = MAX_CONCURRENT_ACTIONS;
+    pReq->family = family;
+
+	/* a second lookup would wait in _SlDrvWaitForPoolObj for the first */
+	OSI_RET_OK_CHECK(sl_LockObjLock(&g_pCB->ProtectionLockObj, SL_OS_WAIT_FOREVER));
+	Busy = (0 != (g_pCB->ActiveActionsBitmap & (1<<GETHOSYBYNAME_ID)));
+	OSI_RET_OK_CHECK(sl_LockObjUnlock(&g_pCB->ProtectionLockObj));
+	if (Busy)
+	{
+		return SL_EALREADY;
+	}
+
+    ExtCtrl.TxPayloadLen = usNameLen;
+    ExtCtrl.RxPayloadLen = 0;
+    ExtCtrl.pTxPayload = (UINT8 *)hostname;
+    ExtCtrl.pRxPayload = 0;
+
+    Msg.Cmd.Len = usNameLen;
+    Msg.Cmd.family = family;
+
+	pObjIdx = _SlDrvWaitForPoolObj(GETHOSYBYNAME_ID,SL_MAX_SOCKETS);
+	if (MAX_CONCURRENT_ACTIONS == pObjIdx)
+	{
+		return SL_POOL_IS_EMPTY;
+	}
+	OSI_RET_OK_CHECK(sl_LockObjLock(&g_pCB->ProtectionLockObj, SL_OS_WAIT_FOREVER));
+
+	/* the answer lands in the caller's request, which outlives this call */
+	g_pCB->ObjPool[pObjIdx].pRespArgs =  (UINT8 *)pReq->Rsp;
+	if (SL_AF_INET6 == family)  
+	{
+		g_pCB->ObjPool[pObjIdx].AdditionalData |= SL_NETAPP_FAMILY_MASK;
+	}
+	
+    OSI_RET_OK_CHECK(sl_LockObjUnlock(&g_pCB->ProtectionLockObj));
+
+    VERIFY_RET_OK(_SlDrvCmdOp((_SlCmdCtrl_t *)&_SlGetHostByNameCtrl, &Msg, &ExtCtrl));
+
+    if(SL_RET_CODE_OK != Msg.Rsp.status)
+    {
+        /* no answer will follow */
+        _SlDrvReleasePoolObj(pObjIdx);
+        return Msg.Rsp.status;
+    }
+    pReq->ObjIdx = pObjIdx;
+    return SL_RET_CODE_OK;
+}
+#endif
+
+/******************************************************************************/
+/*  sl_NetAppDnsGetHostByNameResult */
+/******************************************************************************/
+#if _SL_INCLUDE_FUNC(sl_NetAppDnsGetHostByNameResult)
+int sl_NetAppDnsGetHostByNameResult(SlNetAppDnsRequest_t *pReq, unsigned long* out_ip_addr)
+{
+    _GetHostByNameAsyncResponse_u   *pAsyncRsp = (_GetHostByNameAsyncResponse_u *)pReq->Rsp;
+    int                             Status;
+
+    if (MAX_CONCURRENT_ACTIONS <= pReq->ObjIdx)
+    {
+        return SL_RET_CODE_INVALID_INPUT;
+    }
+
+    /* _sl_HandleAsync_DnsGetHostByName signals the object once the answer is in */
+    if (SL_OS_RET_CODE_OK != sl_SyncObjWait(&g_pCB->ObjPool[pReq->ObjIdx].SyncObj, SL_OS_NO_WAIT))
+    {
+        return SL_EAGAIN;
+    }
+
+    Status = (INT16)pAsyncRsp->IpV4.status;
+    if(SL_OS_RET_CODE_OK == Status)
+    {
+        sl_Memcpy((char *)out_ip_addr,
+                  (char *)&pAsyncRsp->IpV4.ip0, 
+                  (SL_AF_INET == pReq->family) ? SL_IPV4_ADDRESS_SIZE : SL_IPV6_ADDRESS_SIZE);
+    }
+    _SlDrvReleasePoolObj(pReq->ObjIdx);
+    pReq->ObjIdx = MAX_CONCURRENT_ACTIONS;
+    return Status;
+}
+#endif
+
 /******************************************************************************/
 /*  _sl_HandleAsync_DnsGetHostByName */
 /******************************************************************************/
@@ -45,26 +45,125 @@
 
 #define NONOS_MAX_SPAWN_ENTRIES		5
 
+/* The ready queue is shared with the IRQ; without these bound in user.h */
+/* the platform must not post from an interrupt while the main loop runs */
+#ifndef sl_NonOsIrqSave
+#define sl_NonOsIrqSave()				0
+#define sl_NonOsIrqRestore(State)		((void)(State))
+#endif
+
+#if defined(sl_NonOsSleep) && !defined(sl_NonOsTimeUs)
+#error "sl_NonOsSleep needs sl_NonOsTimeUs"
+#endif
+
+#ifdef sl_NonOsTimeUs
+#define NONOS_TIME_NOW()				sl_NonOsTimeUs()
+#else
+#define NONOS_TIME_NOW()				0
+#endif
+
 typedef struct
 {
 	_SlSpawnEntryFunc_t 		pEntry;
 	void* 						pValue;
+	unsigned long				PostTime;
 }_SlNonOsSpawnEntry_t;
 
 typedef struct
 {
 	_SlNonOsSpawnEntry_t	SpawnEntries[NONOS_MAX_SPAWN_ENTRIES];
+	unsigned char			Head;
+	unsigned char			Count;
+	_SlNonOsStats_t			Stats;
 }_SlNonOsCB_t;
 
 _SlNonOsCB_t g__SlNonOsCB;
 
 
+/* Entries run only while the driver's global lock is free: the spawned */
+/* reader takes it with no timeout, so running it under a holder that is */
+/* waiting in this same loop could never return */
+static int _SlNonOsReady(void)
+{
+	return (0 != g__SlNonOsCB.Count) && ((NULL == g_pCB) ||
+		(__NON_OS_LOCK_OBJ_LOCK_VALUE != *(volatile _SlNonOsSemObj_t *)&g_pCB->GlobalLockObj));
+}
+
+
 _SlNonOsRetVal_t _SlNonOsSemSet(_SlNonOsSemObj_t* pSemObj , _SlNonOsSemObj_t Value)
 {
 	*pSemObj = Value;
 	return NONOS_RET_OK;
 }
 
+
+#ifdef sl_NonOsSleep
+/* Sleeps, unless an entry is ready to run or the object has reached */
+/* WaitValue; with interrupts masked so a post cannot slip in between */
+/* the check and the sleep. SleepUs of 0 sleeps until an interrupt */
+static void _SlNonOsIdle(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t WaitValue, unsigned long SleepUs)
+{
+	unsigned long State;
+	unsigned long Start;
+
+	State = sl_NonOsIrqSave();
+	if (!_SlNonOsReady() &&
+		((NULL == pSyncObj) || (WaitValue != *(volatile _SlNonOsSemObj_t *)pSyncObj)))
+	{
+		Start = NONOS_TIME_NOW();
+		sl_NonOsSleep(SleepUs);
+		g__SlNonOsCB.Stats.SleepTime += NONOS_TIME_NOW() - Start;
+		g__SlNonOsCB.Stats.Wakeups++;
+	}
+	sl_NonOsIrqRestore(State);
+}
+#endif
+
+
+#ifdef sl_NonOsTimeUs
+/* Timeouts past what the microsecond count can measure are clamped */
+static unsigned long _SlNonOsTimeoutUs(_SlNonOsTime_t Timeout)
+{
+	if (Timeout >= ((unsigned long)-1)/1000)
+	{
+		return ((unsigned long)-1)/1000*1000;
+	}
+	return Timeout*1000;
+}
+
+
+_SlNonOsRetVal_t _SlNonOsSemGet(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t WaitValue, _SlNonOsSemObj_t SetValue, _SlNonOsTime_t Timeout)
+{
+	unsigned long Start = sl_NonOsTimeUs();
+	unsigned long Limit = _SlNonOsTimeoutUs(Timeout);
+	unsigned long Elapsed;
+
+	while (1)
+	{
+		if (WaitValue == *(volatile _SlNonOsSemObj_t *)pSyncObj)
+		{
+			*pSyncObj = SetValue;
+			return NONOS_RET_OK;
+		}
+		Elapsed = sl_NonOsTimeUs() - Start;
+		if ((Timeout != NONOS_WAIT_FOREVER) && (Elapsed >= Limit))
+		{
+			/* a NONOS_NO_WAIT check is a poll, not a wait */
+			if (Timeout != NONOS_NO_WAIT)
+			{
+				g__SlNonOsCB.Stats.Timeouts++;
+			}
+			return NONOS_RET_ERR;
+		}
+		_SlNonOsMainLoopTask();
+#ifdef sl_NonOsSleep
+		_SlNonOsIdle(pSyncObj, WaitValue, (Timeout == NONOS_WAIT_FOREVER) ? 0 : Limit - Elapsed);
+#endif
+	}
+}
+
+#else
+
 _SlNonOsRetVal_t _SlNonOsSemGet(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t WaitValue, _SlNonOsSemObj_t SetValue, _SlNonOsTime_t Timeout)
 {
 	while (Timeout>0)
@@ -83,6 +182,7 @@ _SlNonOsRetVal_t _SlNonOsSemGet(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t Wai
 	
 	if (0 == Timeout)
 	{
+		g__SlNonOsCB.Stats.Timeouts++;
 		return NONOS_RET_ERR;
 	}
 	else
@@ -90,24 +190,29 @@ _SlNonOsRetVal_t _SlNonOsSemGet(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t Wai
 		return NONOS_RET_OK;
 	}
 }
+#endif
 
 
 _SlNonOsRetVal_t _SlNonOsSpawn(_SlSpawnEntryFunc_t pEntry , void* pValue , unsigned long flags)
 {
-	int i;
-	
-	for (i=0 ; i<NONOS_MAX_SPAWN_ENTRIES ; i++)
+	_SlNonOsSpawnEntry_t* pE;
+	unsigned long State;
+
+	State = sl_NonOsIrqSave();
+	if (g__SlNonOsCB.Count < NONOS_MAX_SPAWN_ENTRIES)
 	{
-		_SlNonOsSpawnEntry_t* pE = &g__SlNonOsCB.SpawnEntries[i];
-	
-		if (NULL == pE->pEntry)
-		{
-			pE->pValue = pValue;
-			pE->pEntry = pEntry;
-			break;
-		}
+		pE = &g__SlNonOsCB.SpawnEntries[(g__SlNonOsCB.Head + g__SlNonOsCB.Count) % NONOS_MAX_SPAWN_ENTRIES];
+		pE->pValue = pValue;
+		pE->pEntry = pEntry;
+		pE->PostTime = NONOS_TIME_NOW();
+		g__SlNonOsCB.Count++;
+		g__SlNonOsCB.Stats.Posts++;
 	}
-        
+	else
+	{
+		g__SlNonOsCB.Stats.Dropped++;
+	}
+	sl_NonOsIrqRestore(State);
         
         return NONOS_RET_OK;
 }
@@ -115,25 +220,55 @@ _SlNonOsRetVal_t _SlNonOsSpawn(_SlSpawnEntryFunc_t pEntry , void* pValue , unsig
 
 _SlNonOsRetVal_t _SlNonOsMainLoopTask(void)
 {
-	int i;
-	
-	for (i=0 ; i<NONOS_MAX_SPAWN_ENTRIES ; i++)
+	_SlNonOsSpawnEntry_t E;
+	unsigned long State;
+	unsigned long Latency;
+
+	while (_SlNonOsReady())
 	{
-		_SlNonOsSpawnEntry_t* pE = &g__SlNonOsCB.SpawnEntries[i];
-		_SlSpawnEntryFunc_t 		pF = pE->pEntry;
-		
-		if (NULL != pF)
+		/* Taken off the queue before it runs, as it may wait and so */
+		/* come back in here */
+		State = sl_NonOsIrqSave();
+		E = g__SlNonOsCB.SpawnEntries[g__SlNonOsCB.Head];
+		g__SlNonOsCB.Head = (g__SlNonOsCB.Head + 1) % NONOS_MAX_SPAWN_ENTRIES;
+		g__SlNonOsCB.Count--;
+		sl_NonOsIrqRestore(State);
+
+		if((NULL != g_pCB) && ((g_pCB)->RxIrqCnt != (g_pCB)->RxDoneCnt))
 		{
-                        if((g_pCB)->RxIrqCnt != (g_pCB)->RxDoneCnt)
-            {
-				pF(0);/*(pValue);*/
-		}
-			pE->pEntry = NULL;
-			pE->pValue = NULL;
+			Latency = NONOS_TIME_NOW() - E.PostTime;
+			g__SlNonOsCB.Stats.LatencyTotal += Latency;
+			if (Latency > g__SlNonOsCB.Stats.LatencyMax)
+			{
+				g__SlNonOsCB.Stats.LatencyMax = Latency;
+			}
+			g__SlNonOsCB.Stats.Runs++;
+			E.pEntry(0);/*(pValue);*/
 		}
 	}
         
         return NONOS_RET_OK;
 }
+
+
+_SlNonOsRetVal_t _SlNonOsMainLoopWait(_SlNonOsTime_t Timeout)
+{
+#ifdef sl_NonOsSleep
+	_SlNonOsIdle(NULL, 0, (Timeout == NONOS_WAIT_FOREVER) ? 0 : _SlNonOsTimeoutUs(Timeout));
+#endif
+	return _SlNonOsMainLoopTask();
+}
+
+
+void _SlNonOsStatsGet(_SlNonOsStats_t *pStats)
+{
+	*pStats = g__SlNonOsCB.Stats;
+}
+
+
+void _SlNonOsStatsClear(void)
+{
+	memset(&g__SlNonOsCB.Stats, 0, sizeof(g__SlNonOsCB.Stats));
+}
     
 #endif /*(SL_PLATFORM != SL_PLATFORM_NON_OS)*/
@@ -44,8 +44,12 @@ extern "C" {
 
 #ifndef SL_PLATFORM_MULTI_THREADED
 
-#define NONOS_WAIT_FOREVER   							0xFF
+#define NONOS_WAIT_FOREVER   							0xFFFFFFFF
+#ifdef sl_NonOsTimeUs
+#define NONOS_NO_WAIT        							0x00
+#else
 #define NONOS_NO_WAIT        							0x01
+#endif
 
 
 #define NONOS_RET_OK                            (0)
@@ -65,8 +69,11 @@ typedef char _SlNonOsRetVal_t;
 
 /*!
 	\brief type definition for a time value
+
+	In mSec when the platform binds sl_NonOsTimeUs and sl_NonOsSleep in 
+	user.h, otherwise in passes of the main loop
 */
-typedef unsigned char _SlNonOsTime_t;
+typedef unsigned long _SlNonOsTime_t;
 
 /*!
 	\brief 	type definition for a sync object container
@@ -254,11 +261,64 @@ _SlNonOsRetVal_t _SlNonOsSpawn(_SlSpawnEntryFunc_t pEntry , void* pValue , unsig
 	
 	\return 0 - No more activities
 			1 - Activity still in progress
-	\note
+	\note	runs the entries posted by _SlNonOsSpawn, oldest first
 	\warning
 */
 _SlNonOsRetVal_t _SlNonOsMainLoopTask(void);
 
+/*!
+	\brief 	This function can be called from the main loop in place of 
+			_SlNonOsMainLoopTask while the application waits for an event
+	
+	When nothing has been posted it sleeps until something is, or until 
+	another interrupt or the timeout, and then runs what was posted
+	
+	\param	Timeout		-	the longest to sleep in mSec, or NONOS_WAIT_FOREVER
+	
+	\return as _SlNonOsMainLoopTask
+	\note	without sl_NonOsSleep bound in user.h, the same as 
+			_SlNonOsMainLoopTask
+	\warning
+*/
+_SlNonOsRetVal_t _SlNonOsMainLoopWait(_SlNonOsTime_t Timeout);
+
+/*!
+	\brief 	statistics of the non-os main loop, kept from start up or the last
+			_SlNonOsStatsClear. Times are in uSec and stay 0 without 
+			sl_NonOsTimeUs bound in user.h
+*/
+typedef struct
+{
+	unsigned long		Posts;				/* entries posted by _SlNonOsSpawn */
+	unsigned long		Dropped;			/* posts lost to a full queue */
+	unsigned long		Runs;				/* entries run */
+	unsigned long		Wakeups;			/* returns from sl_NonOsSleep */
+	unsigned long		Timeouts;			/* waits that gave up */
+	unsigned long long	SleepTime;			/* time spent in sl_NonOsSleep */
+	unsigned long long	LatencyTotal;		/* post to run, summed over Runs */
+	unsigned long		LatencyMax;
+}_SlNonOsStats_t;
+
+/*!
+	\brief 	This function copies out the statistics of the non-os main loop
+	
+	\param	pStats		-	receives the statistics
+	
+	\return None
+	\note
+	\warning
+*/
+void _SlNonOsStatsGet(_SlNonOsStats_t *pStats);
+
+/*!
+	\brief 	This function clears the statistics of the non-os main loop
+	
+	\return None
+	\note
+	\warning
+*/
+void _SlNonOsStatsClear(void);
+
 extern _SlNonOsRetVal_t _SlNonOsSemGet(_SlNonOsSemObj_t* pSyncObj, _SlNonOsSemObj_t WaitValue, _SlNonOsSemObj_t SetValue, _SlNonOsTime_t Timeout);
 extern _SlNonOsRetVal_t _SlNonOsSemSet(_SlNonOsSemObj_t* pSemObj , _SlNonOsSemObj_t Value);
 extern _SlNonOsRetVal_t _SlNonOsSpawn(_SlSpawnEntryFunc_t pEntry , void* pValue , unsigned long flags);
@@ -174,6 +174,10 @@ extern "C" {
 
 #define _SL_INC_sl_NetAppDnsGetHostByName     __nap__clt
 
+#define _SL_INC_sl_NetAppDnsGetHostByNameAsync    __nap__clt
+
+#define _SL_INC_sl_NetAppDnsGetHostByNameResult   __nap__clt
+
 
 #define _SL_INC_sl_NetAppDnsGetHostByService			__nap__clt
 #define _SL_INC_sl_NetAppMDNSRegisterService		__nap__clt
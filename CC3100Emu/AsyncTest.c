@@ -0,0 +1,543 @@
+// AsyncTest.c
+// Runs on a PC, not on the LaunchPad
+// Drives utils/asyncsock.c, the non-blocking socket layer, over the
+// SimpleLink driver built with the Linux platform port, against
+// NwpEmu and HttpStandIn, and checks that
+//   sl_NetAppDnsGetHostByNameAsync() returns before the answer, a
+//     second lookup gets SL_EALREADY, and the result comes back right
+//   a nonblocking connect answers SL_EALREADY and then connects, and
+//     sl_Select() reports it writable
+//   one GET through the layer comes back whole, with the events in
+//     order, while the main loop keeps running
+//   several GETs to a slow server overlap instead of queueing, up to
+//     ASYNCSOCK_MAX at once, and one more is refused
+//   bulk recv and send through the layer move the right bytes
+//   a refused connect, an unknown name and closing a connection in
+//     the middle of its lookup end cleanly
+// and prints request latency and throughput against the blocking
+// calls, how many main loop passes ran while requests were out, and
+// the driver commands per request when polling and when selecting.
+//
+// build (from this folder, after NwpEmu and HttpStandIn):
+//   gcc -O2 -I.. -I../CC3100/platform/linux -I../CC3100/simplelink/include -I../CC3100/simplelink/source -I../CC3100/simplelink -o AsyncTest AsyncTest.c ../utils/asyncsock.c ../CC3100/platform/linux/board.c ../CC3100/platform/linux/spi.c ../CC3100/simplelink/source/device.c ../CC3100/simplelink/source/driver.c ../CC3100/simplelink/source/flowcont.c ../CC3100/simplelink/source/fs.c ../CC3100/simplelink/source/netapp.c ../CC3100/simplelink/source/netcfg.c ../CC3100/simplelink/source/nonos.c ../CC3100/simplelink/source/socket.c ../CC3100/simplelink/source/spawn.c ../CC3100/simplelink/source/wlan.c
+// usage: AsyncTest [-v]        (-v logs the emulator's traffic)
+
+// system headers first: socket.h renames the BSD calls to sl_ ones
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <stdint.h>
+#include "simplelink.h"
+#include "utils/asyncsock.h"
+
+#define PORT          18090            // HttpStandIn, what port 80 maps to
+#define CLOSED_PORT   18091            // nothing listens here
+#define DNS_MS        20               // modelled DNS round trip
+#define DELAY_MS      50               // /delay/ server think time
+#define SERVER        "api.openweathermap.org"
+#define REQUEST       "GET /data/2.5/weather?q=Austin%20Texas&units=metric HTTP/1.1\r\nUser-Agent: Keil\r\nHost:api.openweathermap.org\r\nAccept: */*\r\n\r\n"
+#define ROUNDS        50
+#define BULK          (1<<20)
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+static pid_t Server = -1;
+
+static void StopServer(void){
+  if(Server > 0){
+    kill(Server, SIGTERM);
+    waitpid(Server, 0, 0);
+    Server = -1;
+  }
+}
+
+// a protocol slip leaves the driver spinning; fail instead
+static void Timeout(int sig){
+  (void)sig;
+  printf("  FAIL: timed out\n");
+  if(Server > 0) kill(Server, SIGTERM);
+  _exit(1);
+}
+
+static double Seconds(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static double CpuSeconds(void){
+  struct rusage r;
+  getrusage(RUSAGE_SELF, &r);
+  return r.ru_utime.tv_sec + r.ru_stime.tv_sec + (r.ru_utime.tv_usec + r.ru_stime.tv_usec)*1e-6;
+}
+
+//---------------------events---------------------
+#define CONNECTED   1
+#define IP_ACQUIRED 2
+static volatile unsigned long Status;
+
+void SimpleLinkWlanEventHandler(SlWlanEvent_t *pWlanEvent){
+  if(pWlanEvent->Event == SL_WLAN_CONNECT_EVENT){
+    Status |= CONNECTED;
+  }else if(pWlanEvent->Event == SL_WLAN_DISCONNECT_EVENT){
+    Status &= ~(CONNECTED | IP_ACQUIRED);
+  }
+}
+
+void SimpleLinkNetAppEventHandler(SlNetAppEvent_t *pNetAppEvent){
+  if(pNetAppEvent->Event == SL_NETAPP_IPV4_ACQUIRED) Status |= IP_ACQUIRED;
+}
+
+void SimpleLinkHttpServerCallback(SlHttpServerEvent_t *pEvent, SlHttpServerResponse_t *pResponse){
+  (void)pEvent; (void)pResponse;
+}
+
+//---------------------one HTTP request as a state machine---------------------
+// the callback sends the request once connected, keeps a receive
+// armed until the whole response is in, then closes
+#define RESPONSE_MAX  2048
+typedef struct{
+  const char *request;
+  long requestLen;
+  char response[RESPONSE_MAX + 1];
+  long have;
+  long want;                           // header plus Content-Length, once known
+  char events[16];                     // in the order they came
+  int nEvents;
+  int status;                          // of an ERROR event
+  int done;
+  double started, finished;
+}Request_t;
+
+static void Event(int32_t sock, uint32_t event, int32_t status, void *param){
+  Request_t *r = param;
+  char *end;
+
+  if(r->nEvents < (int)sizeof(r->events) - 1){
+    r->events[r->nEvents++] =
+      (event == ASYNCSOCK_EVENT_RESOLVED)  ? 'D' :
+      (event == ASYNCSOCK_EVENT_CONNECTED) ? 'C' :
+      (event == ASYNCSOCK_EVENT_SENT)      ? 'S' :
+      (event == ASYNCSOCK_EVENT_RECV)      ? 'R' :
+      (event == ASYNCSOCK_EVENT_CLOSED)    ? 'X' : 'E';
+  }
+  switch(event){
+    case ASYNCSOCK_EVENT_CONNECTED:
+      AsyncSockSend(sock, r->request, r->requestLen);
+      AsyncSockRecv(sock, r->response, RESPONSE_MAX);
+      break;
+    case ASYNCSOCK_EVENT_RECV:
+      r->have += status;
+      r->response[r->have] = 0;
+      if(r->want < 0 && (end = strstr(r->response, "\r\n\r\n")) && strstr(r->response, "Content-Length: ")){
+        r->want = end + 4 - r->response + atol(strstr(r->response, "Content-Length: ") + 16);
+      }
+      if(r->want >= 0 && r->have >= r->want){
+        r->done = 1;
+        r->finished = Seconds();
+        AsyncSockClose(sock);
+      }else if(AsyncSockRecv(sock, r->response + r->have, RESPONSE_MAX - r->have) != 0){
+        r->done = -1;
+        AsyncSockClose(sock);
+      }
+      break;
+    case ASYNCSOCK_EVENT_CLOSED:
+    case ASYNCSOCK_EVENT_ERROR:
+      r->status = status;
+      r->done = -1;
+      r->finished = Seconds();
+      AsyncSockClose(sock);
+      break;
+  }
+}
+
+static int Get(Request_t *r, const char *host, unsigned long addr, unsigned short port, const char *request){
+  memset(r, 0, sizeof(*r));
+  r->request = request;
+  r->requestLen = strlen(request);
+  r->want = -1;
+  r->started = Seconds();
+  return host ? AsyncSockConnect(host, port, Event, r) : AsyncSockConnectAddr(addr, port, Event, r);
+}
+
+//---------------------tests---------------------
+static unsigned long ServerIp;
+
+static void Start(void){
+  int role, ret;
+  role = sl_Start(0, 0, 0);
+  CHECK(role == ROLE_STA, "sl_Start gave %d", role);
+  ret = sl_WlanConnect("AsyncTest", 9, 0, 0, 0);
+  CHECK(ret == 0, "sl_WlanConnect gave %d", ret);
+  while((Status & (CONNECTED | IP_ACQUIRED)) != (CONNECTED | IP_ACQUIRED)){
+    _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER);
+  }
+  AsyncSockInit();
+}
+
+static void Dns(void){
+  SlNetAppDnsRequest_t req, other;
+  unsigned long ip = 0;
+  long passes = 0;
+  double t;
+  int ret;
+
+  t = Seconds();
+  ret = sl_NetAppDnsGetHostByNameAsync(SERVER, strlen(SERVER), SL_AF_INET, &req);
+  CHECK(ret == 0, "async lookup gave %d", ret);
+  CHECK(Seconds() - t < DNS_MS*1e-3/2, "async lookup took %.1f ms", (Seconds() - t)*1e3);
+  ret = sl_NetAppDnsGetHostByNameAsync("other.invalid", 13, SL_AF_INET, &other);
+  CHECK(ret == SL_EALREADY, "second lookup gave %d", ret);
+  do{
+    sl_Task();
+    passes++;
+    ret = sl_NetAppDnsGetHostByNameResult(&req, &ip);
+  }while(ret == SL_EAGAIN);
+  t = Seconds() - t;
+  CHECK(ret == 0 && ip == SL_IPV4_VAL(127,0,0,1), "lookup gave %d, %08lx", ret, ip);
+  CHECK(passes > 1, "the answer was there at once");
+  ServerIp = ip;
+  printf("  DNS, async: answer after %.1f ms, %ld main loop passes meanwhile\n", t*1e3, passes);
+
+  ret = sl_NetAppDnsGetHostByNameAsync("nowhere.invalid", 15, SL_AF_INET, &req);
+  CHECK(ret == 0, "async lookup gave %d", ret);
+  while((ret = sl_NetAppDnsGetHostByNameResult(&req, &ip)) == SL_EAGAIN) sl_Task();
+  CHECK(ret == SL_NET_APP_DNS_QUERY_NO_RESPONSE, "bad name gave %d", ret);
+  ret = sl_NetAppDnsGetHostByName(SERVER, strlen(SERVER), &ip, SL_AF_INET);
+  CHECK(ret == 0, "blocking lookup after async ones gave %d", ret);
+}
+
+// the NWP side of the layer, by hand
+static void NonBlockingConnect(void){
+  SlSockNonblocking_t nb = {1};
+  SlSockAddrIn_t addr;
+  SlFdSet_t wr;
+  SlTimeval_t tv = {1, 0};
+  int sd, ret, tries = 0;
+
+  // the server may still be starting
+  sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+  CHECK(sd >= 0, "socket gave %d", sd);
+  sl_SetSockOpt(sd, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &nb, sizeof(nb));
+  addr.sin_family = SL_AF_INET;
+  addr.sin_port = sl_Htons(80);
+  addr.sin_addr.s_addr = sl_Htonl(ServerIp);
+  ret = sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr));
+  CHECK(ret == SL_EALREADY || ret == 0, "first connect gave %d", ret);
+  if(ret == SL_EALREADY){
+    SL_FD_ZERO(&wr);
+    SL_FD_SET(sd, &wr);
+    ret = sl_Select(sd + 1, 0, &wr, 0, &tv);
+    CHECK(ret == 1 && SL_FD_ISSET(sd, &wr), "select gave %d", ret);
+    while((ret = sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr))) == SL_EALREADY && tries++ < 100) usleep(1000);
+    CHECK(ret == 0 || ret == SL_ECONNREFUSED, "connect gave %d", ret);
+  }
+  sl_Close(sd);
+}
+
+// one request through the layer, counting the main loop passes that
+// went by while it was out
+static void One(void){
+  Request_t r;
+  long passes = 0;
+  int sock, tries;
+
+  // the server may still be starting
+  for(tries = 0; tries < 100; tries++){
+    sock = Get(&r, 0, ServerIp, 80, REQUEST);
+    while(!r.done) AsyncSockRun(0);
+    if(r.done > 0) break;
+    usleep(10000);
+  }
+  CHECK(r.done > 0, "server never answered (%d)", r.status);
+
+  sock = Get(&r, SERVER, 0, 80, REQUEST);
+  CHECK(sock >= 0, "connect gave %d", sock);
+  while(!r.done){
+    AsyncSockRun(0);
+    passes++;                          // display, inputs, ... would go here
+  }
+  r.events[r.nEvents] = 0;
+  CHECK(r.done > 0 && strstr(r.response, "\"name\":\"Austin\"") && r.response[r.have - 1] == '}',
+        "response %ld bytes, done %d", r.have, r.done);
+  CHECK(strncmp(r.events, "DCS", 3) == 0 && strchr(r.events, 'R'), "events %s", r.events);
+  CHECK(AsyncSockState(sock) == ASYNCSOCK_STATE_FREE, "state %lu", (unsigned long)AsyncSockState(sock));
+  printf("  GET by name, async:   %.3f ms, %ld main loop passes, events %s\n",
+         (r.finished - r.started)*1e3, passes, r.events);
+}
+
+// the same GET with a new connection each time, as getWeather does
+// it: blocking calls against the layer polling and selecting
+static void Latency(void){
+  static const char *how[3] = {"blocking", "async, polling", "async, select"};
+  tAsyncSockStats st;
+  SlSockAddrIn_t addr;
+  char buf[RESPONSE_MAX];
+  Request_t r;
+  double t, sum, max;
+  int i, k, sd, n;
+
+  for(k = 0; k < 3; k++){
+    sum = max = 0;
+    AsyncSockStatsClear();
+    for(i = 0; i < ROUNDS; i++){
+      t = Seconds();
+      if(k == 0){
+        sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+        addr.sin_family = SL_AF_INET;
+        addr.sin_port = sl_Htons(80);
+        addr.sin_addr.s_addr = sl_Htonl(ServerIp);
+        sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr));
+        sl_Send(sd, REQUEST, sizeof(REQUEST) - 1, 0);
+        n = 0;
+        while(n < 100 || !strchr(buf, '}')){
+          int got = sl_Recv(sd, buf + n, sizeof(buf) - 1 - n, 0);
+          if(got <= 0) break;
+          n += got;
+          buf[n] = 0;
+        }
+        CHECK(strstr(buf, "\"name\":\"Austin\""), "blocking GET gave %d bytes", n);
+        sl_Close(sd);
+      }else{
+        Get(&r, 0, ServerIp, 80, REQUEST);
+        while(!r.done) AsyncSockRun(k == 1 ? 0 : 100);
+        CHECK(r.done > 0 && strstr(r.response, "\"name\":\"Austin\""), "GET gave %d", r.done);
+      }
+      t = Seconds() - t;
+      sum += t;
+      if(t > max) max = t;
+    }
+    AsyncSockStatsGet(&st);
+    if(k == 0){
+      printf("  GET, %-15s avg %.3f max %.3f ms\n", how[k], sum/ROUNDS*1e3, max*1e3);
+    }else{
+      printf("  GET, %-15s avg %.3f max %.3f ms, %.1f commands (%.1f not ready, %.1f select) per GET\n",
+             how[k], sum/ROUNDS*1e3, max*1e3, (double)st.ui32Commands/ROUNDS,
+             (double)st.ui32Polls/ROUNDS, (double)st.ui32Selects/ROUNDS);
+    }
+  }
+}
+
+// requests to a server that takes DELAY_MS to answer: in turn with
+// the blocking calls, then all at once through the layer
+static void Overlap(void){
+  static Request_t r[ASYNCSOCK_MAX];
+  Request_t extra;
+  char req[160], buf[RESPONSE_MAX];
+  SlSockAddrIn_t addr;
+  double t, serial, overlapped, cpu;
+  long passes = 0;
+  int i, sd, n, busy, most = 0;
+
+  sprintf(req, "GET /delay/%d HTTP/1.1\r\nHost: %s\r\n\r\n", DELAY_MS, SERVER);
+  t = Seconds();
+  for(i = 0; i < ASYNCSOCK_MAX; i++){
+    sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+    addr.sin_family = SL_AF_INET;
+    addr.sin_port = sl_Htons(80);
+    addr.sin_addr.s_addr = sl_Htonl(ServerIp);
+    sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr));
+    sl_Send(sd, req, strlen(req), 0);
+    n = 0;
+    buf[0] = 0;
+    while(!strchr(buf, '}')){
+      int got = sl_Recv(sd, buf + n, sizeof(buf) - 1 - n, 0);
+      if(got <= 0) break;
+      n += got;
+      buf[n] = 0;
+    }
+    sl_Close(sd);
+  }
+  serial = Seconds() - t;
+
+  t = Seconds();
+  cpu = CpuSeconds();
+  for(i = 0; i < ASYNCSOCK_MAX; i++){
+    n = Get(&r[i], SERVER, 0, 80, req);
+    CHECK(n >= 0, "connection %d gave %d", i, n);
+  }
+  n = Get(&extra, SERVER, 0, 80, req);
+  CHECK(n == SL_ENSOCK, "connection past ASYNCSOCK_MAX gave %d", n);
+  do{
+    busy = AsyncSockRun(ASYNCSOCK_SELECT_MIN_MS);
+    if(busy > most) most = busy;
+    passes++;
+  }while(busy);
+  overlapped = Seconds() - t;
+  cpu = CpuSeconds() - cpu;
+  for(i = 0; i < ASYNCSOCK_MAX; i++){
+    CHECK(r[i].done > 0 && strstr(r[i].response, "\"name\":\"Austin\""), "request %d done %d", i, r[i].done);
+  }
+  CHECK(most == ASYNCSOCK_MAX, "at most %d in flight", most);
+  CHECK(overlapped < serial/2, "%d overlapped requests took %.1f ms", ASYNCSOCK_MAX, overlapped*1e3);
+  printf("  %d GETs, %d ms server: blocking %.1f ms, async %.1f ms (%ld passes, %.1f ms cpu)\n",
+         ASYNCSOCK_MAX, DELAY_MS, serial*1e3, overlapped*1e3, passes, cpu*1e3);
+}
+
+// bulk transfers through the layer, kept flowing from the callback
+typedef struct{
+  char *buf;                           // request to send once connected
+  long size, got;                      // body bytes expected and checked
+  int header;                          // the response header is past
+  int bad, done;
+}Bulk_t;
+
+static void BulkEvent(int32_t sock, uint32_t event, int32_t status, void *param){
+  static char chunk[4*1460];
+  Bulk_t *b = param;
+  char *body;
+  int i, n;
+
+  if(event == ASYNCSOCK_EVENT_RECV && b->size == 0){
+    b->got = status;                   // the reply to a POST
+    b->done = 1;
+  }else if(event == ASYNCSOCK_EVENT_RECV){
+    // the header comes first; after it, check the a-z pattern
+    n = status;
+    body = chunk;
+    if(!b->header){
+      body = memmem(chunk, n, "\r\n\r\n", 4);
+      if(body == 0){
+        b->bad = b->done = 1;
+        return;
+      }
+      body += 4;
+      n -= body - chunk;
+      b->header = 1;
+    }
+    for(i = 0; i < n; i++){
+      if(body[i] != 'a' + (b->got + i)%26) b->bad = 1;
+    }
+    b->got += n;
+    if(b->got >= b->size){
+      b->done = 1;
+    }else{
+      AsyncSockRecv(sock, chunk, sizeof(chunk));
+    }
+  }else if(event == ASYNCSOCK_EVENT_SENT && b->size == 0){
+    b->done = 1;
+  }else if(event == ASYNCSOCK_EVENT_CONNECTED){
+    AsyncSockSend(sock, b->buf, strlen(b->buf));
+    AsyncSockRecv(sock, chunk, sizeof(chunk));
+  }else if(event == ASYNCSOCK_EVENT_ERROR || event == ASYNCSOCK_EVENT_CLOSED){
+    b->bad = b->done = 1;
+  }
+}
+
+static void Bulk(void){
+  static char data[BULK];
+  char req[128], reply[256];
+  tAsyncSockStats st;
+  Bulk_t b;
+  double t;
+  long i;
+  int sock;
+
+  // receive: /bytes, the callback re-arming each chunk
+  sprintf(req, "GET /bytes/%d HTTP/1.1\r\nHost: %s\r\n\r\n", BULK, SERVER);
+  memset(&b, 0, sizeof(b));
+  b.buf = req;
+  b.size = BULK;
+  AsyncSockStatsClear();
+  t = Seconds();
+  sock = AsyncSockConnectAddr(ServerIp, 80, BulkEvent, &b);
+  while(!b.done) AsyncSockRun(0);
+  t = Seconds() - t;
+  AsyncSockStatsGet(&st);
+  CHECK(!b.bad && b.got == BULK, "recv got %ld%s", b.got, b.bad ? ", bad" : "");
+  CHECK(st.ui64BytesReceived > BULK, "stats counted %llu bytes", (unsigned long long)st.ui64BytesReceived);
+  printf("  recv %d bytes, async:  %.2f MB/s\n", BULK, BULK/t/1e6);
+
+  // send: a POST on the same connection, its body handed over
+  // ASYNCSOCK_SEND_BURST bytes a run, then the server's count
+  for(i = 0; i < BULK; i++) data[i] = 'a' + i%26;
+  memset(&b, 0, sizeof(b));
+  sprintf(req, "POST /sink HTTP/1.1\r\nHost: %s\r\nContent-Length: %d\r\n\r\n", SERVER, BULK);
+  t = Seconds();
+  CHECK(AsyncSockSend(sock, req, strlen(req)) == 0, "send refused");
+  while(!b.done) AsyncSockRun(0);
+  b.done = 0;
+  CHECK(AsyncSockSend(sock, data, BULK) == 0, "send refused");
+  CHECK(AsyncSockSend(sock, data, BULK) == SL_EALREADY, "second send accepted");
+  while(!b.done) AsyncSockRun(0);
+  b.done = 0;
+  memset(reply, 0, sizeof(reply));
+  AsyncSockRecv(sock, reply, sizeof(reply) - 1);
+  while(!b.done) AsyncSockRun(0);
+  t = Seconds() - t;
+  CHECK(strstr(reply, "\r\n\r\n") && atol(strstr(reply, "\r\n\r\n") + 4) == BULK, "server got %s", reply);
+  printf("  send %d bytes, async:  %.2f MB/s\n", BULK, BULK/t/1e6);
+  AsyncSockClose(sock);
+  CHECK(AsyncSockState(sock) == ASYNCSOCK_STATE_FREE, "state %lu after close", (unsigned long)AsyncSockState(sock));
+}
+
+static void Failures(void){
+  Request_t r;
+  int sock;
+
+  Get(&r, 0, ServerIp, CLOSED_PORT, REQUEST);
+  while(!r.done) AsyncSockRun(0);
+  CHECK(r.done < 0 && r.status == SL_ECONNREFUSED, "closed port gave %d", r.status);
+
+  Get(&r, "nowhere.invalid", 0, 80, REQUEST);
+  while(!r.done) AsyncSockRun(0);
+  CHECK(r.done < 0 && r.status == SL_NET_APP_DNS_QUERY_NO_RESPONSE, "bad name gave %d", r.status);
+
+  // closed while its lookup is in flight: the answer is still
+  // collected, and the next lookup goes ahead
+  sock = Get(&r, SERVER, 0, 80, REQUEST);
+  AsyncSockRun(0);
+  CHECK(AsyncSockState(sock) == ASYNCSOCK_STATE_RESOLVING, "state %lu", (unsigned long)AsyncSockState(sock));
+  AsyncSockClose(sock);
+  Get(&r, SERVER, 0, 80, REQUEST);
+  while(!r.done) AsyncSockRun(ASYNCSOCK_SELECT_MIN_MS);
+  CHECK(r.done > 0, "request after an abandoned lookup gave %d", r.status);
+  CHECK(r.nEvents == 0 || r.events[0] == 'D', "events %s", r.events);
+}
+
+static void Stop(void){
+  int ret = sl_Stop(0xFF);
+  CHECK(ret == 0, "sl_Stop gave %d", ret);
+}
+
+int main(int argc, char **argv){
+  char port[16], emu[256];
+  int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+
+  setvbuf(stdout, 0, _IOLBF, 0);
+  signal(SIGALRM, Timeout);
+  alarm(60);
+  sprintf(port, "%d", PORT);
+  Server = fork();
+  if(Server == 0){
+    execl("./HttpStandIn", "HttpStandIn", "-p", port, (char *)0);
+    perror("./HttpStandIn");
+    _exit(127);
+  }
+  atexit(StopServer);
+  sprintf(emu, "./NwpEmu%s -r -n %d -d %s=127.0.0.1 -p 80=%d -p %d=%d",
+          verbose ? " -v" : "", DNS_MS, SERVER, PORT, CLOSED_PORT, CLOSED_PORT);
+  setenv("CC3100_EMU", emu, 1);
+
+  printf("asyncsock over the SimpleLink driver against NwpEmu\n");
+  Start();
+  Dns();
+  NonBlockingConnect();
+  One();
+  Latency();
+  Overlap();
+  Bulk();
+  Failures();
+  Stop();
+
+  printf("%s (%lu errors)\n", Errors ? "FAILED" : "passed", Errors);
+  return Errors ? 1 : 0;
+}
@@ -0,0 +1,371 @@
+// EmuTest.c
+// Runs on a PC, not on the LaunchPad
+// Drives the unmodified SimpleLink host driver, built with the Linux
+// platform port, against NwpEmu and HttpStandIn, and checks that
+//   sl_Start() reports station mode and sl_DevGet() the version
+//   WLAN connect raises the connected and IP acquired events
+//   DNS answers the stand-in's address, and unknown names fail
+//   connect to a closed port gives SL_ECONNREFUSED
+//   the getWeather request comes back whole, both one connection
+//     per request (as getWeather does it) and kept alive
+//   bulk recv and send move the right bytes
+//   recv on an idle nonblocking socket gives SL_EAGAIN, and recv
+//     after the server closes gives 0
+//   sl_Stop() returns 0
+// and prints request latency, throughput, the bytes clocked over
+// the bus with the time they would take on the 4 MHz SPI, and how the
+// non-OS main loop spent the run: wake-ups, time asleep, IRQ to
+// handler latency, and processor time against wall time.
+//
+// build (from this folder, after NwpEmu and HttpStandIn):
+//   gcc -O2 -I../CC3100/platform/linux -I../CC3100/simplelink/include -I../CC3100/simplelink/source -I../CC3100/simplelink -o EmuTest EmuTest.c ../CC3100/platform/linux/board.c ../CC3100/platform/linux/spi.c ../CC3100/simplelink/source/device.c ../CC3100/simplelink/source/driver.c ../CC3100/simplelink/source/flowcont.c ../CC3100/simplelink/source/fs.c ../CC3100/simplelink/source/netapp.c ../CC3100/simplelink/source/netcfg.c ../CC3100/simplelink/source/nonos.c ../CC3100/simplelink/source/socket.c ../CC3100/simplelink/source/spawn.c ../CC3100/simplelink/source/wlan.c
+// usage: EmuTest [-v]          (-v logs the emulator's traffic)
+
+// system headers first: socket.h renames the BSD calls to sl_ ones
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "simplelink.h"
+
+#define PORT          18080            // HttpStandIn, what port 80 maps to
+#define CLOSED_PORT   18081            // nothing listens here
+#define SPI_CLOCK     4000000          // SSI2 rate in platform/ek-tm4c123gxl/spi.c
+#define SERVER        "api.openweathermap.org"
+#define REQUEST       "GET /data/2.5/weather?q=Austin%20Texas&units=metric HTTP/1.1\r\nUser-Agent: Keil\r\nHost:api.openweathermap.org\r\nAccept: */*\r\n\r\n"
+#define ROUNDS        50
+#define BULK          (1<<20)
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+static pid_t Server = -1;
+
+static void StopServer(void){
+  if(Server > 0){
+    kill(Server, SIGTERM);
+    waitpid(Server, 0, 0);
+    Server = -1;
+  }
+}
+
+// a protocol slip leaves the driver spinning; fail instead
+static void Timeout(int sig){
+  (void)sig;
+  printf("  FAIL: timed out\n");
+  if(Server > 0) kill(Server, SIGTERM);
+  _exit(1);
+}
+
+static double Seconds(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+//---------------------events---------------------
+#define CONNECTED   1
+#define IP_ACQUIRED 2
+static volatile unsigned long Status;
+static unsigned long Ip;
+
+void SimpleLinkWlanEventHandler(SlWlanEvent_t *pWlanEvent){
+  if(pWlanEvent->Event == SL_WLAN_CONNECT_EVENT){
+    Status |= CONNECTED;
+  }else if(pWlanEvent->Event == SL_WLAN_DISCONNECT_EVENT){
+    Status &= ~(CONNECTED | IP_ACQUIRED);
+  }
+}
+
+void SimpleLinkNetAppEventHandler(SlNetAppEvent_t *pNetAppEvent){
+  if(pNetAppEvent->Event == SL_NETAPP_IPV4_ACQUIRED){
+    Ip = pNetAppEvent->EventData.ipAcquiredV4.ip;
+    Status |= IP_ACQUIRED;
+  }
+}
+
+void SimpleLinkHttpServerCallback(SlHttpServerEvent_t *pEvent, SlHttpServerResponse_t *pResponse){
+  (void)pEvent; (void)pResponse;
+}
+
+//---------------------HTTP over SimpleLink---------------------
+static int Open(unsigned long ip, unsigned short port){
+  SlSockAddrIn_t addr;
+  int sd, ret;
+  sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+  if(sd < 0) return sd;
+  addr.sin_family = SL_AF_INET;
+  addr.sin_port = sl_Htons(port);
+  addr.sin_addr.s_addr = sl_Htonl(ip);
+  ret = sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr));
+  if(ret < 0){
+    sl_Close(sd);
+    return ret;
+  }
+  return sd;
+}
+
+// sl_Send() counts what is left of a call in 16 bits, so hand it
+// less than 64K at a time
+#define SEND_MAX      16384
+static int SendAll(int sd, const char *buf, long len){
+  int n;
+  while(len > 0){
+    n = sl_Send(sd, buf, (len > SEND_MAX) ? SEND_MAX : len, 0);
+    if(n <= 0) return -1;
+    buf += n;
+    len -= n;
+  }
+  return 0;
+}
+
+// reads one response; its body goes to body[] (up to size) and is
+// checked against the /bytes pattern when pattern is set; returns
+// the body length, or -1
+static long Response(int sd, char *body, long size, int pattern){
+  char buf[1460 + 1];
+  char head[4*1460];
+  long have = 0, len = -1, got = 0, i;
+  char *end;
+  int n;
+
+  for(;;){                             // header
+    n = sl_Recv(sd, buf, sizeof(buf) - 1, 0);
+    if(n <= 0) return -1;
+    if(have + n > (long)sizeof(head) - 1) return -1;
+    memcpy(head + have, buf, n);
+    have += n;
+    head[have] = 0;
+    end = strstr(head, "\r\n\r\n");
+    if(end) break;
+  }
+  end += 4;
+  if(strstr(head, "Content-Length: ")) len = atol(strstr(head, "Content-Length: ") + 16);
+  if(len < 0) return -1;
+  n = head + have - end;               // body bytes that came with the header
+  memcpy(buf, end, n);
+  for(;;){
+    for(i = 0; i < n; i++){
+      if(pattern && buf[i] != 'a' + (got + i)%26) return -1;
+      if(got + i < size) body[got + i] = buf[i];
+    }
+    got += n;
+    if(got >= len) break;
+    n = sl_Recv(sd, buf, (len - got < 1460) ? len - got : 1460, 0);
+    if(n <= 0) return -1;
+  }
+  if(got < size) body[got] = 0;
+  return got;
+}
+
+//---------------------tests---------------------
+static unsigned long ServerIp;
+
+static void Start(void){
+  SlVersionFull ver;
+  unsigned char opt = SL_DEVICE_GENERAL_VERSION, len = sizeof(ver);
+  int role, ret;
+  double t0;
+
+  role = sl_Start(0, 0, 0);
+  CHECK(role == ROLE_STA, "sl_Start gave %d", role);
+  ret = sl_DevGet(SL_DEVICE_GENERAL_CONFIGURATION, &opt, &len, (unsigned char *)&ver);
+  CHECK(ret == 0 && len == sizeof(ver) && ver.NwpVersion[0] == 2, "sl_DevGet gave %d, len %d", ret, len);
+
+  t0 = Seconds();
+  ret = sl_WlanConnect("EmuTest", 7, 0, 0, 0);
+  CHECK(ret == 0, "sl_WlanConnect gave %d", ret);
+  while((Status & (CONNECTED | IP_ACQUIRED)) != (CONNECTED | IP_ACQUIRED)){
+    _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER);
+  }
+  printf("  connected, IP %lu.%lu.%lu.%lu after %.1f ms\n",
+         SL_IPV4_BYTE(Ip,3), SL_IPV4_BYTE(Ip,2), SL_IPV4_BYTE(Ip,1), SL_IPV4_BYTE(Ip,0),
+         (Seconds() - t0)*1e3);
+}
+
+static void Names(void){
+  unsigned long ip = 0;
+  int ret;
+  ret = sl_NetAppDnsGetHostByName(SERVER, strlen(SERVER), &ip, SL_AF_INET);
+  CHECK(ret == 0 && ip == SL_IPV4_VAL(127,0,0,1), "DNS gave %d, %08lx", ret, ip);
+  ServerIp = ip;
+  ret = sl_NetAppDnsGetHostByName("nowhere.invalid", 15, &ip, SL_AF_INET);
+  CHECK(ret == SL_NET_APP_DNS_QUERY_NO_RESPONSE, "bad name gave %d", ret);
+}
+
+static void Refused(void){
+  int sd = Open(ServerIp, CLOSED_PORT);
+  CHECK(sd == SL_ECONNREFUSED, "closed port gave %d", sd);
+}
+
+static void Weather(void){
+  char body[1024];
+  double t, min = 1e9, max = 0, sum = 0;
+  long len;
+  int sd, i, tries;
+
+  // the server may still be starting
+  for(tries = 0; (sd = Open(ServerIp, 80)) == SL_ECONNREFUSED && tries < 100; tries++) usleep(10000);
+  CHECK(sd >= 0, "connect gave %d", sd);
+  if(sd >= 0) sl_Close(sd);
+
+  // as getWeather does it: a new connection for every request
+  for(i = 0; i < ROUNDS; i++){
+    t = Seconds();
+    sd = Open(ServerIp, 80);
+    CHECK(sd >= 0, "connect gave %d", sd);
+    if(sd < 0) return;
+    CHECK(SendAll(sd, REQUEST, sizeof(REQUEST) - 1) == 0, "send failed");
+    len = Response(sd, body, sizeof(body), 0);
+    CHECK(len > 0 && strstr(body, "\"name\":\"Austin\"") && body[len - 1] == '}', "body %ld", len);
+    sl_Close(sd);
+    t = Seconds() - t;
+    sum += t;
+    if(t < min) min = t;
+    if(t > max) max = t;
+  }
+  printf("  GET, connection each: min %.3f avg %.3f max %.3f ms\n", min*1e3, sum/ROUNDS*1e3, max*1e3);
+
+  // the same requests on one kept-alive connection
+  min = 1e9; max = sum = 0;
+  sd = Open(ServerIp, 80);
+  CHECK(sd >= 0, "connect gave %d", sd);
+  if(sd < 0) return;
+  for(i = 0; i < ROUNDS; i++){
+    t = Seconds();
+    CHECK(SendAll(sd, REQUEST, sizeof(REQUEST) - 1) == 0, "send failed");
+    len = Response(sd, body, sizeof(body), 0);
+    CHECK(len > 0 && strstr(body, "\"name\":\"Austin\""), "body %ld", len);
+    t = Seconds() - t;
+    sum += t;
+    if(t < min) min = t;
+    if(t > max) max = t;
+  }
+  sl_Close(sd);
+  printf("  GET, kept alive:      min %.3f avg %.3f max %.3f ms\n", min*1e3, sum/ROUNDS*1e3, max*1e3);
+}
+
+static void Bulk(void){
+  static char data[BULK];
+  char req[128], reply[32];
+  double t;
+  long len, i;
+  int sd, n;
+
+  sd = Open(ServerIp, 80);
+  CHECK(sd >= 0, "connect gave %d", sd);
+  if(sd < 0) return;
+
+  n = sprintf(req, "GET /bytes/%d HTTP/1.1\r\nHost: %s\r\n\r\n", BULK, SERVER);
+  t = Seconds();
+  SendAll(sd, req, n);
+  len = Response(sd, data, 0, 1);
+  t = Seconds() - t;
+  CHECK(len == BULK, "recv got %ld", len);
+  printf("  recv %d bytes: %.2f MB/s\n", BULK, BULK/t/1e6);
+
+  for(i = 0; i < BULK; i++) data[i] = 'a' + i%26;
+  n = sprintf(req, "POST /sink HTTP/1.1\r\nHost: %s\r\nContent-Length: %d\r\n\r\n", SERVER, BULK);
+  t = Seconds();
+  SendAll(sd, req, n);
+  CHECK(SendAll(sd, data, BULK) == 0, "send failed");
+  len = Response(sd, reply, sizeof(reply), 0);
+  t = Seconds() - t;
+  CHECK(len > 0 && atol(reply) == BULK, "server got %s", reply);
+  printf("  send %d bytes: %.2f MB/s\n", BULK, BULK/t/1e6);
+  sl_Close(sd);
+}
+
+static void Edges(void){
+  SlSockNonblocking_t nb = {1};
+  char buf[64], body[1024];
+  long len;
+  int sd, n;
+
+  sd = Open(ServerIp, 80);
+  CHECK(sd >= 0, "connect gave %d", sd);
+  if(sd < 0) return;
+  sl_SetSockOpt(sd, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &nb, sizeof(nb));
+  n = sl_Recv(sd, buf, sizeof(buf), 0);
+  CHECK(n == SL_EAGAIN, "idle nonblocking recv gave %d", n);
+  nb.NonblockingEnabled = 0;
+  sl_SetSockOpt(sd, SL_SOL_SOCKET, SL_SO_NONBLOCKING, &nb, sizeof(nb));
+
+  n = sprintf(body, "GET /data/2.5/weather HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", SERVER);
+  SendAll(sd, body, n);
+  len = Response(sd, body, sizeof(body), 0);
+  CHECK(len > 0, "body %ld", len);
+  n = sl_Recv(sd, buf, sizeof(buf), 0);
+  CHECK(n == 0, "recv after close gave %d", n);
+  sl_Close(sd);
+}
+
+static void Stop(void){
+  int ret = sl_Stop(0xFF);
+  CHECK(ret == 0, "sl_Stop gave %d", ret);
+}
+
+static double CpuSeconds(void){
+  struct rusage r;
+  getrusage(RUSAGE_SELF, &r);
+  return r.ru_utime.tv_sec + r.ru_stime.tv_sec + (r.ru_utime.tv_usec + r.ru_stime.tv_usec)*1e-6;
+}
+
+static void MainLoop(double wall, double cpu){
+  _SlNonOsStats_t s;
+  _SlNonOsStatsGet(&s);
+  CHECK(s.Dropped == 0 && s.Runs <= s.Posts, "%lu posts, %lu runs, %lu dropped", s.Posts, s.Runs, s.Dropped);
+  CHECK(s.Wakeups > 0, "never slept");
+  printf("  main loop: %lu posts, %lu run, %lu wake-ups, %.1f ms asleep of %.1f ms\n",
+         s.Posts, s.Runs, s.Wakeups, s.SleepTime*1e-3, wall*1e3);
+  printf("  IRQ to handler: %.1f us mean, %lu us max; cpu %.1f ms\n",
+         s.Runs ? (double)s.LatencyTotal/s.Runs : 0.0, s.LatencyMax, cpu*1e3);
+}
+
+int main(int argc, char **argv){
+  char port[16], emu[256];
+  unsigned long written, read;
+  double wall, cpu;
+  int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+
+  setvbuf(stdout, 0, _IOLBF, 0);
+  signal(SIGALRM, Timeout);
+  alarm(60);
+  sprintf(port, "%d", PORT);
+  Server = fork();
+  if(Server == 0){
+    execl("./HttpStandIn", "HttpStandIn", "-p", port, (char *)0);
+    perror("./HttpStandIn");
+    _exit(127);
+  }
+  atexit(StopServer);
+  sprintf(emu, "./NwpEmu%s -r -d %s=127.0.0.1 -p 80=%d -p %d=%d",
+          verbose ? " -v" : "", SERVER, PORT, CLOSED_PORT, CLOSED_PORT);
+  setenv("CC3100_EMU", emu, 1);
+
+  printf("SimpleLink driver against NwpEmu\n");
+  wall = Seconds();
+  cpu = CpuSeconds();
+  Start();
+  Names();
+  Refused();
+  Weather();
+  Bulk();
+  Edges();
+  written = g_ulSpiBytesWritten;
+  read = g_ulSpiBytesRead;
+  Stop();
+  wall = Seconds() - wall;
+  cpu = CpuSeconds() - cpu;
+  MainLoop(wall, cpu);
+  printf("  bus: %lu bytes written, %lu read, %.1f ms at %d MHz\n",
+         written, read, (written + read)*8.0/SPI_CLOCK*1e3, SPI_CLOCK/1000000);
+
+  printf("%s (%lu errors)\n", Errors ? "FAILED" : "passed", Errors);
+  return Errors ? 1 : 0;
+}
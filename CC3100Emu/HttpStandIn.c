@@ -0,0 +1,286 @@
+// HttpStandIn.c
+// Runs on a PC, not on the LaunchPad
+// A small HTTP/1.1 server on localhost that stands in for
+// api.openweathermap.org behind NwpEmu, so the SimpleLink driver and
+// the getWeather client can be run and timed without a network:
+//   GET /data/2.5/weather...  a canned weather report in JSON
+//   GET /bytes/N              N bytes of a-z, for throughput
+//   POST /sink                reads the body and reports its length
+//   GET /delay/N              the weather report, N ms late, as from
+//                             a distant server
+// Connections are kept alive unless the request asks to close or is
+// HTTP/1.0, and with -k are closed after that long idle, without a
+// word, the way real servers drop them.
+//
+// build (from this folder):
+//   gcc -O2 -o HttpStandIn HttpStandIn.c
+// usage: HttpStandIn [-p port] [-k idle_ms]      (default 8080, never)
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define CLIENTS   32
+#define REQ_MAX   4096
+
+static const char Weather[] =
+  "{\"coord\":{\"lon\":-97.74,\"lat\":30.27},"
+  "\"weather\":[{\"id\":800,\"main\":\"Clear\",\"description\":\"Sky is Clear\",\"icon\":\"01d\"}],"
+  "\"base\":\"cmc stations\","
+  "\"main\":{\"temp\":31.5,\"pressure\":1012,\"humidity\":48,\"temp_min\":30,\"temp_max\":33},"
+  "\"wind\":{\"speed\":4.1,\"deg\":170},\"clouds\":{\"all\":1},\"dt\":1430939400,"
+  "\"sys\":{\"type\":1,\"id\":2558,\"message\":0.0084,\"country\":\"US\",\"sunrise\":1430912284,\"sunset\":1430960693},"
+  "\"id\":4671654,\"name\":\"Austin\",\"cod\":200}";
+
+typedef struct{
+  int fd;                              // -1 when free
+  char req[REQ_MAX + 1];
+  int have;
+  long bodyLeft;                       // of a POST being read
+  long bodyTotal;
+  int closeAfter;
+  long long due;                       // of a delayed reply, 0 if none
+  long long idle;                      // when it was last heard from
+}Client_t;
+static Client_t Clients[CLIENTS];
+static long IdleMs;                    // 0 keeps idle connections
+
+static long long Now(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000LL + ts.tv_nsec/1000000;
+}
+
+static void WriteAll(int fd, const char *buf, long len){
+  long n;
+  while(len > 0){
+    n = send(fd, buf, len, MSG_NOSIGNAL);
+    if(n < 0 && errno == EINTR) continue;
+    if(n < 0 && errno == EAGAIN){
+      struct pollfd p = {fd, POLLOUT, 0};
+      poll(&p, 1, 1000);
+      continue;
+    }
+    if(n <= 0) return;
+    buf += n;
+    len -= n;
+  }
+}
+
+// header and body in one write, as a real server's buffered output
+// would go; split, they meet Nagle and the client's delayed ACK
+static void Reply(Client_t *c, int status, const char *type, const char *body, long len){
+  char hdr[256 + 1024];
+  int n = snprintf(hdr, 256,
+    "HTTP/1.1 %d %s\r\nServer: HttpStandIn\r\nContent-Type: %s\r\n"
+    "Content-Length: %ld\r\nConnection: %s\r\n\r\n",
+    status, status == 200 ? "OK" : "Not Found", type, len,
+    c->closeAfter ? "close" : "keep-alive");
+  if(len <= 1024){
+    memcpy(hdr + n, body, len);
+    WriteAll(c->fd, hdr, n + len);
+  }else{
+    WriteAll(c->fd, hdr, n);
+    WriteAll(c->fd, body, len);
+  }
+}
+
+static void Bytes(Client_t *c, long len){
+  static char chunk[26*150];           // whole alphabets, so writes join up
+  char hdr[160];
+  long n;
+  int i;
+  if(chunk[0] == 0){
+    for(i = 0; i < (int)sizeof(chunk); i++) chunk[i] = 'a' + i%26;
+  }
+  n = snprintf(hdr, sizeof(hdr),
+    "HTTP/1.1 200 OK\r\nServer: HttpStandIn\r\nContent-Type: application/octet-stream\r\n"
+    "Content-Length: %ld\r\nConnection: %s\r\n\r\n", len, c->closeAfter ? "close" : "keep-alive");
+  WriteAll(c->fd, hdr, n);
+  while(len > 0){
+    n = (len > (long)sizeof(chunk)) ? (long)sizeof(chunk) : len;
+    WriteAll(c->fd, chunk, n);
+    len -= n;
+  }
+}
+
+static void Drop(Client_t *c){
+  close(c->fd);
+  c->fd = -1;
+}
+
+// one complete request header is in c->req
+static void Serve(Client_t *c){
+  char method[8], path[1024], version[16];
+  char *p;
+  long len = 0;
+
+  if(sscanf(c->req, "%7s %1023s %15s", method, path, version) != 3){
+    Drop(c);
+    return;
+  }
+  c->closeAfter = (strcmp(version, "HTTP/1.0") == 0) || strcasestr(c->req, "\r\nConnection: close");
+  if(strcmp(method, "POST") == 0){
+    p = strcasestr(c->req, "\r\nContent-Length:");
+    if(p) len = atol(p + 17);
+    c->bodyLeft = c->bodyTotal = len;
+    if(len > 0) return;                // reply once the body is in
+  }
+  if(strcmp(method, "GET") == 0 && strncmp(path, "/data/2.5/weather", 17) == 0){
+    Reply(c, 200, "application/json; charset=utf-8", Weather, sizeof(Weather) - 1);
+  }else if(strcmp(method, "GET") == 0 && strncmp(path, "/delay/", 7) == 0){
+    c->due = Now() + atol(path + 7);   // answered from the poll loop
+    return;
+  }else if(strcmp(method, "GET") == 0 && strncmp(path, "/bytes/", 7) == 0){
+    Bytes(c, atol(path + 7));
+  }else if(strcmp(method, "POST") == 0 && strcmp(path, "/sink") == 0){
+    char body[32];
+    int n = snprintf(body, sizeof(body), "%ld\n", c->bodyTotal);
+    Reply(c, 200, "text/plain", body, n);
+  }else{
+    Reply(c, 404, "text/plain", "not found\n", 10);
+  }
+  if(c->closeAfter) Drop(c);
+}
+
+// serves the requests in c->req, stopping at a delayed one so that
+// the replies keep their order
+static void Parse(Client_t *c){
+  char *end;
+  int used;
+
+  while(c->fd >= 0 && c->have > 0 && c->due == 0){
+    if(c->bodyLeft > 0){               // POST body, discarded
+      used = (c->have < c->bodyLeft) ? c->have : (int)c->bodyLeft;
+      c->bodyLeft -= used;
+      memmove(c->req, c->req + used, c->have - used);
+      c->have -= used;
+      if(c->bodyLeft == 0){
+        char body[32];
+        int m = snprintf(body, sizeof(body), "%ld\n", c->bodyTotal);
+        Reply(c, 200, "text/plain", body, m);
+        if(c->closeAfter) Drop(c);
+      }
+      continue;
+    }
+    c->req[c->have] = 0;
+    end = strstr(c->req, "\r\n\r\n");
+    if(end == 0){
+      if(c->have == REQ_MAX) Drop(c);  // header too long
+      return;
+    }
+    used = end + 4 - c->req;
+    end[2] = 0;                        // keep the last header's CRLF
+    Serve(c);
+    if(c->fd < 0) return;
+    memmove(c->req, c->req + used, c->have - used);
+    c->have -= used;
+  }
+}
+
+static void Readable(Client_t *c){
+  int n = recv(c->fd, c->req + c->have, REQ_MAX - c->have, 0);
+  if(n <= 0){
+    Drop(c);
+    return;
+  }
+  c->have += n;
+  c->idle = Now();
+  Parse(c);
+}
+
+static void Delayed(Client_t *c){
+  c->due = 0;
+  c->idle = Now();
+  Reply(c, 200, "application/json; charset=utf-8", Weather, sizeof(Weather) - 1);
+  if(c->closeAfter){
+    Drop(c);
+    return;
+  }
+  Parse(c);
+}
+
+int main(int argc, char **argv){
+  struct sockaddr_in sin;
+  struct pollfd p[1 + CLIENTS];
+  int map[1 + CLIENTS];
+  int port = 8080, listener, one = 1, fd, n, i, c, timeout;
+  long long now, due;
+
+  while((c = getopt(argc, argv, "p:k:")) != -1){
+    if(c == 'p') port = atoi(optarg);
+    else if(c == 'k') IdleMs = atol(optarg);
+    else{
+      fprintf(stderr, "usage: HttpStandIn [-p port] [-k idle_ms]\n");
+      return 2;
+    }
+  }
+  signal(SIGPIPE, SIG_IGN);
+  listener = socket(AF_INET, SOCK_STREAM, 0);
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons(port);
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if(bind(listener, (struct sockaddr *)&sin, sizeof(sin)) < 0 || listen(listener, 16) < 0){
+    perror("HttpStandIn");
+    return 1;
+  }
+  for(i = 0; i < CLIENTS; i++) Clients[i].fd = -1;
+
+  for(;;){
+    p[0].fd = listener;
+    p[0].events = POLLIN;
+    n = 1;
+    due = 0;
+    for(i = 0; i < CLIENTS; i++){
+      if(Clients[i].fd < 0) continue;
+      if(Clients[i].due){              // read no further until it is sent
+        if(due == 0 || Clients[i].due < due) due = Clients[i].due;
+        continue;
+      }
+      if(IdleMs && (due == 0 || Clients[i].idle + IdleMs < due)) due = Clients[i].idle + IdleMs;
+      p[n].fd = Clients[i].fd;
+      p[n].events = POLLIN;
+      map[n++] = i;
+    }
+    now = Now();
+    timeout = (due == 0) ? -1 : (due <= now) ? 0 : (int)(due - now);
+    if(poll(p, n, timeout) < 0){
+      if(errno == EINTR) continue;
+      perror("HttpStandIn");
+      return 1;
+    }
+    if(p[0].revents & POLLIN){
+      fd = accept(listener, 0, 0);
+      for(i = 0; i < CLIENTS && Clients[i].fd >= 0; i++);
+      if(fd >= 0 && i < CLIENTS){
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        memset(&Clients[i], 0, sizeof(Clients[i]));
+        Clients[i].fd = fd;
+        Clients[i].idle = Now();
+      }else if(fd >= 0){
+        close(fd);
+      }
+    }
+    for(i = 1; i < n; i++){
+      if(p[i].revents && Clients[map[i]].fd == p[i].fd) Readable(&Clients[map[i]]);
+    }
+    now = Now();
+    for(i = 0; i < CLIENTS; i++){
+      if(Clients[i].fd >= 0 && Clients[i].due && Clients[i].due <= now) Delayed(&Clients[i]);
+      if(Clients[i].fd >= 0 && IdleMs && !Clients[i].due && Clients[i].idle + IdleMs <= now) Drop(&Clients[i]);
+    }
+  }
+}
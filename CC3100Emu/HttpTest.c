@@ -0,0 +1,349 @@
+// HttpTest.c
+// Runs on a PC, not on the LaunchPad
+// Drives utils/httpclient.c, the keep-alive HTTP client, over the
+// SimpleLink driver built with the Linux platform port, against
+// NwpEmu and HttpStandIn with a modelled DNS and TCP handshake time,
+// and checks that
+//   repeated requests to one server look it up and connect once
+//   a batch of requests goes out in one flight and every response
+//     comes back whole and in order
+//   a connection the server dropped while idle is opened again, and
+//     the request answered, without another lookup
+//   the cached address is looked up again once it is older than
+//     HTTPCLIENT_DNS_TTL_MS, and the oldest server makes way for a
+//     new one past HTTPCLIENT_MAX_HOSTS
+//   a server closing after a response, mid-batch too, costs a new
+//     connection and nothing else
+//   a response too big for the buffer is cut short, and the next
+//     request on the connection still works
+//   an unknown name and a refused connect give their errors
+// and prints request latency, the time spent on lookups and
+// handshakes, and round trips per request, for the getWeather way
+// (a lookup and a connection for each request), for kept-alive
+// requests and for pipelined ones.
+//
+// build (from this folder, after NwpEmu and HttpStandIn):
+//   gcc -O2 -DHTTPCLIENT_DNS_TTL_MS=1000 -I.. -I../CC3100/platform/linux -I../CC3100/simplelink/include -I../CC3100/simplelink/source -I../CC3100/simplelink -o HttpTest HttpTest.c ../utils/httpclient.c ../utils/ustdlib.c ../CC3100/platform/linux/board.c ../CC3100/platform/linux/spi.c ../CC3100/simplelink/source/device.c ../CC3100/simplelink/source/driver.c ../CC3100/simplelink/source/flowcont.c ../CC3100/simplelink/source/fs.c ../CC3100/simplelink/source/netapp.c ../CC3100/simplelink/source/netcfg.c ../CC3100/simplelink/source/nonos.c ../CC3100/simplelink/source/socket.c ../CC3100/simplelink/source/spawn.c ../CC3100/simplelink/source/wlan.c
+// usage: HttpTest [-v]         (-v logs the emulator's traffic)
+
+// system headers first: socket.h renames the BSD calls to sl_ ones
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <stdint.h>
+#include "simplelink.h"
+#include "utils/httpclient.h"
+
+#define PORT          18100            // HttpStandIn, what port 80 maps to
+#define CLOSED_PORT   18101            // nothing listens here
+#define DNS_MS        20               // modelled DNS round trip
+#define CONNECT_MS    10               // modelled TCP handshake
+#define IDLE_MS       300              // server drops idle connections
+#define TTL_MS        1000             // HTTPCLIENT_DNS_TTL_MS in the build
+#define SERVER        "api.openweathermap.org"
+#define OTHER         "embsysmooc.appspot.com"
+#define THIRD         "third.example"
+#define REQUEST       "GET /data/2.5/weather?q=Austin%20Texas&units=metric HTTP/1.1\r\nUser-Agent: Keil\r\nHost:api.openweathermap.org\r\nAccept: */*\r\n\r\n"
+#define CLOSING       "GET /data/2.5/weather HTTP/1.1\r\nHost:api.openweathermap.org\r\nConnection: close\r\n\r\n"
+#define ROUNDS        20
+#define BATCH         8
+#define RESPONSE_MAX  1024             // MAX_RECV_BUFF_SIZE in getWeather
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+#if HTTPCLIENT_DNS_TTL_MS != TTL_MS
+#error "build with -DHTTPCLIENT_DNS_TTL_MS=1000"
+#endif
+
+static pid_t Server = -1;
+
+static void StopServer(void){
+  if(Server > 0){
+    kill(Server, SIGTERM);
+    waitpid(Server, 0, 0);
+    Server = -1;
+  }
+}
+
+// a protocol slip leaves the driver spinning; fail instead
+static void Timeout(int sig){
+  (void)sig;
+  printf("  FAIL: timed out\n");
+  if(Server > 0) kill(Server, SIGTERM);
+  _exit(1);
+}
+
+static double Seconds(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+//---------------------events---------------------
+#define CONNECTED   1
+#define IP_ACQUIRED 2
+static volatile unsigned long Status;
+
+void SimpleLinkWlanEventHandler(SlWlanEvent_t *pWlanEvent){
+  if(pWlanEvent->Event == SL_WLAN_CONNECT_EVENT){
+    Status |= CONNECTED;
+  }else if(pWlanEvent->Event == SL_WLAN_DISCONNECT_EVENT){
+    Status &= ~(CONNECTED | IP_ACQUIRED);
+  }
+}
+
+void SimpleLinkNetAppEventHandler(SlNetAppEvent_t *pNetAppEvent){
+  if(pNetAppEvent->Event == SL_NETAPP_IPV4_ACQUIRED) Status |= IP_ACQUIRED;
+}
+
+void SimpleLinkHttpServerCallback(SlHttpServerEvent_t *pEvent, SlHttpServerResponse_t *pResponse){
+  (void)pEvent; (void)pResponse;
+}
+
+//---------------------tests---------------------
+static tHttpClientStats St;
+
+// a whole weather report: the header, then the JSON to its last brace
+static int Whole(const char *r){
+  const char *body = strstr(r, "\r\n\r\n");
+  return strncmp(r, "HTTP/1.1 200", 12) == 0 && body && strstr(body, "\"name\":\"Austin\"") &&
+         r[strlen(r) - 1] == '}';
+}
+
+static void Start(void){
+  int role, ret;
+  role = sl_Start(0, 0, 0);
+  CHECK(role == ROLE_STA, "sl_Start gave %d", role);
+  ret = sl_WlanConnect("HttpTest", 8, 0, 0, 0);
+  CHECK(ret == 0, "sl_WlanConnect gave %d", ret);
+  while((Status & (CONNECTED | IP_ACQUIRED)) != (CONNECTED | IP_ACQUIRED)){
+    _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER);
+  }
+  HttpClientInit();
+}
+
+// as getWeather does it: a lookup, a connection, one recv, a close
+static void OneShot(void){
+  static char buf[RESPONSE_MAX];
+  SlSockAddrIn_t addr;
+  unsigned long ip;
+  double t, setup, sum = 0, setupSum = 0;
+  int i, sd, n, tries;
+
+  // the server may still be starting
+  for(tries = 0; tries < 100 && HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf)) < 0; tries++){
+    usleep(10000);
+  }
+  CHECK(Whole(buf), "server never answered");
+  HttpClientClose();
+
+  for(i = 0; i < ROUNDS; i++){
+    t = Seconds();
+    sl_NetAppDnsGetHostByName(SERVER, strlen(SERVER), &ip, SL_AF_INET);
+    sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+    addr.sin_family = SL_AF_INET;
+    addr.sin_port = sl_Htons(80);
+    addr.sin_addr.s_addr = sl_Htonl(ip);
+    sl_Connect(sd, (SlSockAddr_t *)&addr, sizeof(addr));
+    setup = Seconds() - t;
+    sl_Send(sd, REQUEST, sizeof(REQUEST) - 1, 0);
+    memset(buf, 0, sizeof(buf));
+    n = sl_Recv(sd, buf, sizeof(buf) - 1, 0);
+    sl_Close(sd);
+    t = Seconds() - t;
+    CHECK(n > 0 && Whole(buf), "one-shot GET gave %d", n);
+    sum += t;
+    setupSum += setup;
+  }
+  printf("  GET, lookup and connect each: %7.3f ms, %6.3f ms of it setup, 3 round trips\n",
+         sum/ROUNDS*1e3, setupSum/ROUNDS*1e3);
+}
+
+// the same requests through the client, which keeps the connection
+static void KeptAlive(void){
+  static char buf[RESPONSE_MAX];
+  double t, sum = 0;
+  int i, ret;
+
+  HttpClientInit();
+  for(i = 0; i < ROUNDS; i++){
+    t = Seconds();
+    ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+    sum += Seconds() - t;
+    CHECK(ret == 0 && Whole(buf), "kept-alive GET %d gave %d", i, ret);
+  }
+  HttpClientStatsGet(&St);
+  CHECK(St.ui32Lookups == 1 && St.ui32Connects == 1 && St.ui32Reuses == ROUNDS - 1,
+        "%lu lookups, %lu connects, %lu reuses", (unsigned long)St.ui32Lookups,
+        (unsigned long)St.ui32Connects, (unsigned long)St.ui32Reuses);
+  CHECK(St.ui32RoundTrips == ROUNDS + 2, "%lu round trips", (unsigned long)St.ui32RoundTrips);
+  printf("  GET, kept alive:              %7.3f ms, %6.3f ms of it setup, %.2f round trips\n",
+         sum/ROUNDS*1e3, St.ui32SetupUs/1e3/ROUNDS, (double)St.ui32RoundTrips/ROUNDS);
+}
+
+static void Pipelined(void){
+  static char buf[BATCH*RESPONSE_MAX];
+  const char *reqs[BATCH];
+  char *rsp[BATCH];
+  double t, sum = 0;
+  int i, k, ret;
+
+  for(i = 0; i < BATCH; i++) reqs[i] = REQUEST;
+  HttpClientStatsClear();
+  for(k = 0; k < ROUNDS; k++){
+    memset(rsp, 0, sizeof(rsp));
+    t = Seconds();
+    ret = HttpClientPipeline(SERVER, 80, reqs, BATCH, buf, sizeof(buf), rsp);
+    sum += Seconds() - t;
+    CHECK(ret == BATCH, "batch gave %d", ret);
+    for(i = 0; i < ret; i++) CHECK(Whole(rsp[i]), "response %d of batch %d", i, k);
+  }
+  HttpClientStatsGet(&St);
+  CHECK(St.ui32RoundTrips == ROUNDS && St.ui32Connects == 0, "%lu round trips, %lu connects",
+        (unsigned long)St.ui32RoundTrips, (unsigned long)St.ui32Connects);
+  printf("  GET, %d pipelined:             %7.3f ms,  0.000 ms of it setup, %.2f round trips\n",
+         BATCH, sum/ROUNDS/BATCH*1e3, (double)St.ui32RoundTrips/St.ui32Requests);
+}
+
+// the server drops the connection while it is idle; the cached
+// address outlives that, but not HTTPCLIENT_DNS_TTL_MS
+static void Stale(void){
+  static char buf[RESPONSE_MAX];
+  double t;
+  int ret;
+
+  HttpClientStatsClear();
+  usleep((IDLE_MS + 100)*1000);
+  t = Seconds();
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+  t = Seconds() - t;
+  HttpClientStatsGet(&St);
+  CHECK(ret == 0 && Whole(buf), "GET after idle gave %d", ret);
+  CHECK(St.ui32Reconnects == 1 && St.ui32Connects == 1 && St.ui32Lookups == 0 && St.ui32CacheHits == 1,
+        "%lu reconnects, %lu connects, %lu lookups", (unsigned long)St.ui32Reconnects,
+        (unsigned long)St.ui32Connects, (unsigned long)St.ui32Lookups);
+  printf("  GET after the server dropped it: %.3f ms, reconnected from the cached address\n", t*1e3);
+
+  HttpClientStatsClear();
+  usleep((TTL_MS + 100)*1000);
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+  HttpClientStatsGet(&St);
+  CHECK(ret == 0 && Whole(buf), "GET after the TTL gave %d", ret);
+  CHECK(St.ui32Lookups == 1 && St.ui32CacheHits == 0, "%lu lookups after the TTL",
+        (unsigned long)St.ui32Lookups);
+
+  // three servers, two entries: the first is forgotten
+  HttpClientStatsClear();
+  ret = HttpClientRequest(OTHER, 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == 0, "GET from %s gave %d", OTHER, ret);
+  ret = HttpClientRequest(THIRD, 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == 0, "GET from %s gave %d", THIRD, ret);
+  ret = HttpClientRequest(OTHER, 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == 0, "GET from %s gave %d", OTHER, ret);
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == 0, "GET from %s gave %d", SERVER, ret);
+  HttpClientStatsGet(&St);
+  CHECK(St.ui32Lookups == 3 && St.ui32Reuses == 1, "%lu lookups, %lu reuses over three servers",
+        (unsigned long)St.ui32Lookups, (unsigned long)St.ui32Reuses);
+}
+
+static void Closing(void){
+  static char buf[BATCH*RESPONSE_MAX];
+  const char *reqs[3] = {REQUEST, CLOSING, REQUEST};
+  char *rsp[3];
+  int ret;
+
+  HttpClientStatsClear();
+  ret = HttpClientRequest(SERVER, 80, CLOSING, buf, RESPONSE_MAX);
+  CHECK(ret == 0 && strstr(buf, "Connection: close"), "closing GET gave %d", ret);
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, RESPONSE_MAX);
+  CHECK(ret == 0 && Whole(buf), "GET after a close gave %d", ret);
+  HttpClientStatsGet(&St);
+  CHECK(St.ui32Connects == 1 && St.ui32Reconnects == 0, "%lu connects, %lu reconnects",
+        (unsigned long)St.ui32Connects, (unsigned long)St.ui32Reconnects);
+
+  HttpClientStatsClear();
+  ret = HttpClientPipeline(SERVER, 80, reqs, 3, buf, sizeof(buf), rsp);
+  CHECK(ret == 3 && Whole(rsp[0]) && strstr(rsp[1], "Connection: close") && Whole(rsp[2]),
+        "batch with a close gave %d", ret);
+  HttpClientStatsGet(&St);
+  CHECK(St.ui32Connects == 1 && St.ui32RoundTrips == 3, "%lu connects, %lu round trips",
+        (unsigned long)St.ui32Connects, (unsigned long)St.ui32RoundTrips);
+}
+
+static void Truncated(void){
+  static char buf[RESPONSE_MAX];
+  int ret, i, ok = 1;
+  char *body;
+
+  ret = HttpClientRequest(SERVER, 80, "GET /bytes/5000 HTTP/1.1\r\nHost: x\r\n\r\n", buf, sizeof(buf));
+  CHECK(ret == 0 && strlen(buf) == sizeof(buf) - 1, "long GET gave %d, %d bytes", ret, (int)strlen(buf));
+  body = strstr(buf, "\r\n\r\n") + 4;
+  for(i = 0; body[i]; i++) ok &= (body[i] == 'a' + i%26);
+  CHECK(ok, "long body garbled");
+  HttpClientStatsClear();
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+  HttpClientStatsGet(&St);
+  CHECK(ret == 0 && Whole(buf) && St.ui32Reuses == 1, "GET after a cut response gave %d", ret);
+}
+
+static void Failures(void){
+  static char buf[RESPONSE_MAX];
+  int ret;
+
+  ret = HttpClientRequest("nowhere.invalid", 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == SL_NET_APP_DNS_QUERY_NO_RESPONSE, "unknown name gave %d", ret);
+  ret = HttpClientRequest(SERVER, CLOSED_PORT, REQUEST, buf, sizeof(buf));
+  CHECK(ret == SL_ECONNREFUSED, "closed port gave %d", ret);
+  ret = HttpClientRequest(SERVER, 80, REQUEST, buf, sizeof(buf));
+  CHECK(ret == 0 && Whole(buf), "GET after failures gave %d", ret);
+}
+
+static void Stop(void){
+  int ret;
+  HttpClientClose();
+  ret = sl_Stop(0xFF);
+  CHECK(ret == 0, "sl_Stop gave %d", ret);
+}
+
+int main(int argc, char **argv){
+  char port[16], idle[16], emu[512];
+  int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+
+  setvbuf(stdout, 0, _IOLBF, 0);
+  signal(SIGALRM, Timeout);
+  alarm(60);
+  sprintf(port, "%d", PORT);
+  sprintf(idle, "%d", IDLE_MS);
+  Server = fork();
+  if(Server == 0){
+    execl("./HttpStandIn", "HttpStandIn", "-p", port, "-k", idle, (char *)0);
+    perror("./HttpStandIn");
+    _exit(127);
+  }
+  atexit(StopServer);
+  sprintf(emu, "./NwpEmu%s -r -n %d -c %d -d %s=127.0.0.1 -d %s=127.0.0.1 -d %s=127.0.0.1 -p 80=%d -p %d=%d",
+          verbose ? " -v" : "", DNS_MS, CONNECT_MS, SERVER, OTHER, THIRD, PORT, CLOSED_PORT, CLOSED_PORT);
+  setenv("CC3100_EMU", emu, 1);
+
+  printf("httpclient over the SimpleLink driver against NwpEmu, %d ms DNS, %d ms handshake\n",
+         DNS_MS, CONNECT_MS);
+  Start();
+  OneShot();
+  KeptAlive();
+  Pipelined();
+  Stale();
+  Closing();
+  Truncated();
+  Failures();
+  Stop();
+
+  printf("%s (%lu errors)\n", Errors ? "FAILED" : "passed", Errors);
+  return Errors ? 1 : 0;
+}
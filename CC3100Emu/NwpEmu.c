@@ -0,0 +1,1059 @@
+// NwpEmu.c
+// Runs on a PC, not on the LaunchPad
+// Stands in for the CC3100 network processor behind the Linux
+// SimpleLink port in CC3100/platform/linux.  spi_Open() starts it
+// with the SPI byte stream on fd 3 and the nHIB/IRQ lines on fd 4,
+// and it answers the host driver the way the NWP does:
+//   device init complete, stop, get/set and event masks
+//   WLAN connect and disconnect, with the connected and IP acquired
+//     events raised after a modelled association and DHCP time
+//   DNS, from -d overrides and then the host resolver unless -r
+//   socket, connect, send, recv, close and the nonblocking and
+//     receive timeout options, on real host sockets
+//   nonblocking connect, which answers SL_EALREADY until the
+//     handshake is done and then reports it to the next call
+//   select, over the read and write sets, with the NWP's 10 ms
+//     shortest timeout
+//   a modelled TCP handshake time before a blocking connect is
+//     reported done
+// Each message goes out only after the host's CNYS word, preceded by
+// its own IRQ edge, and carries the flow control credit the driver's
+// data path waits for; a dummy message refills it when it runs low.
+//
+// build (from this folder):
+//   gcc -O2 -I../CC3100/platform/linux -I../CC3100/simplelink/include -I../CC3100/simplelink/source -I../CC3100/simplelink -o NwpEmu NwpEmu.c
+// usage: NwpEmu [-v] [-r] [-a assoc_ms] [-i dhcp_ms] [-n dns_ms] [-c connect_ms]
+//               [-t txpool] [-d name=a.b.c.d]... [-p port=hostport]...
+//   -d answers DNS for name without the resolver, -r fails every
+//   other name, -p sends connects for port to hostport on the same
+//   address; spi_Open() runs the command in $CC3100_EMU, e.g.
+//   CC3100_EMU="./NwpEmu -d api.openweathermap.org=127.0.0.1 -p 80=8080"
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+// the BSD names in socket.h would rename the host's socket calls
+#include "user.h"
+#undef SL_INC_STD_BSD_API_NAMING
+#include "simplelink.h"
+#include "protocol.h"
+#include "flowcont.h"
+
+#define SPI_FD        3
+#define LINES_FD      4
+#define BODY_MAX      2048             // response arguments and payload
+#define QUEUE_SIZE    64
+#define TIMERS        16
+#define OVERRIDES     16
+#define TCP_CHUNK     1460             // SL_SOCKET_PAYLOAD_TYPE_TCP_IPV4
+#define SELECT_MIN_MS 10               // sl_Select() rounds shorter timeouts up
+#define RSP(opcode)   ((UINT16)((opcode) & 0x7FFF))
+#define ALIGN4(n)     (((n) + 3) & ~3)
+
+static int Verbose;
+static int NoResolver;                 // only the -d names resolve
+static long AssocMs = 5;               // connect command to connected event
+static long DhcpMs = 5;                // connected event to IP acquired
+static long DnsMs = 0;                 // query to answer
+static long ConnectMs = 0;             // connect command to connected event
+static int TxPool = 8;                 // free NWP buffers advertised
+
+static struct{ char *name; struct in_addr addr; } Hosts[OVERRIDES];
+static int HostCount;
+static struct{ unsigned short from, to; } Ports[OVERRIDES];
+static int PortCount;
+
+static unsigned long CmdCount, MsgCount, DummyCount;
+
+static long long Now(void){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+static void Log(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static void Log(const char *fmt, ...){
+  va_list ap;
+  if(!Verbose) return;
+  va_start(ap, fmt);
+  fputs("NwpEmu: ", stderr);
+  vfprintf(stderr, fmt, ap);
+  fputc('\n', stderr);
+  va_end(ap);
+}
+
+static void Die(const char *what){
+  fprintf(stderr, "NwpEmu: %s: %s\n", what, strerror(errno));
+  exit(1);
+}
+
+//---------------------bus---------------------
+static void ReadAll(int fd, void *buf, int len){
+  int done = 0, n;
+  while(done < len){
+    n = read(fd, (char *)buf + done, len - done);
+    if(n < 0 && errno == EINTR) continue;
+    if(n <= 0){                        // host closed the interface
+      Log("host gone");
+      exit(0);
+    }
+    done += n;
+  }
+}
+
+static void WriteAll(int fd, const void *buf, int len){
+  int done = 0, n;
+  while(done < len){
+    n = write(fd, (const char *)buf + done, len - done);
+    if(n < 0 && errno == EINTR) continue;
+    if(n <= 0){
+      Log("host gone");
+      exit(0);
+    }
+    done += n;
+  }
+}
+
+//---------------------message queue---------------------
+// messages wait here until the host clocks them out; the response
+// header is filled in as each one leaves, so it carries the credit
+// and socket state at that moment
+typedef struct{
+  UINT16 opcode;
+  UINT16 len;                          // arguments and payload
+  UINT8 body[BODY_MAX];
+}Msg_t;
+
+static Msg_t Queue[QUEUE_SIZE];
+static int QueueHead, QueueCount;
+static int Enabled;                    // nHIB high
+static int IrqRaised;                  // edge sent, message not yet read
+static int HostCredits = FLOW_CONT_MIN;
+static int Connected;                  // WLAN_CONN_STATUS_BIT
+static UINT8 TxFailure, NonBlocking;   // per socket bits
+
+static Msg_t *Alloc(UINT16 opcode){
+  Msg_t *m;
+  if(QueueCount == QUEUE_SIZE){
+    fprintf(stderr, "NwpEmu: queue full, dropping 0x%04x\n", opcode);
+    exit(1);
+  }
+  m = &Queue[(QueueHead + QueueCount) % QUEUE_SIZE];
+  QueueCount++;
+  m->opcode = opcode;
+  m->len = 0;
+  return m;
+}
+
+static void Append(Msg_t *m, const void *data, int len){
+  if(m->len + len > BODY_MAX){
+    fprintf(stderr, "NwpEmu: 0x%04x body too long\n", m->opcode);
+    exit(1);
+  }
+  memcpy(&m->body[m->len], data, len);
+  m->len += len;
+}
+
+static void Send(UINT16 opcode, const void *args, int argLen,
+                 const void *payload, int payloadLen){
+  Msg_t *m = Alloc(opcode);
+  Append(m, args, argLen);
+  if(payloadLen > 0) Append(m, payload, payloadLen);
+}
+
+static void SendBasic(UINT16 opcode, INT16 status){
+  _BasicResponse_t rsp = {status, 0};
+  Send(opcode, &rsp, sizeof(rsp), 0, 0);
+}
+
+static void SendSocket(UINT16 opcode, INT16 statusOrLen, UINT8 sd){
+  _SocketResponse_t rsp = {statusOrLen, sd, 0};
+  Send(opcode, &rsp, sizeof(rsp), 0, 0);
+}
+
+// after CNYS: sync, header and the 4-byte aligned body, exactly what
+// _SlDrvRxHdrRead() and _SlDrvMsgRead() will read
+static void Emit(void){
+  static const UINT8 pad[4];
+  UINT32 sync = N2H_SYNC_PATTERN;
+  _SlResponseHeader_t hdr;
+  Msg_t dummy, *m;
+
+  if(QueueCount == 0){
+    // the host only reads after an edge; answer rather than hang it
+    fprintf(stderr, "NwpEmu: read with nothing queued\n");
+    dummy.opcode = SL_OPCODE_DEVICE_DEVICEASYNCDUMMY;
+    dummy.len = 0;
+    m = &dummy;
+  }else{
+    m = &Queue[QueueHead];
+  }
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.GenHeader.Opcode = m->opcode;
+  hdr.GenHeader.Len = _SL_RESP_SPEC_HDR_SIZE + m->len;
+  hdr.TxPoolCnt = TxPool;
+  hdr.DevStatus = Connected;
+  hdr.SocketTXFailure = TxFailure;
+  hdr.SocketNonBlocking = NonBlocking;
+  if(m->opcode != SL_OPCODE_DEVICE_INITCOMPLETE) HostCredits = TxPool;
+
+  WriteAll(SPI_FD, &sync, sizeof(sync));
+  WriteAll(SPI_FD, &hdr, sizeof(hdr));
+  WriteAll(SPI_FD, m->body, m->len);
+  WriteAll(SPI_FD, pad, ALIGN4(m->len) - m->len);
+  Log("-> 0x%04x len %d", m->opcode, m->len);
+  MsgCount++;
+  if(m != &dummy){
+    QueueHead = (QueueHead + 1) % QUEUE_SIZE;
+    QueueCount--;
+  }
+  IrqRaised = 0;
+}
+
+//---------------------timers---------------------
+// asynchronous events that the NWP raises some time after the command
+typedef struct{
+  long long due;                       // 0 when free
+  Msg_t msg;
+}Timer_t;
+static Timer_t Timers[TIMERS];
+
+static Msg_t *Later(long ms, UINT16 opcode){
+  int i;
+  for(i = 0; i < TIMERS; i++){
+    if(Timers[i].due == 0){
+      Timers[i].due = Now() + ms;
+      Timers[i].msg.opcode = opcode;
+      Timers[i].msg.len = 0;
+      return &Timers[i].msg;
+    }
+  }
+  fprintf(stderr, "NwpEmu: out of timers\n");
+  exit(1);
+}
+
+static void Cancel(UINT16 opcode){
+  int i;
+  for(i = 0; i < TIMERS; i++){
+    if(Timers[i].due && Timers[i].msg.opcode == opcode) Timers[i].due = 0;
+  }
+}
+
+static void FireTimers(void){
+  long long now = Now();
+  Msg_t *m;
+  int i;
+  for(i = 0; i < TIMERS; i++){
+    if(Timers[i].due && Timers[i].due <= now){
+      Timers[i].due = 0;
+      m = Alloc(Timers[i].msg.opcode);
+      m->len = Timers[i].msg.len;
+      memcpy(m->body, Timers[i].msg.body, m->len);
+      if(m->opcode == SL_OPCODE_WLAN_WLANASYNCCONNECTEDRESPONSE) Connected = 1;
+    }
+  }
+}
+
+//---------------------sockets---------------------
+typedef struct{
+  int fd;                              // -1 when free
+  UINT8 sd;                            // as the host knows it
+  UINT8 connecting;
+  UINT8 connected;
+  UINT8 connReady;                     // nonblocking result not yet reported
+  INT16 connErr;
+  UINT16 recvWanted;                   // parked blocking recv
+  long rcvTimeoMs;                     // SL_SO_RCVTIMEO, 0 forever
+  long long recvDue;
+}Sock_t;
+static Sock_t Socks[SL_MAX_SOCKETS];
+
+static Sock_t *FindSock(UINT8 sd){
+  Sock_t *s;
+  if((sd & BSD_SOCKET_ID_MASK) >= SL_MAX_SOCKETS) return 0;
+  s = &Socks[sd & BSD_SOCKET_ID_MASK];
+  return (s->fd >= 0 && s->sd == sd) ? s : 0;
+}
+
+static void CloseSock(Sock_t *s){
+  int idx = s - Socks;
+  close(s->fd);
+  s->fd = -1;
+  s->connecting = 0;
+  s->connected = 0;
+  s->connReady = 0;
+  s->recvWanted = 0;
+  TxFailure &= ~(1 << idx);
+  NonBlocking &= ~(1 << idx);
+}
+
+// send what is waiting, up to one TCP segment; returns 0 if the
+// socket has nothing yet
+static int ServeRecv(Sock_t *s, int wanted){
+  UINT8 buf[TCP_CHUNK];
+  Msg_t *m;
+  _SocketResponse_t rsp = {0, s->sd, 0};
+  int n;
+
+  if(wanted > TCP_CHUNK) wanted = TCP_CHUNK;
+  n = recv(s->fd, buf, wanted, MSG_DONTWAIT);
+  if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 0;
+  rsp.statusOrLen = (n < 0) ? -errno : n;
+  m = Alloc(SL_OPCODE_SOCKET_RECVASYNCRESPONSE);
+  Append(m, &rsp, sizeof(rsp));
+  if(n > 0) Append(m, buf, n);
+  s->recvWanted = 0;
+  return 1;
+}
+
+// the connected event of a blocking connect, after the handshake's
+// modelled round trip to the server
+static void ConnectDone(UINT8 sd, INT16 status){
+  _SocketResponse_t rsp = {status, sd, 0};
+  if(ConnectMs == 0){
+    SendSocket(SL_OPCODE_SOCKET_CONNECTASYNCRESPONSE, status, sd);
+    return;
+  }
+  Append(Later(ConnectMs, SL_OPCODE_SOCKET_CONNECTASYNCRESPONSE), &rsp, sizeof(rsp));
+}
+
+// a blocking connect is answered now; a nonblocking one keeps the
+// result for the host's next sl_Connect()
+static void FinishConnect(Sock_t *s){
+  int err = 0;
+  socklen_t len = sizeof(err);
+  getsockopt(s->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+  s->connecting = 0;
+  s->connected = (err == 0);
+  Log("connect sd 0x%02x: %s", s->sd, err ? strerror(err) : "ok");
+  // SimpleLink's socket error numbers are the BSD ones
+  if(NonBlocking & (1 << (s - Socks))){
+    s->connReady = 1;
+    s->connErr = -err;
+  }else{
+    ConnectDone(s->sd, -err);
+  }
+}
+
+//---------------------select---------------------
+static struct{
+  int active;
+  UINT16 readFds, writeFds;
+  long long due;                       // 0 waits forever
+}Sel;
+
+// a set socket is readable with data, end of file or an error
+// waiting, and writable once it is no longer connecting
+static int SelectReady(UINT16 *readFds, UINT16 *writeFds){
+  struct pollfd p;
+  Sock_t *s;
+  int i, n = 0;
+
+  *readFds = *writeFds = 0;
+  for(i = 0; i < SL_MAX_SOCKETS; i++){
+    s = &Socks[i];
+    if(s->fd < 0) continue;
+    if(Sel.readFds & (1 << i)){
+      p.fd = s->fd;
+      p.events = POLLIN;
+      if(!s->connecting && poll(&p, 1, 0) > 0){
+        *readFds |= 1 << i;
+        n++;
+      }
+    }
+    if((Sel.writeFds & (1 << i)) && !s->connecting){
+      *writeFds |= 1 << i;
+      n++;
+    }
+  }
+  return n;
+}
+
+static void CheckSelect(long long now){
+  _SelectAsyncResponse_t rsp;
+  UINT16 r, w;
+  int n;
+
+  if(!Sel.active) return;
+  n = SelectReady(&r, &w);
+  if(n == 0 && (Sel.due == 0 || now < Sel.due)) return;
+  memset(&rsp, 0, sizeof(rsp));
+  rsp.status = n;
+  rsp.readFdsCount = __builtin_popcount(r);
+  rsp.writeFdsCount = __builtin_popcount(w);
+  rsp.readFds = r;
+  rsp.writeFds = w;
+  Sel.active = 0;
+  Send(SL_OPCODE_SOCKET_SELECTASYNCRESPONSE, &rsp, sizeof(rsp), 0, 0);
+}
+
+//---------------------command handlers---------------------
+static UINT16 RspOpcode;               // of the command being handled
+
+static void Ok(const UINT8 *args, int len){
+  (void)args; (void)len;
+  SendBasic(RspOpcode, 0);
+}
+
+static void Stop(const UINT8 *args, int len){
+  Ok(args, len);
+  SendBasic(SL_OPCODE_DEVICE_STOP_ASYNC_RESPONSE, 0);
+}
+
+static void EventMaskGet(const UINT8 *args, int len){
+  _DevMaskEventGetResponse_t rsp = {((_DevMaskEventGetCommand_t *)args)->group, 0};
+  (void)len;
+  Send(RspOpcode, &rsp, sizeof(rsp), 0, 0);
+}
+
+static void DevGet(const UINT8 *args, int len){
+  _DeviceSetGet_t rsp = *(_DeviceSetGet_t *)args;   // ConfigLen unset
+  SlVersionFull ver;
+  SlDateTime_t dt;
+  const void *payload = 0;
+  int size = 0;
+  struct tm tm;
+  time_t t;
+  (void)len;
+
+  if(rsp.DeviceSetId == SL_DEVICE_GENERAL_CONFIGURATION &&
+     rsp.Option == SL_DEVICE_GENERAL_VERSION){
+    memset(&ver, 0, sizeof(ver));
+    ver.ChipFwAndPhyVersion.ChipId = 0x4000000;
+    ver.ChipFwAndPhyVersion.FwVersion[0] = 2;
+    ver.ChipFwAndPhyVersion.FwVersion[1] = 2;
+    ver.NwpVersion[0] = 2;
+    ver.NwpVersion[1] = 2;
+    ver.RomVersion = 0x3333;
+    payload = &ver;
+    size = sizeof(ver);
+  }else if(rsp.DeviceSetId == SL_DEVICE_GENERAL_CONFIGURATION &&
+           rsp.Option == SL_DEVICE_GENERAL_CONFIGURATION_DATE_TIME){
+    t = time(0);
+    localtime_r(&t, &tm);
+    memset(&dt, 0, sizeof(dt));
+    dt.sl_tm_sec = tm.tm_sec;
+    dt.sl_tm_min = tm.tm_min;
+    dt.sl_tm_hour = tm.tm_hour;
+    dt.sl_tm_day = tm.tm_mday;
+    dt.sl_tm_mon = tm.tm_mon + 1;
+    dt.sl_tm_year = tm.tm_year + 1900;
+    payload = &dt;
+    size = sizeof(dt);
+  }
+  rsp.Status = 0;
+  rsp.ConfigLen = size;
+  Send(RspOpcode, &rsp, sizeof(rsp), payload, size);
+}
+
+static void ConfigGet(const UINT8 *args, int len){
+  // _WlanCfgSetGet_t, _NetAppSetGet_t: status, id, option, length
+  _NetCfgSetGet_t rsp = *(_NetCfgSetGet_t *)args;
+  (void)len;
+  rsp.Status = 0;
+  rsp.ConfigLen = 0;
+  Send(RspOpcode, &rsp, sizeof(rsp), 0, 0);
+}
+
+static void NetCfgGet(const UINT8 *args, int len){
+  _NetCfgSetGet_t rsp = *(_NetCfgSetGet_t *)args;
+  static const UINT8 mac[SL_MAC_ADDR_LEN] = {0x08, 0x00, 0x28, 0x5a, 0xee, 0x01};
+  _NetCfgIpV4Args_t ip;
+  const void *payload = 0;
+  int size = 0;
+  (void)len;
+
+  if(rsp.ConfigId == SL_MAC_ADDRESS_GET){
+    payload = mac;
+    size = sizeof(mac);
+  }else if(rsp.ConfigId == SL_IPV4_STA_P2P_CL_GET_INFO && Connected){
+    ip.ipV4 = SL_IPV4_VAL(192,168,1,100);
+    ip.ipV4Mask = SL_IPV4_VAL(255,255,255,0);
+    ip.ipV4Gateway = SL_IPV4_VAL(192,168,1,1);
+    ip.ipV4DnsServer = SL_IPV4_VAL(192,168,1,1);
+    rsp.ConfigOpt = 1;                 // from DHCP
+    payload = &ip;
+    size = sizeof(ip);
+  }
+  rsp.Status = 0;
+  rsp.ConfigLen = size;
+  Send(RspOpcode, &rsp, sizeof(rsp), payload, size);
+}
+
+static sl_protocol_wlanConnectAsyncResponse_t Ap;
+
+static void WlanConnect(const UINT8 *args, int len){
+  const _WlanConnectCommon_t *cmd = (const _WlanConnectCommon_t *)args;
+  SlIpV4AcquiredAsync_t ip;
+  Msg_t *m;
+
+  if(len < (int)sizeof(*cmd) + cmd->SsidLen || cmd->SsidLen > sizeof(Ap.ssid_name)){
+    SendBasic(RspOpcode, SL_SOC_ERROR);
+    return;
+  }
+  memset(&Ap, 0, sizeof(Ap));
+  Ap.ssid_len = cmd->SsidLen;
+  memcpy(Ap.ssid_name, args + sizeof(*cmd), cmd->SsidLen);
+  memcpy(Ap.bssid, "\x00\x1a\x11\xc3\x9e\x01", 6);
+  Log("associating with %.*s", Ap.ssid_len, (char *)Ap.ssid_name);
+  SendBasic(RspOpcode, 0);
+
+  m = Later(AssocMs, SL_OPCODE_WLAN_WLANASYNCCONNECTEDRESPONSE);
+  Append(m, &Ap, sizeof(Ap));
+  ip.ip = SL_IPV4_VAL(192,168,1,100);
+  ip.gateway = SL_IPV4_VAL(192,168,1,1);
+  ip.dns = SL_IPV4_VAL(192,168,1,1);
+  m = Later(AssocMs + DhcpMs, SL_OPCODE_NETAPP_IPACQUIRED);
+  Append(m, &ip, sizeof(ip));
+}
+
+static void WlanDisconnect(const UINT8 *args, int len){
+  int pending = 0, i;
+  Msg_t *m;
+  (void)args; (void)len;
+
+  for(i = 0; i < TIMERS; i++){
+    if(Timers[i].due && Timers[i].msg.opcode == SL_OPCODE_WLAN_WLANASYNCCONNECTEDRESPONSE) pending = 1;
+  }
+  if(!Connected && !pending){
+    SendBasic(RspOpcode, SL_SOC_ERROR);   // already disconnected
+    return;
+  }
+  Cancel(SL_OPCODE_WLAN_WLANASYNCCONNECTEDRESPONSE);
+  Cancel(SL_OPCODE_NETAPP_IPACQUIRED);
+  Connected = 0;
+  SendBasic(RspOpcode, 0);
+  Ap.reason_code = SL_USER_INITIATED_DISCONNECTION;
+  m = Alloc(SL_OPCODE_WLAN_WLANASYNCDISCONNECTEDRESPONSE);
+  Append(m, &Ap, sizeof(Ap));
+}
+
+static int Lookup(const char *name, struct in_addr *addr){
+  struct addrinfo hints, *res;
+  int i;
+  for(i = 0; i < HostCount; i++){
+    if(strcmp(Hosts[i].name, name) == 0){
+      *addr = Hosts[i].addr;
+      return 1;
+    }
+  }
+  if(NoResolver) return 0;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  if(getaddrinfo(name, 0, &hints, &res) != 0) return 0;
+  *addr = ((struct sockaddr_in *)res->ai_addr)->sin_addr;
+  freeaddrinfo(res);
+  return 1;
+}
+
+static void DnsGetHostByName(const UINT8 *args, int len){
+  const _GetHostByNameCommand_t *cmd = (const _GetHostByNameCommand_t *)args;
+  _GetHostByNameIPv4AsyncResponse_t rsp;
+  char name[256];
+  struct in_addr addr;
+  int n = cmd->Len;
+  Msg_t *m;
+
+  if(n > len - (int)sizeof(*cmd)) n = len - sizeof(*cmd);
+  if(n > (int)sizeof(name) - 1) n = sizeof(name) - 1;
+  memcpy(name, args + sizeof(*cmd), n);
+  name[n] = 0;
+  SendBasic(RspOpcode, 0);
+
+  memset(&rsp, 0, sizeof(rsp));
+  if(Lookup(name, &addr)){
+    rsp.ip0 = ntohl(addr.s_addr);      // host order, as sl_Htonl expects
+    Log("dns %s -> %s", name, inet_ntoa(addr));
+  }else{
+    rsp.status = (UINT16)SL_NET_APP_DNS_QUERY_NO_RESPONSE;
+    Log("dns %s failed", name);
+  }
+  m = Later(DnsMs, SL_OPCODE_NETAPP_DNSGETHOSTBYNAMEASYNCRESPONSE);
+  Append(m, &rsp, sizeof(rsp));
+}
+
+static void Socket(const UINT8 *args, int len){
+  const _SocketCommand_t *cmd = (const _SocketCommand_t *)args;
+  int idx, type, one = 1;
+  Sock_t *s;
+  (void)len;
+
+  for(idx = 0; idx < SL_MAX_SOCKETS && Socks[idx].fd >= 0; idx++);
+  if(idx == SL_MAX_SOCKETS){
+    SendSocket(RspOpcode, SL_ENSOCK, 0);
+    return;
+  }
+  if(cmd->Domain != SL_AF_INET){
+    SendSocket(RspOpcode, SL_EAFNOSUPPORT, 0);
+    return;
+  }
+  type = (cmd->Type == SL_SOCK_DGRAM) ? SOCK_DGRAM : SOCK_STREAM;
+  s = &Socks[idx];
+  s->fd = socket(AF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if(s->fd < 0){
+    SendSocket(RspOpcode, -errno, 0);
+    s->fd = -1;
+    return;
+  }
+  if(type == SOCK_STREAM) setsockopt(s->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  s->sd = ((type == SOCK_STREAM) ? SL_SOCKET_PAYLOAD_TYPE_TCP_IPV4 : SL_SOCKET_PAYLOAD_TYPE_UDP_IPV4) | idx;
+  s->connecting = 0;
+  s->recvWanted = 0;
+  s->rcvTimeoMs = 0;
+  Log("socket sd 0x%02x", s->sd);
+  SendSocket(RspOpcode, s->sd, s->sd);
+}
+
+static void Close(const UINT8 *args, int len){
+  UINT8 sd = ((const _CloseCommand_t *)args)->sd;
+  Sock_t *s = FindSock(sd);
+  (void)len;
+  if(s == 0){
+    SendSocket(RspOpcode, SL_EBADF, sd);
+    return;
+  }
+  CloseSock(s);
+  SendSocket(RspOpcode, 0, sd);
+}
+
+static void Connect(const UINT8 *args, int len){
+  const _SocketAddrIPv4Command_t *cmd = (const _SocketAddrIPv4Command_t *)args;
+  Sock_t *s = FindSock(cmd->sd);
+  struct sockaddr_in sin;
+  struct pollfd p;
+  unsigned short port = ntohs(cmd->port);
+  int i;
+  (void)len;
+
+  if(s == 0){
+    SendSocket(RspOpcode, SL_EBADF, cmd->sd);
+    return;
+  }
+  for(i = 0; i < PortCount; i++){
+    if(Ports[i].from == port){
+      port = Ports[i].to;
+      break;
+    }
+  }
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons(port);
+  sin.sin_addr.s_addr = cmd->address;  // already network order
+  if(NonBlocking & (1 << (s - Socks))){
+    p.fd = s->fd;
+    p.events = POLLOUT;
+    if(s->connecting && poll(&p, 1, 0) > 0) FinishConnect(s);
+    if(s->connecting){                 // asked again too soon
+      SendSocket(RspOpcode, SL_EALREADY, cmd->sd);
+      return;
+    }
+    if(s->connReady){                  // done since the last call
+      s->connReady = 0;
+      SendSocket(RspOpcode, s->connErr, cmd->sd);
+      if(s->connErr == 0) SendSocket(SL_OPCODE_SOCKET_CONNECTASYNCRESPONSE, 0, cmd->sd);
+      return;
+    }
+    if(s->connected){
+      SendSocket(RspOpcode, SL_EISCONN, cmd->sd);
+      return;
+    }
+  }
+  Log("connect sd 0x%02x to %s:%u", s->sd, inet_ntoa(sin.sin_addr), port);
+  if(connect(s->fd, (struct sockaddr *)&sin, sizeof(sin)) == 0){
+    s->connected = 1;
+    SendSocket(RspOpcode, 0, cmd->sd);
+    ConnectDone(cmd->sd, 0);
+  }else if(errno == EINPROGRESS){
+    s->connecting = 1;                 // finished from the poll loop
+    if(NonBlocking & (1 << (s - Socks))){
+      SendSocket(RspOpcode, SL_EALREADY, cmd->sd);
+    }else{
+      SendSocket(RspOpcode, 0, cmd->sd);
+    }
+  }else if(NonBlocking & (1 << (s - Socks))){
+    SendSocket(RspOpcode, -errno, cmd->sd);
+  }else{
+    SendSocket(RspOpcode, 0, cmd->sd);
+    ConnectDone(cmd->sd, -errno);
+  }
+}
+
+static void SocketSend(const UINT8 *args, int len){
+  const _sendRecvCommand_t *cmd = (const _sendRecvCommand_t *)args;
+  Sock_t *s = FindSock(cmd->sd);
+  const UINT8 *data = args + sizeof(*cmd);
+  int n = cmd->StatusOrLen, done = 0, w;
+  struct pollfd p;
+
+  // there is no response; a failure shows in SocketTXFailure
+  if(n > len - (int)sizeof(*cmd)) n = len - sizeof(*cmd);
+  if(s == 0) return;
+  while(done < n){
+    w = send(s->fd, data + done, n - done, MSG_NOSIGNAL);
+    if(w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)){
+      p.fd = s->fd;
+      p.events = POLLOUT;
+      poll(&p, 1, -1);
+      continue;
+    }
+    if(w < 0){
+      Log("send sd 0x%02x: %s", s->sd, strerror(errno));
+      TxFailure |= 1 << (s - Socks);
+      return;
+    }
+    done += w;
+  }
+}
+
+static void SocketRecv(const UINT8 *args, int len){
+  const _sendRecvCommand_t *cmd = (const _sendRecvCommand_t *)args;
+  Sock_t *s = FindSock(cmd->sd);
+  Msg_t *m;
+  _SocketResponse_t rsp = {SL_EBADF, cmd->sd, 0};
+  (void)len;
+
+  if(s == 0){
+    m = Alloc(SL_OPCODE_SOCKET_RECVASYNCRESPONSE);
+    Append(m, &rsp, sizeof(rsp));
+    return;
+  }
+  if(ServeRecv(s, cmd->StatusOrLen)) return;
+  if(NonBlocking & (1 << (s - Socks))){
+    SendSocket(SL_OPCODE_SOCKET_RECVASYNCRESPONSE, SL_EAGAIN, s->sd);
+    return;
+  }
+  s->recvWanted = cmd->StatusOrLen;    // answered from the poll loop
+  s->recvDue = s->rcvTimeoMs ? Now() + s->rcvTimeoMs : 0;
+}
+
+static void Select(const UINT8 *args, int len){
+  const _SelectCommand_t *cmd = (const _SelectCommand_t *)args;
+  long ms;
+  (void)len;
+
+  // the driver has only one select out at a time
+  SendBasic(RspOpcode, 0);
+  Sel.readFds = cmd->readFds;
+  Sel.writeFds = cmd->writeFds;
+  // tv_usec has already been turned into milliseconds
+  if(cmd->tv_sec == 0xFFFF && cmd->tv_usec == 0xFFFF){
+    Sel.due = 0;
+  }else{
+    ms = cmd->tv_sec*1000L + cmd->tv_usec;
+    if(ms < SELECT_MIN_MS) ms = SELECT_MIN_MS;
+    Sel.due = Now() + ms;
+  }
+  Sel.active = 1;
+  CheckSelect(Now());                  // answers now if a socket is ready
+}
+
+static void SetSockOpt(const UINT8 *args, int len){
+  const _setSockOptCommand_t *cmd = (const _setSockOptCommand_t *)args;
+  const UINT8 *value = args + sizeof(*cmd);
+  Sock_t *s = FindSock(cmd->sd);
+  SlSockNonblocking_t nb;
+  SlTimeval_t tv;
+  int idx;
+
+  if(s == 0){
+    SendSocket(RspOpcode, SL_EBADF, cmd->sd);
+    return;
+  }
+  idx = s - Socks;
+  if(cmd->level == SL_SOL_SOCKET && cmd->optionName == SL_SO_NONBLOCKING &&
+     cmd->optionLen >= sizeof(nb) && len >= (int)(sizeof(*cmd) + sizeof(nb))){
+    memcpy(&nb, value, sizeof(nb));
+    if(nb.NonblockingEnabled) NonBlocking |= 1 << idx;
+    else NonBlocking &= ~(1 << idx);
+  }else if(cmd->level == SL_SOL_SOCKET && cmd->optionName == SL_SO_RCVTIMEO &&
+           cmd->optionLen >= sizeof(tv) && len >= (int)(sizeof(*cmd) + sizeof(tv))){
+    memcpy(&tv, value, sizeof(tv));
+    s->rcvTimeoMs = tv.tv_sec*1000 + tv.tv_usec/1000;
+  }
+  SendSocket(RspOpcode, 0, cmd->sd);
+}
+
+static void GetSockOpt(const UINT8 *args, int len){
+  const _getSockOptCommand_t *cmd = (const _getSockOptCommand_t *)args;
+  _getSockOptResponse_t rsp = {0, cmd->sd, cmd->optionLen};
+  Sock_t *s = FindSock(cmd->sd);
+  UINT8 value[32];
+  SlSockNonblocking_t nb;
+  (void)len;
+
+  memset(value, 0, sizeof(value));
+  if(rsp.optionLen > sizeof(value)) rsp.optionLen = sizeof(value);
+  if(s == 0){
+    rsp.status = SL_EBADF;
+    rsp.optionLen = 0;
+  }else if(cmd->level == SL_SOL_SOCKET && cmd->optionName == SL_SO_NONBLOCKING &&
+           rsp.optionLen >= sizeof(nb)){
+    nb.NonblockingEnabled = (NonBlocking >> (s - Socks)) & 1;
+    memcpy(value, &nb, sizeof(nb));
+  }
+  Send(RspOpcode, &rsp, sizeof(rsp), value, rsp.optionLen);
+}
+
+static const struct{
+  UINT16 opcode;
+  void (*handler)(const UINT8 *args, int len);
+}Commands[] = {
+  {SL_OPCODE_DEVICE_STOP_COMMAND,          Stop},
+  {SL_OPCODE_DEVICE_EVENTMASKSET,          Ok},
+  {SL_OPCODE_DEVICE_EVENTMASKGET,          EventMaskGet},
+  {SL_OPCODE_DEVICE_DEVICEGET,             DevGet},
+  {SL_OPCODE_DEVICE_DEVICESET,             Ok},
+  {SL_OPCODE_DEVICE_NETCFG_SET_COMMAND,    Ok},
+  {SL_OPCODE_DEVICE_NETCFG_GET_COMMAND,    NetCfgGet},
+  {SL_OPCODE_WLAN_WLANCONNECTCOMMAND,      WlanConnect},
+  {SL_OPCODE_WLAN_WLANDISCONNECTCOMMAND,   WlanDisconnect},
+  {SL_OPCODE_WLAN_PROFILEADDCOMMAND,       Ok},
+  {SL_OPCODE_WLAN_PROFILEDELCOMMAND,       Ok},
+  {SL_OPCODE_WLAN_POLICYSETCOMMAND,        Ok},
+  {SL_OPCODE_WLAN_SET_MODE,                Ok},
+  {SL_OPCODE_WLAN_CFG_SET,                 Ok},
+  {SL_OPCODE_WLAN_CFG_GET,                 ConfigGet},
+  {SL_OPCODE_NETAPP_START_COMMAND,         Ok},
+  {SL_OPCODE_NETAPP_STOP_COMMAND,          Ok},
+  {SL_OPCODE_NETAPP_NETAPPSET,             Ok},
+  {SL_OPCODE_NETAPP_NETAPPGET,             ConfigGet},
+  {SL_OPCODE_NETAPP_MDNSREGISTERSERVICE,   Ok},
+  {SL_OPCODE_NETAPP_DNSGETHOSTBYNAME,      DnsGetHostByName},
+  {SL_OPCODE_SOCKET_SOCKET,                Socket},
+  {SL_OPCODE_SOCKET_CLOSE,                 Close},
+  {SL_OPCODE_SOCKET_CONNECT,               Connect},
+  {SL_OPCODE_SOCKET_SEND,                  SocketSend},
+  {SL_OPCODE_SOCKET_RECV,                  SocketRecv},
+  {SL_OPCODE_SOCKET_SELECT,                Select},
+  {SL_OPCODE_SOCKET_SETSOCKOPT,            SetSockOpt},
+  {SL_OPCODE_SOCKET_GETSOCKOPT,            GetSockOpt},
+};
+
+//---------------------host interface---------------------
+static void Command(void){
+  static UINT8 args[BODY_MAX + 64];
+  _SlGenericHeader_t hdr;
+  UINT8 drain[64];
+  int len, n, i;
+
+  ReadAll(SPI_FD, &hdr, sizeof(hdr));
+  len = hdr.Len;
+  n = (len > (int)sizeof(args)) ? (int)sizeof(args) : len;
+  memset(args, 0, 16);                 // short commands read as zeros
+  ReadAll(SPI_FD, args, n);
+  for(i = n; i < len; i += sizeof(drain)){
+    ReadAll(SPI_FD, drain, (len - i < (int)sizeof(drain)) ? len - i : (int)sizeof(drain));
+  }
+  CmdCount++;
+  Log("<- 0x%04x len %d", hdr.Opcode, len);
+
+  RspOpcode = RSP(hdr.Opcode);
+  for(i = 0; i < (int)(sizeof(Commands)/sizeof(Commands[0])); i++){
+    if(Commands[i].opcode == hdr.Opcode){
+      Commands[i].handler(args, n);
+      break;
+    }
+  }
+  if(i == (int)(sizeof(Commands)/sizeof(Commands[0]))){
+    // the driver reads a basic response for most commands it has no
+    // special case for; anything longer will desynchronize it
+    fprintf(stderr, "NwpEmu: unsupported command 0x%04x\n", hdr.Opcode);
+    SendBasic(RspOpcode, SL_SOC_ERROR);
+  }
+
+  // send and recv take a buffer on the NWP side; keep the host able
+  // to issue the next one
+  if(hdr.Opcode == SL_OPCODE_SOCKET_SEND || hdr.Opcode == SL_OPCODE_SOCKET_RECV ||
+     hdr.Opcode == SL_OPCODE_SOCKET_RECVFROM){
+    HostCredits--;
+    if(HostCredits <= FLOW_CONT_MIN + 1 && QueueCount == 0){
+      Alloc(SL_OPCODE_DEVICE_DEVICEASYNCDUMMY);
+      DummyCount++;
+    }
+  }
+}
+
+static void Bus(void){
+  static const _SlSyncPattern_t sync = H2N_SYNC_PATTERN;
+  static const _SlSyncPattern_t cnys = H2N_CNYS_PATTERN;
+  UINT8 word[4];
+
+  ReadAll(SPI_FD, word, sizeof(word));
+  if(memcmp(word, &sync.Short, 4) == 0){
+    Command();
+  }else if(memcmp(word, &cnys.Short, 4) == 0){
+    Emit();
+  }else{
+    fprintf(stderr, "NwpEmu: lost sync, %02x %02x %02x %02x\n",
+            word[0], word[1], word[2], word[3]);
+  }
+}
+
+static void Reset(void){
+  int i;
+  for(i = 0; i < SL_MAX_SOCKETS; i++){
+    if(Socks[i].fd >= 0) CloseSock(&Socks[i]);
+  }
+  for(i = 0; i < TIMERS; i++) Timers[i].due = 0;
+  QueueHead = QueueCount = 0;
+  IrqRaised = 0;
+  Connected = 0;
+  TxFailure = NonBlocking = 0;
+  HostCredits = FLOW_CONT_MIN;
+}
+
+static void Lines(void){
+  char c;
+  int n = read(LINES_FD, &c, 1);
+  InitComplete_t init = {INIT_STA_OK};
+
+  if(n < 0 && errno == EINTR) return;
+  if(n <= 0){
+    Log("host gone");
+    exit(0);
+  }
+  if(c == BOARD_LINE_NHIB_HIGH && !Enabled){
+    Reset();
+    Enabled = 1;
+    Log("nHIB high");
+    Send(SL_OPCODE_DEVICE_INITCOMPLETE, &init, sizeof(init), 0, 0);
+  }else if(c == BOARD_LINE_NHIB_LOW){
+    Reset();
+    Enabled = 0;
+    Log("nHIB low");
+  }
+}
+
+//---------------------main loop---------------------
+static void Loop(void){
+  struct pollfd p[2 + 2*SL_MAX_SOCKETS];
+  int map[2 + 2*SL_MAX_SOCKETS];
+  long long now, due;
+  int n, i, timeout;
+  Sock_t *s;
+
+  for(;;){
+    FireTimers();
+    if(Enabled && QueueCount && !IrqRaised){
+      WriteAll(LINES_FD, "I", 1);
+      IrqRaised = 1;
+    }
+
+    p[0].fd = SPI_FD;   p[0].events = POLLIN;
+    p[1].fd = LINES_FD; p[1].events = POLLIN;
+    n = 2;
+    now = Now();
+    due = 0;
+    for(i = 0; i < TIMERS; i++){
+      if(Timers[i].due && (due == 0 || Timers[i].due < due)) due = Timers[i].due;
+    }
+    for(i = 0; i < SL_MAX_SOCKETS; i++){
+      s = &Socks[i];
+      if(s->fd < 0 || !(s->connecting || s->recvWanted)) continue;
+      p[n].fd = s->fd;
+      p[n].events = s->connecting ? POLLOUT : POLLIN;
+      map[n++] = i;
+      if(s->recvWanted && s->recvDue && (due == 0 || s->recvDue < due)) due = s->recvDue;
+    }
+    if(Sel.active){                    // wake for the select's sockets too
+      for(i = 0; i < SL_MAX_SOCKETS; i++){
+        s = &Socks[i];
+        if(s->fd < 0 || s->connecting || !(Sel.readFds & (1 << i))) continue;
+        p[n].fd = s->fd;
+        p[n].events = POLLIN;
+        map[n++] = i;
+      }
+      if(Sel.due && (due == 0 || Sel.due < due)) due = Sel.due;
+    }
+    timeout = (due == 0) ? -1 : (due <= now) ? 0 : (int)(due - now);
+    if(poll(p, n, timeout) < 0){
+      if(errno == EINTR) continue;
+      Die("poll");
+    }
+
+    if(p[1].revents) Lines();
+    if(p[0].revents & (POLLIN | POLLHUP)) Bus();
+    now = Now();
+    for(i = 2; i < n; i++){
+      s = &Socks[map[i]];
+      if(s->fd < 0) continue;
+      if(s->connecting && p[i].revents){
+        FinishConnect(s);
+      }else if(s->recvWanted && p[i].revents){
+        ServeRecv(s, s->recvWanted);
+      }
+    }
+    for(i = 0; i < SL_MAX_SOCKETS; i++){
+      s = &Socks[i];
+      if(s->fd >= 0 && s->recvWanted && s->recvDue && s->recvDue <= now){
+        s->recvWanted = 0;
+        SendSocket(SL_OPCODE_SOCKET_RECVASYNCRESPONSE, SL_EAGAIN, s->sd);
+      }
+    }
+    CheckSelect(now);
+  }
+}
+
+static void Usage(void){
+  fprintf(stderr, "usage: NwpEmu [-v] [-r] [-a assoc_ms] [-i dhcp_ms] [-n dns_ms] [-c connect_ms]\n"
+                  "              [-t txpool] [-d name=a.b.c.d]... [-p port=hostport]...\n");
+  exit(2);
+}
+
+static void Report(void){
+  if(Verbose){
+    fprintf(stderr, "NwpEmu: %lu commands, %lu messages, %lu flow control dummies\n",
+            CmdCount, MsgCount, DummyCount);
+  }
+}
+
+int main(int argc, char **argv){
+  char *eq;
+  int c, i;
+
+  while((c = getopt(argc, argv, "vra:i:n:c:t:d:p:")) != -1){
+    switch(c){
+      case 'v': Verbose = 1; break;
+      case 'r': NoResolver = 1; break;
+      case 'a': AssocMs = atol(optarg); break;
+      case 'i': DhcpMs = atol(optarg); break;
+      case 'n': DnsMs = atol(optarg); break;
+      case 'c': ConnectMs = atol(optarg); break;
+      case 't': TxPool = atoi(optarg); break;
+      case 'd':
+        eq = strchr(optarg, '=');
+        if(eq == 0 || HostCount == OVERRIDES) Usage();
+        *eq = 0;
+        Hosts[HostCount].name = optarg;
+        if(inet_aton(eq + 1, &Hosts[HostCount].addr) == 0) Usage();
+        HostCount++;
+        break;
+      case 'p':
+        if(PortCount == OVERRIDES || sscanf(optarg, "%hu=%hu", &Ports[PortCount].from, &Ports[PortCount].to) != 2) Usage();
+        PortCount++;
+        break;
+      default: Usage();
+    }
+  }
+  if(TxPool <= FLOW_CONT_MIN + 1 || TxPool > 255) Usage();
+  if(fcntl(SPI_FD, F_GETFD) < 0 || fcntl(LINES_FD, F_GETFD) < 0){
+    fprintf(stderr, "NwpEmu: run by spi_Open(), which passes the bus on fds 3 and 4\n");
+    return 2;
+  }
+  for(i = 0; i < SL_MAX_SOCKETS; i++) Socks[i].fd = -1;
+  atexit(Report);
+  Loop();
+  return 0;
+}
@@ -0,0 +1,162 @@
+// Filter.c
+// Runs on LM4F120/TM4C123
+// Streaming filters for 12-bit ADC samples: running median,
+// one-pole IIR low pass and decimating moving average.  See
+// Filter.h for how to use them.
+
+#include "Filter.h"
+
+//********Median_Init*****************
+// Start a running median filter
+// inputs: m  filter
+//         n  taps, 3, 5 or 9 (any odd number 1 to MEDMAX)
+// outputs: none
+void Median_Init(MedTyp *m, unsigned char n){
+  if(n > MEDMAX){
+    n = MEDMAX;
+  }
+  m->n = n|1;                   // odd, so there is a middle
+  m->count = 0;
+  m->next = 0;
+}
+
+//********Median_In*****************
+// Add one sample, replacing the oldest in the sorted window
+// inputs: m  filter
+//         x  sample
+// outputs: median of the last n samples
+unsigned long Median_In(MedTyp *m, unsigned long x){
+  int lo, hi, mid, i;
+  unsigned short old;
+  if(m->count == m->n){
+    // find the oldest sample in Sorted[], binary search
+    old = m->Window[m->next];
+    lo = 0;
+    hi = m->count - 1;
+    while(lo < hi){
+      mid = (lo + hi)>>1;
+      if(m->Sorted[mid] < old){
+        lo = mid + 1;
+      } else{
+        hi = mid;
+      }
+    }
+    // slide the new sample from there to where it belongs
+    i = lo;
+    if(x > old){
+      while((i < m->count-1) && (m->Sorted[i+1] < x)){
+        m->Sorted[i] = m->Sorted[i+1];
+        i = i + 1;
+      }
+    } else{
+      while((i > 0) && (m->Sorted[i-1] > x)){
+        m->Sorted[i] = m->Sorted[i-1];
+        i = i - 1;
+      }
+    }
+    m->Sorted[i] = x;
+  } else{
+    // still filling, insert in place
+    for(i=m->count; (i > 0) && (m->Sorted[i-1] > x); i=i-1){
+      m->Sorted[i] = m->Sorted[i-1];
+    }
+    m->Sorted[i] = x;
+    m->count = m->count + 1;
+  }
+  m->Window[m->next] = x;
+  m->next = m->next + 1;
+  if(m->next == m->n){
+    m->next = 0;
+  }
+  return m->Sorted[m->count>>1];
+}
+
+//********Median_Block*****************
+// Median_In for each sample of a block, in may equal out
+// inputs: m    filter
+//         in   samples
+//         out  one median per sample
+//         n    number of samples
+// outputs: none
+void Median_Block(MedTyp *m, const unsigned short *in, unsigned short *out, unsigned long n){
+  unsigned long i;
+  for(i=0; i<n; i=i+1){
+    out[i] = Median_In(m, in[i]);
+  }
+}
+
+//********IIR_Init*****************
+// Start a one-pole low pass filter, time constant about 2^k samples
+// inputs: f  filter
+//         k  1 to 8, bigger is smoother and slower
+// outputs: none
+void IIR_Init(IIRTyp *f, unsigned char k){
+  f->k = k;
+  f->y = 0;
+  f->primed = 0;
+}
+
+//********IIR_In*****************
+// Add one sample, y = y + (x - y)/2^k with y kept to 1/256
+// inputs: f  filter
+//         x  sample
+// outputs: filtered value, rounded
+unsigned long IIR_In(IIRTyp *f, unsigned long x){
+  long x8 = (long)x<<8;
+  if(f->primed == 0){
+    f->y = x8;
+    f->primed = 1;
+  } else{
+    f->y = f->y + ((x8 - f->y)>>f->k);  // arithmetic shift rounds toward -infinity
+  }
+  return (f->y + 128)>>8;
+}
+
+//********IIR_Block*****************
+// IIR_In for each sample of a block, in may equal out
+// inputs: f    filter
+//         in   samples
+//         out  one output per sample
+//         n    number of samples
+// outputs: none
+void IIR_Block(IIRTyp *f, const unsigned short *in, unsigned short *out, unsigned long n){
+  unsigned long i;
+  for(i=0; i<n; i=i+1){
+    out[i] = IIR_In(f, in[i]);
+  }
+}
+
+//********Decimate_Init*****************
+// Start a decimating moving average
+// inputs: d      filter
+//         shift  averages 2^shift samples, 0 to 8
+// outputs: none
+void Decimate_Init(DecTyp *d, unsigned char shift){
+  d->shift = shift;
+  d->sum = 0;
+  d->count = 0;
+}
+
+//********Decimate_Block*****************
+// Average each 2^shift samples, carrying leftovers to the next block
+// inputs: d    filter
+//         in   samples
+//         n    number of samples
+//         out  room for n/2^shift + 1 averages, may equal in
+// outputs: number of averages written to out
+unsigned long Decimate_Block(DecTyp *d, const unsigned short *in, unsigned long n, unsigned short *out){
+  unsigned long i, m = 0, sum = d->sum, count = d->count, size = 1UL<<d->shift;
+  for(i=0; i<n; i=i+1){
+    sum = sum + in[i];
+    count = count + 1;
+    if(count == size){
+      out[m] = (sum + (size>>1))>>d->shift;   // rounded
+      m = m + 1;
+      sum = 0;
+      count = 0;
+    }
+  }
+  d->sum = sum;
+  d->count = count;
+  return m;
+}
@@ -0,0 +1,107 @@
+// Filter.h
+// Runs on LM4F120/TM4C123
+// Streaming filters for 12-bit ADC samples, such as the slide
+// pot on PE2.  Each filter keeps its state in a struct, so there
+// can be as many as needed, and each can take one sample at a
+// time (from SysTick_Handler, say) or a whole block (such as
+// one from a uDMA ring).  No division, no floating point, no
+// malloc.
+//   Median    running median of the last 3, 5 or 9 samples,
+//             throws away spikes without smearing steps
+//   IIR       one-pole low pass, y = y + (x - y)/2^k
+//   Decimate  average of each 2^shift samples, one output
+//             per 2^shift inputs
+
+// most taps in a median filter
+#define MEDMAX  9
+
+struct Median {
+  unsigned char n;                // taps, odd, 1 to MEDMAX
+  unsigned char count;            // samples in the window, up to n
+  unsigned char next;             // Window[] slot for the next sample, the oldest once full
+  unsigned short Window[MEDMAX];  // samples in the order they came
+  unsigned short Sorted[MEDMAX];  // the same samples, smallest first
+};
+typedef struct Median MedTyp;
+
+struct IIR {
+  long y;                         // output times 256
+  unsigned char k;                // alpha is 1/2^k
+  unsigned char primed;           // 0 until the first sample
+};
+typedef struct IIR IIRTyp;
+
+struct Decimate {
+  unsigned long sum;              // samples so far toward the next output
+  unsigned short count;
+  unsigned char shift;            // averages 2^shift samples
+};
+typedef struct Decimate DecTyp;
+
+//********Median_Init*****************
+// Start a running median filter
+// inputs: m  filter
+//         n  taps, 3, 5 or 9 (any odd number 1 to MEDMAX)
+// outputs: none
+void Median_Init(MedTyp *m, unsigned char n);
+
+//********Median_In*****************
+// Add one sample.  The oldest sample leaves the sorted window
+// and the new one goes in its place, found by binary search,
+// so the window is never sorted from scratch.  Until n samples
+// have come in, the median is of the ones there are.
+// inputs: m  filter
+//         x  sample
+// outputs: median of the last n samples
+unsigned long Median_In(MedTyp *m, unsigned long x);
+
+//********Median_Block*****************
+// Median_In for each sample of a block, in may equal out
+// inputs: m    filter
+//         in   samples
+//         out  one median per sample
+//         n    number of samples
+// outputs: none
+void Median_Block(MedTyp *m, const unsigned short *in, unsigned short *out, unsigned long n);
+
+//********IIR_Init*****************
+// Start a one-pole low pass filter, time constant about 2^k samples
+// inputs: f  filter
+//         k  1 to 8, bigger is smoother and slower
+// outputs: none
+void IIR_Init(IIRTyp *f, unsigned char k);
+
+//********IIR_In*****************
+// Add one sample.  The first sample sets the output, so it
+// does not ramp up from 0.
+// inputs: f  filter
+//         x  sample
+// outputs: filtered value, rounded
+unsigned long IIR_In(IIRTyp *f, unsigned long x);
+
+//********IIR_Block*****************
+// IIR_In for each sample of a block, in may equal out
+// inputs: f    filter
+//         in   samples
+//         out  one output per sample
+//         n    number of samples
+// outputs: none
+void IIR_Block(IIRTyp *f, const unsigned short *in, unsigned short *out, unsigned long n);
+
+//********Decimate_Init*****************
+// Start a decimating moving average
+// inputs: d      filter
+//         shift  averages 2^shift samples, 0 to 8
+// outputs: none
+void Decimate_Init(DecTyp *d, unsigned char shift);
+
+//********Decimate_Block*****************
+// Average each 2^shift samples.  Samples left over at the end of
+// a block are carried into the next one, so blocks do not have
+// to be a multiple of 2^shift.
+// inputs: d    filter
+//         in   samples
+//         n    number of samples
+//         out  room for n/2^shift + 1 averages, may equal in
+// outputs: number of averages written to out
+unsigned long Decimate_Block(DecTyp *d, const unsigned short *in, unsigned long n, unsigned short *out);
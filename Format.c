@@ -0,0 +1,203 @@
+// Format.c
+// Runs on LM4F120/TM4C123, or any C compiler
+// Integer and fixed-point to ASCII conversion without the divide
+// instruction, see Format.h.
+// n/100 is (n*0x51EB851F)>>37, exact for every 32-bit n because
+// 0x51EB851F*100 is 2^37+28 and 28*2^32 < 2^37.  The remainder
+// picks two digits out of Digits2[].  n/10 is (n*0xCCCCCCCD)>>35
+// for the same reason.
+
+#include "Format.h"
+
+static const char Digits2[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+#define DIV100(n) ((unsigned long)(((unsigned long long)(n)*0x51EB851FULL)>>37))
+#define DIV10(n)  ((unsigned long)(((unsigned long long)(n)*0xCCCCCCCDULL)>>35))
+
+// Number of decimal digits in n, 1 to 10
+static int count(unsigned long n){
+  if(n < 100000){
+    if(n < 100) return (n < 10) ? 1 : 2;
+    if(n < 10000) return (n < 1000) ? 3 : 4;
+    return 5;
+  }
+  if(n < 10000000) return (n < 1000000) ? 6 : 7;
+  if(n < 1000000000) return (n < 100000000) ? 8 : 9;
+  return 10;
+}
+
+// Write the digits of n so the last one is just before end
+static void digits(char *end, unsigned long n){
+  unsigned long q;
+  const char *d;
+  while(n >= 100){
+    q = DIV100(n);
+    d = &Digits2[2*(n - 100*q)];
+    end = end - 2;
+    end[0] = d[0];
+    end[1] = d[1];
+    n = q;
+  }
+  if(n >= 10){
+    d = &Digits2[2*n];
+    end[-2] = d[0];
+    end[-1] = d[1];
+  } else{
+    end[-1] = '0' + n;
+  }
+}
+
+// Write count copies of c and return the position after them
+static char *fill(char *dst, char c, int count){
+  while(count > 0){
+    *dst = c;
+    dst = dst + 1;
+    count = count - 1;
+  }
+  return dst;
+}
+
+//------------Fmt_UDec------------
+// Unsigned decimal, right-justified
+// Input: buf    at least FMTMAX bytes, or width+1 if width is larger
+//        n      32-bit unsigned number
+//        width  0 for just the digits, else the field size
+//        pad    ' ' or '0'
+// Output: characters written, not counting the null
+int Fmt_UDec(char *buf, unsigned long n, int width, char pad){
+  int k = count(n);
+  if(width == 0){
+    width = k;
+  }
+  if(k > width){
+    fill(buf, '*', width);
+  } else{
+    fill(buf, pad, width - k);
+    digits(&buf[width], n);
+  }
+  buf[width] = 0;
+  return width;
+}
+
+//------------Fmt_SDec------------
+// Signed decimal, right-justified, '-' for negative numbers
+// Input: buf    at least FMTMAX bytes, or width+1 if width is larger
+//        n      32-bit signed number
+//        width  0 for just the sign and digits, else the field size
+//        pad    ' ' before the sign, or '0' after it
+// Output: characters written, not counting the null
+int Fmt_SDec(char *buf, long n, int width, char pad){
+  unsigned long u = (n < 0) ? 0UL - (unsigned long)n : (unsigned long)n;
+  int sign = (n < 0), k = count(u) + sign;
+  char *p = buf;
+  if(width == 0){
+    width = k;
+  }
+  if(k > width){
+    fill(buf, '*', width);
+  } else{
+    if(pad != '0'){
+      p = fill(p, pad, width - k);
+    }
+    if(sign){
+      *p = '-';
+      p = p + 1;
+    }
+    if(pad == '0'){
+      fill(p, '0', width - k);
+    }
+    digits(&buf[width], u);
+  }
+  buf[width] = 0;
+  return width;
+}
+
+//------------Fmt_Fix------------
+// Unsigned decimal fixed-point "d.ddd" with a unit suffix
+// Input: buf    big enough for the number and the unit
+//        n      32-bit unsigned number in units of 10^-frac
+//        width  digits in front of the point, 0 for as many as needed
+//        frac   digits after the point, 0 to 9
+//        unit   string put after the number, or 0
+// Output: characters written, not counting the null
+int Fmt_Fix(char *buf, unsigned long n, int width, int frac, const char *unit){
+  unsigned long q;
+  const char *d;
+  int whole, i;
+  char *p;
+  if(frac > 9){
+    frac = 9;
+  }
+  whole = count(n) - frac;
+  if(whole < 1){                        // 0.0ddd
+    whole = 1;
+  }
+  if(width == 0){
+    width = whole;
+  }
+  p = &buf[width + (frac ? frac + 1 : 0)];
+  if(whole > width){
+    fill(buf, '*', width);
+    if(frac){
+      buf[width] = '.';
+      fill(&buf[width+1], '*', frac);
+    }
+  } else{
+    i = frac;                           // fraction from the right, zeros included
+    if(i&1){
+      q = DIV10(n);
+      p[-1] = '0' + (n - 10*q);
+      n = q;
+      i = i - 1;
+    }
+    while(i > 0){
+      q = DIV100(n);
+      d = &Digits2[2*(n - 100*q)];
+      p[-frac-2+i] = d[0];
+      p[-frac-1+i] = d[1];
+      n = q;
+      i = i - 2;
+    }
+    if(frac){
+      buf[width] = '.';
+    }
+    fill(buf, ' ', width - whole);
+    digits(&buf[width], n);
+  }
+  while(unit && *unit){
+    *p = *unit;
+    p = p + 1;
+    unit = unit + 1;
+  }
+  *p = 0;
+  return p - buf;
+}
+
+//------------Fmt_Hex------------
+// Unsigned hexadecimal, upper case, zero padded
+// Input: buf     at least FMTMAX bytes
+//        n       32-bit unsigned number
+//        digits  least number of digits, 1 to 8
+// Output: characters written, not counting the null
+int Fmt_Hex(char *buf, unsigned long n, int digits){
+  int k = 8, i;
+  n = n&0xFFFFFFFF;
+  while((k > digits) && ((n>>(4*(k-1))) == 0)){
+    k = k - 1;                          // drop leading zeros
+  }
+  for(i=0; i<k; i=i+1){
+    buf[i] = "0123456789ABCDEF"[(n>>(4*(k-1-i)))&0x0F];
+  }
+  buf[k] = 0;
+  return k;
+}
@@ -0,0 +1,63 @@
+// Format.h
+// Runs on LM4F120/TM4C123, or any C compiler
+// Integer and fixed-point to ASCII conversion without the divide
+// instruction.  Digits come out two at a time from a 100 entry
+// table, and n/100 is a multiply by the reciprocal (one UMULL),
+// so a 5 digit number costs 2 multiplies instead of 8 divides.
+// Every function writes into the caller's buffer, adds the null,
+// and returns the number of characters before the null.
+// Numbers are 32 bits.
+
+// most characters any function here writes, including the null
+// (11 digits and sign, point, plus the unit string for Fmt_Fix)
+#define FMTMAX  13
+
+//------------Fmt_UDec------------
+// Unsigned decimal, right-justified
+// Input: buf    at least FMTMAX bytes, or width+1 if width is larger
+//        n      32-bit unsigned number
+//        width  0 for just the digits, else the field size;
+//               numbers that do not fit are all '*'
+//        pad    ' ' or '0', fills the field in front of the digits
+// Output: characters written, not counting the null
+// Examples  Fmt_UDec(s,31,4,' ')    "  31"
+//           Fmt_UDec(s,31,4,'0')    "0031"
+//           Fmt_UDec(s,10000,4,' ') "****"
+int Fmt_UDec(char *buf, unsigned long n, int width, char pad);
+
+//------------Fmt_SDec------------
+// Signed decimal, right-justified, '-' for negative numbers
+// Input: buf    at least FMTMAX bytes, or width+1 if width is larger
+//        n      32-bit signed number
+//        width  0 for just the sign and digits, else the field size
+//               counting the sign; numbers that do not fit are all '*'
+//        pad    ' ' puts the spaces before the sign, '0' puts the
+//               zeros after it
+// Output: characters written, not counting the null
+// Examples  Fmt_SDec(s,-31,5,' ')   "  -31"
+//           Fmt_SDec(s,-31,5,'0')   "-0031"
+int Fmt_SDec(char *buf, long n, int width, char pad);
+
+//------------Fmt_Fix------------
+// Unsigned decimal fixed-point "d.ddd" with a unit suffix
+// Input: buf    at least FMTMAX+strlen(unit) bytes, or more if width is larger
+//        n      32-bit unsigned number in units of 10^-frac
+//        width  digits in front of the point, right-justified with
+//               spaces, at least 1; numbers that do not fit have
+//               every digit replaced by '*'.  0 for as many as needed
+//        frac   digits after the point, 0 to 9, 0 means no point
+//        unit   string put after the number, such as " cm", or 0
+// Output: characters written, not counting the null
+// Examples  Fmt_Fix(s,31,1,3," cm")    "0.031 cm"
+//           Fmt_Fix(s,2210,1,3," cm")  "2.210 cm"
+//           Fmt_Fix(s,10000,1,3," cm") "*.*** cm"
+int Fmt_Fix(char *buf, unsigned long n, int width, int frac, const char *unit);
+
+//------------Fmt_Hex------------
+// Unsigned hexadecimal, upper case, zero padded
+// Input: buf     at least FMTMAX bytes
+//        n       32-bit unsigned number
+//        digits  least number of digits, 1 to 8
+// Output: characters written, not counting the null
+// Examples  Fmt_Hex(s,0x2A,4)  "002A"
+int Fmt_Hex(char *buf, unsigned long n, int digits);
@@ -0,0 +1,261 @@
+// FormatTest.c
+// Runs on a PC, not on the LaunchPad
+// Checks Format.c against the routines it replaced and against
+// sprintf, then times the old and new call sites.
+//   UART_ConvertUDec and UART_ConvertDistance (Lab11) for every
+//     n from 0 to 99999
+//   Nokia5110_OutUDec (Lab14, Lab15) for every 16-bit n
+//   Fmt_UDec, Fmt_SDec, Fmt_Hex and Fmt_Fix against sprintf for
+//     0 to 99999, the powers of ten and the 32-bit limits
+// The old routines are copied here as they were, with
+// Nokia5110_OutChar writing into a string instead of the LCD.
+// gcc turns a divide by a constant into a multiply, so on the PC
+// the old routines already get the reciprocal for free.  Build
+// with -DUDIV to make the divisors variables; then every / and %
+// is a divide instruction, which is what the Keil projects
+// (optimization level 0) do with UDIV on the TM4C123.
+//
+// build (from this folder):
+//   gcc -O2 -I.. -o FormatTest FormatTest.c ../Format.c
+//   gcc -O2 -DUDIV -I.. -o FormatTest FormatTest.c ../Format.c
+// usage: FormatTest [-n passes]   (default 50 benchmark passes)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Format.h"
+
+static char String[10], Old[16], New[16];
+static int Errors;
+
+#ifdef UDIV
+static volatile unsigned long D10 = 10, D100 = 100, D1000 = 1000, D10000 = 10000;
+#else
+#define D10     10
+#define D100    100
+#define D1000   1000
+#define D10000  10000
+#endif
+
+// ************ old Lab11_UART/UART.c ************
+void Old_ConvertUDec(unsigned long n){
+  if(n < 10){
+    String[0] = ' '; String[1] = ' '; String[2] = ' ';
+    String[3] = 0x30 + n;
+  } else if(9 < n && n < 100){
+    String[0] = ' '; String[1] = ' ';
+    String[2] = 0x30 + n/D10;
+    String[3] = 0x30 + n%D10;
+  } else if(99 < n && n < 1000){
+    String[0] = ' ';
+    String[1] = 0x30 + n/D100;
+    String[2] = 0x30 + (n/D10)%D10;
+    String[3] = 0x30 + n%D10;
+  } else if(999 < n && n < 10000){
+    String[0] = 0x30 + n/D1000;
+    String[1] = 0x30 + (n/D100)%D10;
+    String[2] = 0x30 + (n/D10)%D10;
+    String[3] = 0x30 + n%D10;
+  } else{
+    String[0] = '*'; String[1] = '*'; String[2] = '*'; String[3] = '*';
+  }
+  String[4] = ' ';
+  String[5] = '\0';
+}
+void Old_ConvertDistance(unsigned long n){
+  if(n < 1000){
+    String[0] = '0';
+    String[1] = '.';
+    if(n < 10){
+      String[2] = '0'; String[3] = '0';
+      String[4] = 0x30 + n;
+    } else if(n > 9 && n < 100){
+      String[2] = '0';
+      String[3] = 0x30 + n/D10;
+      String[4] = 0x30 + n%D10;
+    } else if(n > 99){
+      String[2] = 0x30 + n/D100;
+      String[3] = 0x30 + (n/D10)%D10;
+      String[4] = 0x30 + n%D10;
+    }
+  } else{
+    if(n < 10000){
+      String[0] = 0x30 + n/D1000;
+      String[1] = '.';
+      String[2] = 0x30 + (n/D100)%D10;
+      String[3] = 0x30 + (n/D10)%D10;
+      String[4] = 0x30 + n%D10;
+    } else{
+      String[0] = '*'; String[1] = '.';
+      String[2] = '*'; String[3] = '*'; String[4] = '*';
+    }
+  }
+  String[5] = ' '; String[6] = 'c'; String[7] = 'm'; String[8] = '\0';
+}
+
+// ************ old Nokia5110.c ************
+static char *Lcd;
+void OutChar(unsigned char c){
+  *Lcd = c;
+  Lcd = Lcd + 1;
+  *Lcd = 0;
+}
+void OutString(char *ptr){
+  while(*ptr){
+    OutChar((unsigned char)*ptr);
+    ptr = ptr + 1;
+  }
+}
+void Old_OutUDec(unsigned short n){
+  if(n < 10){
+    OutString("    ");
+    OutChar(n+'0');
+  } else if(n<100){
+    OutString("   ");
+    OutChar(n/D10+'0');
+    OutChar(n%D10+'0');
+  } else if(n<1000){
+    OutString("  ");
+    OutChar(n/D100+'0');
+    n = n%D100;
+    OutChar(n/D10+'0');
+    OutChar(n%D10+'0');
+  } else if(n<10000){
+    OutChar(' ');
+    OutChar(n/D1000+'0');
+    n = n%D1000;
+    OutChar(n/D100+'0');
+    n = n%D100;
+    OutChar(n/D10+'0');
+    OutChar(n%D10+'0');
+  } else{
+    OutChar(n/D10000+'0');
+    n = n%D10000;
+    OutChar(n/D1000+'0');
+    n = n%D1000;
+    OutChar(n/D100+'0');
+    n = n%D100;
+    OutChar(n/D10+'0');
+    OutChar(n%D10+'0');
+  }
+}
+
+// ************ the same three on Format.c ************
+void New_ConvertUDec(unsigned long n){
+  Fmt_UDec(String, n, 4, ' ');
+  String[4] = ' ';
+  String[5] = 0;
+}
+void New_ConvertDistance(unsigned long n){
+  Fmt_Fix(String, n, 1, 3, " cm");
+}
+void New_OutUDec(unsigned short n){
+  char s[6];
+  Fmt_UDec(s, n, 5, ' ');
+  OutString(s);
+}
+
+static void check(const char *what, unsigned long n, const char *want, const char *got, int len){
+  if(strcmp(want, got) || ((len >= 0) && (len != (int)strlen(got)))){
+    if(Errors < 20){
+      printf("%s(%lu): want \"%s\" got \"%s\" returned %d\n", what, n, want, got, len);
+    }
+    Errors = Errors + 1;
+  }
+}
+
+// Check the four kernels against sprintf for one number
+static void against(unsigned long n){ char want[32], got[32];
+  int len, w;
+  long s = (long)n;
+  len = Fmt_UDec(got, n, 0, ' ');
+  sprintf(want, "%lu", n);            check("Fmt_UDec", n, want, got, len);
+  for(w=1; w<=12; w=w+1){
+    len = Fmt_UDec(got, n, w, '0');
+    sprintf(want, "%0*lu", w, n);
+    if((int)strlen(want) > w) memset(want, '*', w), want[w] = 0;
+    check("Fmt_UDec 0", n, want, got, len);
+  }
+  len = Fmt_SDec(got, s, 0, ' ');
+  sprintf(want, "%ld", s);            check("Fmt_SDec", n, want, got, len);
+  len = Fmt_SDec(got, -s, 12, ' ');
+  sprintf(want, "%12ld", -s);         check("Fmt_SDec -", n, want, got, len);
+  len = Fmt_SDec(got, -s, 12, '0');
+  sprintf(want, "%012ld", -s);        check("Fmt_SDec 0", n, want, got, len);
+  len = Fmt_Hex(got, n, 4);
+  sprintf(want, "%04lX", n);          check("Fmt_Hex", n, want, got, len);
+  len = Fmt_Fix(got, n, 0, 3, " cm");
+  sprintf(want, "%lu.%03lu cm", n/1000, n%1000); check("Fmt_Fix", n, want, got, len);
+  len = Fmt_Fix(got, n, 3, 2, 0);
+  if(n < 100000){
+    sprintf(want, "%3lu.%02lu", n/100, n%100);
+  } else{
+    strcpy(want, "***.**");
+  }
+  check("Fmt_Fix 3", n, want, got, len);
+  len = Fmt_Fix(got, n, 0, 0, "mV");
+  sprintf(want, "%lumV", n);          check("Fmt_Fix 0", n, want, got, len);
+}
+
+int main(int argc, char **argv){
+  unsigned long n, p, passes = 50;
+  unsigned long edge[] = {0, 9, 10, 99, 100, 999, 1000, 9999, 10000, 65535, 99999, 100000,
+    999999, 1000000, 9999999, 10000000, 99999999, 100000000, 999999999, 1000000000,
+    2147483647, 2147483648UL, 4000000000UL, 4294967295UL};
+  char got[32];
+  clock_t start;
+  double told[3], tnew[3];
+  volatile char sink;
+  if((argc > 2) && (strcmp(argv[1], "-n") == 0)){
+    passes = strtoul(argv[2], 0, 0);
+  }
+  for(n=0; n<=99999; n=n+1){
+    Old_ConvertUDec(n);     strcpy(Old, String);
+    New_ConvertUDec(n);     check("UART_ConvertUDec", n, Old, String, -1);
+    Old_ConvertDistance(n); strcpy(Old, String);
+    New_ConvertDistance(n); check("UART_ConvertDistance", n, Old, String, -1);
+    against(n);
+  }
+  for(n=0; n<=65535; n=n+1){
+    Lcd = Old; Old[0] = 0; Old_OutUDec(n);
+    Lcd = New; New[0] = 0; New_OutUDec(n);
+    check("Nokia5110_OutUDec", n, Old, New, -1);
+  }
+  for(n=0; n<sizeof(edge)/sizeof(edge[0]); n=n+1){
+    against(edge[n]);
+    Fmt_Hex(got, edge[n], 8);
+    sprintf(Old, "%08lX", edge[n]);
+    check("Fmt_Hex 8", edge[n], Old, got, -1);
+  }
+  Fmt_SDec(got, -2147483647L-1, 0, ' ');
+  check("Fmt_SDec", 0, "-2147483648", got, -1);
+  printf("%d errors\n", Errors);
+
+  // time each old routine and its replacement over the numbers it
+  // can show, 0..9999 for the UART ones and 0..65535 for the LCD
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=9999; n=n+1){ Old_ConvertUDec(n); sink = String[0]; }
+  told[0] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=9999; n=n+1){ New_ConvertUDec(n); sink = String[0]; }
+  tnew[0] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=9999; n=n+1){ Old_ConvertDistance(n); sink = String[0]; }
+  told[1] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=9999; n=n+1){ New_ConvertDistance(n); sink = String[0]; }
+  tnew[1] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=65535; n=n+1){ Lcd = Old; Old_OutUDec(n); sink = Old[0]; }
+  told[2] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(p=0; p<passes; p=p+1) for(n=0; n<=65535; n=n+1){ Lcd = New; New_OutUDec(n); sink = New[0]; }
+  tnew[2] = (double)(clock()-start)/CLOCKS_PER_SEC;
+  (void)sink;
+  printf("%lu passes          old (ns/call)  new (ns/call)\n", passes);
+  printf("UART_ConvertUDec     %8.1f       %8.1f\n", 1e9*told[0]/(passes*10000.0), 1e9*tnew[0]/(passes*10000.0));
+  printf("UART_ConvertDistance %8.1f       %8.1f\n", 1e9*told[1]/(passes*10000.0), 1e9*tnew[1]/(passes*10000.0));
+  printf("Nokia5110_OutUDec    %8.1f       %8.1f\n", 1e9*told[2]/(passes*65536.0), 1e9*tnew[2]/(passes*65536.0));
+  return Errors ? 1 : 0;
+}
@@ -26,30 +26,19 @@
 // U0Tx (PA1) connected to serial port on PC
 // Ground connected ground in the USB cable
 
-#include "tm4c123gh6pm.h"
 #include "UART.h"
+#include "UARTbuf.h"
+#include "Format.h"
 
 //------------UART_Init------------
 // Initialize the UART for 115200 baud rate (assuming 80 MHz UART clock),
 // 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Output goes through the interrupt driven rings in UARTbuf.c,
+// so it only waits when 511 bytes are already queued
 // Input: none
 // Output: none
 void UART_Init(void){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-//                 switching from PC5,PC4 to PA1,PA0
-  SYSCTL_RCGC1_R |= SYSCTL_RCGC1_UART0; // activate UART0
-  SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
-  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
-  UART0_IBRD_R = 43;                    // IBRD = int(80,000,000 / (16 * 115200)) = int(43.402778)
-  UART0_FBRD_R = 26;                    // FBRD = round(0.402778 * 64) = 26
-                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
-  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-  UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
-  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1,PA0
-  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1,PA0
-                                        // configure PA1,PA0 as UART0
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
-  GPIO_PORTA_AMSEL_R &= ~0x03;          // disable analog functionality on PA1,PA0
+  UARTbuf_Init(115200, 1);              // UART0 on PA1,PA0, long strings by uDMA
 }
 
 //------------UART_InChar------------
@@ -57,9 +46,7 @@ void UART_Init(void){
 // Input: none
 // Output: ASCII code for key typed
 unsigned char UART_InChar(void){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  while((UART0_FR_R&UART_FR_RXFE) != 0);
-  return((unsigned char)(UART0_DR_R&0xFF));
+  return UARTbuf_InChar();
 }
 
 //------------UART_InCharNonBlocking------------
@@ -67,10 +54,9 @@ unsigned char UART_InChar(void){
 // if there is no data.
 // Input: none
 // Output: ASCII code for key typed or 0 if no character
-unsigned char UART_InCharNonBlocking(void){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  if((UART0_FR_R&UART_FR_RXFE) == 0){
-    return((unsigned char)(UART0_DR_R&0xFF));
+unsigned char UART_InCharNonBlocking(void){ unsigned char data;
+  if(UARTbuf_Read(&data, 1)){
+    return data;
   } else{
     return 0;
   }
@@ -81,9 +67,7 @@ unsigned char UART_InCharNonBlocking(void){
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART_OutChar(unsigned char data){
-// as part of Lab 11, modify this program to use UART0 instead of UART1
-  while((UART0_FR_R&UART_FR_TXFF) != 0);
-  UART0_DR_R = data;
+  UARTbuf_OutChar(data);
 }
 
 //------------UART_InUDec------------
@@ -143,48 +127,9 @@ unsigned char String[10];
 // 2210 to "2210 "
 //10000 to "**** "  any value larger than 9999 converted to "**** "
 void UART_ConvertUDec(unsigned long n){
-// as part of Lab 11 implement this function
-  
-	if (n < 10) {
-		String [0] = ' ';
-		String [1] = ' ';
-		String [2] = ' ';
-		String [3] = 0x30 + n;
-	}
-	
-	else if (9 < n && n < 100) {
-		String [0] = ' ';
-		String [1] = ' ';
-		String [2] = 0x30 + n/10;
-		String [3] = 0x30 + n%10;
-	}
-	
-	else if (99 < n && n < 1000) {
-		String [0] = ' ';
-		String [1] = 0x30 + n/100;
-		String [2] = 0x30 + (n/10)%10;
-		String [3] = 0x30 + n%10;
-	}
-	
-	else if (999 < n && n < 10000) {
-		String [0] = 0x30 + n/1000;
-		String [1] = 0x30 + (n/100)%10;
-		String [2] = 0x30 + (n/10)%10;
-		String [3] = 0x30 + n%10;
-	}
-	
-	else {   //this is the case that n > 9999 
-		String[0]='*';
-		String[1]='*';	
-		String[2]='*';
-		String[3]='*';
-	}
-	
-	String[4]=' ';
-	String[5]='\0'; /*using C-style zero-terminated strings. 
-	Basically set the final character in the string to NUL ('\0')
-	 doing zero-terminated can reset the char values beyond the terminated point. 
-	 See onenote for more reference */
+  Fmt_UDec((char *)String, n, 4, ' ');  // "****" if more than 4 digits
+  String[4] = ' ';
+  String[5] = 0;
 }
 
 
@@ -210,52 +155,7 @@ void UART_OutUDec(unsigned long n){
 // 2210 to "2.210 cm"
 //10000 to "*.*** cm"  any value larger than 9999 converted to "*.*** cm"
 void UART_ConvertDistance(unsigned long n){
-// as part of Lab 11 implement this function
-  if (n < 1000) {
-		String[0]='0';
-		String[1]='.';
-		
-		if (n < 10) {
-			String[2]='0';
-			String[3]='0';
-			String[4]=0x30 + n;
-		}
-		
-		else if (n > 9 && n <100) {
-			String[2]='0';
-			String[3]=0x30 + n/10;
-			String[4]=0x30 + n%10;
-		}
-
-		else if (n > 99) {
-			String[2]=0x30 + n/100;
-			String[3]=0x30 + (n/10)%10;
-			String[4]=0x30 + n%10;
-		}
-		
-	}
-	
-	else  {  //case that n > 999
-		if (n<10000) {
-			String[0]=0x30 + n/1000;
-			String[1]='.';
-			String[2]=0x30 + (n/100)%10;
-			String[3]=0x30 + (n/10)%10;
-			String[4]=0x30 + n%10;
-		}
-		
-		else {
-			String[0]='*';
-			String[1]='.';
-			String[2]='*';
-			String[3]='*';
-			String[4]='*';
-		}
-	}
-	String[5]=' ';
-	String[6]='c';
-	String[7]='m';
-	String[8]='\0';
+  Fmt_Fix((char *)String, n, 1, 3, " cm");   // "*.*** cm" if more than 9999
 }
 
 //-----------------------UART_OutDistance-----------------------
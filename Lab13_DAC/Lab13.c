@@ -27,7 +27,7 @@ int main(void){ // Real Lab13
   EnableInterrupts();  // enable after all initialization are done
   while(1){                
 // input from keys to select tone
-	
+    Sound_Play(Piano_In()); // every key held gets its own voice
 	}
             
 }
@@ -6,43 +6,121 @@
 // December 29, 2014
 // This routine calls the 4-bit DAC
 
+// Wavetable synthesizer.  SysTick runs at a fixed sample rate,
+// FS, no matter which notes are playing.  Each of the four keys
+// has a voice with a 32-bit phase accumulator; every interrupt
+// the phase advances by f*2^32/FS, the top 6 bits pick one of
+// the 64 wave table entries and the next 8 bits interpolate
+// between it and the next entry.  All keys that are held are
+// mixed together, so chords play.
+
 #include "Sound.h"
 #include "DAC.h"
 #include "..//tm4c123gh6pm.h"
 
+#define FS          20000     // sample rate in Hz
+#define PHASE(f)    ((unsigned long)((f)*4294967296.0/FS))
+#define NVOICES     4         // one voice per key on PE3-0
+#define WAVESIZE    64        // entries in each wave table, must be 2^WAVEBITS
+#define WAVEBITS    6
+#define SILENCE     8         // DAC output with no notes, the middle the wave tables are centered on
+
+// phase step per interrupt for keys 0 to 3
+const unsigned long Step[NVOICES] = {
+  PHASE(523.251),   // C
+  PHASE(587.330),   // D
+  PHASE(659.255),   // E
+  PHASE(783.991)    // G
+};
+
+// one period of each instrument, 0 to 255 with 128 in the middle
+// made from the n=64 columns of dac.xls and the dac_*.xls files
+const unsigned char Wave[INSTRUMENTS][WAVESIZE] = {
+  {  // Sine, from dac.xls
+    128, 140, 152, 165, 176, 188, 198, 208, 218, 226, 234, 240, 245, 250, 253, 254,
+    255, 254, 253, 250, 245, 240, 234, 226, 218, 208, 198, 188, 176, 165, 152, 140,
+    127, 115, 103,  90,  79,  67,  57,  47,  37,  29,  21,  15,  10,   5,   2,   1,
+      0,   1,   2,   5,  10,  15,  21,  29,  37,  47,  57,  67,  79,  90, 103, 115
+  },
+  {  // Guitar, from dac_Guitar.xls
+     85,  85,  85,  80,  65,  45,  25,   5,   0,  10,  35,  70, 115, 150, 175, 190,
+    195, 185, 165, 130,  90,  50,  30,  30,  55, 100, 155, 210, 245, 255, 240, 210,
+    175, 140, 115, 100,  90,  85,  85,  85,  95, 110, 120, 130, 135, 130, 120,  95,
+     75,  50,  40,  35,  40,  50,  50,  50,  50,  50,  55,  65,  75,  85,  85,  85
+  },
+  {  // Bassoon, from dac_basson.xls
+    125, 141, 142, 140, 135, 132, 130, 126, 119, 111, 107, 111, 127, 170, 234, 255,
+    208, 118,  38,   0,   3,  27,  52,  82, 120, 158, 182, 189, 175, 146, 114,  84,
+     57,  37,  31,  47,  81, 122, 154, 166, 152, 121,  96,  85,  85,  89,  91,  91,
+     97, 107, 114, 117, 121, 128, 142, 150, 144, 135, 129, 130, 131, 126, 118, 114
+  },
+  {  // Flute, from dac_flute.xls
+    100, 124, 147, 158, 170, 186, 203, 217, 231, 240, 250, 252, 255, 252, 250, 238,
+    227, 216, 205, 188, 171, 156, 140, 128, 116, 108, 100,  92,  83,  80,  78,  73,
+     68,  69,  70,  67,  63,  60,  57,  54,  51,  44,  37,  30,  23,  19,  14,  10,
+      6,   3,   0,   2,   4,   7,  11,  16,  21,  28,  35,  44,  53,  64,  76,  88
+  },
+  {  // Horn, from dac_horn.xls
+    121, 122, 124, 128, 132, 147, 162, 202, 241, 248, 255, 209, 162, 111,  60,  51,
+     42,  42,  42,  46,  50,  53,  56,  59,  63,  70,  78,  97, 116, 125, 134, 142,
+    149, 161, 173, 186, 199, 207, 215, 204, 192, 208, 223, 202, 181, 153, 125,  88,
+     51,  32,  14,   7,   0,   4,   8,  16,  23,  35,  46,  58,  70,  88, 107, 114
+  },
+  {  // Trumpet, from dac_trumpet.xls
+    164, 171, 179, 185, 192, 195, 197, 190, 175, 149, 123,  78,  32,   8,   0,  32,
+    123, 191, 240, 255, 252, 223, 195, 185, 175, 172, 169, 174, 178, 176, 174, 169,
+    165, 165, 165, 168, 171, 173, 174, 169, 165, 165, 165, 169, 173, 179, 184, 181,
+    178, 177, 177, 177, 177, 180, 182, 181, 179, 175, 172, 169, 165, 168, 171, 167
+  }
+};
+
+// scales the sum of n voices back to one voice, 256 is 1.0
+const unsigned short Gain[NVOICES+1] = {0, 256, 128, 85, 64};
 
-unsigned char Index;
-const unsigned char SineWave[16] = {4,5,6,7,8,9,10,11,12,11,10,9,8,7,6,5};
-unsigned long period=0x05;
-unsigned long SW_current;
-unsigned long SW_old = 0;
+unsigned long Phase[NVOICES];   // phase of each voice, 2^32 is one period
+unsigned long Keys;             // bit i set if voice i is playing
+const unsigned char *Instrument = Wave[SINE];
 
 
 // **************Sound_Init*********************
-// Initialize Systick periodic interrupts
+// Initialize Systick periodic interrupts at FS
 // Also calls DAC_Init() to initialize DAC
 // Input: none
 // Output: none
 void Sound_Init(void){
-	DAC_Init(); // Port B is DAC
-	Index = 0;
-	NVIC_ST_CTRL_R = 0; // disable SysTick during setup
-  NVIC_ST_RELOAD_R = period-1;// reload value
-	NVIC_ST_CURRENT_R = 0; // any write to current clears it
-	NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x20000000; //set priority to 1
-	NVIC_ST_CTRL_R = 0x0007; // enable,core clock, and interrupts
+  DAC_Init(); // Port B is DAC
+  DAC_Out(SILENCE);
+  Keys = 0;
+  NVIC_ST_CTRL_R = 0; // disable SysTick during setup
+  NVIC_ST_RELOAD_R = 80000000/FS-1;// reload value, fixed sample rate
+  NVIC_ST_CURRENT_R = 0; // any write to current clears it
+  NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x20000000; //set priority to 1
+  NVIC_ST_CTRL_R = 0x0007; // enable,core clock, and interrupts
+}
+
+// **************Sound_Instrument*********************
+// Select the wave table used by all voices
+// Input: SINE, GUITAR, BASSOON, FLUTE, HORN or TRUMPET
+// Output: none
+void Sound_Instrument(unsigned char instrument){
+  if(instrument < INSTRUMENTS){
+    Instrument = Wave[instrument];
+  }
 }
 
-// **************Sound_Tone*********************
-// Change Systick periodic interrupts to start sound output
-// Input: interrupt period
-//           Units of period are 12.5ns
-//           Maximum is 2^24-1
-//           Minimum is determined by length of ISR
+// **************Sound_Play*********************
+// Play the notes for the keys that are held
+// Input: 0x01 C, 0x02 D, 0x04 E, 0x08 G, or any combination
+//        0 for silence
 // Output: none
-void Sound_Tone(unsigned long period_local){
-// this routine sets the RELOAD and starts SysTick
-	period = period_local;
+void Sound_Play(unsigned char keys){ int i;
+  keys &= (1<<NVOICES)-1;
+  for(i=0; i<NVOICES; i=i+1){
+    if((keys&~Keys)&(1<<i)){
+      Phase[i] = 0;     // new note starts at the top of the table
+    }
+  }
+  Keys = keys;          // the ISR leaves silent voices alone
 }
 
 
@@ -51,22 +129,30 @@ void Sound_Tone(unsigned long period_local){
 // Output: none
 void Sound_Off(void){
  // this routine stops the sound output
-	GPIO_PORTB_DATA_R &= ~0x0F;
+  Keys = 0;
+  DAC_Out(SILENCE);     // rest at the midpoint, not 0, so there is no click
 }
 
 
 // Interrupt service routine
-// Executed every 12.5ns*(period)
-void SysTick_Handler(void){
-	SW_current = GPIO_PORTE_DATA_R&0x0F;
-	if (SW_current != SW_old) {
-		if (GPIO_PORTE_DATA_R & 0x01) Sound_Tone(80000000/(16*523.251)); //set note C pitch
-		if (GPIO_PORTE_DATA_R & 0x02) Sound_Tone(80000000/(16*587.330)); //set note D pitch
-		if (GPIO_PORTE_DATA_R & 0x04) Sound_Tone(80000000/(16*659.255)); //set note E pitch
-		if (GPIO_PORTE_DATA_R & 0x08) Sound_Tone(80000000/(16*783.991)); //set note G pitch
-		Sound_Init();
-	}
-	Index = (Index+1)&0x0F; // 4,5,6,7,7,7,6,5,4,3,2,1,1,1,2,3...
-	DAC_Out(SineWave[Index]); // output one value each interrupt
-	SW_old = SW_current;
+// Executed every 12.5ns*(80000000/FS), whatever the notes are
+void SysTick_Handler(void){ int i;
+  unsigned long n = 0, frac;
+  long sum = 0, a, b;
+  if(Keys == 0){
+    DAC_Out(SILENCE);
+    return;
+  }
+  for(i=0; i<NVOICES; i=i+1){
+    if(Keys&(1<<i)){
+      a = Instrument[Phase[i]>>(32-WAVEBITS)];
+      b = Instrument[((Phase[i]>>(32-WAVEBITS))+1)&(WAVESIZE-1)];
+      frac = (Phase[i]>>(24-WAVEBITS))&0xFF;
+      sum = sum + a + (((b-a)*(long)frac)>>8) - 128;
+      Phase[i] = Phase[i] + Step[i];
+      n = n + 1;
+    }
+  }
+  sum = 128 + ((sum*Gain[n])>>8);  // 0 to 255
+  DAC_Out(sum>>4);
 }
@@ -5,21 +5,28 @@
 // Daniel Valvano, Jonathan Valvano
 // December 29, 2014
 
+// wave tables for Sound_Instrument
+#define SINE        0
+#define GUITAR      1
+#define BASSOON     2
+#define FLUTE       3
+#define HORN        4
+#define TRUMPET     5
+#define INSTRUMENTS 6
+
 // **************Sound_Init*********************
 // Initialize Systick periodic interrupts
+// at a fixed sample rate, silent
 // Also initializes DAC
 // Input: none
 // Output: none
 void Sound_Init(void);
 
-// **************Sound_Tone*********************
-// Change SysTick periodic interrupts to start sound output
-// Input: interrupt period
-//           Units of period are 12.5ns
-//           Maximum is 2^24-1
-//           Minimum is determined by length of ISR
+// **************Sound_Instrument*********************
+// Select the wave table used by all voices
+// Input: SINE, GUITAR, BASSOON, FLUTE, HORN or TRUMPET
 // Output: none
-void Sound_Tone(unsigned long period);
+void Sound_Instrument(unsigned char instrument);
 
 
 // **************Sound_Off*********************
@@ -28,6 +35,10 @@ void Sound_Tone(unsigned long period);
 void Sound_Off(void);
 
 
-// **************Sound_Off*********************
-// Input: the note. i.e. C, D, E, G
-void Sound_Play (unsigned char note);
+// **************Sound_Play*********************
+// Play the notes for the keys that are held,
+// one voice per key, mixed together
+// Input: 0x01 C, 0x02 D, 0x04 E, 0x08 G, or any combination
+//        0 for silence
+// Output: none
+void Sound_Play(unsigned char keys);
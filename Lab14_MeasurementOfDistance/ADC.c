@@ -3,6 +3,8 @@
 // Provide functions that initialize ADC0 SS3 to be triggered by
 // software and trigger a conversion, wait for it to finish,
 // and return the result. 
+// Also a streaming mode: Timer0A triggers ADC0 SS1 at a fixed
+// rate and uDMA moves the samples into a ring of blocks.
 // Daniel Valvano
 // January 15, 2016
 
@@ -22,16 +24,39 @@
  http://users.ece.utexas.edu/~valvano/
  */
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "ADC.h"
+#ifndef HEADLESS
 #include "..//tm4c123gh6pm.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_adc.h"
+#include "driverlib/adc.h"
+#include "driverlib/udma.h"
+#endif
 
+#ifndef HEADLESS
 // This initialization function sets up the ADC 
 // Max sample rate: <=125,000 samples/second
 // SS3 triggering event: software trigger
 // SS3 1st sample source:  channel 1
 // SS3 interrupts: enabled but not promoted to controller
-void ADC0_Init(void){ 
-  
+void ADC0_Init(void){ volatile unsigned long delay;
+  SYSCTL_RCGC2_R |= 0x00000010;   // 1) activate clock for Port E
+  delay = SYSCTL_RCGC2_R;         //    allow time for clock to stabilize
+  GPIO_PORTE_DIR_R &= ~0x04;      // 2) make PE2 input
+  GPIO_PORTE_AFSEL_R |= 0x04;     // 3) enable alternate function on PE2
+  GPIO_PORTE_DEN_R &= ~0x04;      // 4) disable digital I/O on PE2
+  GPIO_PORTE_AMSEL_R |= 0x04;     // 5) enable analog function on PE2
+  SYSCTL_RCGC0_R |= 0x00010000;   // 6) activate ADC0 
+  delay = SYSCTL_RCGC2_R;         
+  SYSCTL_RCGC0_R &= ~0x00000300;  // 7) configure for 125K 
+  ADC0_SSPRI_R = 0x0123;          // 8) Sequencer 3 is highest priority
+  ADC0_ACTSS_R &= ~0x0008;        // 9) disable sample sequencer 3
+  ADC0_EMUX_R &= ~0xF000;         // 10) seq3 is software trigger
+  ADC0_SSMUX3_R = (ADC0_SSMUX3_R&0xFFFFFFF0)+1; // 11) channel Ain1 (PE2)
+  ADC0_SSCTL3_R = 0x0006;         // 12) no TS0 D0, yes IE0 END0
+  ADC0_ACTSS_R |= 0x0008;         // 13) enable sample sequencer 3
 }
 
 
@@ -39,6 +64,311 @@ void ADC0_Init(void){
 // Busy-wait Analog to digital conversion
 // Input: none
 // Output: 12-bit result of ADC conversion
-unsigned long ADC0_In(void){  
-  return 0; // replace this line with proper code
+unsigned long ADC0_In(void){ unsigned long result;
+  ADC0_PSSI_R = 0x0008;            // 1) initiate SS3
+  while((ADC0_RIS_R&0x08)==0){};   // 2) wait for conversion done
+  result = ADC0_SSFIFO3_R&0xFFF;   // 3) read result
+  ADC0_ISC_R = 0x0008;             // 4) acknowledge completion
+  return result;
+}
+#endif
+
+//***************** streaming mode *****************
+// Each Timer0A timeout starts sequencer 1, which converts Ain1
+// ADCSTEPS times, each one the hardware average of ADCOVERSAMPLE
+// conversions.  The last step asks uDMA channel 15 to move the
+// ADCSTEPS results out of the FIFO.  uDMA runs in ping-pong mode,
+// the primary and alternate structures each filling one block of
+// the ring, so there is never a gap while the ISR re-arms the
+// other one.  Full blocks go on the Ready queue for the foreground
+// and come back on the Free queue when it is done with them.  Each
+// queue has one writer, so neither needs interrupts disabled.
+static unsigned short Ring[ADCNBLOCKS][ADCBLOCK];
+static unsigned char Ready[ADCNBLOCKS];  // full blocks, oldest first
+static volatile unsigned long ReadyHead, ReadyTail;
+static unsigned char Free[ADCNBLOCKS];   // blocks the uDMA can fill
+static volatile unsigned long FreeHead, FreeTail;
+static unsigned char Fill[2];            // block of the primary and alternate structure
+static int Next;                         // structure that finishes next, 0 primary 1 alternate
+static unsigned long Stamp[ADCNBLOCKS];  // time each block was finished
+
+// counters for ADC0_Stats
+static unsigned long Blocks;             // blocks finished, kept or not
+static unsigned long Dropped;            // blocks thrown away because the ring was full
+static unsigned long Interval;           // time between the last two blocks
+static unsigned long LastStamp;
+static unsigned long Latency, LatencyMax;// block finished to foreground, 12.5ns units
+
+#ifdef HEADLESS
+// Host model of sequencer 1 and uDMA channel 15, so the ring,
+// queues and counters can be checked without a board.  Each
+// call to ADC0_ModelTrigger() is one Timer0A timeout.
+static unsigned long ModelTime;          // 12.5ns units
+static unsigned long ModelPeriod;
+static unsigned short Fifo[ADCSTEPS];    // SS1 FIFO is 4 deep
+static int FifoCount;
+static unsigned long FifoOverflow;       // ADCOSTAT, conversions lost
+static unsigned short *DMADst[2];        // primary and alternate
+static unsigned long DMACount[2];        // transfers left, 0 means stopped
+static int DMAActive;                    // structure the next request goes to
+static int DMAOn;                        // channel enabled
+static int DMAInt;                       // DMACHIS bit 15, set until software clears it
+static unsigned long Stuck;              // triggers that left the handler still asserted
+
+static unsigned long now(void){
+  return ModelTime;
+}
+static int dmastopped(int s){
+  return DMACount[s] == 0;
+}
+static void dmaarm(int s, unsigned short *dst){
+  DMADst[s] = dst;
+  DMACount[s] = ADCBLOCK;
+  DMAOn = 1;
+}
+static void dmaack(void){
+  DMAInt = 0;
+}
+
+unsigned long ADC0_ModelOverflow(void){
+  return FifoOverflow;
+}
+
+unsigned long ADC0_ModelStuck(void){
+  return Stuck;
+}
+
+void ADC0_ModelTrigger(const unsigned short *sample){ int i;
+  ModelTime = ModelTime + ModelPeriod;
+  for(i=0; i<ADCSTEPS; i=i+1){           // conversions land in the FIFO
+    if(FifoCount < ADCSTEPS){
+      Fifo[FifoCount] = sample[i]&0xFFF;
+      FifoCount = FifoCount + 1;
+    } else{
+      FifoOverflow = FifoOverflow + 1;   // hardware drops it too
+    }
+  }
+  // IE on the last step is a burst request for ADCSTEPS samples
+  if(DMAOn && (DMACount[DMAActive] >= ADCSTEPS) && (FifoCount == ADCSTEPS)){
+    for(i=0; i<ADCSTEPS; i=i+1){
+      *DMADst[DMAActive] = Fifo[i];
+      DMADst[DMAActive] = DMADst[DMAActive] + 1;
+    }
+    FifoCount = 0;
+    DMACount[DMAActive] = DMACount[DMAActive] - ADCSTEPS;
+    if(DMACount[DMAActive] == 0){        // ping-pong switches structures
+      DMAActive = DMAActive^1;
+      if(DMACount[DMAActive] == 0){
+        DMAOn = 0;                       // both stopped, channel is done
+      }
+      DMAInt = 1;
+    }
+  }
+  if(DMAInt){                            // uDMA completion comes on the SS1 vector
+    ADC0Seq1_Handler();
+    for(i=0; DMAInt && (i<100); i=i+1){
+      ADC0Seq1_Handler();                // a level, the NVIC takes it again right away
+    }
+    if(DMAInt){
+      Stuck = Stuck + 1;
+    }
+  }
+}
+#else
+// uDMA channel control table, must be 1024-byte aligned
+#if defined(ewarm)
+#pragma data_alignment=1024
+static uint8_t DMAControlTable[1024];
+#elif defined(ccs)
+#pragma DATA_ALIGN(DMAControlTable, 1024)
+static uint8_t DMAControlTable[1024];
+#else
+static uint8_t DMAControlTable[1024] __attribute__ ((aligned(1024)));
+#endif
+
+// Timer1A counts down from 2^32-1 and is never reloaded, so
+// negating it gives a clock that counts up 80 times per us
+static unsigned long now(void){
+  return 0 - TIMER1_TAV_R;
+}
+static int dmastopped(int s){
+  return uDMAChannelModeGet(UDMA_CHANNEL_ADC1|(s ? UDMA_ALT_SELECT : UDMA_PRI_SELECT)) == UDMA_MODE_STOP;
+}
+static void dmaarm(int s, unsigned short *dst){
+  uDMAChannelTransferSet(UDMA_CHANNEL_ADC1|(s ? UDMA_ALT_SELECT : UDMA_PRI_SELECT), UDMA_MODE_PINGPONG,
+                         (void *)(ADC0_BASE + ADC_O_SSFIFO1), dst, ADCBLOCK);
+  uDMAChannelEnable(UDMA_CHANNEL_ADC1);
+}
+// DMACHIS bit 15 holds the SS1 interrupt on until it is cleared
+static void dmaack(void){
+  uDMAIntClear(1<<UDMA_CHANNEL_ADC1);
+}
+#endif
+
+//------------ADC0_InitStream------------
+// Start timer-triggered sampling of Ain1 (PE2) into the ring.
+// Uses Timer0A (trigger), Timer1A (time stamps), ADC0 SS1,
+// uDMA channel 15 and the ADC0 SS1 interrupt.
+// Input: period  time between triggers, 12.5ns units,
+//                each trigger gives ADCSTEPS samples
+//                Minimum is ADCSTEPS*ADCOVERSAMPLE*640 (125K ADC)
+// Output: none
+void ADC0_InitStream(unsigned long period){ int i;
+#ifndef HEADLESS
+  volatile unsigned long delay;
+#endif
+  ReadyHead = ReadyTail = 0;
+  for(i=2; i<ADCNBLOCKS; i=i+1){         // blocks 0 and 1 go to the uDMA
+    Free[i-2] = i;
+  }
+  FreeHead = ADCNBLOCKS-2;
+  FreeTail = 0;
+  Fill[0] = 0;
+  Fill[1] = 1;
+  Next = 0;
+  Blocks = Dropped = Interval = Latency = LatencyMax = 0;
+#ifdef HEADLESS
+  ModelTime = 0;
+  ModelPeriod = period;
+  FifoCount = 0;
+  FifoOverflow = 0;
+  DMAActive = 0;
+  DMAInt = 0;
+  Stuck = 0;
+  dmaarm(0, Ring[0]);
+  dmaarm(1, Ring[1]);
+  LastStamp = now();
+#else
+  SYSCTL_RCGC2_R |= 0x00000010;   // activate clock for Port E
+  SYSCTL_RCGCADC_R |= 0x01;       // activate ADC0
+  SYSCTL_RCGCTIMER_R |= 0x03;     // activate Timer0 and Timer1
+  SYSCTL_RCGCDMA_R |= 0x01;       // activate uDMA
+  delay = SYSCTL_RCGCDMA_R;       // allow time for clocks to stabilize
+  delay = SYSCTL_RCGCADC_R;
+  GPIO_PORTE_DIR_R &= ~0x04;      // make PE2 input
+  GPIO_PORTE_AFSEL_R |= 0x04;     // enable alternate function on PE2
+  GPIO_PORTE_DEN_R &= ~0x04;      // disable digital I/O on PE2
+  GPIO_PORTE_AMSEL_R |= 0x04;     // enable analog function on PE2
+  TIMER1_CTL_R = 0;               // Timer1A free running 32-bit time stamps
+  TIMER1_CFG_R = 0;
+  TIMER1_TAMR_R = 0x02;           // periodic, counts down
+  TIMER1_TAILR_R = 0xFFFFFFFF;
+  TIMER1_IMR_R = 0;
+  TIMER1_CTL_R = 0x01;
+  TIMER0_CTL_R = 0;               // Timer0A 32-bit periodic, triggers ADC0
+  TIMER0_CFG_R = 0;
+  TIMER0_TAMR_R = 0x02;
+  TIMER0_TAILR_R = period-1;
+  TIMER0_IMR_R = 0;               // no timer interrupts, only the ADC trigger
+  ADC0_PC_R = 0x01;               // 125K samples/second
+  ADCSequenceDisable(ADC0_BASE, 1);
+  ADCSequenceConfigure(ADC0_BASE, 1, ADC_TRIGGER_TIMER, 1);
+  for(i=0; i<ADCSTEPS-1; i=i+1){
+    ADCSequenceStepConfigure(ADC0_BASE, 1, i, ADC_CTL_CH1);
+  }
+  ADCSequenceStepConfigure(ADC0_BASE, 1, ADCSTEPS-1, ADC_CTL_CH1|ADC_CTL_IE|ADC_CTL_END);
+  ADCHardwareOversampleConfigure(ADC0_BASE, ADCOVERSAMPLE);
+  uDMAEnable();
+  uDMAControlBaseSet(DMAControlTable);
+  uDMAChannelAssign(UDMA_CH15_ADC0_1);
+  uDMAChannelAttributeDisable(UDMA_CHANNEL_ADC1, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                              UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+  uDMAChannelControlSet(UDMA_CHANNEL_ADC1|UDMA_PRI_SELECT,
+                        UDMA_SIZE_16|UDMA_SRC_INC_NONE|UDMA_DST_INC_16|UDMA_ARB_4);
+  uDMAChannelControlSet(UDMA_CHANNEL_ADC1|UDMA_ALT_SELECT,
+                        UDMA_SIZE_16|UDMA_SRC_INC_NONE|UDMA_DST_INC_16|UDMA_ARB_4);
+  dmaarm(0, Ring[0]);
+  dmaarm(1, Ring[1]);
+  ADCSequenceDMAEnable(ADC0_BASE, 1);
+  ADCSequenceEnable(ADC0_BASE, 1);
+  NVIC_PRI3_R = (NVIC_PRI3_R&0x00FFFFFF)|0x40000000; // ADC0 SS1 is IRQ 15, priority 2
+  NVIC_EN0_R = 1<<15;
+  LastStamp = now();
+  TIMER0_CTL_R = 0x21;            // TAOTE: timeout triggers the ADC, and enable
+#endif
+}
+
+// Block s has been filled.  Queue it for the foreground and give
+// the structure a free block, or if the foreground has not freed
+// one, drop the block and fill it again.
+static void blockdone(int s){ unsigned long t = now();
+  Interval = t - LastStamp;
+  LastStamp = t;
+  Blocks = Blocks + 1;
+  if(FreeHead != FreeTail){
+    Stamp[Fill[s]] = t;
+    Ready[ReadyHead%ADCNBLOCKS] = Fill[s];
+    ReadyHead = ReadyHead + 1;
+    Fill[s] = Free[FreeTail%ADCNBLOCKS];
+    FreeTail = FreeTail + 1;
+  } else{
+    Dropped = Dropped + 1;
+  }
+  dmaarm(s, Ring[Fill[s]]);
+}
+
+// ADC0 SS1 interrupt, used only for uDMA completion.  If the ISR
+// was held off long enough for both structures to finish, they
+// are handled in the order they were filled.
+void ADC0Seq1_Handler(void){
+#ifndef HEADLESS
+  ADC0_ISC_R = 0x0002;            // acknowledge SS1
+#endif
+  dmaack();                       // before the check, so a block that finishes now interrupts again
+  while(dmastopped(Next)){
+    blockdone(Next);
+    Next = Next^1;
+  }
+}
+
+//------------ADC0_GetBlock------------
+// Take the oldest full block, call once per block and
+// ADC0_FreeBlock() when done with it.
+// Input: none
+// Output: pointer to ADCBLOCK 12-bit samples, oldest first
+//         0 if no block is full yet
+unsigned short *ADC0_GetBlock(void){ unsigned long b;
+  if(ReadyTail == ReadyHead){
+    return 0;
+  }
+  b = Ready[ReadyTail%ADCNBLOCKS];
+  Latency = now() - Stamp[b];
+  if(Latency > LatencyMax){
+    LatencyMax = Latency;
+  }
+  return Ring[b];
+}
+
+//------------ADC0_FreeBlock------------
+// Give the block from ADC0_GetBlock() back to the uDMA
+// Input: none
+// Output: none
+void ADC0_FreeBlock(void){
+  if(ReadyTail == ReadyHead){
+    return;
+  }
+  Free[FreeHead%ADCNBLOCKS] = Ready[ReadyTail%ADCNBLOCKS];
+  FreeHead = FreeHead + 1;
+  ReadyTail = ReadyTail + 1;
+}
+
+//------------ADC0_Stats------------
+// Report how the stream is keeping up
+// Input: rate     measured samples/second over the last block
+//        dropped  blocks thrown away because the ring was full
+//        latency  longest time from a block filling to
+//                 ADC0_GetBlock(), 12.5ns units
+//        Any pointer can be 0
+// Output: blocks filled since ADC0_InitStream
+unsigned long ADC0_Stats(unsigned long *rate, unsigned long *dropped, unsigned long *latency){
+  if(rate){
+    *rate = Interval ? (unsigned long)((80000000ULL*ADCBLOCK)/Interval) : 0;
+  }
+  if(dropped){
+    *dropped = Dropped;
+  }
+  if(latency){
+    *latency = LatencyMax;
+  }
+  return Blocks;
 }
@@ -3,6 +3,8 @@
 // Provide functions that initialize ADC0 SS3 to be triggered by
 // software and trigger a conversion, wait for it to finish,
 // and return the result. 
+// Also a streaming mode: Timer0A triggers ADC0 SS1 at a fixed
+// rate and uDMA moves the samples into a ring of blocks.
 // Daniel Valvano
 // January 15, 2016
 
@@ -37,3 +39,62 @@ void ADC0_Init(void);
 // Input: none
 // Output: 12-bit result of ADC conversion
 unsigned long ADC0_In(void);
+
+// streaming mode
+#define ADCSTEPS      4     // samples per trigger, sequencer 1 has 4 steps
+#define ADCOVERSAMPLE 8     // hardware averaging of each sample, 2 to 64
+#define ADCBLOCK      64    // samples per block, a multiple of ADCSTEPS
+#define ADCNBLOCKS    4     // blocks in the ring, at least 3
+
+//------------ADC0_InitStream------------
+// Start timer-triggered sampling of Ain1 (PE2) into the ring.
+// Uses Timer0A (trigger), Timer1A (time stamps), ADC0 SS1,
+// uDMA channel 15 and the ADC0 SS1 interrupt.
+// Input: period  time between triggers, 12.5ns units,
+//                each trigger gives ADCSTEPS samples
+//                Minimum is ADCSTEPS*ADCOVERSAMPLE*640 (125K ADC)
+// Output: none
+void ADC0_InitStream(unsigned long period);
+
+//------------ADC0_GetBlock------------
+// Take the oldest full block, call once per block and
+// ADC0_FreeBlock() when done with it.
+// Input: none
+// Output: pointer to ADCBLOCK 12-bit samples, oldest first
+//         0 if no block is full yet
+unsigned short *ADC0_GetBlock(void);
+
+//------------ADC0_FreeBlock------------
+// Give the block from ADC0_GetBlock() back to the uDMA
+// Input: none
+// Output: none
+void ADC0_FreeBlock(void);
+
+//------------ADC0_Stats------------
+// Report how the stream is keeping up
+// Input: rate     measured samples/second over the last block
+//        dropped  blocks thrown away because the ring was full
+//        latency  longest time from a block filling to
+//                 ADC0_GetBlock(), 12.5ns units
+//        Any pointer can be 0
+// Output: blocks filled since ADC0_InitStream
+unsigned long ADC0_Stats(unsigned long *rate, unsigned long *dropped, unsigned long *latency);
+
+// uDMA completion interrupt for the stream
+void ADC0Seq1_Handler(void);
+
+#ifdef HEADLESS
+// Host model only: one Timer0A timeout, converting the
+// ADCSTEPS values in sample[] into the SS1 FIFO
+void ADC0_ModelTrigger(const unsigned short *sample);
+
+// Host model only: conversions lost because the FIFO was full
+unsigned long ADC0_ModelOverflow(void);
+
+// Host model only: the uDMA completion, like DMACHIS on the
+// board, stays asserted until ADC0Seq1_Handler() clears it
+// Output: triggers that ended with it still asserted after 100
+//         handler runs in a row; on the board the handler would
+//         never let main run again
+unsigned long ADC0_ModelStuck(void);
+#endif
@@ -0,0 +1,31 @@
+// CalTable.h
+// Made by Headless/CalFit from Calibration.txt, do not edit
+// piecewise linear through 7 points
+// one entry every 16 ADC samples, plus one past the end
+
+#define CALSHIFT 4
+
+const unsigned short CalDefault[257] = {
+  96, 104, 112, 119, 127, 135, 142, 150, 158, 166, 173, 181,
+  189, 196, 204, 212, 220, 227, 235, 243, 250, 258, 266, 274,
+  281, 289, 297, 305, 312, 320, 328, 335, 343, 351, 359, 366,
+  374, 382, 389, 397, 405, 413, 421, 429, 437, 446, 454, 462,
+  470, 478, 486, 494, 502, 510, 518, 527, 535, 543, 551, 559,
+  567, 575, 583, 591, 599, 608, 616, 624, 632, 640, 648, 656,
+  664, 672, 681, 689, 697, 705, 713, 721, 729, 737, 745, 753,
+  762, 770, 778, 786, 794, 802, 809, 817, 824, 831, 839, 846,
+  853, 861, 868, 875, 883, 890, 897, 905, 912, 920, 927, 934,
+  942, 949, 956, 964, 971, 978, 986, 993, 1000, 1008, 1015, 1023,
+  1030, 1037, 1045, 1052, 1059, 1067, 1074, 1081, 1089, 1096, 1103, 1111,
+  1118, 1126, 1133, 1140, 1148, 1155, 1162, 1170, 1177, 1184, 1192, 1199,
+  1206, 1214, 1221, 1228, 1235, 1243, 1250, 1257, 1265, 1272, 1279, 1286,
+  1294, 1301, 1308, 1315, 1323, 1330, 1337, 1345, 1352, 1359, 1366, 1374,
+  1381, 1388, 1395, 1403, 1410, 1416, 1423, 1430, 1437, 1444, 1451, 1458,
+  1465, 1472, 1479, 1486, 1492, 1499, 1506, 1513, 1520, 1527, 1534, 1541,
+  1548, 1555, 1562, 1568, 1575, 1582, 1589, 1596, 1603, 1610, 1617, 1624,
+  1631, 1638, 1644, 1651, 1658, 1665, 1672, 1679, 1686, 1693, 1700, 1707,
+  1714, 1721, 1727, 1734, 1741, 1748, 1755, 1762, 1769, 1776, 1783, 1790,
+  1797, 1817, 1851, 1885, 1919, 1953, 1987, 2021, 2055, 2089, 2123, 2157,
+  2191, 2226, 2260, 2294, 2328, 2362, 2396, 2430, 2464, 2498, 2532, 2566,
+  2600, 2634, 2668, 2702, 2736
+};
@@ -0,0 +1,181 @@
+// Calibration.c
+// Runs on LM4F120/TM4C123
+// Convert 12-bit ADC samples into distance (0.001 cm) with a
+// lookup table.  CalTable[i] is the distance at ADC sample
+// i<<CALSHIFT, with one extra entry past the end so every
+// sample has a next entry to interpolate toward.  All the
+// division happens when the table is made, offline in
+// Headless/CalFit or in Cal_Recalibrate.
+// EEPROM layout at CALADDR: a header word, a checksum word, then
+// the table two entries per word.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Calibration.h"
+#include "CalTable.h"               // CalDefault[] and CALSHIFT from CalFit
+#ifndef HEADLESS
+#include "..//tm4c123gh6pm.h"
+#include "driverlib/eeprom.h"
+#endif
+
+#define CALSIZE     (4096>>CALSHIFT)
+#define CALMASK     ((1<<CALSHIFT)-1)
+#define CALADDR     0               // EEPROM byte address, multiple of 4
+#define CALWORDS    ((CALSIZE+2)/2) // table size in EEPROM words
+#define CALMAGIC    (0x43414C00+CALSHIFT) // "CAL" and the shift
+
+unsigned short CalTable[CALSIZE+1];
+
+#ifdef HEADLESS
+// Host model of the 2K EEPROM
+uint32_t EEPROM[512];
+static int eeprominit(void){
+  return 1;
+}
+static uint32_t eepromread(uint32_t addr){
+  return EEPROM[addr/4];
+}
+static int eepromwrite(uint32_t addr, uint32_t data){
+  EEPROM[addr/4] = data;
+  return 1;
+}
+#else
+static int eeprominit(void){ volatile unsigned long delay;
+  SYSCTL_RCGCEEPROM_R |= 0x01;      // activate EEPROM
+  delay = SYSCTL_RCGCEEPROM_R;      // allow time for clock to stabilize
+  return EEPROMInit() == EEPROM_INIT_OK;
+}
+static uint32_t eepromread(uint32_t addr){ uint32_t data;
+  EEPROMRead(&data, addr, 4);
+  return data;
+}
+static int eepromwrite(uint32_t addr, uint32_t data){
+  return EEPROMProgram(&data, addr, 4) == 0;
+}
+#endif
+
+// word i of the table as stored in EEPROM
+static uint32_t tableword(int i){
+  if(2*i+1 > CALSIZE){
+    return CalTable[2*i];           // odd count, top half is unused
+  }
+  return CalTable[2*i] + ((uint32_t)CalTable[2*i+1]<<16);
+}
+
+//********Cal_Init*****************
+// Use the table saved in EEPROM by Cal_Save, or the compiled
+// in default if there is none
+// Input: none
+// Output: 1 if the table came from EEPROM, 0 if default
+int Cal_Init(void){ int i;
+  uint32_t sum = 0, w;
+  Cal_Default();
+  if((CALADDR + 4*(CALWORDS+2) > 2048) || !eeprominit() || (eepromread(CALADDR) != CALMAGIC)){
+    return 0;
+  }
+  for(i=0; i<CALWORDS; i=i+1){      // check it before using any of it
+    sum = sum + eepromread(CALADDR+8+4*i);
+  }
+  if(sum != eepromread(CALADDR+4)){
+    return 0;
+  }
+  for(i=0; i<CALWORDS; i=i+1){
+    w = eepromread(CALADDR+8+4*i);
+    CalTable[2*i] = w&0xFFFF;
+    if(2*i+1 <= CALSIZE){
+      CalTable[2*i+1] = w>>16;
+    }
+  }
+  return 1;
+}
+
+//********Cal_Default*****************
+// Go back to the compiled in table, EEPROM is not changed
+// Input: none
+// Output: none
+void Cal_Default(void){ int i;
+  for(i=0; i<=CALSIZE; i=i+1){
+    CalTable[i] = CalDefault[i];
+  }
+}
+
+//********Cal_Convert*****************
+// Convert a 12-bit ADC sample into distance, one table read
+// and a multiply-shift between table entries, no division
+// Input: sample  12-bit ADC sample, 0 to 4095
+// Output: distance (resolution 0.001cm)
+unsigned long Cal_Convert(unsigned long sample){ long a, b;
+  if(sample > 4095){
+    sample = 4095;
+  }
+  a = CalTable[sample>>CALSHIFT];
+  b = CalTable[(sample>>CALSHIFT)+1];
+  return a + (((b - a)*(long)(sample&CALMASK))>>CALSHIFT);
+}
+
+//********Cal_Recalibrate*****************
+// Build a new table through measured points, straight lines
+// between neighboring points, extended past the first and last.
+// Input: adc    ADC samples at the known positions
+//        truth  the known positions (0.001 cm)
+//        n      number of points, 2 to CALMAXPOINTS
+// Output: 1 if ok, 0 if too few points or two at the same ADC
+//         value, in which case the table is not changed
+int Cal_Recalibrate(const unsigned long *adc, const unsigned long *truth, int n){
+  long x[CALMAXPOINTS], y[CALMAXPOINTS], s, num, d, v;
+  int i, j;
+  if((n < 2) || (n > CALMAXPOINTS)){
+    return 0;
+  }
+  for(j=0; j<n; j=j+1){             // insertion sort by ADC value
+    for(i=j; (i>0) && (x[i-1] > (long)adc[j]); i=i-1){
+      x[i] = x[i-1];
+      y[i] = y[i-1];
+    }
+    x[i] = adc[j];
+    y[i] = truth[j];
+  }
+  for(i=1; i<n; i=i+1){
+    if(x[i] == x[i-1]){
+      return 0;
+    }
+  }
+  i = 1;
+  for(j=0; j<=CALSIZE; j=j+1){
+    s = (long)j<<CALSHIFT;
+    while((i < n-1) && (s > x[i])){
+      i = i + 1;
+    }
+    num = (y[i] - y[i-1])*(s - x[i-1]); // same rounding as CalFit
+    d = x[i] - x[i-1];
+    if(num >= 0){
+      v = y[i-1] + (num + d/2)/d;
+    } else{
+      v = y[i-1] - (-num + d/2)/d;
+    }
+    if(v < 0) v = 0;
+    if(v > 65535) v = 65535;
+    CalTable[j] = v;
+  }
+  return 1;
+}
+
+//********Cal_Save*****************
+// Store the table in EEPROM for Cal_Init to find after reset.
+// The header is written last, so a reset part way through
+// leaves no valid table rather than a damaged one.
+// Input: none
+// Output: 1 if ok, 0 if EEPROM failed or the table does not fit
+int Cal_Save(void){ int i;
+  uint32_t sum = 0;
+  if((CALADDR + 4*(CALWORDS+2) > 2048) || !eeprominit() || !eepromwrite(CALADDR, 0)){
+    return 0;
+  }
+  for(i=0; i<CALWORDS; i=i+1){
+    if(!eepromwrite(CALADDR+8+4*i, tableword(i))){
+      return 0;
+    }
+    sum = sum + tableword(i);
+  }
+  return eepromwrite(CALADDR+4, sum) && eepromwrite(CALADDR, CALMAGIC);
+}
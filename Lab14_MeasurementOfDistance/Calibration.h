@@ -0,0 +1,47 @@
+// Calibration.h
+// Runs on LM4F120/TM4C123
+// Convert 12-bit ADC samples into distance (0.001 cm) with a
+// lookup table.  The default table is made offline from the
+// spreadsheet points by Headless/CalFit and compiled in as
+// CalTable.h; a new one can be made at run time from measured
+// points and kept in EEPROM.
+
+// most points Cal_Recalibrate can take
+#define CALMAXPOINTS 16
+
+//********Cal_Init*****************
+// Use the table saved in EEPROM by Cal_Save, or the compiled
+// in default if there is none
+// Input: none
+// Output: 1 if the table came from EEPROM, 0 if default
+int Cal_Init(void);
+
+//********Cal_Default*****************
+// Go back to the compiled in table, EEPROM is not changed
+// Input: none
+// Output: none
+void Cal_Default(void);
+
+//********Cal_Convert*****************
+// Convert a 12-bit ADC sample into distance, one table read
+// and a multiply-shift between table entries, no division
+// Input: sample  12-bit ADC sample, 0 to 4095
+// Output: distance (resolution 0.001cm)
+unsigned long Cal_Convert(unsigned long sample);
+
+//********Cal_Recalibrate*****************
+// Build a new table through measured points, straight lines
+// between neighboring points, extended past the first and last.
+// The points do not have to be in order.
+// Input: adc    ADC samples at the known positions
+//        truth  the known positions (0.001 cm)
+//        n      number of points, 2 to CALMAXPOINTS
+// Output: 1 if ok, 0 if too few points or two at the same ADC
+//         value, in which case the table is not changed
+int Cal_Recalibrate(const unsigned long *adc, const unsigned long *truth, int n);
+
+//********Cal_Save*****************
+// Store the table in EEPROM for Cal_Init to find after reset
+// Input: none
+// Output: 1 if ok, 0 if EEPROM failed or the table does not fit
+int Cal_Save(void);
@@ -0,0 +1,158 @@
+// CalFit.c
+// Runs on a PC (any C compiler), not on the LaunchPad
+// Fits the calibration points from the spreadsheets and writes
+// CalTable.h, the lookup table Calibration.c uses to turn a
+// 12-bit ADC sample into a distance in 0.001 cm.  The table has
+// one entry every 2^CALSHIFT samples plus one past the end, so
+// Cal_Convert() is a table read and, between entries, one
+// multiply and shift.  The fitting, with its divisions and
+// floating point, all happens here.
+//
+// build: gcc -o CalFit CalFit.c
+// usage: CalFit [-q] [-f] points.txt > ../CalTable.h
+//   -q  least squares quadratic through all the points
+//       (default is piecewise linear, straight lines between
+//       neighboring points, extended past the first and last)
+//   -f  full 4096 entry table, CALSHIFT 0, no interpolation
+//       (default is 256 entries, CALSHIFT 4)
+// points.txt has one point per line, "ADC truth", with # comments,
+// for example Calibration.txt in this folder.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXPOINTS 64
+
+long X[MAXPOINTS], Y[MAXPOINTS];   // ADC sample, position in 0.001 cm
+int N;
+
+// Piecewise linear, integer math rounded the same way as
+// Cal_Recalibrate() in Calibration.c, so both build the same table
+long Linear(long x){ int i = 1;
+  long num, d;
+  while((i < N-1) && (x > X[i])){
+    i = i + 1;
+  }
+  num = (Y[i] - Y[i-1])*(x - X[i-1]);
+  d = X[i] - X[i-1];
+  if(num >= 0){
+    return Y[i-1] + (num + d/2)/d;
+  }
+  return Y[i-1] - (-num + d/2)/d;
+}
+
+// Least squares fit y = a + b*x + c*x*x, normal equations
+// solved by Gaussian elimination
+int Quadratic(double *a, double *b, double *c){ int i, j, k;
+  double m[3][4] = {{0}}, p[5] = {0}, q[3] = {0}, t, x;
+  for(i=0; i<N; i=i+1){
+    x = 1;
+    for(j=0; j<5; j=j+1){
+      p[j] = p[j] + x;
+      if(j < 3){
+        q[j] = q[j] + x*Y[i];
+      }
+      x = x*X[i];
+    }
+  }
+  for(i=0; i<3; i=i+1){
+    for(j=0; j<3; j=j+1){
+      m[i][j] = p[i+j];
+    }
+    m[i][3] = q[i];
+  }
+  for(i=0; i<3; i=i+1){
+    if(m[i][i] == 0){
+      return 0;
+    }
+    for(k=0; k<3; k=k+1){
+      if(k != i){
+        t = m[k][i]/m[i][i];
+        for(j=i; j<4; j=j+1){
+          m[k][j] = m[k][j] - t*m[i][j];
+        }
+      }
+    }
+  }
+  *a = m[0][3]/m[0][0];
+  *b = m[1][3]/m[1][1];
+  *c = m[2][3]/m[2][2];
+  return 1;
+}
+
+int main(int argc, char **argv){
+  FILE *f;
+  char line[128];
+  int quad = 0, full = 0, arg = 1, i, j, shift;
+  long x, y, size;
+  double a = 0, b = 0, c = 0, v;
+  while((arg < argc) && (argv[arg][0] == '-')){
+    if(strcmp(argv[arg], "-q") == 0){
+      quad = 1;
+    } else if(strcmp(argv[arg], "-f") == 0){
+      full = 1;
+    }
+    arg = arg + 1;
+  }
+  if(arg >= argc){
+    fprintf(stderr, "usage: CalFit [-q] [-f] points.txt\n");
+    return 1;
+  }
+  f = fopen(argv[arg], "r");
+  if(f == NULL){
+    fprintf(stderr, "can't open %s\n", argv[arg]);
+    return 1;
+  }
+  while((N < MAXPOINTS) && fgets(line, sizeof(line), f)){
+    if((line[0] != '#') && (sscanf(line, "%ld %ld", &x, &y) == 2)){
+      for(i=N; (i>0) && (X[i-1] > x); i=i-1){  // keep them sorted by ADC
+        X[i] = X[i-1];
+        Y[i] = Y[i-1];
+      }
+      X[i] = x;
+      Y[i] = y;
+      N = N + 1;
+    }
+  }
+  fclose(f);
+  for(i=1; i<N; i=i+1){
+    if(X[i] == X[i-1]){
+      fprintf(stderr, "two points at ADC %ld\n", X[i]);
+      return 1;
+    }
+  }
+  if((N < 2) || (quad && ((N < 3) || !Quadratic(&a, &b, &c)))){
+    fprintf(stderr, "need at least %d different points\n", quad ? 3 : 2);
+    return 1;
+  }
+  shift = full ? 0 : 4;
+  size = 4096>>shift;
+  printf("// CalTable.h\n");
+  printf("// Made by Headless/CalFit from %s, do not edit\n", argv[arg]);
+  if(quad){
+    printf("// distance = %.6g + %.6g*ADC + %.6g*ADC*ADC (0.001 cm)\n", a, b, c);
+  } else{
+    printf("// piecewise linear through %d points\n", N);
+  }
+  printf("// one entry every %d ADC samples, plus one past the end\n\n", 1<<shift);
+  printf("#define CALSHIFT %d\n\n", shift);
+  printf("const unsigned short CalDefault[%ld] = {", size+1);
+  for(j=0; j<=size; j=j+1){
+    x = (long)j<<shift;
+    if(quad){
+      v = a + b*x + c*x*x;
+      y = (long)(v + ((v < 0) ? -0.5 : 0.5));
+    } else{
+      y = Linear(x);
+    }
+    if(y < 0) y = 0;              // same limits as Cal_Recalibrate()
+    if(y > 65535) y = 65535;
+    if((j%12) == 0){
+      printf("\n ");
+    }
+    printf(" %ld%s", y, (j < size) ? "," : "");
+  }
+  printf("\n};\n");
+  return 0;
+}
@@ -0,0 +1,161 @@
+// CalTest.c
+// Runs on a PC, not on the LaunchPad
+// Accuracy and speed test of Calibration.c, built with HEADLESS
+// defined so the EEPROM is a memory model.
+//  1) error of Cal_Convert at every spreadsheet point
+//  2) Cal_Recalibrate through the points gives the same table as
+//     CalFit (when CalTable.h was made piecewise linear from them)
+//  3) Cal_Save then Cal_Init brings the table back, and a damaged
+//     EEPROM copy is not used
+//  4) conversions per second, against a conversion that divides
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o CalTest CalTest.c ../Calibration.c
+// usage: CalTest [-e maxerror] [points.txt ...]
+//   -e  largest error allowed at a point, 0.001 cm (default 50)
+//   default points are Calibration.txt and Calibration2.txt, the
+//   first file is the one used for 2)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+#include "../Calibration.h"
+
+#define REPEAT 2000
+
+extern uint32_t EEPROM[];           // EEPROM model in Calibration.c
+
+unsigned long Adc[CALMAXPOINTS], Truth[CALMAXPOINTS];
+unsigned long Table[4096];          // Cal_Convert of every sample
+
+int ReadPoints(const char *name){ FILE *f;
+  char line[128];
+  int n = 0;
+  f = fopen(name, "r");
+  if(f == NULL){
+    fprintf(stderr, "can't open %s\n", name);
+    exit(2);
+  }
+  while((n < CALMAXPOINTS) && fgets(line, sizeof(line), f)){
+    if((line[0] != '#') && (sscanf(line, "%lu %lu", &Adc[n], &Truth[n]) == 2)){
+      n = n + 1;
+    }
+  }
+  fclose(f);
+  return n;
+}
+
+// what a first try at Convert looks like, a line and a divide,
+// here through the end points so it is fair on the same data
+volatile unsigned long Slope = 1900, Offset = 100, Span = 3742;
+unsigned long Divide(unsigned long sample){
+  return Offset + (Slope*sample)/Span;
+}
+
+int main(int argc, char **argv){
+  const char *file[8] = {"Calibration.txt", "Calibration2.txt"};
+  int files = 2, f, i, n, bad = 0, arg = 1;
+  long err, maxerror = 50, worst;
+  unsigned long s, sum, r;
+  clock_t start;
+  double t1, t2;
+  if((arg+1 < argc) && (strcmp(argv[arg], "-e") == 0)){
+    maxerror = atol(argv[arg+1]);
+    arg = arg + 2;
+  }
+  if(arg < argc){
+    for(files=0; (arg < argc) && (files < 8); arg=arg+1, files=files+1){
+      file[files] = argv[arg];
+    }
+  }
+  if(Cal_Init() != 0){
+    printf("blank EEPROM was used\n");
+    bad = 1;
+  }
+  // 1) accuracy at the spreadsheet points
+  for(f=0; f<files; f=f+1){
+    n = ReadPoints(file[f]);
+    worst = 0;
+    printf("%s\n   ADC  truth  output  error\n", file[f]);
+    for(i=0; i<n; i=i+1){
+      err = (long)Cal_Convert(Adc[i]) - (long)Truth[i];
+      printf("  %4lu  %5lu  %6lu  %5ld\n", Adc[i], Truth[i], Cal_Convert(Adc[i]), err);
+      if(labs(err) > worst){
+        worst = labs(err);
+      }
+    }
+    printf("  worst error %ld (0.001 cm)\n", worst);
+    if(worst > maxerror){
+      printf("  more than %ld\n", maxerror);
+      bad = 1;
+    }
+  }
+  // 2) run-time table against the compiled one
+  for(s=0; s<4096; s=s+1){
+    Table[s] = Cal_Convert(s);
+  }
+  n = ReadPoints(file[0]);
+  if(!Cal_Recalibrate(Adc, Truth, n)){
+    printf("Cal_Recalibrate refused %s\n", file[0]);
+    bad = 1;
+  }
+  for(s=0, i=0; s<4096; s=s+1){
+    if(Cal_Convert(s) != Table[s]){
+      i = i + 1;
+    }
+  }
+  printf("Cal_Recalibrate from %s: %d of 4096 samples differ from CalTable.h%s\n", file[0], i,
+         i ? " (was CalTable.h made with -q or other points?)" : "");
+  // 3) EEPROM round trip
+  Adc[0] = 0;                       // a table unlike the default
+  Truth[0] = 5000;
+  Adc[1] = 4095;
+  Truth[1] = 0;
+  Cal_Recalibrate(Adc, Truth, 2);
+  for(s=0; s<4096; s=s+1){
+    Table[s] = Cal_Convert(s);
+  }
+  if(!Cal_Save()){
+    printf("Cal_Save failed\n");
+    bad = 1;
+  }
+  Cal_Default();
+  if(Cal_Init() != 1){
+    printf("saved table was not found\n");
+    bad = 1;
+  }
+  for(s=0; s<4096; s=s+1){
+    if(Cal_Convert(s) != Table[s]){
+      printf("sample %lu is %lu after Cal_Init, %lu before Cal_Save\n", s, Cal_Convert(s), Table[s]);
+      bad = 1;
+      break;
+    }
+  }
+  EEPROM[10] = EEPROM[10]^0x0100;   // one bit of the stored table
+  if(Cal_Init() != 0){
+    printf("damaged table was used\n");
+    bad = 1;
+  }
+  Cal_Default();
+  // 4) throughput
+  start = clock();
+  for(r=0, sum=0; r<REPEAT; r=r+1){
+    for(s=0; s<4096; s=s+1){
+      sum = sum + Cal_Convert(s^r);
+    }
+  }
+  t1 = (double)(clock() - start)/CLOCKS_PER_SEC;
+  start = clock();
+  for(r=0; r<REPEAT; r=r+1){
+    for(s=0; s<4096; s=s+1){
+      sum = sum + Divide((s^r)&0xFFF);
+    }
+  }
+  t2 = (double)(clock() - start)/CLOCKS_PER_SEC;
+  printf("Cal_Convert %.2f ns/sample, divide %.2f ns/sample (%lu)\n",
+         1e9*t1/(4096.0*REPEAT), 1e9*t2/(4096.0*REPEAT), sum&1);
+  printf(bad ? "FAIL\n" : "ok\n");
+  return bad;
+}
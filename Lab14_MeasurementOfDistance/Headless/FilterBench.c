@@ -0,0 +1,168 @@
+// FilterBench.c
+// Runs on a PC, not on the LaunchPad
+// Checks and times the filters in ../../Filter.c on a made-up slide
+// pot signal: slow steps and ramps, ADC noise of a few counts,
+// and now and then a spike to 0 or 4095.
+//  - every running median output is checked against sorting
+//    the same window from scratch
+//  - RMS error against the clean signal and the number of
+//    outputs hit by a spike, for each filter
+//  - time per sample, in CPU cycles on x86 (rdtsc) and in ns
+//
+// build (from this folder):
+//   gcc -O2 -I../.. -o FilterBench FilterBench.c ../../Filter.c -lm
+// usage: FilterBench [samples]   (default 1000000)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../../Filter.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+#define BLOCK 64
+
+unsigned short *Clean, *Noisy, *Out;
+long Samples;
+
+static unsigned long M = 1;
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+
+void MakeSignal(void){ long i;
+  long v;
+  for(i=0; i<Samples; i=i+1){
+    v = ((i/5000)%2) ? 1000 + (i%5000)/2 : 3000;  // ramp up, then hold
+    Clean[i] = v;
+    v = v + (long)(Random32()>>29) - 4;           // noise -4 to +3
+    if((Random32()>>24) == 0){                     // 1 in 256 is a spike
+      v = (Random32()&0x80000000) ? 4095 : 0;
+    }
+    Noisy[i] = v;
+  }
+}
+
+// RMS error and spikes, skipping the first skip outputs (startup)
+// out[j] is compared to the clean sample delay[j] back
+void Report(const char *name, long n, long step, long delay,
+            unsigned long long cycles, double seconds){
+  long j, spikes = 0, count = 0;
+  double err, sum = 0;
+  for(j=64; j<n; j=j+1){
+    err = (double)Out[j] - Clean[j*step + step - 1 - delay];
+    sum = sum + err*err;
+    count = count + 1;
+    if(fabs(err) > 400){
+      spikes = spikes + 1;
+    }
+  }
+  printf("%-12s %13.1f %10.2f %10.1f %7ld\n", name,
+         (double)cycles/Samples, 1e9*seconds/Samples,
+         sqrt(sum/count), spikes);
+}
+
+int cmp(const void *a, const void *b){
+  return *(const unsigned short *)a - *(const unsigned short *)b;
+}
+
+int CheckMedian(int taps){ MedTyp m;
+  unsigned short w[MEDMAX];
+  long i, k, first;
+  Median_Init(&m, taps);
+  for(i=0; i<Samples; i=i+1){
+    Out[i] = Median_In(&m, Noisy[i]);
+    first = (i >= taps-1) ? i-taps+1 : 0;
+    for(k=first; k<=i; k=k+1){
+      w[k-first] = Noisy[k];
+    }
+    qsort(w, i-first+1, sizeof(w[0]), cmp);
+    if(Out[i] != w[(i-first+1)/2]){
+      printf("median %d wrong at sample %ld: %u, should be %u\n", taps, i, Out[i], w[(i-first+1)/2]);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int main(int argc, char **argv){
+  MedTyp m;
+  IIRTyp f;
+  DecTyp d;
+  long i, n;
+  int taps[3] = {3, 5, 9}, t, k[3] = {2, 4, 6};
+  char name[32];
+  unsigned long long c;
+  clock_t start;
+  Samples = (argc > 1) ? atol(argv[1]) : 1000000;
+  Samples = Samples - Samples%BLOCK;
+  if(Samples < 4*BLOCK){
+    Samples = 4*BLOCK;
+  }
+  Clean = malloc(Samples*sizeof(Clean[0]));
+  Noisy = malloc(Samples*sizeof(Noisy[0]));
+  Out = malloc(Samples*sizeof(Out[0]));
+  if((Clean == NULL) || (Noisy == NULL) || (Out == NULL)){
+    return 2;
+  }
+  MakeSignal();
+  for(t=0; t<3; t=t+1){
+    if(!CheckMedian(taps[t])){
+      return 1;
+    }
+  }
+  printf("running medians match sorting every window\n\n");
+  printf("filter       cycles/sample  ns/sample  RMS error  spikes\n");
+  memcpy(Out, Noisy, Samples*sizeof(Out[0]));
+  Report("none", Samples, 1, 0, 0, 0);
+  for(t=0; t<3; t=t+1){         // one sample at a time, as from SysTick
+    Median_Init(&m, taps[t]);
+    start = clock();
+    c = CYCLES();
+    for(i=0; i<Samples; i=i+1){
+      Out[i] = Median_In(&m, Noisy[i]);
+    }
+    c = CYCLES() - c;
+    sprintf(name, "median %d", taps[t]);
+    Report(name, Samples, 1, taps[t]/2, c, (double)(clock() - start)/CLOCKS_PER_SEC);
+  }
+  for(t=0; t<3; t=t+1){         // whole blocks, as from the uDMA ring
+    IIR_Init(&f, k[t]);
+    start = clock();
+    c = CYCLES();
+    for(i=0; i<Samples; i=i+BLOCK){
+      IIR_Block(&f, &Noisy[i], &Out[i], BLOCK);
+    }
+    c = CYCLES() - c;
+    sprintf(name, "IIR k=%d", k[t]);
+    Report(name, Samples, 1, (1<<k[t]) - 1, c, (double)(clock() - start)/CLOCKS_PER_SEC);
+  }
+  for(t=0; t<3; t=t+1){
+    Decimate_Init(&d, k[t]);
+    start = clock();
+    c = CYCLES();
+    for(i=0, n=0; i<Samples; i=i+BLOCK){
+      n = n + Decimate_Block(&d, &Noisy[i], BLOCK, &Out[n]);
+    }
+    c = CYCLES() - c;
+    sprintf(name, "decimate %d", 1<<k[t]);
+    Report(name, n, 1<<k[t], (1<<k[t])/2, c, (double)(clock() - start)/CLOCKS_PER_SEC);
+  }
+  Median_Init(&m, 5);           // the chain the labs use
+  IIR_Init(&f, 2);
+  start = clock();
+  c = CYCLES();
+  for(i=0; i<Samples; i=i+1){
+    Out[i] = IIR_In(&f, Median_In(&m, Noisy[i]));
+  }
+  c = CYCLES() - c;
+  Report("median5+IIR", Samples, 1, 5, c, (double)(clock() - start)/CLOCKS_PER_SEC);
+  return 0;
+}
@@ -0,0 +1,88 @@
+// Headless.c
+// Runs on a PC, not on the LaunchPad
+// Checks the streaming mode of ADC.c without a board.  ADC.c is
+// built with HEADLESS defined, which replaces sequencer 1 and
+// uDMA channel 15 with a model, and each ADC0_ModelTrigger()
+// call is one Timer0A timeout.  The samples are a counter, so
+// every block the foreground gets can be checked for order, and
+// for gaps that match the dropped-block counter.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o Headless Headless.c ../ADC.c
+// usage: Headless [options]
+//   -n triggers  number of Timer0A timeouts (default 100000)
+//   -p period    time between triggers, 12.5ns units (default 80000)
+//   -k triggers  the foreground takes one block every k triggers,
+//                0 takes each block as soon as it is full (default 0)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../ADC.h"
+
+int main(int argc, char **argv){
+  long triggers = 100000, every = 0, n, i;
+  unsigned long period = 80000, rate, dropped, latency, blocks;
+  unsigned long taken = 0, skipped = 0, expect = 0;
+  unsigned short sample[ADCSTEPS], *block;
+  for(i=1; i<argc; i=i+1){
+    if((argv[i][0] != '-') || (i+1 >= argc)){
+      fprintf(stderr, "usage: Headless [-n triggers] [-p period] [-k triggers]\n");
+      return 2;
+    }
+    switch(argv[i][1]){
+      case 'n': triggers = atol(argv[i+1]); break;
+      case 'p': period = strtoul(argv[i+1], 0, 0); break;
+      case 'k': every = atol(argv[i+1]); break;
+    }
+    i = i + 1;
+  }
+  ADC0_InitStream(period);
+  for(n=0; n<=triggers; n=n+1){
+    // the foreground, either keeping up or only now and then
+    while(((every == 0) || ((n%every) == 0)) && (block = ADC0_GetBlock())){
+      if(block[0] != (expect&0xFFF)){   // whole blocks were dropped
+        skipped = skipped + ((block[0] - expect)&0xFFF)/ADCBLOCK;
+        expect = block[0];
+      }
+      for(i=0; i<ADCBLOCK; i=i+1){
+        if(block[i] != ((expect+i)&0xFFF)){
+          fprintf(stderr, "block %lu sample %ld is %u, expected %lu\n",
+                  taken, i, block[i], (expect+i)&0xFFF);
+          return 1;
+        }
+      }
+      expect = expect + ADCBLOCK;
+      taken = taken + 1;
+      ADC0_FreeBlock();
+      if(every){
+        break;                          // one block each time
+      }
+    }
+    if(n < triggers){
+      for(i=0; i<ADCSTEPS; i=i+1){
+        sample[i] = (n*ADCSTEPS + i)&0xFFF;
+      }
+      ADC0_ModelTrigger(sample);
+    }
+  }
+  while((block = ADC0_GetBlock())){     // whatever is left in the ring
+    skipped = skipped + ((block[0] - expect)&0xFFF)/ADCBLOCK;
+    expect = block[0] + ADCBLOCK;
+    taken = taken + 1;
+    ADC0_FreeBlock();
+  }
+  blocks = ADC0_Stats(&rate, &dropped, &latency);
+  skipped = skipped + ((blocks*ADCBLOCK - expect)&0xFFF)/ADCBLOCK; // dropped after the last one taken
+  printf("%lu blocks, %lu taken, %lu dropped, %lu samples/s, latency %lu us, FIFO overflow %lu\n",
+         blocks, taken, dropped, rate, latency/80, ADC0_ModelOverflow());
+  if((blocks != (unsigned long)(triggers*ADCSTEPS/ADCBLOCK)) || (taken + dropped != blocks) ||
+     (skipped != dropped) || ADC0_ModelOverflow()){
+    fprintf(stderr, "counters do not add up\n");
+    return 1;
+  }
+  if(ADC0_ModelStuck()){
+    fprintf(stderr, "uDMA completion never cleared, %lu triggers\n", ADC0_ModelStuck());
+    return 1;
+  }
+  return 0;
+}
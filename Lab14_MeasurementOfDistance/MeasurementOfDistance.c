@@ -30,6 +30,9 @@
 
 
 #include "ADC.h"
+#include "Calibration.h"
+#include "Filter.h"
+#include "Format.h"
 #include "..//tm4c123gh6pm.h"
 #include "Nokia5110.h"
 #include "TExaS.h"
@@ -50,7 +53,7 @@ unsigned long Flag;       // 1 means valid Distance, 0 means Distance is empty
 // Input: sample  12-bit ADC sample
 // Output: 32-bit distance (resolution 0.001cm)
 unsigned long Convert(unsigned long sample){
-  return 0;  // replace this line with real code
+  return Cal_Convert(sample);  // table made from Calibration.xls, see Calibration.c
 }
 
 // Initialize SysTick interrupts to trigger at 40 Hz, 25 ms
@@ -74,31 +77,44 @@ void SysTick_Handler(void){
 // 2210 to "2.210 cm"
 //10000 to "*.*** cm"  any value larger than 9999 converted to "*.*** cm"
 void UART_ConvertDistance(unsigned long n){
-// as part of Lab 11 you implemented this function
-
+  Fmt_Fix((char *)String, n, 1, 3, " cm");   // "*.*** cm" if more than 9999
 }
 
 // main1 is a simple main program allowing you to debug the ADC interface
 int main1(void){ 
   TExaS_Init(ADC0_AIN1_PIN_PE2, SSI0_Real_Nokia5110_Scope);
   ADC0_Init();    // initialize ADC0, channel 1, sequencer 3
+  Cal_Init();   // calibration from EEPROM, or the default table
   EnableInterrupts();
   while(1){ 
     ADCdata = ADC0_In();
   }
 }
 // once the ADC is operational, you can use main2 to debug the convert to distance
-int main2(void){ 
+// The ADC runs on its own, Timer0A triggered with uDMA, and the
+// foreground averages each block of ADCBLOCK samples, then takes
+// the median of the last three averages to throw out glitches
+int main2(void){ unsigned short *block, average[2];
+  DecTyp blockaverage;
+  MedTyp glitch;
+  Decimate_Init(&blockaverage, 6);  // 64 samples, one ADCBLOCK
+  Median_Init(&glitch, 3);
   TExaS_Init(ADC0_AIN1_PIN_PE2, SSI0_Real_Nokia5110_NoScope);
-  ADC0_Init();    // initialize ADC0, channel 1, sequencer 3
+  ADC0_InitStream(80000); // 1 kHz triggers, 4000 samples/second
+  Cal_Init();             // calibration from EEPROM, or the default table
   Nokia5110_Init();             // initialize Nokia5110 LCD
   EnableInterrupts();
   while(1){ 
-    ADCdata = ADC0_In();
-    Nokia5110_SetCursor(0, 0);
-    Distance = Convert(ADCdata);
-    UART_ConvertDistance(Distance); // from Lab 11
-    Nokia5110_OutString(String);    // output to Nokia5110 LCD (optional)
+    block = ADC0_GetBlock();
+    if(block){
+      Decimate_Block(&blockaverage, block, ADCBLOCK, average);
+      ADC0_FreeBlock();       // the uDMA can have it back
+      ADCdata = Median_In(&glitch, average[0]);
+      Nokia5110_SetCursor(0, 0);
+      Distance = Convert(ADCdata);
+      UART_ConvertDistance(Distance); // from Lab 11
+      Nokia5110_OutString(String);    // output to Nokia5110 LCD (optional)
+    }
   }
 }
 // once the ADC and convert to distance functions are operational,
@@ -56,6 +56,7 @@
 // back light    (LED, pin 8) not connected, consists of 4 white LEDs which draw ~80mA total
 
 #include "Nokia5110.h"
+#include "Format.h"
 // Maximum dimensions of the LCD, although the pixels are
 // numbered from zero to (MAX-1).  Address may automatically
 // be incremented after each transmission.
@@ -340,39 +341,9 @@ void Nokia5110_OutString(unsigned char *ptr){
 // Outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_OutUDec(unsigned short n){
-  if(n < 10){
-    Nokia5110_OutString("    ");
-    Nokia5110_OutChar(n+'0'); /* n is between 0 and 9 */
-  } else if(n<100){
-    Nokia5110_OutString("   ");
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  } else if(n<1000){
-    Nokia5110_OutString("  ");
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
-  else if(n<10000){
-    Nokia5110_OutChar(' ');
-    Nokia5110_OutChar(n/1000+'0'); /* thousands digit */
-    n = n%1000;
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
-  else {
-    Nokia5110_OutChar(n/10000+'0'); /* ten-thousands digit */
-    n = n%10000;
-    Nokia5110_OutChar(n/1000+'0'); /* thousands digit */
-    n = n%1000;
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
+  unsigned char s[6];
+  Fmt_UDec((char *)s, n, 5, ' ');
+  Nokia5110_OutString(s);
 }
 
 //********Nokia5110_SetCursor*****************
@@ -0,0 +1,203 @@
+// Collision.c
+// Runs on TM4C123 or LM4F120
+// Pixel-exact collision detection for the 16 color BMP
+// sprites drawn by Nokia5110_PrintBMP().
+// Broad phase: the 84x48 screen is split into 16x16 cells and
+// each cell keeps a bit for every object touching it, so a
+// query only looks at objects that share a cell.
+// Narrow phase: rectangles that overlap are compared one row
+// at a time by shifting one row word and ANDing it with the
+// other, 32 pixels per operation.
+
+#include "Nokia5110.h"
+#include "Collision.h"
+
+extern char Screen[];           // screen buffer in Nokia5110.c
+
+#define CELLSIZE    16
+#define GRIDW       ((SCREENW+CELLSIZE-1)/CELLSIZE)
+#define GRIDH       ((SCREENH+CELLSIZE-1)/CELLSIZE)
+
+static unsigned long Cell[GRIDH][GRIDW]; // bit i set if object i touches the cell
+static unsigned char ObjX[COLMAXOBJ];    // left column
+static unsigned char ObjTop[COLMAXOBJ];  // top row
+static unsigned char ObjGroup[COLMAXOBJ];
+static MTyp *ObjMask[COLMAXOBJ];
+static long NumObj;
+
+//********Collision_MakeMask*****************
+// Build a hit mask from a 16 color BMP image.  A pixel is
+// solid if its color is above threshold, exactly the pixels
+// Nokia5110_PrintBMP() would turn on.
+// inputs: mask      mask to fill in
+//         ptr       pointer to a 16 color BMP image
+//         threshold grayscale colors above this number are solid, 0 to 14
+// outputs: 1 if ok, 0 if the image is bigger than 32x16
+int Collision_MakeMask(MTyp *mask, const unsigned char *ptr, unsigned char threshold){
+  long width = ptr[18], height = ptr[22], stride, x, y;
+  const unsigned char *data;
+  unsigned long bits;
+  unsigned char color;
+  if((width > MASKMAXW) || (height > MASKMAXH) || (height <= 0)){
+    return 0;
+  }
+  if(threshold > 14){
+    threshold = 14;             // only full 'on' turns pixel on
+  }
+  mask->w = width;
+  mask->h = height;
+  stride = ((width+1)/2 + 3)&~3; // rows are padded to 4 bytes
+  // bitmaps are encoded backwards, so the last row in the file is the top
+  data = &ptr[ptr[10]];          // byte 10 contains the offset where image data can be found
+  for(y=0; y<height; y=y+1){
+    bits = 0;
+    for(x=0; x<width; x=x+1){
+      color = data[stride*(height-1-y) + x/2];
+      color = (x&1) ? (color&0x0F) : (color>>4);
+      if(color > threshold){
+        bits |= 1UL<<x;
+      }
+    }
+    mask->row[y] = bits;
+  }
+  return 1;
+}
+
+//********Collision_Clear*****************
+// Remove all objects, call once per frame before adding the
+// objects at their new positions.
+// inputs: none
+// outputs: none
+void Collision_Clear(void){ int i, j;
+  for(i=0; i<GRIDH; i=i+1){
+    for(j=0; j<GRIDW; j=j+1){
+      Cell[i][j] = 0;
+    }
+  }
+  NumObj = 0;
+}
+
+//********Collision_Add*****************
+// Add an object to the grid for this frame.
+// inputs: x,y    bottom left corner, same as Nokia5110_PrintBMP()
+//         mask   hit mask
+//         group  one bit that says what kind of object this is
+// outputs: handle 0 to 31, or -1 if full or off the screen
+long Collision_Add(unsigned char x, unsigned char y, MTyp *mask, unsigned char group){
+  long i, top, cx, cy;
+  if((NumObj >= COLMAXOBJ) ||
+     ((x + mask->w) > SCREENW) || (y < (mask->h - 1)) || (y >= SCREENH)){
+    return -1;
+  }
+  i = NumObj;
+  NumObj = NumObj + 1;
+  top = y - mask->h + 1;
+  ObjX[i] = x;
+  ObjTop[i] = top;
+  ObjGroup[i] = group;
+  ObjMask[i] = mask;
+  for(cy=top/CELLSIZE; cy<=(y/CELLSIZE); cy=cy+1){
+    for(cx=x/CELLSIZE; cx<=((x+mask->w-1)/CELLSIZE); cx=cx+1){
+      Cell[cy][cx] |= 1UL<<i;
+    }
+  }
+  return i;
+}
+
+// Compare the overlapping rows of objects a and b.  If erode
+// is set the pixels of b are removed from a.
+// outputs: number of pixels of a covered by b
+static unsigned long overlap(long a, long b, int erode){
+  long dx, r, first, last, n;
+  unsigned long bits, count = 0;
+  MTyp *ma = ObjMask[a], *mb = ObjMask[b];
+  // rectangles must overlap, which also keeps the shift below 32
+  dx = ObjX[b] - ObjX[a];
+  if((dx >= ma->w) || (-dx >= mb->w)){
+    return 0;
+  }
+  first = (ObjTop[a] > ObjTop[b]) ? ObjTop[a] : ObjTop[b];
+  last = ObjTop[a] + ma->h;
+  n = ObjTop[b] + mb->h;
+  if(n < last){
+    last = n;
+  }
+  for(r=first; r<last; r=r+1){
+    bits = mb->row[r - ObjTop[b]];
+    bits = (dx >= 0) ? (bits<<dx) : (bits>>(-dx)); // b's row in a's columns
+    bits &= ma->row[r - ObjTop[a]];
+    if(bits){
+      if(erode == 0){
+        return 1;               // one pixel is enough
+      }
+      ma->row[r - ObjTop[a]] &= ~bits;
+      for(; bits; bits &= bits-1){
+        count = count + 1;
+      }
+    }
+  }
+  return count;
+}
+
+//********Collision_Hits*****************
+// Find every object in the given groups that has at least one
+// solid pixel on top of a solid pixel of object a.
+// inputs: a       handle from Collision_Add
+//         groups  OR of the group bits to check against
+// outputs: bit i is set if object i hits object a
+unsigned long Collision_Hits(long a, unsigned char groups){
+  long cx, cy, b;
+  unsigned long near = 0, hits = 0;
+  if((a < 0) || (a >= NumObj)){
+    return 0;
+  }
+  for(cy=ObjTop[a]/CELLSIZE; cy<=((ObjTop[a]+ObjMask[a]->h-1)/CELLSIZE); cy=cy+1){
+    for(cx=ObjX[a]/CELLSIZE; cx<=((ObjX[a]+ObjMask[a]->w-1)/CELLSIZE); cx=cx+1){
+      near |= Cell[cy][cx];
+    }
+  }
+  near &= ~(1UL<<a);            // an object does not hit itself
+  for(b=0; near; b=b+1, near>>=1){
+    if((near&0x01) && (ObjGroup[b]&groups) && overlap(a, b, 0)){
+      hits |= 1UL<<b;
+    }
+  }
+  return hits;
+}
+
+//********Collision_Erode*****************
+// Remove the pixels of object a that are covered by object b,
+// changing a's mask in place.
+// inputs: a  handle of the object to erode
+//         b  handle of the object doing the damage
+// outputs: number of pixels removed from a
+unsigned long Collision_Erode(long a, long b){
+  if((a < 0) || (a >= NumObj) || (b < 0) || (b >= NumObj) || (a == b)){
+    return 0;
+  }
+  return overlap(a, b, 1);
+}
+
+//********Collision_Draw*****************
+// Draw an object's mask into the screen buffer, turning its
+// solid pixels on and the rest of its rectangle off.
+// inputs: a  handle from Collision_Add
+// outputs: none
+void Collision_Draw(long a){
+  long x, y, i;
+  MTyp *m;
+  if((a < 0) || (a >= NumObj)){
+    return;
+  }
+  m = ObjMask[a];
+  for(y=0; y<m->h; y=y+1){
+    i = ObjX[a] + SCREENW*((ObjTop[a]+y)/8);
+    for(x=0; x<m->w; x=x+1){
+      if(m->row[y]&(1UL<<x)){
+        Screen[i+x] |= 1<<((ObjTop[a]+y)%8);
+      } else{
+        Screen[i+x] &= ~(1<<((ObjTop[a]+y)%8));
+      }
+    }
+  }
+}
@@ -0,0 +1,78 @@
+// Collision.h
+// Runs on TM4C123 or LM4F120
+// Pixel-exact collision detection for the 16 color BMP
+// sprites drawn by Nokia5110_PrintBMP().  Each sprite gets a
+// 1-bit hit mask, one 32-bit word per row.  Objects are put in
+// a uniform grid over the 84x48 screen so only objects that
+// share a grid cell are compared, and only overlapping
+// rectangles are tested pixel by pixel.
+// Not called from SpaceInvaders.c yet, Headless/CollisionTest.c
+// tests and times it on a PC.
+
+// tallest and widest sprite that can have a hit mask
+#define MASKMAXH    16
+#define MASKMAXW    32
+
+// most objects that can be added between calls to Collision_Clear
+#define COLMAXOBJ   32
+
+struct HitMask {
+  unsigned char w;                // width in pixels
+  unsigned char h;                // height in pixels
+  unsigned long row[MASKMAXH];    // row[0] is the top, bit 0 is the left column
+};
+typedef struct HitMask MTyp;
+
+//********Collision_MakeMask*****************
+// Build a hit mask from a 16 color BMP image.  A pixel is
+// solid if its color is above threshold, exactly the pixels
+// Nokia5110_PrintBMP() would turn on.  Masks that will be
+// eroded (bunkers) must be in RAM, one per bunker.
+// inputs: mask      mask to fill in
+//         ptr       pointer to a 16 color BMP image
+//         threshold grayscale colors above this number are solid, 0 to 14
+// outputs: 1 if ok, 0 if the image is bigger than 32x16
+int Collision_MakeMask(MTyp *mask, const unsigned char *ptr, unsigned char threshold);
+
+//********Collision_Clear*****************
+// Remove all objects, call once per frame before adding the
+// objects at their new positions.
+// inputs: none
+// outputs: none
+void Collision_Clear(void);
+
+//********Collision_Add*****************
+// Add an object to the grid for this frame.  Positions are
+// the same as Nokia5110_PrintBMP(): x is the left column and
+// y is the bottom row.
+// inputs: x,y    bottom left corner
+//         mask   hit mask, kept by pointer, so it must stay valid
+//         group  one bit that says what kind of object this is,
+//                such as 0x01 for lasers and 0x02 for invaders
+// outputs: handle 0 to 31, or -1 if full or off the screen
+long Collision_Add(unsigned char x, unsigned char y, MTyp *mask, unsigned char group);
+
+//********Collision_Hits*****************
+// Find every object in the given groups that has at least one
+// solid pixel on top of a solid pixel of object a.
+// inputs: a       handle from Collision_Add
+//         groups  OR of the group bits to check against
+// outputs: bit i is set if object i hits object a
+unsigned long Collision_Hits(long a, unsigned char groups);
+
+//********Collision_Erode*****************
+// Remove the pixels of object a that are covered by object b,
+// changing a's mask in place.  Use it to chip a bunker where
+// a missile or laser hit it.
+// inputs: a  handle of the object to erode
+//         b  handle of the object doing the damage
+// outputs: number of pixels removed from a
+unsigned long Collision_Erode(long a, long b);
+
+//********Collision_Draw*****************
+// Draw an object's mask into the screen buffer, turning its
+// solid pixels on and the rest of its rectangle off, so an
+// eroded bunker is shown the way it now is.
+// inputs: a  handle from Collision_Add
+// outputs: none
+void Collision_Draw(long a);
@@ -0,0 +1,365 @@
+// CollisionTest.c
+// Runs on a PC, not on the LaunchPad
+// Deterministic tests and a throughput benchmark for Collision.c
+//  - Collision_MakeMask() of every BMP the game uses must turn on
+//    exactly the pixels Nokia5110_PrintBMP() turns on
+//  - Collision_Add() must refuse objects off the screen or past
+//    COLMAXOBJ
+//  - Collision_Hits() and Collision_Erode() on random scenes must
+//    agree with a pixel by pixel check of every pair
+//  - Collision_Draw() must change only the object's rectangle
+//  - time per frame to find every hit in a game sized scene,
+//    with the grid and with a check of every pair, in CPU cycles
+//    on x86 (rdtsc) and in ns
+// Collision.c is not called from Game_Frame() yet, this is the
+// only place it runs.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o CollisionTest CollisionTest.c ../Collision.c ../SpaceInvaders.c ../Nokia5110.c ../../Format.c
+// usage: CollisionTest [scenes [frames]]   (default 2000 10000)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Nokia5110.h"
+#include "../Collision.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+extern char Screen[];       // screen buffer in Nokia5110.c
+extern const unsigned char SmallEnemy30PointA[], SmallEnemy20PointA[];
+extern const unsigned char SmallEnemy10PointA[], SmallEnemy10PointB[];
+extern const unsigned char PlayerShip0[], SmallEnemyBonus0[];
+extern const unsigned char Bunker0[], Bunker1[], Bunker2[], Bunker3[];
+extern const unsigned char Missile0[], Missile1[], Missile2[];
+extern const unsigned char Laser0[], Laser1[];
+
+struct image{
+  const char *name;
+  const unsigned char *bmp;
+};
+const struct image Images[] = {
+  {"Enemy30A", SmallEnemy30PointA}, {"Enemy20A", SmallEnemy20PointA},
+  {"Enemy10A", SmallEnemy10PointA}, {"Enemy10B", SmallEnemy10PointB},
+  {"Player",   PlayerShip0},        {"Bonus",    SmallEnemyBonus0},
+  {"Bunker0",  Bunker0},            {"Bunker1",  Bunker1},
+  {"Bunker2",  Bunker2},            {"Bunker3",  Bunker3},
+  {"Missile0", Missile0},           {"Missile1", Missile1},
+  {"Missile2", Missile2},           {"Laser0",   Laser0},
+  {"Laser1",   Laser1}
+};
+#define IMAGES (sizeof(Images)/sizeof(Images[0]))
+#define SCREENBYTES (SCREENW*SCREENH/8)
+
+// SpaceInvaders.c is linked for its images, Game_Frame() is not run
+unsigned long Random(void){
+  return 0;
+}
+
+static unsigned long M = 1;
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+
+static long Errors;
+static void check(int ok, const char *what){
+  if(!ok){
+    if(Errors < 10){
+      printf("FAIL: %s\n", what);
+    }
+    Errors = Errors + 1;
+  }
+}
+
+static int pixel(long x, long y){
+  return (Screen[x + SCREENW*(y/8)]>>(y%8))&0x01;
+}
+
+// an object as the test sees it, kept apart from Collision.c
+struct obj{
+  long x, y;                // bottom left corner
+  MTyp *mask;
+  unsigned char group;
+};
+
+// 1 if solid pixels of a and b are on the same screen pixel,
+// counting them in *count if count is not null
+static int reference(const struct obj *a, const struct obj *b, unsigned long *count){
+  long sx, sy, atop = a->y - a->mask->h + 1, btop = b->y - b->mask->h + 1;
+  unsigned long n = 0;
+  for(sy=0; sy<SCREENH; sy=sy+1){
+    for(sx=0; sx<SCREENW; sx=sx+1){
+      if((sx >= a->x) && (sx < a->x + a->mask->w) && (sy >= atop) && (sy <= a->y) &&
+         (sx >= b->x) && (sx < b->x + b->mask->w) && (sy >= btop) && (sy <= b->y) &&
+         ((a->mask->row[sy-atop]>>(sx-a->x))&0x01) &&
+         ((b->mask->row[sy-btop]>>(sx-b->x))&0x01)){
+        n = n + 1;
+      }
+    }
+  }
+  if(count){
+    *count = n;
+  }
+  return n != 0;
+}
+
+// every image, at a few positions and thresholds, must match PrintBMP
+void TestMakeMask(void){ unsigned long i, t;
+  long x, y, sx, sy, bad;
+  MTyp mask;
+  unsigned char big[64];
+  for(i=0; i<IMAGES; i=i+1){
+    for(t=0; t<15; t=t+7){
+      check(Collision_MakeMask(&mask, Images[i].bmp, t), Images[i].name);
+      check((mask.w == Images[i].bmp[18]) && (mask.h == Images[i].bmp[22]), "mask size");
+      bad = 0;
+      for(y=mask.h-1; y<SCREENH; y=y+13){
+        for(x=0; x+mask.w<=SCREENW; x=x+11){
+          Nokia5110_ClearBuffer();
+          Nokia5110_PrintBMP(x, y, Images[i].bmp, t);
+          for(sy=0; sy<SCREENH; sy=sy+1){
+            for(sx=0; sx<SCREENW; sx=sx+1){
+              if((sx >= x) && (sx < x + mask.w) && (sy > y - mask.h) && (sy <= y)){
+                bad += pixel(sx, sy) != ((mask.row[sy-(y-mask.h+1)]>>(sx-x))&0x01);
+              } else{
+                bad += pixel(sx, sy);
+              }
+            }
+          }
+        }
+      }
+      if(bad){
+        printf("%s threshold %lu: %ld pixels differ from PrintBMP\n", Images[i].name, t, bad);
+      }
+      check(bad == 0, "mask matches PrintBMP");
+    }
+  }
+  memset(big, 0, sizeof(big));
+  big[10] = 54; big[18] = 33; big[22] = 8;
+  check(Collision_MakeMask(&mask, big, 0) == 0, "33 pixels wide is refused");
+  big[18] = 32; big[22] = 17;
+  check(Collision_MakeMask(&mask, big, 0) == 0, "17 pixels high is refused");
+}
+
+void TestAdd(void){ long i;
+  MTyp mask;
+  mask.w = 10; mask.h = 4;
+  for(i=0; i<MASKMAXH; i=i+1){
+    mask.row[i] = 0x3FF;
+  }
+  Collision_Clear();
+  check(Collision_Add(75, 10, &mask, 1) == -1, "past the right edge");
+  check(Collision_Add(0, 2, &mask, 1) == -1, "past the top");
+  check(Collision_Add(0, 48, &mask, 1) == -1, "past the bottom");
+  check(Collision_Add(74, 3, &mask, 1) == 0, "top right corner");
+  check(Collision_Add(0, 47, &mask, 1) == 1, "bottom left corner");
+  check(Collision_Hits(0, 0xFF) == 0, "far apart");
+  check(Collision_Hits(-1, 0xFF) == 0, "bad handle");
+  check(Collision_Hits(2, 0xFF) == 0, "handle not added");
+  check(Collision_Erode(0, 0) == 0, "erode itself");
+  for(i=2; i<COLMAXOBJ; i=i+1){
+    check(Collision_Add(40, 20, &mask, 2) == i, "handles in order");
+  }
+  check(Collision_Add(40, 20, &mask, 2) == -1, "full");
+  check(Collision_Hits(2, 0x02) == (0xFFFFFFFFUL&~0x07UL), "all on one spot");
+  check(Collision_Hits(2, 0x01) == 0, "group filter");
+  Collision_Clear();
+  check(Collision_Hits(2, 0xFF) == 0, "cleared");
+}
+
+// random masks at random places, compared with the reference
+void TestScenes(long scenes){ long s, i, j, n;
+  static MTyp masks[COLMAXOBJ];
+  struct obj objs[COLMAXOBJ];
+  long handle[COLMAXOBJ];
+  unsigned long expect, groups, count, got;
+  for(s=0; s<scenes; s=s+1){
+    n = 2 + Random32()%(COLMAXOBJ-1);
+    Collision_Clear();
+    for(i=0; i<n; i=i+1){
+      masks[i].w = 1 + Random32()%MASKMAXW;
+      masks[i].h = 1 + Random32()%MASKMAXH;
+      for(j=0; j<masks[i].h; j=j+1){
+        masks[i].row[j] = Random32()&Random32(); // about one pixel in four
+        if(masks[i].w < 32){
+          masks[i].row[j] &= (1UL<<masks[i].w) - 1;
+        }
+      }
+      objs[i].mask = &masks[i];
+      objs[i].x = Random32()%(SCREENW - masks[i].w + 1);
+      objs[i].y = masks[i].h - 1 + Random32()%(SCREENH - masks[i].h + 1);
+      objs[i].group = 1<<(Random32()%4);
+      handle[i] = Collision_Add(objs[i].x, objs[i].y, &masks[i], objs[i].group);
+      check(handle[i] == i, "add in scene");
+    }
+    for(i=0; i<n; i=i+1){
+      groups = (s&1) ? 0xFF : (Random32()&0x0F);
+      expect = 0;
+      for(j=0; j<n; j=j+1){
+        if((j != i) && (objs[j].group&groups) && reference(&objs[i], &objs[j], 0)){
+          expect |= 1UL<<j;
+        }
+      }
+      got = Collision_Hits(i, groups);
+      if(got != expect){
+        printf("scene %ld object %ld: hits %08lX, expected %08lX\n", s, i, got, expect);
+      }
+      check(got == expect, "hits match the reference");
+    }
+    // erode one pair, the count must match and the hit must be gone
+    i = Random32()%n;
+    j = Random32()%n;
+    if(i != j){
+      reference(&objs[i], &objs[j], &count);
+      check(Collision_Erode(i, j) == count, "erode count");
+      check(reference(&objs[i], &objs[j], 0) == 0, "eroded pixels are gone");
+      check((Collision_Hits(i, 0xFF)&(1UL<<j)) == 0, "no hit after erode");
+    }
+  }
+}
+
+// Draw sets the mask's pixels, clears the rest of its rectangle
+// and leaves everything else alone
+void TestDraw(void){ long i, sx, sy, top, bad = 0;
+  char background[SCREENBYTES];
+  MTyp mask;
+  Collision_MakeMask(&mask, Bunker0, 0);
+  mask.row[1] &= ~0x3CUL;   // chip it
+  for(i=0; i<SCREENBYTES; i=i+1){
+    background[i] = Random32()>>24;
+  }
+  memcpy(Screen, background, SCREENBYTES);
+  Collision_Clear();
+  Collision_Draw(Collision_Add(33, 22, &mask, 1));
+  top = 22 - mask.h + 1;
+  for(sy=0; sy<SCREENH; sy=sy+1){
+    for(sx=0; sx<SCREENW; sx=sx+1){
+      if((sx >= 33) && (sx < 33 + mask.w) && (sy >= top) && (sy <= 22)){
+        bad += pixel(sx, sy) != ((mask.row[sy-top]>>(sx-33))&0x01);
+      } else{
+        bad += pixel(sx, sy) != ((background[sx + SCREENW*(sy/8)]>>(sy%8))&0x01);
+      }
+    }
+  }
+  check(bad == 0, "draw");
+}
+
+// A frame of the game at full strength: 3 rows of 5 enemies,
+// 4 bunkers, the player, a laser and 3 missiles, 24 objects,
+// moved a little every frame.  Every object is checked against
+// every other object.
+#define GAMEOBJ 24
+void Bench(long frames){ long f, i, j, n;
+  static MTyp masks[GAMEOBJ];
+  struct obj objs[GAMEOBJ];
+  unsigned long long c, cgrid = 0, cpair = 0;
+  unsigned long hits, hitsgrid = 0, hitspair = 0;
+  long r;
+  clock_t start, tgrid = 0, tpair = 0;
+  n = 0;
+  for(i=0; i<15; i=i+1){
+    Collision_MakeMask(&masks[n], Images[i/5].bmp, 0);
+    objs[n].x = 2 + 16*(i%5); objs[n].y = 9 + 10*(i/5);
+    objs[n].group = 0x02; n = n + 1;
+  }
+  for(i=0; i<4; i=i+1){
+    Collision_MakeMask(&masks[n], Bunker0, 0);
+    objs[n].x = 1 + 21*i; objs[n].y = 39;
+    objs[n].group = 0x04; n = n + 1;
+  }
+  Collision_MakeMask(&masks[n], PlayerShip0, 0);
+  objs[n].x = 32; objs[n].y = 47; objs[n].group = 0x08; n = n + 1;
+  Collision_MakeMask(&masks[n], Laser0, 0);
+  objs[n].x = 40; objs[n].y = 38; objs[n].group = 0x01; n = n + 1;
+  for(i=0; i<3; i=i+1){
+    Collision_MakeMask(&masks[n], Missile0, 0);
+    objs[n].x = 10 + 30*i; objs[n].y = 20; objs[n].group = 0x10; n = n + 1;
+  }
+  for(i=0; i<n; i=i+1){
+    objs[i].mask = &masks[i];
+  }
+  for(f=0; f<frames; f=f+1){
+    // enemies march, the rest wander, all stay on the screen
+    for(i=0; i<15; i=i+1){
+      objs[i].x = ((f/4)%2) + 16*(i%5) + ((f/16)%4);
+    }
+    for(i=19; i<n; i=i+1){
+      r = Random32();
+      objs[i].x = (r>>8)%(SCREENW - masks[i].w + 1);
+      objs[i].y = masks[i].h - 1 + (r>>20)%(SCREENH - masks[i].h + 1);
+    }
+    start = clock();
+    c = CYCLES();
+    Collision_Clear();
+    for(i=0; i<n; i=i+1){
+      Collision_Add(objs[i].x, objs[i].y, objs[i].mask, objs[i].group);
+    }
+    hits = 0;
+    for(i=0; i<n; i=i+1){
+      hits += __builtin_popcountl(Collision_Hits(i, 0xFF));
+    }
+    cgrid += CYCLES() - c;
+    tgrid += clock() - start;
+    hitsgrid += hits;
+    start = clock();
+    c = CYCLES();
+    hits = 0;
+    for(i=0; i<n; i=i+1){   // every pair, rectangles first, then pixels
+      for(j=0; j<n; j=j+1){
+        long ax = objs[i].x, bx = objs[j].x;
+        long atop = objs[i].y - masks[i].h + 1, btop = objs[j].y - masks[j].h + 1;
+        long y0, y1, y;
+        if((j == i) || (bx >= ax + masks[i].w) || (ax >= bx + masks[j].w) ||
+           (btop > objs[i].y) || (atop > objs[j].y)){
+          continue;
+        }
+        y0 = (atop > btop) ? atop : btop;
+        y1 = (objs[i].y < objs[j].y) ? objs[i].y : objs[j].y;
+        for(y=y0; y<=y1; y=y+1){
+          unsigned long a = masks[i].row[y-atop], b = masks[j].row[y-btop];
+          if((bx >= ax) ? (a & (b<<(bx-ax))) : (a & (b>>(ax-bx)))){
+            hits = hits + 1;
+            break;
+          }
+        }
+      }
+    }
+    cpair += CYCLES() - c;
+    tpair += clock() - start;
+    hitspair += hits;
+  }
+  check(hitsgrid == hitspair, "benchmark hits match every pair");
+  printf("%ld frames of %ld objects, %.2f hits per frame\n", frames, n, (double)hitsgrid/frames);
+  printf("%-12s %12s %12s\n", "", "cyc/frame", "ns/frame");
+  printf("%-12s %12.0f %12.0f\n", "grid", (double)cgrid/frames,
+         1e9*(double)tgrid/CLOCKS_PER_SEC/frames);
+  printf("%-12s %12.0f %12.0f\n", "every pair", (double)cpair/frames,
+         1e9*(double)tpair/CLOCKS_PER_SEC/frames);
+}
+
+int main(int argc, char **argv){
+  long scenes = 2000, frames = 10000;
+  if(argc > 1){
+    scenes = atol(argv[1]);
+  }
+  if(argc > 2){
+    frames = atol(argv[2]);
+  }
+  TestMakeMask();
+  TestAdd();
+  TestScenes(scenes);
+  TestDraw();
+  Bench(frames);
+  if(Errors){
+    printf("%ld checks failed\n", Errors);
+    return 1;
+  }
+  printf("all checks pass\n");
+  return 0;
+}
@@ -0,0 +1,154 @@
+// DisplayTest.c
+// Runs on a PC, not on the LaunchPad
+// Runs the game's frames through Nokia5110.c, built with
+// HEADLESS defined, against its host model of SSI0, uDMA
+// channel 11 and the LCD, and checks that
+//   every frame sent with Nokia5110_DisplayBufferAsync() ends
+//     up on the LCD, even though the screen buffer is cleared
+//     as soon as the call returns
+//   the task runs once per frame, from SSI0_Handler()
+// It then measures how long each frame holds up the caller
+// with Nokia5110_DisplayBuffer() and with
+// Nokia5110_DisplayBufferAsync(), when the game spends a given
+// time drawing each frame.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o DisplayTest DisplayTest.c ../SpaceInvaders.c ../Nokia5110.c ../../Format.c
+// usage: DisplayTest [-n frames] [-w us]
+//   -n frames  frames in each run (default 2000)
+//   -w us      time the game spends drawing a frame (default 1000)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../Nokia5110.h"
+
+extern char Screen[];       // screen buffer in Nokia5110.c
+extern char LCD[];          // display RAM of the LCD model in Nokia5110.c
+void Game_Init(void);
+void Game_Frame(unsigned long pot, unsigned long buttons);
+
+#define SCREENBYTES (SCREENW*SCREENH/8)
+static char Expect[SCREENBYTES];
+static long Frames = 2000;
+static unsigned long Work = 80000;     // bus cycles per frame spent drawing
+static long Done;                      // tasks run
+static int Errors;
+
+static void check(int ok, const char *what){
+  if(!ok){
+    printf("FAIL %s\n", what);
+    Errors = Errors + 1;
+  }
+}
+
+// C version of random.s, see Headless.c
+static unsigned long M;
+void Random_Init(unsigned long seed){
+  M = seed;
+}
+unsigned long Random(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M>>24;
+}
+
+// scripted inputs: sweep the pot, tap fire
+static void frame(long n){ long i;
+  i = (n*41)%8190;
+  Game_Frame((i < 4095) ? i : 8190 - i, ((n%23) < 3) ? 0x01 : 0);
+}
+
+static void task(void){
+  Done = Done + 1;
+}
+
+static void start(void){
+  Random_Init(1);
+  Nokia5110_Init();
+  Nokia5110_ClearBuffer();
+  Nokia5110_DisplayBuffer();
+  while(!Nokia5110_ModelIdle()){
+    Nokia5110_ModelTick(192);
+  }
+  Game_Init();
+  Done = 0;
+}
+
+//------------correctness------------
+// send each frame, wreck the buffer, then let the model finish
+static void Check(void){ long n, bad = 0;
+  start();
+  for(n=0; n<Frames; n=n+1){
+    frame(n);
+    memcpy(Expect, Screen, SCREENBYTES);
+    Nokia5110_DisplayBufferAsync(task);
+    check(Nokia5110_DisplayBusy(), "async call returns while the frame is going out");
+    Nokia5110_ClearBuffer();            // the next frame can start right away
+    while(!Nokia5110_ModelIdle()){
+      Nokia5110_ModelTick(192);
+    }
+    if(memcmp(LCD, Expect, SCREENBYTES) != 0){
+      bad = bad + 1;
+    }
+  }
+  check(bad == 0, "every async frame reaches the LCD");
+  check(Done == Frames, "the task runs once per frame");
+  printf("%ld frames sent by uDMA, %ld reached the LCD intact, %ld tasks\n",
+         Frames, Frames - bad, Done);
+}
+
+//------------timing------------
+// draw for Work cycles, then hand the frame to the display
+static void Time(int async){ long n;
+  unsigned long t, wait, waitmax = 0, bytes = 0, data, cmds;
+  unsigned long long waits = 0, total;
+  start();
+  total = Nokia5110_ModelTime();
+  for(n=0; n<Frames; n=n+1){
+    frame(n);
+    Nokia5110_ModelTick(Work);          // the CPU draws, a frame may be going out
+    t = Nokia5110_ModelTime();
+    if(async){
+      Nokia5110_DisplayBufferAsync(task);
+    } else{
+      Nokia5110_DisplayBuffer();
+    }
+    wait = Nokia5110_ModelTime() - t;
+    Nokia5110_DisplayStats(&data, &cmds);
+    bytes = bytes + data;
+    waits = waits + wait;
+    if(wait > waitmax){
+      waitmax = wait;
+    }
+  }
+  total = Nokia5110_ModelTime() - total;
+  if(async){
+    check(Done >= Frames - 1, "async tasks keep up");
+  }
+  printf("%-19s %9lu %11.1f %9.1f %11.1f %9.0f\n",
+         async ? "DisplayBufferAsync" : "DisplayBuffer", bytes/Frames,
+         (double)waits/Frames/80, (double)waitmax/80,
+         (double)total/Frames/80, 80e6*Frames/total);
+}
+
+int main(int argc, char **argv){ int i;
+  for(i=1; i+1<argc; i=i+2){
+    if(strcmp(argv[i], "-n") == 0){
+      Frames = atol(argv[i+1]);
+    } else if(strcmp(argv[i], "-w") == 0){
+      Work = 80*atol(argv[i+1]);
+    }
+  }
+  Check();
+  printf("\n%lu us of drawing per frame, SSIClk 3.33 MHz\n", Work/80);
+  printf("%-19s %9s %11s %9s %11s %9s\n", "", "bytes", "wait us", "max us",
+         "frame us", "frames/s");
+  Time(0);
+  Time(1);
+  if(Errors){
+    printf("%d errors\n", Errors);
+    return 1;
+  }
+  printf("passed\n");
+  return 0;
+}
@@ -0,0 +1,201 @@
+// Headless.c
+// Runs on a PC, not on the LaunchPad
+// Headless build of SpaceInvaders.c for regression and
+// performance testing.  The game's Game_Init() and Game_Frame()
+// are run as fast as the PC can go, with the slide pot and
+// buttons read from an input trace instead of PE2 and PE0/PE1.
+// Nokia5110.c is built with HEADLESS defined, so each frame is
+// sent through the normal Nokia5110_DisplayBuffer() into host
+// models of SSI0 and the LCD (LCD[]) rather than the real ones.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o Headless Headless.c ../SpaceInvaders.c ../Nokia5110.c ../../Format.c
+// usage: Headless [options]
+//   -r file     record: write a trace of scripted inputs to file and play it
+//   -n frames   number of frames for -r (default 1000)
+//   -s seed     Random_Init seed for -r (default 1)
+//   -t file     replay: read the seed and inputs from a trace
+//   -h file     write the hash of every frame to file
+//   -c file     compare every frame hash with a file written by -h,
+//               stop at the first frame that differs
+//   -p folder   dump every frame as folder/frameNNNNN.pbm
+//
+// Trace file: the first line is "seed N", then one line per
+// frame with the slide pot (0 to 4095) and the buttons (bit 0
+// fire, bit 1 special weapon), e.g. "2048 1".
+// Hash file: one line per frame, "frame hash", where hash is
+// the 32-bit FNV-1a hash of the 504 bytes the LCD shows.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Nokia5110.h"
+#include "../random.h"
+
+#define MAXFRAMES   1000000
+
+extern char Screen[];       // screen buffer in Nokia5110.c
+extern char LCD[];          // display RAM of the LCD model in Nokia5110.c
+void Game_Init(void);
+void Game_Frame(unsigned long pot, unsigned long buttons);
+
+unsigned short TracePot[MAXFRAMES];
+unsigned char TraceButtons[MAXFRAMES];
+
+// *************************** Random ***************************
+// C version of random.s, same linear congruential generator.
+// random.s always starts from 1; here the seed is used so each
+// trace can pick its own, and replays start from the same one.
+static unsigned long M;
+void Random_Init(unsigned long seed){
+  M = seed;
+}
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+unsigned long Random(void){
+  return Random32()>>24;    // top 8 bits of number
+}
+
+// 32-bit FNV-1a hash of what the LCD shows
+unsigned long Hash(void){ int i;
+  unsigned long h = 2166136261UL;
+  for(i=0; i<SCREENW*SCREENH/8; i=i+1){
+    h = ((h^(unsigned char)LCD[i])*16777619UL)&0xFFFFFFFF;
+  }
+  return h;
+}
+
+// Write the LCD as a binary PBM, 84 pixels is 11 bytes per row
+void DumpPBM(const char *folder, long frame){ FILE *f;
+  char name[512];
+  unsigned char row[(SCREENW+7)/8];
+  int x, y;
+  sprintf(name, "%s/frame%05ld.pbm", folder, frame);
+  f = fopen(name, "wb");
+  if(f == NULL){
+    return;
+  }
+  fprintf(f, "P4\n%d %d\n", SCREENW, SCREENH);
+  for(y=0; y<SCREENH; y=y+1){
+    memset(row, 0, sizeof(row));
+    for(x=0; x<SCREENW; x=x+1){
+      if(LCD[SCREENW*(y/8) + x]&(1<<(y%8))){
+        row[x/8] |= 0x80>>(x%8);
+      }
+    }
+    fwrite(row, 1, sizeof(row), f);
+  }
+  fclose(f);
+}
+
+int main(int argc, char **argv){
+  const char *record = 0, *trace = 0, *hashout = 0, *compare = 0, *folder = 0;
+  FILE *f, *hf = 0, *cf = 0;
+  long frames = 1000, n, i, ref;
+  unsigned long seed = 1, h, refh, pot, buttons;
+  clock_t start;
+  double seconds;
+  for(i=1; i<argc; i=i+1){
+    if((argv[i][0] != '-') || (i+1 >= argc)){
+      fprintf(stderr, "usage: Headless [-r file [-n frames] [-s seed] | -t file] [-h file] [-c file] [-p folder]\n");
+      return 2;
+    }
+    switch(argv[i][1]){
+      case 'r': record = argv[i+1]; break;
+      case 'n': frames = atol(argv[i+1]); break;
+      case 's': seed = strtoul(argv[i+1], 0, 0); break;
+      case 't': trace = argv[i+1]; break;
+      case 'h': hashout = argv[i+1]; break;
+      case 'c': compare = argv[i+1]; break;
+      case 'p': folder = argv[i+1]; break;
+    }
+    i = i + 1;
+  }
+  if(frames > MAXFRAMES){
+    frames = MAXFRAMES;
+  }
+  if(trace){                // replay a recorded trace
+    f = fopen(trace, "r");
+    if((f == NULL) || (fscanf(f, " seed %lu", &seed) != 1)){
+      fprintf(stderr, "can't read trace %s\n", trace);
+      return 2;
+    }
+    for(n=0; (n<MAXFRAMES) && (fscanf(f, "%lu %lu", &pot, &buttons) == 2); n=n+1){
+      TracePot[n] = pot&0xFFF;
+      TraceButtons[n] = buttons&0x03;
+    }
+    fclose(f);
+    frames = n;
+  } else{                   // scripted inputs: sweep the pot, tap fire
+    for(n=0; n<frames; n=n+1){
+      i = (n*41)%8190;      // triangle wave 0..4095..0
+      TracePot[n] = (i < 4095) ? i : 8190 - i;
+      TraceButtons[n] = ((n%23) < 3) ? 0x01 : 0;
+    }
+    if(record){
+      f = fopen(record, "w");
+      if(f == NULL){
+        fprintf(stderr, "can't write trace %s\n", record);
+        return 2;
+      }
+      fprintf(f, "seed %lu\n", seed);
+      for(n=0; n<frames; n=n+1){
+        fprintf(f, "%u %u\n", TracePot[n], TraceButtons[n]);
+      }
+      fclose(f);
+    }
+  }
+  if(hashout && ((hf = fopen(hashout, "w")) == NULL)){
+    fprintf(stderr, "can't write %s\n", hashout);
+    return 2;
+  }
+  if(compare && ((cf = fopen(compare, "r")) == NULL)){
+    fprintf(stderr, "can't read %s\n", compare);
+    return 2;
+  }
+  Random_Init(seed);
+  Nokia5110_Init();
+  Nokia5110_ClearBuffer();
+  Nokia5110_DisplayBuffer();
+  Game_Init();
+  start = clock();
+  for(n=0; n<frames; n=n+1){
+    Game_Frame(TracePot[n], TraceButtons[n]);
+    Nokia5110_DisplayBuffer();
+    Nokia5110_ModelTick(80000000/30);   // rest of the 30 Hz frame, the FIFO empties
+    if(memcmp(LCD, Screen, SCREENW*SCREENH/8) != 0){
+      fprintf(stderr, "frame %ld: LCD does not match Screen[] after DisplayBuffer\n", n);
+      return 1;
+    }
+    h = Hash();
+    if(hf){
+      fprintf(hf, "%ld %08lx\n", n, h);
+    }
+    if(folder){
+      DumpPBM(folder, n);
+    }
+    if(cf){
+      if(fscanf(cf, "%ld %lx", &ref, &refh) != 2){
+        fprintf(stderr, "frame %ld: no reference hash\n", n);
+        return 1;
+      }
+      if((ref != n) || (refh != h)){
+        fprintf(stderr, "frame %ld: hash %08lx differs from reference %08lx\n", n, h, refh);
+        return 1;
+      }
+    }
+  }
+  seconds = (double)(clock() - start)/CLOCKS_PER_SEC;
+  if(hf){
+    fclose(hf);
+  }
+  if(cf){
+    fclose(cf);
+  }
+  fprintf(stderr, "%ld frames, seed %lu, %.3f s, %.0f frames/s\n", frames, seed,
+          seconds, (seconds > 0) ? frames/seconds : 0.0);
+  return 0;
+}
@@ -0,0 +1,321 @@
+// SoundTest.c
+// Runs on a PC, not on the LaunchPad
+// Golden vector test for the mixer in Sound.c.  The test plays
+// the part of the DAC, Timer0A and the NVIC: every sample time
+// it calls Play(), the Timer0A task, and it runs PendSV_Handler()
+// a set number of sample times after Play() pends it.
+//  - each clip played alone must come out of the DAC as exactly
+//    its 4-bit samples, then silence (8)
+//  - four overlapping clips must match a reference mixer
+//  - a long random session with voice stealing must give the
+//    same DAC output whether PendSV runs right away or up to 40
+//    samples late, and that output must hash to GOLDEN, the
+//    value the mixer gave when it still ran inside Play()
+//  - average cost of Play() on every sample and on the last
+//    sample of a block, and of PendSV_Handler(), in CPU cycles
+//    on x86 (rdtsc)
+//  - cost of decoding the packed 4-bit clips, in cycles per
+//    sample, against the same mixer reading 8-bit clips
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o SoundTest SoundTest.c ../Sound.c
+// usage: SoundTest
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../Sound.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+extern const unsigned char shoot[], invaderkilled[], explosion[], highpitch[];
+extern const unsigned char fastinvader1[], fastinvader2[], fastinvader3[], fastinvader4[];
+extern unsigned long Steals, Drops, Out;
+void Play(void);
+unsigned long Sound_Mix(unsigned char *block);
+void PendSV_Handler(void);
+
+// FNV-1a of the DAC output of RandomSession(), 400000 samples
+#define GOLDEN 0xF15C13BFUL
+
+struct clip{
+  const char *name;
+  const unsigned char *wave;
+  unsigned long count;
+  void (*start)(void);
+};
+const struct clip Clips[] = {
+  {"shoot",         shoot,         4080, Sound_Shoot},
+  {"invaderkilled", invaderkilled, 3377, Sound_Killed},
+  {"explosion",     explosion,     2000, Sound_Explosion},
+  {"fastinvader1",  fastinvader1,   982, Sound_Fastinvader1},
+  {"fastinvader2",  fastinvader2,  1042, Sound_Fastinvader2},
+  {"fastinvader3",  fastinvader3,  1054, Sound_Fastinvader3},
+  {"fastinvader4",  fastinvader4,  1098, Sound_Fastinvader4},
+  {"highpitch",     highpitch,     1802, Sound_Highpitch}
+};
+#define CLIPS (sizeof(Clips)/sizeof(Clips[0]))
+
+// ************ model of the hardware Sound.c uses ************
+unsigned long NVIC_EN0_R, NVIC_DIS0_R, NVIC_INT_CTRL_R, NVIC_SYS_PRI3_R, TIMER0_CTL_R;
+static void (*Task)(void);
+static int Enabled;                 // IRQ 19 is enabled
+static unsigned long Level;         // DAC output
+static long Lag;                    // sample times from pend to PendSV
+static long Pending = -1;           // sample times until PendSV runs, -1 if none
+static unsigned long long PlaySum, PlayN, EndSum, EndN, MixSum, MixN;
+
+void DAC_Init(unsigned long bits){
+  Level = 0;
+}
+void DAC_Out(unsigned long data){
+  Level = data;
+}
+void Timer0_Init(void(*task)(void), unsigned long period){
+  Task = task;
+  Enabled = 1;
+}
+
+static void Mix(void){ unsigned long long c;
+  Pending = -1;
+  c = CYCLES();
+  PendSV_Handler();
+  c = CYCLES() - c;
+  MixSum += c; MixN++;
+}
+
+// one sample time: Timer0A if enabled, then PendSV if it is due
+// output: DAC level during this sample time
+static unsigned long Step(void){ unsigned long long c;
+  if(NVIC_EN0_R&(1<<19)){
+    Enabled = 1;
+    NVIC_EN0_R = 0;
+  }
+  if(Enabled){
+    c = CYCLES();
+    Task();
+    c = CYCLES() - c;
+    PlaySum += c; PlayN++;
+    if((Out&63) == 0){      // just finished a block
+      EndSum += c; EndN++;
+    }
+  }
+  if(NVIC_INT_CTRL_R&0x10000000){
+    NVIC_INT_CTRL_R = 0;
+    Pending = Lag;
+  }
+  if(Pending == 0){
+    Mix();
+  } else if(Pending > 0){
+    Pending--;
+  }
+  if(NVIC_DIS0_R&(1<<19)){
+    Enabled = 0;
+    NVIC_DIS0_R = 0;
+  }
+  return Level;
+}
+
+// Foreground code, such as starting a clip, cannot run while
+// PendSV is pending, PendSV has a higher priority.
+static void Foreground(void){
+  if(Pending >= 0){
+    Mix();
+  }
+}
+
+static void Reset(long lag){
+  Lag = lag;
+  Pending = -1;
+  NVIC_EN0_R = NVIC_DIS0_R = NVIC_INT_CTRL_R = TIMER0_CTL_R = 0;
+  Sound_Init();
+}
+
+static long Errors;
+static void check(int ok, const char *what){
+  if(!ok){
+    if(Errors < 10){
+      printf("FAIL: %s\n", what);
+    }
+    Errors = Errors + 1;
+  }
+}
+
+static unsigned long sample(const unsigned char *wave, unsigned long i){
+  return (i&1) ? (wave[i/2]&0x0F) : (wave[i/2]>>4);
+}
+
+// A clip started at sample time 50 is in the block mixed after
+// sample 63 and plays from sample 128.
+void TestAlone(void){ unsigned long i, t, bad;
+  for(i=0; i<CLIPS; i=i+1){
+    Reset(0);
+    bad = 0;
+    for(t=0; t<Clips[i].count + 1000; t=t+1){
+      if(t == 50){
+        Foreground();
+        Clips[i].start();
+      }
+      if(Step() != (((t >= 128) && (t < 128 + Clips[i].count)) ?
+                     sample(Clips[i].wave, t - 128) : 8)){
+        bad = bad + 1;
+      }
+    }
+    if(bad){
+      printf("%s: %lu samples differ\n", Clips[i].name, bad);
+    }
+    check(bad == 0, "clip alone");
+    check(Enabled == 0, "Timer0A stops after the clip");
+  }
+}
+
+// Four clips overlapping, compared with summing around 128,
+// clipping to 0 to 255 and shifting down to 4 bits
+void TestMix(void){ unsigned long t, v, bad = 0, expect;
+  const unsigned long clip[4] = {0, 3, 2, 7};
+  const unsigned long at[4] = {50, 50+64*3, 50+64*10, 50+64*12};
+  long sum;
+  Reset(0);
+  for(t=0; t<6000; t=t+1){
+    sum = 128;
+    for(v=0; v<4; v=v+1){
+      if(t == at[v]){
+        Foreground();
+        Clips[clip[v]].start();
+      }
+      if((t >= at[v] - 50 + 128) && (t < at[v] - 50 + 128 + Clips[clip[v]].count)){
+        sum += (sample(Clips[clip[v]].wave, t - (at[v] - 50 + 128))<<4) - 128;
+      }
+    }
+    expect = (sum < 0) ? 0 : (sum > 255) ? 15 : sum>>4;
+    if(Step() != expect){
+      bad = bad + 1;
+    }
+  }
+  if(bad){
+    printf("four voices: %lu samples differ\n", bad);
+  }
+  check(bad == 0, "four voices");
+}
+
+// Random clips, about one every 400 samples in bursts that
+// steal voices, and quiet spells long enough for Timer0A to stop.  Clips start
+// at sample 50 of a block, after PendSV has run.
+#define SESSION 400000
+static unsigned long M = 1;
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+unsigned long RandomSession(long lag, unsigned char *out){
+  unsigned long t, hash = 2166136261UL;
+  M = 1;
+  Reset(lag);
+  for(t=0; t<SESSION; t=t+1){
+    if((((Enabled ? Out : t)&63) == 50) && ((Random32()>>16)%((t%40000 < 30000) ? 6 : 2000) == 0)){
+      Foreground();
+      Clips[(Random32()>>16)%CLIPS].start();
+    }
+    out[t] = Step();
+    hash = ((hash ^ out[t])*16777619UL)&0xFFFFFFFF;
+  }
+  return hash;
+}
+
+// The mixer as it was before the clips were packed: one 8-bit
+// sample per byte.  Same block, sum, clip and shift.
+static unsigned long mix8(const unsigned char *wave[], unsigned long index[],
+                          unsigned long count[], long voices, unsigned char *block){
+  long sum[64];
+  unsigned long i, n, v;
+  for(i=0; i<64; i++){
+    sum[i] = 128;
+  }
+  for(v=0; v<voices; v++){
+    n = (count[v] > 64) ? 64 : count[v];
+    for(i=0; i<n; i++){
+      sum[i] += wave[v][index[v]+i] - 128;
+    }
+    index[v] += n;
+    count[v] -= n;
+  }
+  for(i=0; i<64; i++){
+    block[i] = (sum[i] < 0) ? 0 : (sum[i] > 255) ? 15 : sum[i]>>4;
+  }
+  return voices;
+}
+
+// Mix the first clips of Clips[] start to finish, 1 to 4 voices
+// at once, packed through Sound_Mix() and 8-bit through mix8()
+// output: cycles per voice sample, packed and 8-bit
+#define DECODEPASSES 2000
+void DecodeBench(long voices, double *packed, double *bits8){
+  static unsigned char wave8[4][4080];
+  const unsigned char *wave[4];
+  unsigned long index[4], count[4], i, v, samples = 0;
+  unsigned char block[64], check8[64];
+  unsigned long long c, c4 = 0, c8 = 0;
+  long pass;
+  for(v=0; v<voices; v++){
+    for(i=0; i<Clips[v].count; i++){
+      wave8[v][i] = sample(Clips[v].wave, i)<<4; // what the 8-bit clips held, >>4 is exact
+    }
+    wave[v] = wave8[v];
+  }
+  for(pass=0; pass<DECODEPASSES; pass++){
+    Reset(0);
+    for(v=0; v<voices; v++){
+      Sound_PlayPriority(Clips[v].wave, Clips[v].count, 1);
+      index[v] = 0;
+      count[v] = Clips[v].count;
+      samples += (pass == 0) ? Clips[v].count : 0;
+    }
+    do{
+      c = CYCLES();
+      i = Sound_Mix(block);
+      c4 += CYCLES() - c;
+      c = CYCLES();
+      mix8(wave, index, count, voices, check8);
+      c8 += CYCLES() - c;
+      check(memcmp(block, check8, 64) == 0, "packed and 8-bit clips mix the same");
+    } while(i);
+  }
+  *packed = (double)c4/DECODEPASSES/samples;
+  *bits8 = (double)c8/DECODEPASSES/samples;
+}
+
+int main(void){ long lag, v;
+  double packed, bits8;
+  static unsigned char first[SESSION], out[SESSION];
+  unsigned long hash;
+  TestAlone();
+  TestMix();
+  hash = RandomSession(0, first);
+  printf("random session: %lu voices stolen, %lu clips dropped, hash %08lX\n", Steals, Drops, hash);
+  check((Steals > 0) && (Drops > 0), "voices were stolen and clips dropped");
+  check(hash == GOLDEN, "golden hash");
+  PlaySum = PlayN = EndSum = EndN = MixSum = MixN = 0;
+  for(lag=1; lag<=40; lag=lag+13){
+    RandomSession(lag, out);
+    check(memcmp(first, out, SESSION) == 0, "same output with PendSV late");
+  }
+  printf("%-16s %10s %10s\n", "", "calls", "avg cyc");
+  printf("%-16s %10llu %10.1f\n", "Play (Timer0A)", PlayN, (double)PlaySum/PlayN);
+  printf("%-16s %10llu %10.1f\n", "  end of block", EndN, (double)EndSum/EndN);
+  printf("%-16s %10llu %10.1f\n", "PendSV (mix)", MixN, (double)MixSum/MixN);
+  printf("%-16s %10s %10s\n", "mixing", "packed", "8-bit");
+  for(v=1; v<=4; v=v+1){
+    DecodeBench(v, &packed, &bits8);
+    printf("%ld voice%-9s %10.2f %10.2f cycles per voice sample\n", v, (v > 1) ? "s" : "", packed, bits8);
+  }
+  if(Errors){
+    printf("%ld checks failed\n", Errors);
+    return 1;
+  }
+  printf("all checks pass\n");
+  return 0;
+}
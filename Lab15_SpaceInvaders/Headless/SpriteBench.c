@@ -0,0 +1,140 @@
+// SpriteBench.c
+// Runs on a PC, not on the LaunchPad
+// Checks and times Nokia5110_PrintSprite() against
+// Nokia5110_PrintBMP() for the images the game draws every
+// frame, the BMP arrays in SpaceInvaders.c and the sprites
+// SpriteConvert made from them.
+//  - each pair is drawn at every position on the screen over a
+//    random background, and the two Screen[] results must match
+//  - time per sprite, in CPU cycles on x86 (rdtsc) and in ns
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o SpriteBench SpriteBench.c ../SpaceInvaders.c ../Nokia5110.c ../../Format.c
+// usage: SpriteBench [passes]   (default 200)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Nokia5110.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+extern char Screen[];       // screen buffer in Nokia5110.c
+extern const unsigned char SmallEnemy30PointA[], SmallEnemy30PointASprite[];
+extern const unsigned char SmallEnemy20PointA[], SmallEnemy20PointASprite[];
+extern const unsigned char SmallEnemy10PointA[], SmallEnemy10PointASprite[];
+extern const unsigned char SmallEnemy10PointB[], SmallEnemy10PointBSprite[];
+extern const unsigned char PlayerShip0[], PlayerShip0Sprite[];
+extern const unsigned char Bunker0[], Bunker0Sprite[];
+extern const unsigned char Missile0[], Missile0Sprite[];
+extern const unsigned char Laser0[], Laser0Sprite[];
+
+struct pair{
+  const char *name;
+  const unsigned char *bmp;
+  const unsigned char *sprite;
+};
+const struct pair Pairs[] = {
+  {"Enemy30A",  SmallEnemy30PointA, SmallEnemy30PointASprite},
+  {"Enemy20A",  SmallEnemy20PointA, SmallEnemy20PointASprite},
+  {"Enemy10A",  SmallEnemy10PointA, SmallEnemy10PointASprite},
+  {"Enemy10B",  SmallEnemy10PointB, SmallEnemy10PointBSprite},
+  {"Player",    PlayerShip0,        PlayerShip0Sprite},
+  {"Bunker",    Bunker0,            Bunker0Sprite},
+  {"Missile",   Missile0,           Missile0Sprite},
+  {"Laser",     Laser0,             Laser0Sprite}
+};
+#define PAIRS (sizeof(Pairs)/sizeof(Pairs[0]))
+#define SCREENBYTES (SCREENW*SCREENH/8)
+
+// SpaceInvaders.c is linked for its images, Game_Frame() is not run
+unsigned long Random(void){
+  return 0;
+}
+
+static unsigned long M = 1;
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+
+// Draw one pair at every position over a random background,
+// return the number of positions where the results differ
+long Check(const struct pair *p){ long x, y, i, bad = 0;
+  char background[SCREENBYTES], expect[SCREENBYTES];
+  long width = p->sprite[0], height = p->sprite[1];
+  for(y=height-1; y<SCREENH; y=y+1){
+    for(x=0; x+width<=SCREENW; x=x+1){
+      for(i=0; i<SCREENBYTES; i=i+1){
+        background[i] = Random32()>>24;
+      }
+      memcpy(Screen, background, SCREENBYTES);
+      Nokia5110_PrintBMP(x, y, p->bmp, 0);
+      memcpy(expect, Screen, SCREENBYTES);
+      memcpy(Screen, background, SCREENBYTES);
+      Nokia5110_PrintSprite(x, y, p->sprite);
+      if(memcmp(expect, Screen, SCREENBYTES) != 0){
+        if(bad == 0){
+          printf("%s: PrintSprite differs from PrintBMP at x=%ld y=%ld\n", p->name, x, y);
+        }
+        bad = bad + 1;
+      }
+    }
+  }
+  return bad;
+}
+
+// Time drawing one pair at every position, passes times over
+// output: cycles and ns per sprite in *cycles and *ns
+void Time(const struct pair *p, int sprite, long passes, double *cycles, double *ns){
+  long x, y, n, count = 0;
+  long width = p->sprite[0], height = p->sprite[1];
+  unsigned long long c;
+  clock_t start;
+  start = clock();
+  c = CYCLES();
+  for(n=0; n<passes; n=n+1){
+    for(y=height-1; y<SCREENH; y=y+1){
+      for(x=0; x+width<=SCREENW; x=x+1){
+        if(sprite){
+          Nokia5110_PrintSprite(x, y, p->sprite);
+        } else{
+          Nokia5110_PrintBMP(x, y, p->bmp, 0);
+        }
+        count = count + 1;
+      }
+    }
+  }
+  c = CYCLES() - c;
+  *cycles = (double)c/count;
+  *ns = 1e9*(double)(clock() - start)/CLOCKS_PER_SEC/count;
+}
+
+int main(int argc, char **argv){ unsigned long i;
+  long passes = 200, errors = 0;
+  double bmpc, bmpns, sprc, sprns;
+  if(argc > 1){
+    passes = atol(argv[1]);
+  }
+  printf("%-10s %6s %11s %11s %11s %11s %8s\n", "image", "size",
+         "BMP cyc", "sprite cyc", "BMP ns", "sprite ns", "speedup");
+  for(i=0; i<PAIRS; i=i+1){
+    errors = errors + Check(&Pairs[i]);
+    Time(&Pairs[i], 0, passes, &bmpc, &bmpns);
+    Time(&Pairs[i], 1, passes, &sprc, &sprns);
+    printf("%-10s %3dx%-2d %11.1f %11.1f %11.1f %11.1f %7.1fx\n", Pairs[i].name,
+           Pairs[i].sprite[0], Pairs[i].sprite[1], bmpc, sprc, bmpns, sprns,
+           (sprns > 0) ? bmpns/sprns : 0.0);
+  }
+  if(errors){
+    printf("%ld positions differ\n", errors);
+    return 1;
+  }
+  printf("every position matches PrintBMP\n");
+  return 0;
+}
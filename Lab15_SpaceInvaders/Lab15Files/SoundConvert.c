@@ -0,0 +1,107 @@
+// SoundConvert.c
+// Runs on a PC (any C compiler), not on the LaunchPad
+// Converts a .wav file into the packed 4-bit sound format
+// played by Sound.c.  The DAC is only 4 bits, and Sound.c used
+// to shift every 8-bit sample right by 4 as it played, so
+// keeping just the top 4 bits loses nothing that was heard and
+// halves the flash: two samples per byte, the first sample in
+// the upper 4 bits.
+//
+// build: gcc -o SoundConvert SoundConvert.c
+// usage: SoundConvert file.wav [name [first [count]]]
+//   name   C array name (default is the file name)
+//   first  first sample to keep (default 0)
+//   count  number of samples to keep (default all)
+// The .wav must be mono, 8-bit or 16-bit PCM, and should be
+// 11.025 kHz to match the Timer0A rate in Sound.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXSAMPLES 200000
+
+unsigned char Wav[2*MAXSAMPLES+1024];
+unsigned char Sample[MAXSAMPLES];   // 8-bit unsigned, 128 is silence
+
+// little endian fields of the .wav header
+unsigned long Field32(long i){
+  return Wav[i] + (Wav[i+1]<<8) + (Wav[i+2]<<16) + ((unsigned long)Wav[i+3]<<24);
+}
+unsigned long Field16(long i){
+  return Wav[i] + (Wav[i+1]<<8);
+}
+
+int main(int argc, char **argv){
+  FILE *f;
+  char name[64], *p;
+  long size, i, n, first = 0, count = -1, channels = 0, bits = 0, rate = 0;
+  long data = 0, length = 0;
+  if(argc < 2){
+    fprintf(stderr, "usage: SoundConvert file.wav [name [first [count]]]\n");
+    return 1;
+  }
+  f = fopen(argv[1], "rb");
+  if(f == NULL){
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 1;
+  }
+  size = (long)fread(Wav, 1, sizeof(Wav), f);
+  fclose(f);
+  if(argc > 2){
+    strncpy(name, argv[2], sizeof(name)-1);
+  } else{                           // default name is the file name
+    p = strrchr(argv[1], '/');
+    strncpy(name, p ? p+1 : argv[1], sizeof(name)-1);
+    p = strchr(name, '.');
+    if(p) *p = 0;
+  }
+  name[sizeof(name)-1] = 0;
+  if(argc > 3) first = atol(argv[3]);
+  if(argc > 4) count = atol(argv[4]);
+  if((size < 44) || memcmp(Wav, "RIFF", 4) || memcmp(&Wav[8], "WAVE", 4)){
+    fprintf(stderr, "%s is not a .wav file\n", argv[1]);
+    return 1;
+  }
+  // walk the chunks for "fmt " and "data"
+  for(i=12; i+8<=size; i=i+8+((Field32(i+4)+1)&~1UL)){
+    if(memcmp(&Wav[i], "fmt ", 4) == 0){
+      channels = Field16(i+10);
+      rate = Field32(i+12);
+      bits = Field16(i+22);
+    } else if(memcmp(&Wav[i], "data", 4) == 0){
+      data = i+8;
+      length = Field32(i+4);
+      if(data+length > size){
+        length = size-data;
+      }
+      break;
+    }
+  }
+  if((channels != 1) || ((bits != 8) && (bits != 16)) || (data == 0)){
+    fprintf(stderr, "%s must be mono 8-bit or 16-bit PCM\n", argv[1]);
+    return 1;
+  }
+  if(rate != 11025){
+    fprintf(stderr, "warning: %s is %ld Hz, Sound.c plays at 11025 Hz\n", argv[1], rate);
+  }
+  n = length/(bits/8);
+  for(i=0; i<n; i=i+1){             // 16-bit samples are signed
+    Sample[i] = (bits == 8) ? Wav[data+i] : (unsigned char)(Wav[data+2*i+1]^0x80);
+  }
+  if(first > n) first = n;
+  if((count < 0) || (first+count > n)) count = n-first;
+  printf("// %s converted from %s, samples %ld to %ld\n", name, argv[1], first, first+count-1);
+  printf("// %ld samples, 4 bits each, %ld bytes (%ld bytes less than 8-bit)\n",
+         count, (count+1)/2, count-(count+1)/2);
+  printf("const unsigned char %s[%ld] = {", name, (count+1)/2);
+  for(i=0; i<count; i=i+2){
+    if((i%40) == 0){
+      printf("\n ");
+    }
+    printf(" %d%s", (Sample[first+i]&0xF0)|((i+1 < count) ? (Sample[first+i+1]>>4) : 0),
+           (i+2 < count) ? "," : "");
+  }
+  printf("};\n");
+  return 0;
+}
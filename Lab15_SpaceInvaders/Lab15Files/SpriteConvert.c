@@ -0,0 +1,139 @@
+// SpriteConvert.c
+// Runs on a PC (any C compiler), not on the LaunchPad
+// Converts the 16 color BMP images used by Nokia5110_PrintBMP()
+// into the pre-decoded sprite format drawn by
+// Nokia5110_PrintSprite().  The output is C source that can be
+// pasted into the game next to (or instead of) the BMP array.
+//
+// build: gcc -o SpriteConvert SpriteConvert.c
+// usage: SpriteConvert [-m] [-t threshold] file.bmp [name]
+//   -m            also emit a mask plane covering the whole image
+//                 rectangle, so drawing the sprite erases what was
+//                 under it (same result as Nokia5110_PrintBMP)
+//   -t threshold  grayscale colors above this number make the
+//                 pixel 'on', 0 to 14 (default 0)
+//   name          C array name (default is the file name)
+//
+// Sprite format, all bytes:
+//   [0] width in pixels (1 to 84)
+//   [1] height in pixels (1 to 48)
+//   [2] number of 8-row pages, (height+7)/8
+//   [3] flags, bit 0 set if a mask plane follows the image
+//   [4] image plane, pages*width bytes, page 0 first, one byte
+//       per column; bit 0 is the top row of the page, the same
+//       layout as Screen[] and the LCD
+//   ... mask plane (optional), same size and layout as the
+//       image; a 1 bit clears the pixel underneath before the
+//       image is ORed in
+//
+// The const unsigned char BMP arrays in SpaceInvaders.c and
+// sprite.c are the .bmp files byte for byte, so they can be
+// converted by saving them as a .bmp file or by running this
+// tool on the matching file in the *Art folders.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXW  84
+#define MAXH  48
+
+unsigned char Bmp[8192];
+unsigned char Pixel[MAXH][MAXW];    // 1 if on, row 0 is the top
+
+// read a little endian 32-bit field of the BMP header
+long Field(long i){
+  return Bmp[i] + (Bmp[i+1]<<8) + (Bmp[i+2]<<16) + ((long)Bmp[i+3]<<24);
+}
+
+int main(int argc, char **argv){
+  FILE *f;
+  char name[64], *p;
+  long size, width, height, pages, stride, offset, x, y, i, n;
+  int mask = 0, threshold = 0, arg = 1;
+  unsigned char b;
+  while((arg < argc) && (argv[arg][0] == '-')){
+    if(strcmp(argv[arg], "-m") == 0){
+      mask = 1;
+    } else if((strcmp(argv[arg], "-t") == 0) && (arg+1 < argc)){
+      arg = arg + 1;
+      threshold = atoi(argv[arg]);
+    } else{
+      break;
+    }
+    arg = arg + 1;
+  }
+  if(arg >= argc){
+    fprintf(stderr, "usage: SpriteConvert [-m] [-t threshold] file.bmp [name]\n");
+    return 1;
+  }
+  f = fopen(argv[arg], "rb");
+  if(f == NULL){
+    fprintf(stderr, "can't open %s\n", argv[arg]);
+    return 1;
+  }
+  size = (long)fread(Bmp, 1, sizeof(Bmp), f);
+  fclose(f);
+  if(arg+1 < argc){
+    strncpy(name, argv[arg+1], sizeof(name)-1);
+  } else{                           // default name is the file name
+    p = strrchr(argv[arg], '/');
+    strncpy(name, p ? p+1 : argv[arg], sizeof(name)-1);
+    p = strchr(name, '.');
+    if(p) *p = 0;
+  }
+  name[sizeof(name)-1] = 0;
+  if((size < 54) || (Bmp[0] != 'B') || (Bmp[1] != 'M') || (Bmp[28] != 4)){
+    fprintf(stderr, "%s is not a 16 color BMP\n", argv[arg]);
+    return 1;
+  }
+  width = Field(18);
+  height = Field(22);
+  offset = Field(10);
+  if((width <= 0) || (width > MAXW) || (height <= 0) || (height > MAXH)){
+    fprintf(stderr, "%s must be 1 to 84 wide and 1 to 48 tall, bottom-up\n", argv[arg]);
+    return 1;
+  }
+  if(threshold > 14){
+    threshold = 14;                 // only full 'on' turns pixel on
+  }
+  // rows are stored bottom-up, two pixels per byte, padded to 4 bytes
+  stride = (((width+1)/2) + 3)&~3;
+  if(offset + stride*height > size){
+    fprintf(stderr, "%s is truncated\n", argv[arg]);
+    return 1;
+  }
+  for(y=0; y<height; y=y+1){
+    for(x=0; x<width; x=x+1){
+      b = Bmp[offset + stride*(height-1-y) + x/2];
+      b = (x&1) ? (b&0x0F) : (b>>4);
+      Pixel[y][x] = (b > threshold);
+    }
+  }
+  pages = (height+7)/8;
+  printf("// %s converted from %s\n", name, argv[arg]);
+  printf("// width=%ld x height=%ld, %ld bytes%s\n", width, height,
+         4 + pages*width*(mask+1), mask ? ", with mask" : "");
+  printf("const unsigned char %s[] = {\n", name);
+  printf(" %ld, %ld, %ld, 0x%02X,", width, height, pages, mask);
+  n = 0;
+  for(i=0; i<=mask; i=i+1){
+    for(y=0; y<pages; y=y+1){
+      for(x=0; x<width; x=x+1){
+        b = 0;
+        for(size=0; (size<8)&&(8*y+size<height); size=size+1){
+          if((i == 1) || Pixel[8*y+size][x]){
+            b |= 1<<size;
+          }
+        }
+        if((n%16) == 0){
+          printf("\n");
+        }
+        printf(" 0x%02X,", b);
+        n = n + 1;
+      }
+    }
+  }
+  printf("\n};\n");
+  return 0;
+}
@@ -52,7 +52,12 @@
 // SSI0Clk       (SCLK, pin 7) connected to PA2
 // back light    (LED, pin 8) not connected, consists of 4 white LEDs which draw ~80mA total
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "Nokia5110.h"
+#include "Format.h"
+#include "utils/cpu_usage.h"
+#include "driverlib/udma.h"
 
 #define DC                      (*((volatile unsigned long *)0x40004100))
 #define DC_COMMAND              0
@@ -88,6 +93,12 @@
 #define SSI_CC_CS_SYSPLL        0x00000000  // Either the system clock (if the
                                             // PLL bypass is in effect) or the
                                             // PLL output (default)
+#define SSI0_DMACTL_R           (*((volatile unsigned long *)0x40008024))
+#define SSI_DMACTL_TXDMAE       0x00000002  // Transmit DMA Enable
+#define SYSCTL_RCGCDMA_R        (*((volatile unsigned long *)0x400FE60C))
+#define UDMA_CHIS_R             (*((volatile unsigned long *)0x400FF504))
+#define NVIC_EN0_R              (*((volatile unsigned long *)0xE000E100))
+#define NVIC_PRI1_R             (*((volatile unsigned long *)0xE000E404))
 #define SYSCTL_RCGC1_R          (*((volatile unsigned long *)0x400FE104))
 #define SYSCTL_RCGC2_R          (*((volatile unsigned long *)0x400FE108))
 #define SYSCTL_RCGC1_SSI0       0x00000010  // SSI0 Clock Gating Control
@@ -113,12 +124,137 @@ enum typeOfWrite{
 // transmit FIFO, configures the Data/Command pin for data,
 // and then adds the data to the transmit FIFO.
 
+// Copy of the last frame sent by Nokia5110_DisplayBuffer().
+// It is only trusted while ShadowValid is set; any function
+// that writes to the LCD directly (text, Clear, DrawFullImage)
+// clears ShadowValid so the next DisplayBuffer sends all 504
+// bytes and resynchronizes the copy.
+static char Shadow[MAX_X*MAX_Y/8];
+static int ShadowValid = 0;
+static unsigned long FrameDataBytes;    // data bytes sent by the last DisplayBuffer
+static unsigned long FrameCmdBytes;     // address command bytes sent by the last DisplayBuffer
+// Shadow[] doubles as the front buffer for
+// Nokia5110_DisplayBufferAsync(): the frame is copied there and
+// uDMA clocks it out of SSI0 while the game draws the next
+// frame in Screen[].  DMABusy is set until the last byte has
+// been handed to the SSI.
+static volatile int DMABusy = 0;
+#ifndef HEADLESS
+static int DMAReady = 0;                // uDMA channel has been configured
+#endif
+static void (*DMADoneTask)(void);       // called from the ISR when the frame is out
+
+#ifdef HEADLESS
+// Headless build for a PC (see Headless/Headless.c): there is
+// no SSI, so lcdwrite feeds a model of SSI0 and the PCD8544
+// instead.  The LCD model keeps the 504 byte display RAM in
+// LCD[], follows the 0x80 (X) and 0x40 (Y) address commands,
+// and advances the address after each data byte the way
+// horizontal addressing does, so LCD[] ends up holding exactly
+// what the real display would show.
+char LCD[MAX_X*MAX_Y/8];
+static unsigned char LcdX, LcdY, LcdH; // address and extended instruction set bit
+void static pcd8544(enum typeOfWrite type, char message){
+  if(type == COMMAND){
+    if((message&0xF8) == 0x20){         // function set, bit 0 is H
+      LcdH = message&0x01;
+    } else if(LcdH == 0){               // extended commands do not move the address
+      if(message&0x80){
+        LcdX = (message&0x7F)%MAX_X;
+      } else if((message&0xF8) == 0x40){
+        LcdY = (message&0x07)%(MAX_Y/8);
+      }
+    }
+  } else{
+    LCD[MAX_X*LcdY + LcdX] = message;
+    LcdX = LcdX + 1;
+    if(LcdX == MAX_X){
+      LcdX = 0;
+      LcdY = (LcdY + 1)%(MAX_Y/8);
+    }
+  }
+}
+
+// The SSI0 model shifts a byte out of its 8 deep transmit FIFO
+// every 192 bus cycles (8 bits of 80 MHz/24 SSIClk), with the
+// D/C level it had when it was written.  The uDMA model fills
+// the FIFO from the primary half of the frame, then the
+// alternate half, and runs SSI0_Handler() as each half is
+// done, the way channel 11 does in ping-pong mode.
+#define BYTETIME 192
+void SSI0_Handler(void);
+static unsigned long ModelTime;         // 12.5ns units
+static unsigned long ShiftTime;         // bus cycles spent on the byte going out
+static unsigned char TxFifo[8];
+static enum typeOfWrite TxType[8];
+static int TxCount;
+static char *DmaSrc[2];                 // primary, alternate
+static unsigned long DmaLeft[2];
+static int DmaHalf;                     // structure being moved, 2 when both are done
+
+static void txput(enum typeOfWrite type, char message){
+  TxFifo[TxCount] = message;
+  TxType[TxCount] = type;
+  TxCount = TxCount + 1;
+}
+// uDMA moves bytes whenever the FIFO has room
+// output: 1 if a half finished, which interrupts
+static int dmafill(void){ int irq = 0;
+  while((DmaHalf < 2) && (TxCount < 8)){
+    txput(DATA, *DmaSrc[DmaHalf]);
+    DmaSrc[DmaHalf] = DmaSrc[DmaHalf] + 1;
+    DmaLeft[DmaHalf] = DmaLeft[DmaHalf] - 1;
+    if(DmaLeft[DmaHalf] == 0){
+      DmaHalf = DmaHalf + 1;
+      irq = 1;
+    }
+  }
+  return irq;
+}
+static void dmastart(char *src, unsigned long count){
+  DmaSrc[0] = src;
+  DmaLeft[0] = count/2;
+  DmaSrc[1] = src + count/2;
+  DmaLeft[1] = count - count/2;
+  DmaHalf = 0;
+  if(dmafill()){
+    SSI0_Handler();
+  }
+}
+static int dmastopped(void){
+  return DmaHalf == 2;
+}
+// let the byte going out finish
+static void ssiwait(void){
+  Nokia5110_ModelTick(BYTETIME - ShiftTime);
+}
+void static lcdwrite(enum typeOfWrite type, char message){
+  while(DMABusy){
+    ssiwait();                          // wait for any frame transfer to finish
+  }
+  if(type == COMMAND){
+    while(TxCount){
+      ssiwait();                        // wait until SSI0 not busy/transmit FIFO empty
+    }
+    txput(COMMAND, message);
+    while(TxCount){
+      ssiwait();
+    }
+  } else{
+    while(TxCount == 8){
+      ssiwait();                        // wait until transmit FIFO not full
+    }
+    txput(DATA, message);
+  }
+}
+#else
 // This is a helper function that sends an 8-bit message to the LCD.
 // inputs: type     COMMAND or DATA
 //         message  8-bit code to transmit
 // outputs: none
 // assumes: SSI0 and port A have already been initialized and enabled
 void static lcdwrite(enum typeOfWrite type, char message){
+  while(DMABusy){};                     // wait for any frame transfer to finish
   if(type == COMMAND){
                                         // wait until SSI0 not busy/transmit FIFO empty
     while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
@@ -132,6 +268,7 @@ void static lcdwrite(enum typeOfWrite type, char message){
     SSI0_DR_R = message;                // data out
   }
 }
+#endif
 
 //********Nokia5110_Init*****************
 // Initialize Nokia 5110 48x84 LCD by sending the proper
@@ -143,6 +280,7 @@ void static lcdwrite(enum typeOfWrite type, char message){
 // outputs: none
 // assumes: system clock rate of 80 MHz
 void Nokia5110_Init(void){
+#ifndef HEADLESS
   volatile unsigned long delay;
   SYSCTL_RCGC1_R |= SYSCTL_RCGC1_SSI0;  // activate SSI0
   SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
@@ -176,6 +314,12 @@ void Nokia5110_Init(void){
   RESET = RESET_LOW;                    // reset the LCD to a known state
   for(delay=0; delay<10; delay=delay+1);// delay minimum 100 ns
   RESET = RESET_HIGH;                   // negative logic
+#else
+  ModelTime = ShiftTime = 0;
+  TxCount = 0;
+  DmaHalf = 2;
+  DMABusy = 0;
+#endif
 
   lcdwrite(COMMAND, 0x21);              // chip active; horizontal addressing mode (V = 0); use extended instruction set (H = 1)
                                         // set LCD Vop (contrast), which may require some tweaking:
@@ -201,6 +345,7 @@ void Nokia5110_Init(void){
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_OutChar(unsigned char data){
   int i;
+  ShadowValid = 0;                      // LCD no longer matches the last frame
   lcdwrite(DATA, 0x00);                 // blank vertical line padding
   for(i=0; i<5; i=i+1){
     lcdwrite(DATA, ASCII[data - 0x20][i]);
@@ -229,39 +374,9 @@ void Nokia5110_OutString(char *ptr){
 // Outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_OutUDec(unsigned short n){
-  if(n < 10){
-    Nokia5110_OutString("    ");
-    Nokia5110_OutChar(n+'0'); /* n is between 0 and 9 */
-  } else if(n<100){
-    Nokia5110_OutString("   ");
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  } else if(n<1000){
-    Nokia5110_OutString("  ");
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
-  else if(n<10000){
-    Nokia5110_OutChar(' ');
-    Nokia5110_OutChar(n/1000+'0'); /* thousands digit */
-    n = n%1000;
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
-  else {
-    Nokia5110_OutChar(n/10000+'0'); /* ten-thousands digit */
-    n = n%10000;
-    Nokia5110_OutChar(n/1000+'0'); /* thousands digit */
-    n = n%1000;
-    Nokia5110_OutChar(n/100+'0'); /* hundreds digit */
-    n = n%100;
-    Nokia5110_OutChar(n/10+'0'); /* tens digit */
-    Nokia5110_OutChar(n%10+'0'); /* ones digit */
-  }
+  char s[6];
+  Fmt_UDec(s, n, 5, ' ');
+  Nokia5110_OutString(s);
 }
 
 //********Nokia5110_SetCursor*****************
@@ -287,6 +402,7 @@ void Nokia5110_SetCursor(unsigned char newX, unsigned char newY){
 // outputs: none
 void Nokia5110_Clear(void){
   int i;
+  ShadowValid = 0;                      // LCD no longer matches the last frame
   for(i=0; i<(MAX_X*MAX_Y/8); i=i+1){
     lcdwrite(DATA, 0x00);
   }
@@ -300,6 +416,7 @@ void Nokia5110_Clear(void){
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DrawFullImage(const char *ptr){
   int i;
+  ShadowValid = 0;                      // LCD no longer matches the last frame
   Nokia5110_SetCursor(0, 0);
   for(i=0; i<(MAX_X*MAX_Y/8); i=i+1){
     lcdwrite(DATA, ptr[i]);
@@ -384,6 +501,65 @@ void Nokia5110_PrintBMP(unsigned char xpos, unsigned char ypos, const unsigned c
     }
   }
 }
+//********Nokia5110_PrintSprite*****************
+// Put a pre-decoded sprite in the proper location in the
+// buffer so it will appear on the screen after the next call
+// to Nokia5110_DisplayBuffer().  Sprites are made from the
+// 16 color BMP images by Lab15Files/SpriteConvert.c; see that
+// file for the format.  Each byte of the sprite is a column
+// of 8 rows, the same as Screen[], so whole bytes are shifted
+// into place instead of setting one pixel at a time.  If the
+// sprite has a mask plane the masked pixels are cleared first,
+// otherwise the sprite is ORed over what is already there.
+// inputs: xpos      horizontal position of bottom left corner of image, columns from the left edge
+//                     must be less than 84
+//                     0 is on the left; 82 is near the right
+//         ypos      vertical position of bottom left corner of image, rows from the top edge
+//                     must be less than 48
+//                     2 is near the top; 47 is at the bottom
+//         ptr       pointer to a sprite made by SpriteConvert
+// outputs: none
+void Nokia5110_PrintSprite(unsigned char xpos, unsigned char ypos, const unsigned char *ptr){
+  long width = ptr[0], height = ptr[1], pages = ptr[2], top, bank, shift, p, x;
+  const unsigned char *image, *mask;
+  char *lo, *hi;
+  unsigned short bits, clear;
+  // check for clipping
+  if(((xpos + width) > SCREENW) || // right side cut off
+     (ypos < (height - 1)) ||      // top cut off
+     (ypos >= SCREENH))          { // bottom cut off
+    return;
+  }
+  top = ypos - height + 1;         // row of the top of the image
+  bank = top/8;                    // first 8-row bank it touches
+  shift = top%8;                   // rows to move down within the bank
+  image = &ptr[4];
+  mask = (ptr[3]&0x01) ? &ptr[4 + pages*width] : 0;
+  for(p=0; p<pages; p=p+1){
+    lo = &Screen[xpos + SCREENW*(bank + p)];
+    hi = ((bank + p + 1) < (SCREENH/8)) ? lo + SCREENW : 0;
+    for(x=0; x<width; x=x+1){
+      bits = image[x]<<shift;      // low byte lands in this bank, high byte in the next
+      if(mask){
+        clear = mask[x]<<shift;
+        lo[x] = (lo[x]&~clear)|bits;
+        if(hi){
+          hi[x] = (hi[x]&~(clear>>8))|(bits>>8);
+        }
+      } else{
+        lo[x] |= bits;
+        if(hi){
+          hi[x] |= bits>>8;
+        }
+      }
+    }
+    image = image + width;
+    if(mask){
+      mask = mask + width;
+    }
+  }
+}
+
 // There is a buffer in RAM that holds one screen
 // This routine clears this buffer
 void Nokia5110_ClearBuffer(void){int i;
@@ -392,12 +568,250 @@ void Nokia5110_ClearBuffer(void){int i;
   }
 }
 
+// Changed bytes separated by at most this many unchanged
+// bytes are sent as one run.  Repositioning costs two command
+// bytes, and each command waits for the SSI to go idle, so
+// resending a short gap is cheaper than starting a new run.
+#define DIRTYGAP    4
+
 //********Nokia5110_DisplayBuffer*****************
-// Fill the whole screen by drawing a 48x84 screen image.
+// Update the screen so it shows the 48x84 screen image in
+// Screen[].  Only the bytes that differ from the last frame
+// sent are transmitted: each of the six 8-row banks is
+// scanned for runs of changed columns, the LCD address is
+// moved to the start of each run with the 0x80 (X) and 0x40
+// (Y) commands, and the run is sent as data.  The whole
+// image is sent the first time, or after any function that
+// draws on the LCD directly.
 // inputs: none
 // outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DisplayBuffer(void){
-  Nokia5110_DrawFullImage(Screen);
+  int bank, x, start, end, i;
+  while(DMABusy){                       // Shadow[] is still being sent
+#ifdef HEADLESS
+    ssiwait();
+#endif
+  }
+  if(ShadowValid == 0){
+    Nokia5110_DrawFullImage(Screen);
+    for(i=0; i<(MAX_X*MAX_Y/8); i=i+1){
+      Shadow[i] = Screen[i];
+    }
+    ShadowValid = 1;
+    FrameDataBytes = MAX_X*MAX_Y/8;
+    FrameCmdBytes = 2;
+    return;
+  }
+  FrameDataBytes = 0;
+  FrameCmdBytes = 0;
+  for(bank=0; bank<(MAX_Y/8); bank=bank+1){
+    i = bank*MAX_X;
+    x = 0;
+    while(x < MAX_X){
+      if(Screen[i+x] == Shadow[i+x]){
+        x = x + 1;                      // unchanged column
+        continue;
+      }
+      start = x;                        // first changed column of a run
+      end = x;                          // last changed column of the run
+      for(x=x+1; (x<MAX_X)&&((x-end)<=DIRTYGAP); x=x+1){
+        if(Screen[i+x] != Shadow[i+x]){
+          end = x;
+        }
+      }
+      lcdwrite(COMMAND, 0x80|start);    // setting bit 7 updates X-position
+      lcdwrite(COMMAND, 0x40|bank);     // setting bit 6 updates Y-position
+      FrameCmdBytes = FrameCmdBytes + 2;
+      for(x=start; x<=end; x=x+1){
+        lcdwrite(DATA, Screen[i+x]);
+        Shadow[i+x] = Screen[i+x];
+      }
+      FrameDataBytes = FrameDataBytes + (end - start + 1);
+    }
+  }
+}
+
+//********Nokia5110_DisplayStats*****************
+// Report the SSI traffic caused by the last call to
+// Nokia5110_DisplayBuffer().  A full frame is 504 data bytes.
+// inputs: data  where to store the number of data bytes sent (0 to 504)
+//         cmds  where to store the number of address command bytes sent
+// outputs: none
+void Nokia5110_DisplayStats(unsigned long *data, unsigned long *cmds){
+  *data = FrameDataBytes;
+  *cmds = FrameCmdBytes;
+}
+
+#ifndef HEADLESS
+// uDMA channel control table, must be 1024-byte aligned.  Only
+// used if no other driver has set one up already.
+#if defined(ewarm)
+#pragma data_alignment=1024
+static uint8_t DMAControlTable[1024];
+#elif defined(ccs)
+#pragma DATA_ALIGN(DMAControlTable, 1024)
+static uint8_t DMAControlTable[1024];
+#else
+static uint8_t DMAControlTable[1024] __attribute__ ((aligned(1024)));
+#endif
+
+// One time setup of uDMA channel 11 (SSI0 TX).  The channel
+// is requested when the SSI0 transmit FIFO is half empty, and
+// the completion interrupt arrives on the SSI0 vector.  The
+// control table is shared with any driver that already set one
+// up (UARTbuf uses channel 9), since moving the base would
+// strand that driver's transfer in progress.
+void static lcddmainit(void){
+  volatile unsigned long delay;
+  SYSCTL_RCGCDMA_R |= 0x01;             // activate uDMA
+  delay = SYSCTL_RCGCDMA_R;             // allow time to finish activating
+  uDMAEnable();
+  if(uDMAControlBaseGet() == 0){        // share a table another driver set up
+    uDMAControlBaseSet(DMAControlTable);
+  }
+  uDMAChannelAssign(UDMA_CH11_SSI0TX);
+  uDMAChannelAttributeDisable(UDMA_CHANNEL_SSI0TX, UDMA_ATTR_ALTSELECT |
+                              UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+  uDMAChannelAttributeEnable(UDMA_CHANNEL_SSI0TX, UDMA_ATTR_USEBURST);
+  uDMAChannelControlSet(UDMA_CHANNEL_SSI0TX|UDMA_PRI_SELECT,
+                        UDMA_SIZE_8|UDMA_SRC_INC_8|UDMA_DST_INC_NONE|UDMA_ARB_4);
+  uDMAChannelControlSet(UDMA_CHANNEL_SSI0TX|UDMA_ALT_SELECT,
+                        UDMA_SIZE_8|UDMA_SRC_INC_8|UDMA_DST_INC_NONE|UDMA_ARB_4);
+  SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;   // SSI0 TX FIFO requests uDMA
+  NVIC_PRI1_R = (NVIC_PRI1_R&0x00FFFFFF)|0x40000000; // SSI0 priority 2
+  NVIC_EN0_R = 1<<7;                    // enable IRQ 7 in NVIC
+  DMAReady = 1;
+}
+
+static int dmastopped(void){
+  return (uDMAChannelModeGet(UDMA_CHANNEL_SSI0TX|UDMA_PRI_SELECT) == UDMA_MODE_STOP) &&
+         (uDMAChannelModeGet(UDMA_CHANNEL_SSI0TX|UDMA_ALT_SELECT) == UDMA_MODE_STOP);
+}
+#endif
+
+//********Nokia5110_DisplayBufferAsync*****************
+// Start sending the 48x84 screen image in the buffer to the
+// LCD and return without waiting for it.  The image is copied
+// to a second buffer, so the game can clear and draw the next
+// frame in the buffer right away.  uDMA moves the first half
+// of the copy (the primary structure) and then the second
+// half (the alternate structure) into the SSI0 transmit FIFO
+// in ping-pong mode.  If a transfer is already in progress,
+// this waits for it to finish first.
+// inputs: task  function to call from the interrupt when the
+//               frame has been handed to the SSI, or 0 for none
+// outputs: none
+// assumes: LCD is in default horizontal addressing mode (V = 0)
+void Nokia5110_DisplayBufferAsync(void(*task)(void)){
+  int i;
+#ifndef HEADLESS
+  if(DMAReady == 0){
+    lcddmainit();
+  }
+#endif
+  while(DMABusy){                       // previous frame still going out
+#ifdef HEADLESS
+    ssiwait();
+#endif
+  }
+  for(i=0; i<(MAX_X*MAX_Y/8); i=i+1){
+    Shadow[i] = Screen[i];
+  }
+  ShadowValid = 1;                      // LCD will match Shadow[] when done
+  FrameDataBytes = MAX_X*MAX_Y/8;
+  FrameCmdBytes = 2;
+  lcdwrite(COMMAND, 0x80);              // X-position 0
+  lcdwrite(COMMAND, 0x40);              // Y-position 0
+  DMADoneTask = task;
+  DMABusy = 1;
+#ifdef HEADLESS
+  dmastart(Shadow, MAX_X*MAX_Y/8);
+#else
+  DC = DC_DATA;                         // every byte the uDMA sends is data
+  uDMAChannelTransferSet(UDMA_CHANNEL_SSI0TX|UDMA_PRI_SELECT, UDMA_MODE_PINGPONG,
+                         (void *)&Shadow[0], (void *)&SSI0_DR_R, MAX_X*MAX_Y/16);
+  uDMAChannelTransferSet(UDMA_CHANNEL_SSI0TX|UDMA_ALT_SELECT, UDMA_MODE_PINGPONG,
+                         (void *)&Shadow[MAX_X*MAX_Y/16], (void *)&SSI0_DR_R, MAX_X*MAX_Y/16);
+  uDMAChannelEnable(UDMA_CHANNEL_SSI0TX);
+#endif
+}
+
+//********Nokia5110_DisplayBusy*****************
+// Check whether a frame started by
+// Nokia5110_DisplayBufferAsync() is still being sent.
+// inputs: none
+// outputs: 1 if busy, 0 if the buffer can be sent again
+int Nokia5110_DisplayBusy(void){
+  return DMABusy;
+}
+
+// SSI0 interrupt, used only for uDMA completion.  It runs
+// once when the primary half is done and once when the
+// alternate half is done; the frame is finished when both
+// structures have returned to stop mode.
+void SSI0_Handler(void){
+  void (*task)(void);
+  CPU_USAGE_ISR_ENTER();                // profiled if built with CPU_USAGE_PROFILE
+#ifndef HEADLESS
+  UDMA_CHIS_R = 1<<UDMA_CHANNEL_SSI0TX; // acknowledge channel 11
+#endif
+  if(DMABusy && dmastopped()){
+    DMABusy = 0;
+    task = DMADoneTask;
+    DMADoneTask = 0;
+    if(task){
+      task();
+    }
+  }
+  CPU_USAGE_ISR_EXIT();
+}
+
+#ifdef HEADLESS
+//********Nokia5110_ModelTick*****************
+// Host model only: let cycles bus cycles (12.5ns) pass.  The
+// model SSI0 sends one byte to the LCD model every 192 cycles,
+// uDMA refills its FIFO, and SSI0_Handler() runs when the real
+// one would interrupt.  Blocking calls run it while they wait.
+// inputs: cycles  bus cycles, 80 per us
+// outputs: none
+void Nokia5110_ModelTick(unsigned long cycles){ int i, irq = 0;
+  ModelTime = ModelTime + cycles;
+  ShiftTime = ShiftTime + cycles;
+  while((ShiftTime >= BYTETIME) && (TxCount > 0)){
+    pcd8544(TxType[0], TxFifo[0]);
+    for(i=1; i<TxCount; i=i+1){
+      TxFifo[i-1] = TxFifo[i];
+      TxType[i-1] = TxType[i];
+    }
+    TxCount = TxCount - 1;
+    ShiftTime = ShiftTime - BYTETIME;
+    irq = irq | dmafill();
+  }
+  if(TxCount == 0){
+    ShiftTime = 0;                      // an idle SSI does not save up time
+  }
+  if(irq){
+    SSI0_Handler();
+  }
+}
+
+//********Nokia5110_ModelTime*****************
+// Host model only: bus cycles the model has run since
+// Nokia5110_Init(), counting the time blocking calls waited.
+// inputs: none
+// outputs: time in 12.5ns units
+unsigned long Nokia5110_ModelTime(void){
+  return ModelTime;
+}
+
+//********Nokia5110_ModelIdle*****************
+// Host model only: check whether the SSI has sent everything,
+// so LCD[] shows the last byte written.
+// inputs: none
+// outputs: 1 if idle, 0 if bytes are still going out
+int Nokia5110_ModelIdle(void){
+  return (TxCount == 0) && !DMABusy;
 }
+#endif
 
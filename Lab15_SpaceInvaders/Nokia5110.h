@@ -259,13 +259,85 @@ void Nokia5110_DrawFullImage(const char *ptr);
 // outputs: none
 void Nokia5110_PrintBMP(unsigned char xpos, unsigned char ypos, const unsigned char *ptr, unsigned char threshold);
 
+//********Nokia5110_PrintSprite*****************
+// Put a pre-decoded sprite in the proper location in the
+// buffer so it will appear on the screen after the next call
+// to Nokia5110_DisplayBuffer().  Sprites are made from the
+// 16 color BMP images by Lab15Files/SpriteConvert.c.  If the
+// sprite has a mask plane the masked pixels are cleared first,
+// otherwise the sprite is ORed over what is already there.
+// inputs: xpos      horizontal position of bottom left corner of image, columns from the left edge
+//                     must be less than 84
+//                     0 is on the left; 82 is near the right
+//         ypos      vertical position of bottom left corner of image, rows from the top edge
+//                     must be less than 48
+//                     2 is near the top; 47 is at the bottom
+//         ptr       pointer to a sprite made by SpriteConvert
+// outputs: none
+void Nokia5110_PrintSprite(unsigned char xpos, unsigned char ypos, const unsigned char *ptr);
+
 // There is a buffer in RAM that holds one screen
 // This routine clears this buffer
 void Nokia5110_ClearBuffer(void);
 
 //********Nokia5110_DisplayBuffer*****************
-// Fill the whole screen by drawing a 48x84 screen image.
+// Update the screen so it shows the 48x84 screen image in
+// the buffer.  Only the runs of bytes that changed since the
+// last frame are sent; the whole image is sent the first time
+// or after any function that draws on the LCD directly.
 // inputs: none
 // outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DisplayBuffer(void);
+
+//********Nokia5110_DisplayBufferAsync*****************
+// Start sending the 48x84 screen image in the buffer to the
+// LCD and return without waiting for it.  The image is copied
+// to a second buffer, so the next frame can be drawn in the
+// buffer right away while uDMA feeds SSI0.  If a transfer is
+// already in progress, this waits for it to finish first.
+// inputs: task  function to call from the interrupt when the
+//               frame has been handed to the SSI, or 0 for none
+// outputs: none
+// assumes: LCD is in default horizontal addressing mode (V = 0)
+void Nokia5110_DisplayBufferAsync(void(*task)(void));
+
+//********Nokia5110_DisplayBusy*****************
+// Check whether a frame started by
+// Nokia5110_DisplayBufferAsync() is still being sent.
+// inputs: none
+// outputs: 1 if busy, 0 if the buffer can be sent again
+int Nokia5110_DisplayBusy(void);
+
+//********Nokia5110_DisplayStats*****************
+// Report the SSI traffic caused by the last call to
+// Nokia5110_DisplayBuffer().  A full frame is 504 data bytes.
+// inputs: data  where to store the number of data bytes sent (0 to 504)
+//         cmds  where to store the number of address command bytes sent
+// outputs: none
+void Nokia5110_DisplayStats(unsigned long *data, unsigned long *cmds);
+
+#ifdef HEADLESS
+//********Nokia5110_ModelTick*****************
+// Host model only: let cycles bus cycles (12.5ns) pass.  The
+// model SSI0 sends one byte to the LCD model every 192 cycles,
+// uDMA refills its FIFO, and SSI0_Handler() runs when the real
+// one would interrupt.  Blocking calls run it while they wait.
+// inputs: cycles  bus cycles, 80 per us
+// outputs: none
+void Nokia5110_ModelTick(unsigned long cycles);
+
+//********Nokia5110_ModelTime*****************
+// Host model only: bus cycles the model has run since
+// Nokia5110_Init(), counting the time blocking calls waited.
+// inputs: none
+// outputs: time in 12.5ns units
+unsigned long Nokia5110_ModelTime(void);
+
+//********Nokia5110_ModelIdle*****************
+// Host model only: check whether the SSI has sent everything,
+// so LCD[] shows the last byte written.
+// inputs: none
+// outputs: 1 if idle, 0 if bytes are still going out
+int Nokia5110_ModelIdle(void);
+#endif
@@ -6,1189 +6,617 @@
 // Jonathan Valvano
 // November 19, 2012
 
+#include "Sound.h"
+#ifdef HEADLESS
+// Host build (Headless/SoundTest.c): the test supplies the DAC
+// and timer, and stands in for the NVIC registers below.
+void DAC_Init(unsigned long bits);
+void DAC_Out(unsigned long data);
+void Timer0_Init(void(*task)(void), unsigned long period);
+extern unsigned long NVIC_EN0_R, NVIC_DIS0_R, NVIC_INT_CTRL_R, NVIC_SYS_PRI3_R, TIMER0_CTL_R;
+#else
 #include "DAC.h"
 #include "Timer0.h"
-#include "Sound.h"
+#define NVIC_EN0_R              (*((volatile unsigned long *)0xE000E100))
+#define NVIC_DIS0_R             (*((volatile unsigned long *)0xE000E180))
+#define NVIC_INT_CTRL_R         (*((volatile unsigned long *)0xE000ED04))
+#define NVIC_SYS_PRI3_R         (*((volatile unsigned long *)0xE000ED20))
+#define TIMER0_CTL_R            (*((volatile unsigned long *)0x4003000C))
+#endif
+#define NVIC_INT_CTRL_PEND_SV   0x10000000  // PendSV Set Pending
 
-const unsigned char shoot[4080] = {
-  129, 99, 103, 164, 214, 129, 31, 105, 204, 118, 55, 92, 140, 225, 152, 61, 84, 154, 184, 101, 
-  75, 129, 209, 135, 47, 94, 125, 207, 166, 72, 79, 135, 195, 118, 68, 122, 205, 136, 64, 106, 
-  143, 173, 105, 54, 122, 200, 133, 74, 106, 215, 236, 91, 43, 84, 163, 115, 34, 81, 150, 209, 
-  184, 198, 191, 113, 95, 12, 0, 79, 167, 111, 120, 238, 255, 255, 118, 0, 0, 0, 0, 0, 
-  89, 236, 255, 255, 255, 255, 190, 0, 0, 0, 20, 170, 161, 137, 255, 255, 255, 181, 37, 0, 
-  0, 15, 0, 60, 167, 255, 255, 255, 255, 255, 60, 0, 0, 41, 60, 44, 128, 211, 255, 255, 
-  255, 150, 51, 12, 0, 0, 10, 136, 201, 208, 236, 255, 255, 209, 0, 0, 0, 15, 16, 31, 
-  128, 255, 255, 255, 255, 252, 144, 0, 0, 0, 77, 68, 75, 171, 255, 255, 255, 233, 139, 53, 
-  0, 0, 9, 106, 77, 123, 209, 255, 255, 255, 146, 68, 7, 0, 0, 0, 136, 166, 159, 219, 
-  255, 255, 255, 82, 0, 0, 0, 0, 0, 81, 214, 225, 229, 255, 255, 255, 115, 0, 0, 0, 
-  75, 63, 47, 126, 209, 255, 255, 255, 222, 119, 54, 0, 0, 0, 112, 133, 103, 185, 255, 255, 
-  255, 222, 136, 74, 0, 0, 0, 102, 96, 98, 177, 255, 255, 255, 255, 191, 119, 0, 0, 0, 
-  44, 125, 116, 122, 222, 255, 255, 255, 236, 98, 50, 0, 0, 0, 17, 129, 208, 164, 194, 255, 
-  255, 255, 198, 19, 0, 0, 0, 0, 40, 154, 205, 191, 209, 255, 255, 255, 147, 74, 20, 0, 
-  0, 0, 112, 140, 119, 180, 255, 255, 255, 236, 211, 122, 0, 0, 0, 33, 85, 81, 123, 207, 
-  255, 255, 255, 255, 255, 132, 0, 0, 0, 29, 31, 33, 115, 184, 255, 255, 248, 255, 255, 226, 
-  33, 0, 0, 0, 55, 44, 58, 128, 215, 255, 243, 255, 255, 255, 226, 36, 0, 0, 0, 12, 
-  31, 98, 170, 232, 225, 228, 255, 255, 255, 140, 39, 0, 0, 0, 0, 13, 96, 192, 192, 174, 
-  242, 255, 255, 255, 207, 50, 0, 0, 0, 0, 0, 70, 149, 232, 192, 191, 248, 255, 255, 236, 
-  140, 40, 0, 0, 0, 0, 24, 118, 208, 167, 163, 224, 255, 255, 255, 209, 137, 63, 10, 0, 
-  0, 0, 88, 120, 115, 153, 181, 253, 255, 255, 228, 239, 219, 87, 0, 0, 0, 0, 22, 54, 
-  130, 204, 200, 177, 238, 255, 255, 231, 208, 137, 75, 0, 0, 0, 0, 94, 105, 112, 178, 225, 
-  204, 215, 255, 255, 255, 201, 112, 44, 10, 0, 0, 0, 91, 101, 115, 167, 214, 245, 232, 216, 
-  255, 255, 225, 150, 63, 23, 0, 0, 0, 40, 101, 113, 140, 198, 216, 198, 219, 255, 255, 233, 
-  180, 137, 81, 17, 0, 0, 0, 64, 78, 108, 154, 197, 240, 212, 207, 233, 255, 255, 209, 144, 
-  71, 36, 0, 0, 0, 22, 103, 106, 136, 170, 200, 248, 221, 212, 233, 255, 255, 195, 112, 37, 
-  6, 0, 0, 0, 27, 126, 128, 139, 173, 190, 224, 243, 221, 214, 233, 255, 221, 144, 54, 2, 
-  0, 0, 0, 0, 67, 154, 177, 161, 173, 171, 214, 250, 221, 211, 225, 243, 204, 122, 48, 9, 
-  3, 0, 0, 2, 75, 154, 167, 160, 177, 202, 218, 195, 195, 221, 249, 235, 188, 143, 105, 53, 
-  0, 0, 0, 15, 63, 79, 133, 166, 202, 215, 174, 160, 191, 240, 229, 205, 200, 207, 204, 109, 
-  20, 0, 0, 0, 0, 19, 89, 164, 174, 163, 168, 187, 216, 183, 171, 202, 211, 240, 212, 171, 
-  154, 113, 68, 0, 0, 0, 0, 16, 54, 115, 152, 200, 214, 178, 157, 176, 201, 192, 177, 195, 
-  218, 208, 168, 136, 87, 55, 2, 0, 0, 0, 55, 77, 108, 152, 180, 211, 198, 166, 170, 187, 
-  195, 181, 185, 205, 218, 174, 149, 132, 91, 60, 0, 0, 0, 3, 64, 88, 108, 159, 198, 197, 
-  181, 167, 177, 194, 173, 159, 184, 190, 214, 202, 160, 153, 140, 103, 34, 0, 0, 3, 6, 19, 
-  71, 115, 166, 204, 184, 170, 183, 197, 166, 144, 152, 180, 204, 194, 174, 180, 185, 157, 132, 96, 
-  60, 36, 0, 0, 0, 24, 78, 105, 125, 156, 185, 202, 177, 168, 168, 181, 170, 142, 154, 180, 
-  201, 181, 167, 168, 171, 170, 128, 85, 44, 30, 16, 0, 3, 22, 58, 120, 137, 149, 173, 176, 
-  194, 185, 164, 156, 156, 170, 146, 136, 161, 185, 191, 171, 156, 163, 168, 142, 108, 84, 60, 17, 
-  0, 7, 29, 48, 55, 85, 128, 171, 183, 171, 178, 187, 178, 160, 147, 152, 160, 146, 133, 149, 
-  168, 188, 170, 154, 159, 159, 156, 130, 109, 96, 68, 23, 5, 13, 23, 50, 71, 81, 106, 146, 
-  168, 188, 191, 173, 171, 168, 174, 161, 139, 139, 147, 144, 132, 142, 159, 176, 174, 160, 153, 150, 
-  147, 150, 128, 109, 91, 53, 44, 34, 15, 24, 40, 70, 82, 96, 126, 149, 180, 184, 178, 173, 
-  174, 177, 166, 144, 144, 149, 150, 137, 126, 129, 143, 149, 153, 156, 163, 168, 149, 139, 136, 135, 
-  136, 118, 106, 92, 74, 46, 26, 31, 44, 55, 60, 75, 91, 119, 146, 156, 166, 173, 183, 183, 
-  168, 161, 159, 159, 156, 142, 139, 143, 143, 132, 128, 130, 139, 144, 137, 143, 152, 163, 160, 147, 
-  140, 133, 136, 129, 116, 112, 118, 112, 89, 68, 50, 46, 53, 53, 58, 67, 84, 105, 105, 113, 
-  136, 156, 170, 171, 173, 176, 177, 167, 160, 153, 153, 152, 140, 139, 142, 140, 140, 130, 132, 129, 
-  137, 133, 128, 128, 135, 140, 142, 143, 147, 150, 146, 136, 130, 129, 126, 128, 116, 111, 113, 120, 
-  119, 87, 46, 13, 0, 6, 53, 96, 139, 161, 200, 255, 255, 174, 82, 58, 55, 105, 219, 208, 
-  82, 71, 70, 112, 235, 204, 79, 70, 71, 120, 239, 207, 79, 68, 67, 118, 242, 204, 78, 65, 
-  65, 112, 242, 207, 78, 64, 60, 109, 243, 211, 77, 58, 57, 103, 245, 216, 81, 60, 58, 99, 
-  232, 225, 82, 53, 58, 88, 221, 236, 98, 53, 58, 81, 205, 250, 118, 51, 55, 72, 183, 255, 
-  139, 51, 57, 63, 167, 255, 164, 55, 54, 57, 143, 255, 191, 58, 53, 55, 115, 255, 214, 75, 
-  51, 55, 96, 232, 243, 96, 44, 54, 78, 200, 255, 133, 47, 57, 63, 163, 255, 177, 53, 55, 
-  55, 122, 255, 215, 64, 47, 51, 98, 238, 245, 98, 46, 60, 75, 191, 255, 150, 46, 53, 55, 
-  142, 255, 201, 58, 48, 50, 101, 243, 243, 91, 44, 51, 70, 190, 255, 152, 46, 54, 58, 129, 
-  255, 212, 68, 43, 50, 92, 222, 255, 116, 43, 54, 61, 164, 255, 187, 51, 46, 53, 102, 248, 
-  246, 94, 41, 54, 65, 176, 255, 174, 48, 46, 54, 113, 255, 236, 81, 40, 54, 72, 177, 255, 
-  168, 47, 48, 58, 111, 252, 245, 89, 46, 51, 71, 176, 255, 180, 50, 46, 54, 101, 235, 255, 
-  106, 41, 54, 64, 152, 255, 207, 63, 39, 51, 88, 202, 255, 140, 40, 48, 55, 120, 255, 240, 
-  82, 40, 53, 68, 163, 255, 191, 51, 46, 50, 94, 214, 255, 136, 40, 53, 57, 120, 255, 242, 
-  88, 41, 54, 70, 156, 255, 207, 60, 43, 53, 85, 190, 255, 166, 46, 47, 60, 101, 222, 255, 
-  125, 41, 48, 61, 122, 255, 243, 95, 37, 51, 70, 144, 255, 221, 67, 41, 54, 75, 164, 255, 
-  200, 55, 43, 53, 84, 184, 255, 177, 50, 46, 57, 95, 201, 255, 156, 47, 47, 60, 101, 216, 
-  255, 139, 44, 50, 61, 112, 224, 255, 126, 44, 51, 65, 113, 229, 255, 122, 39, 48, 63, 115, 
-  236, 255, 120, 47, 48, 64, 119, 231, 255, 118, 43, 50, 68, 116, 229, 255, 128, 46, 47, 67, 
-  112, 219, 255, 135, 47, 53, 63, 108, 205, 255, 154, 50, 48, 61, 98, 192, 255, 170, 50, 50, 
-  58, 92, 173, 255, 195, 57, 39, 46, 77, 149, 255, 208, 65, 34, 51, 78, 137, 255, 233, 79, 
-  41, 50, 72, 120, 232, 255, 112, 43, 47, 67, 106, 201, 255, 160, 47, 47, 60, 92, 170, 255, 
-  200, 63, 46, 55, 82, 142, 255, 242, 91, 48, 50, 75, 118, 212, 255, 146, 48, 47, 63, 101, 
-  167, 255, 201, 64, 47, 57, 84, 136, 243, 253, 106, 44, 55, 71, 111, 188, 255, 177, 55, 47, 
-  55, 91, 146, 252, 243, 92, 47, 54, 77, 113, 191, 255, 168, 54, 48, 63, 92, 144, 250, 243, 
-  96, 51, 50, 74, 106, 184, 255, 185, 57, 48, 54, 87, 133, 233, 255, 116, 50, 51, 65, 105, 
-  164, 255, 214, 67, 48, 53, 84, 118, 200, 255, 160, 55, 51, 58, 95, 140, 242, 252, 108, 48, 
-  51, 67, 101, 159, 255, 216, 71, 50, 50, 81, 113, 180, 255, 187, 57, 47, 53, 88, 122, 205, 
-  255, 153, 50, 48, 61, 96, 135, 226, 255, 123, 51, 53, 65, 98, 144, 242, 240, 102, 48, 48, 
-  72, 103, 146, 255, 232, 84, 50, 53, 74, 103, 156, 255, 222, 84, 51, 54, 79, 106, 159, 255, 
-  224, 78, 53, 54, 75, 106, 154, 255, 226, 85, 51, 54, 75, 105, 152, 255, 228, 89, 51, 54, 
-  74, 106, 147, 245, 238, 106, 50, 50, 74, 103, 139, 231, 250, 126, 53, 53, 65, 101, 129, 208, 
-  255, 147, 54, 53, 61, 91, 120, 191, 255, 177, 61, 47, 57, 87, 115, 164, 255, 211, 71, 54, 
-  53, 78, 109, 146, 243, 240, 108, 55, 55, 65, 105, 128, 202, 255, 156, 58, 51, 58, 98, 115, 
-  171, 255, 208, 74, 51, 53, 79, 112, 143, 228, 253, 128, 55, 51, 64, 102, 122, 181, 255, 195, 
-  67, 48, 57, 89, 111, 143, 233, 249, 123, 58, 55, 68, 102, 119, 176, 255, 195, 72, 51, 58, 
-  84, 112, 136, 216, 255, 150, 55, 51, 60, 92, 115, 159, 253, 229, 99, 54, 58, 72, 103, 123, 
-  178, 255, 195, 68, 53, 60, 81, 113, 136, 207, 255, 164, 61, 51, 58, 89, 119, 144, 225, 255, 
-  137, 58, 54, 64, 94, 119, 154, 239, 240, 112, 54, 58, 68, 103, 119, 156, 246, 224, 96, 46, 
-  48, 65, 101, 118, 159, 246, 224, 94, 50, 55, 65, 106, 122, 159, 248, 221, 99, 51, 55, 68, 
-  105, 126, 156, 243, 228, 108, 55, 51, 70, 101, 122, 154, 231, 242, 128, 55, 55, 65, 98, 119, 
-  144, 215, 255, 152, 60, 54, 63, 91, 119, 136, 194, 255, 181, 64, 51, 63, 85, 109, 126, 171, 
-  255, 218, 94, 57, 58, 71, 108, 122, 153, 225, 245, 140, 57, 51, 67, 94, 118, 136, 187, 255, 
-  192, 74, 53, 58, 82, 109, 126, 154, 229, 246, 130, 57, 57, 67, 95, 118, 132, 183, 255, 197, 
-  77, 54, 60, 78, 106, 125, 150, 214, 255, 153, 61, 54, 63, 88, 116, 126, 166, 242, 226, 112, 
-  58, 50, 67, 96, 120, 136, 180, 255, 202, 79, 54, 55, 71, 102, 122, 142, 195, 255, 181, 68, 
-  53, 60, 79, 108, 125, 144, 198, 255, 171, 67, 50, 57, 85, 108, 126, 144, 202, 255, 168, 65, 
-  50, 58, 85, 112, 128, 146, 197, 253, 173, 67, 50, 57, 82, 105, 123, 139, 190, 253, 185, 72, 
-  50, 58, 79, 108, 126, 137, 177, 249, 207, 92, 58, 60, 72, 99, 119, 133, 161, 229, 236, 130, 
-  58, 51, 67, 94, 113, 126, 147, 198, 252, 174, 67, 50, 61, 84, 105, 128, 136, 164, 243, 219, 
-  103, 58, 53, 67, 96, 116, 130, 146, 198, 249, 170, 68, 50, 61, 79, 111, 126, 133, 163, 231, 
-  229, 125, 58, 50, 64, 95, 112, 129, 140, 177, 248, 202, 92, 58, 54, 72, 99, 118, 132, 147, 
-  190, 249, 187, 75, 53, 57, 81, 106, 118, 133, 144, 200, 255, 176, 67, 54, 60, 81, 109, 123, 
-  137, 143, 197, 252, 173, 71, 53, 60, 81, 106, 118, 137, 143, 190, 250, 187, 77, 54, 63, 77, 
-  102, 119, 133, 144, 177, 240, 202, 99, 54, 54, 74, 98, 118, 132, 137, 164, 224, 232, 132, 60, 
-  48, 63, 94, 115, 126, 140, 152, 195, 249, 178, 72, 55, 55, 78, 109, 119, 135, 144, 168, 225, 
-  228, 129, 63, 50, 63, 91, 112, 129, 139, 144, 188, 239, 200, 92, 60, 57, 71, 101, 119, 133, 
-  143, 149, 197, 249, 180, 72, 53, 57, 70, 101, 113, 129, 136, 144, 197, 238, 167, 68, 50, 55, 
-  77, 102, 118, 133, 140, 150, 197, 240, 170, 70, 57, 60, 81, 102, 116, 132, 142, 143, 190, 240, 
-  187, 87, 53, 57, 72, 99, 118, 132, 143, 143, 173, 229, 212, 120, 60, 50, 68, 91, 115, 126, 
-  136, 140, 156, 198, 239, 168, 72, 55, 58, 79, 106, 120, 133, 139, 143, 168, 224, 218, 132, 60, 
-  48, 67, 91, 112, 125, 133, 143, 146, 176, 232, 204, 108, 55, 51, 71, 94, 113, 126, 139, 144, 
-  144, 181, 232, 195, 103, 57, 53, 71, 95, 112, 129, 140, 140, 143, 174, 226, 204, 115, 57, 51, 
-  71, 94, 112, 125, 135, 143, 143, 164, 209, 224, 146, 64, 51, 60, 79, 108, 123, 133, 140, 140, 
-  150, 184, 229, 187, 89, 54, 54, 72, 96, 116, 129, 139, 137, 142, 160, 197, 229, 156, 68, 51, 
-  55, 78, 106, 118, 130, 136, 140, 146, 161, 204, 221, 149, 64, 51, 63, 79, 105, 120, 129, 140, 
-  142, 139, 160, 202, 221, 156, 64, 53, 60, 75, 102, 120, 130, 140, 144, 144, 154, 188, 224, 178, 
-  89, 55, 54, 70, 95, 116, 125, 137, 143, 142, 142, 164, 204, 216, 144, 63, 51, 63, 84, 102, 
-  118, 130, 136, 140, 143, 147, 171, 214, 198, 122, 60, 48, 65, 88, 112, 118, 132, 139, 139, 139, 
-  143, 168, 209, 202, 128, 60, 50, 65, 87, 105, 120, 132, 139, 139, 143, 143, 160, 198, 212, 152, 
-  70, 54, 60, 79, 101, 118, 130, 137, 137, 137, 142, 146, 174, 208, 194, 116, 57, 51, 71, 89, 
-  111, 123, 128, 137, 140, 143, 147, 146, 177, 211, 184, 109, 57, 51, 70, 92, 111, 123, 136, 137, 
-  137, 143, 143, 147, 171, 202, 198, 128, 61, 50, 63, 85, 108, 120, 132, 139, 140, 143, 143, 140, 
-  152, 184, 208, 163, 89, 54, 54, 74, 96, 112, 128, 132, 140, 139, 143, 142, 140, 157, 184, 205, 
-  159, 84, 58, 53, 72, 98, 116, 129, 139, 143, 142, 146, 140, 137, 147, 176, 201, 180, 111, 57, 
-  51, 70, 92, 111, 125, 132, 140, 142, 144, 142, 140, 139, 154, 183, 205, 157, 84, 54, 51, 70, 
-  92, 106, 125, 133, 136, 142, 140, 137, 136, 135, 144, 180, 200, 163, 98, 55, 50, 75, 89, 112, 
-  125, 133, 139, 140, 143, 140, 139, 137, 135, 157, 188, 195, 144, 75, 55, 55, 81, 99, 115, 132, 
-  137, 143, 142, 142, 139, 140, 136, 136, 153, 184, 197, 153, 84, 57, 55, 77, 98, 115, 128, 137, 
-  142, 140, 144, 139, 136, 137, 139, 142, 161, 185, 185, 139, 74, 54, 64, 79, 102, 116, 129, 139, 
-  139, 140, 144, 139, 140, 136, 135, 136, 150, 176, 192, 161, 96, 58, 53, 77, 96, 115, 123, 132, 
-  142, 139, 139, 142, 142, 135, 137, 135, 130, 150, 177, 188, 160, 101, 58, 54, 72, 91, 111, 122, 
-  135, 137, 143, 142, 142, 139, 136, 137, 135, 130, 133, 153, 176, 185, 149, 87, 61, 55, 77, 94, 
-  112, 129, 135, 139, 139, 142, 140, 139, 136, 137, 135, 132, 128, 137, 161, 178, 183, 132, 75, 53, 
-  60, 81, 101, 118, 130, 136, 140, 139, 143, 140, 135, 136, 137, 130, 129, 132, 128, 140, 167, 181, 
-  167, 115, 70, 54, 67, 85, 108, 119, 136, 136, 142, 142, 139, 142, 140, 132, 135, 132, 130, 130, 
-  126, 128, 147, 168, 183, 156, 106, 68, 57, 65, 92, 106, 123, 132, 136, 142, 140, 140, 137, 139, 
-  133, 129, 133, 130, 125, 130, 130, 126, 146, 167, 176, 160, 113, 71, 55, 65, 87, 105, 119, 133, 
-  139, 140, 140, 137, 140, 139, 130, 133, 130, 129, 132, 132, 128, 126, 130, 139, 154, 167, 174, 142, 
-  95, 67, 57, 72, 95, 111, 126, 132, 140, 142, 140, 140, 139, 136, 137, 130, 135, 132, 128, 128, 
-  128, 126, 130, 126, 132, 150, 163, 173, 161, 118, 79, 60, 67, 84, 102, 120, 129, 135, 140, 140, 
-  142, 142, 140, 132, 135, 130, 130, 133, 129, 128, 126, 130, 130, 126, 125, 130, 137, 156, 163, 170, 
-  146, 102, 74, 58, 72, 88, 109, 122, 130, 139, 140, 140, 139, 137, 136, 137, 130, 135, 132, 128, 
-  129, 128, 132, 128, 126, 128, 125, 130, 130, 128, 135, 150, 159, 163, 163, 125, 91, 65, 63, 75, 
-  95, 115, 123, 132, 140, 142, 143, 140, 139, 130, 132, 129, 128, 128, 123, 129, 129, 125, 123, 126, 
-  126, 126, 125, 129, 125, 125, 125, 126, 135, 143, 154, 159, 157, 135, 102, 78, 61, 71, 89, 106, 
-  120, 129, 137, 139, 143, 142, 142, 139, 139, 136, 132, 128, 133, 128, 128, 132, 128, 126, 132, 126, 
-  126, 130, 128, 126, 126, 126, 128, 128, 128, 125, 129, 130, 139, 152, 152, 156, 150, 126, 99, 82, 
-  65, 70, 89, 106, 120, 133, 139, 140, 143, 140, 139, 137, 139, 132, 136, 133, 129, 128, 133, 129, 
-  128, 132, 128, 126, 125, 130, 128, 132, 128, 126, 130, 126, 126, 126, 125, 125, 125, 126, 128, 128, 
-  128, 128, 128, 129, 142, 144, 150, 147, 144, 133, 108, 91, 79, 70, 77, 96, 106, 123, 133, 139, 
-  144, 140, 140, 139, 137, 139, 132, 153, 176, 119, 102, 113, 113, 116, 130, 166, 122, 99, 130, 113, 
-  132, 166, 118, 103, 130, 111, 136, 166, 115, 105, 129, 111, 132, 160, 120, 102, 128, 115, 130, 160, 
-  120, 101, 129, 109, 130, 163, 119, 105, 128, 109, 130, 164, 116, 101, 129, 111, 130, 164, 116, 108, 
-  129, 111, 128, 159, 119, 112, 129, 111, 125, 157, 120, 116, 128, 106, 126, 150, 130, 123, 120, 111, 
-  120, 139, 146, 126, 113, 116, 119, 133, 153, 126, 106, 120, 113, 132, 160, 122, 102, 128, 109, 126, 
-  163, 115, 111, 129, 109, 126, 154, 125, 119, 123, 111, 120, 139, 146, 126, 109, 120, 116, 133, 164, 
-  118, 102, 128, 109, 126, 163, 119, 108, 129, 111, 125, 149, 130, 123, 118, 115, 122, 132, 159, 128, 
-  108, 125, 111, 132, 164, 118, 109, 129, 111, 125, 150, 132, 128, 119, 112, 119, 132, 159, 123, 106, 
-  128, 111, 128, 159, 120, 118, 125, 112, 122, 139, 150, 126, 111, 125, 115, 129, 164, 116, 112, 128, 
-  111, 125, 144, 142, 128, 113, 118, 116, 130, 164, 120, 106, 126, 115, 126, 146, 139, 123, 113, 122, 
-  116, 130, 166, 118, 106, 129, 112, 125, 144, 143, 129, 116, 119, 118, 130, 160, 116, 116, 125, 116, 
-  126, 133, 154, 128, 109, 126, 116, 128, 153, 126, 120, 120, 118, 120, 132, 166, 122, 109, 126, 112, 
-  120, 136, 139, 125, 109, 115, 118, 123, 154, 122, 116, 120, 112, 122, 129, 163, 119, 108, 123, 113, 
-  125, 136, 152, 126, 112, 122, 118, 122, 150, 132, 125, 119, 116, 116, 130, 157, 119, 118, 123, 118, 
-  122, 132, 159, 120, 109, 125, 115, 125, 137, 156, 123, 111, 123, 118, 126, 139, 142, 128, 116, 119, 
-  118, 128, 147, 132, 122, 115, 118, 123, 128, 152, 128, 120, 125, 116, 116, 132, 153, 120, 120, 123, 
-  118, 122, 128, 157, 122, 119, 125, 119, 123, 129, 159, 116, 116, 126, 119, 123, 129, 159, 116, 116, 
-  126, 119, 120, 132, 159, 116, 118, 125, 119, 120, 132, 154, 118, 118, 123, 122, 123, 129, 153, 120, 
-  120, 123, 118, 122, 128, 152, 120, 125, 125, 116, 123, 126, 144, 130, 120, 120, 113, 122, 126, 144, 
-  137, 122, 118, 118, 123, 120, 135, 147, 125, 119, 119, 122, 120, 132, 154, 122, 115, 123, 118, 119, 
-  132, 154, 119, 113, 123, 115, 126, 132, 146, 122, 125, 122, 115, 122, 125, 137, 143, 126, 119, 119, 
-  125, 120, 132, 154, 122, 115, 126, 123, 122, 129, 153, 122, 119, 125, 119, 123, 126, 139, 142, 123, 
-  119, 119, 125, 118, 132, 154, 118, 118, 125, 116, 126, 126, 140, 132, 125, 123, 116, 123, 120, 132, 
-  154, 122, 113, 122, 118, 122, 128, 146, 126, 123, 122, 115, 126, 120, 132, 153, 116, 116, 123, 118, 
-  122, 128, 142, 129, 123, 125, 116, 123, 120, 132, 153, 116, 116, 128, 116, 126, 126, 139, 137, 122, 
-  120, 119, 122, 120, 132, 149, 120, 125, 125, 116, 129, 122, 129, 153, 122, 119, 125, 119, 128, 123, 
-  136, 144, 128, 120, 118, 123, 123, 129, 142, 126, 122, 125, 119, 129, 118, 132, 149, 119, 123, 125, 
-  119, 129, 122, 129, 153, 120, 120, 125, 119, 129, 128, 129, 150, 122, 122, 125, 120, 129, 125, 132, 
-  139, 122, 120, 119, 125, 125, 129, 140, 137, 128, 120, 120, 126, 126, 126, 137, 137, 123, 122, 125, 
-  125, 126, 129, 135, 137, 128, 120, 120, 123, 128, 128, 136, 137, 126, 120, 125, 125, 125, 125, 136, 
-  140, 128, 120, 125, 125, 125, 125, 132, 144, 128, 115, 119, 116, 122, 123, 129, 144, 118, 115, 125, 
-  118, 126, 120, 130, 144, 118, 122, 128, 116, 128, 122, 129, 140, 120, 125, 125, 119, 128, 123, 129, 
-  136, 132, 125, 125, 122, 123, 128, 128, 129, 143, 123, 122, 125, 123, 128, 125, 125, 142, 120, 125, 
-  125, 123, 128, 128, 128, 132, 136, 126, 122, 125, 123, 128, 125, 129, 143, 118, 125, 125, 123, 128, 
-  128, 128, 132, 136, 126, 122, 125, 123, 128, 128, 129, 142, 119, 125, 125, 123, 128, 128, 128, 129, 
-  137, 126, 122, 125, 125, 125, 126, 129, 142, 122, 126, 125, 123, 128, 125, 128, 129, 142, 119, 123, 
-  125, 123, 123, 128, 128, 129, 137, 125, 125, 125, 123, 128, 128, 128, 132, 130, 123, 125, 125, 125, 
-  126, 126, 126, 136, 126, 125, 125, 123, 123, 128, 128, 128, 137, 120, 123, 123, 123, 125, 129, 128, 
-  128, 137, 120, 125, 125, 125, 123, 128, 128, 128, 136, 123, 123, 128, 119, 126, 128, 128, 128, 136, 
-  123, 123, 128, 123, 123, 123, 123, 129, 136, 123, 125, 125, 119, 128, 128, 123, 130, 135, 129, 130, 
-  120, 125, 125, 125, 125, 125, 129, 135, 125, 125, 125, 125, 123, 128, 128, 128, 137, 120, 123, 128, 
-  125, 128, 128, 125, 125, 132, 125, 125, 125, 125, 126, 126, 126, 126, 126, 136, 126, 120, 126, 125, 
-  123, 128, 128, 128, 136, 123, 125, 125, 123, 128, 123, 128, 128, 128, 133, 126, 125, 125, 125, 123, 
-  128, 123, 128, 133, 123, 125, 125, 123, 128, 128, 128, 128, 128, 135, 123, 125, 125, 125, 125, 126, 
-  126, 126, 130, 135, 125, 125, 125, 125, 125, 126, 126, 126, 130, 130, 125, 125, 125, 125, 126, 126, 
-  126, 126, 130, 129, 125, 125, 125, 125, 126, 126, 126, 126, 132, 125, 125, 125, 125, 126, 126, 126, 
-  126, 130, 130, 123, 129, 125, 125, 129, 125, 125, 125, 125, 129, 129, 125, 125, 125, 125, 126, 126, 
-  126, 130, 129, 130, 126, 125, 125, 125, 125, 126, 129, 125, 129, 135, 125, 125, 129, 125, 125, 125, 
-  129, 125, 129, 130, 123, 125, 129, 125, 129, 125, 125, 125, 129, 129, 130, 123, 125, 125, 125, 126, 
-  126, 126, 122, 129, 128, 123, 123, 123, 122, 126, 122, 126, 128, 123, 128, 128, 128, 123, 128, 123, 
-  128, 128, 128, 128, 128, 129, 129, 125, 129, 125, 125, 125, 125, 126, 126, 126, 130, 125, 125, 125, 
-  126, 126, 126, 126, 128, 128, 128, 129, 125, 125, 125, 125, 126, 126, 126, 126, 126, 130, 129, 125, 
-  125, 125, 125, 130, 125, 125, 129, 125, 129, 129, 125, 125, 125, 125, 126, 126, 126, 130, 125, 125, 
-  129, 125, 125, 125, 125, 130, 125, 125, 125, 125, 130, 125, 129, 125, 129, 129, 125, 125, 129, 125, 
-  129, 125, 129, 129, 125, 125, 125, 125, 129, 125, 125, 125, 126, 128, 128, 129, 125, 129, 125, 125};
+// 4080 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char shoot[2040] = {
+  134, 106, 216, 22, 199, 53, 142, 147, 89, 182, 72, 216, 37, 124, 164, 72, 199, 71, 200, 70,
+  138, 99, 124, 132, 109, 229, 37, 167, 37, 157, 188, 183, 80, 4, 166, 126, 255, 112, 0, 0,
+  94, 255, 255, 176, 0, 26, 168, 255, 251, 32, 0, 3, 175, 255, 255, 48, 2, 50, 141, 255,
+  249, 48, 0, 8, 205, 239, 253, 0, 0, 17, 143, 255, 255, 144, 0, 68, 74, 255, 254, 131,
+  0, 6, 71, 223, 255, 148, 0, 0, 138, 157, 255, 245, 0, 0, 5, 222, 239, 255, 112, 0,
+  67, 39, 223, 255, 215, 48, 0, 120, 107, 255, 253, 132, 0, 6, 102, 191, 255, 251, 112, 0,
+  39, 119, 223, 255, 230, 48, 0, 24, 218, 207, 255, 193, 0, 0, 41, 203, 223, 255, 148, 16,
+  0, 120, 123, 255, 254, 215, 0, 2, 85, 124, 255, 255, 248, 0, 1, 18, 123, 255, 255, 254,
+  32, 0, 50, 56, 223, 255, 255, 226, 0, 0, 22, 174, 238, 255, 248, 32, 0, 0, 108, 202,
+  255, 255, 195, 0, 0, 4, 158, 203, 255, 254, 130, 0, 0, 23, 218, 174, 255, 253, 131, 0,
+  0, 87, 121, 191, 255, 238, 213, 0, 0, 19, 140, 203, 239, 254, 216, 64, 0, 5, 103, 190,
+  205, 255, 252, 114, 0, 0, 86, 122, 223, 237, 255, 233, 49, 0, 2, 103, 140, 220, 223, 254,
+  184, 81, 0, 4, 70, 156, 253, 206, 255, 217, 66, 0, 1, 102, 138, 207, 221, 239, 252, 114,
+  0, 0, 23, 136, 171, 239, 221, 239, 217, 48, 0, 0, 73, 186, 170, 223, 221, 239, 199, 48,
+  0, 0, 73, 170, 188, 220, 205, 254, 184, 99, 0, 0, 52, 138, 205, 170, 191, 236, 204, 198,
+  16, 0, 1, 90, 170, 171, 219, 172, 223, 218, 151, 64, 0, 1, 55, 156, 219, 155, 204, 188,
+  221, 168, 83, 0, 0, 52, 105, 189, 202, 171, 203, 188, 218, 152, 83, 0, 0, 69, 105, 204,
+  186, 188, 169, 187, 220, 169, 134, 32, 0, 1, 71, 172, 186, 188, 169, 155, 204, 171, 185, 134,
+  50, 0, 1, 70, 121, 188, 186, 171, 168, 155, 203, 170, 170, 133, 33, 16, 1, 55, 137, 171,
+  203, 169, 154, 152, 171, 186, 154, 168, 101, 49, 0, 19, 53, 138, 186, 187, 186, 153, 169, 137,
+  171, 169, 153, 152, 102, 65, 0, 19, 69, 105, 171, 186, 170, 170, 136, 153, 136, 155, 170, 153,
+  153, 134, 83, 34, 1, 36, 86, 121, 187, 186, 171, 169, 153, 152, 120, 137, 153, 170, 152, 136,
+  135, 101, 66, 17, 35, 52, 87, 153, 170, 187, 170, 153, 152, 136, 136, 136, 137, 136, 154, 169,
+  136, 136, 119, 119, 84, 50, 51, 52, 86, 103, 137, 170, 171, 186, 169, 153, 136, 136, 136, 136,
+  136, 136, 136, 136, 153, 152, 136, 120, 118, 119, 117, 32, 0, 54, 138, 207, 250, 83, 54, 221,
+  84, 71, 236, 68, 71, 236, 68, 71, 252, 68, 71, 252, 68, 54, 253, 67, 54, 253, 83, 54,
+  238, 83, 53, 222, 99, 53, 207, 115, 52, 191, 131, 51, 175, 163, 51, 143, 179, 51, 127, 212,
+  51, 110, 246, 35, 76, 248, 35, 58, 251, 51, 55, 253, 66, 54, 239, 98, 52, 191, 146, 51,
+  143, 195, 51, 111, 245, 35, 75, 249, 35, 56, 253, 66, 53, 223, 114, 51, 175, 179, 35, 111,
+  245, 35, 75, 250, 50, 55, 254, 82, 52, 191, 162, 51, 111, 245, 35, 75, 251, 50, 54, 239,
+  98, 52, 159, 195, 35, 92, 248, 35, 55, 255, 82, 52, 175, 179, 35, 93, 248, 35, 55, 255,
+  82, 52, 159, 195, 35, 91, 250, 34, 54, 223, 114, 51, 127, 245, 35, 73, 253, 66, 52, 175,
+  195, 35, 91, 251, 50, 53, 207, 146, 35, 109, 248, 35, 55, 239, 114, 52, 126, 247, 35, 55,
+  239, 114, 52, 126, 247, 35, 71, 239, 130, 36, 125, 248, 35, 54, 207, 147, 51, 108, 250, 51,
+  53, 175, 195, 34, 73, 253, 66, 52, 143, 228, 35, 71, 239, 114, 36, 108, 250, 34, 53, 175,
+  195, 35, 88, 255, 83, 52, 125, 249, 50, 54, 175, 196, 35, 88, 255, 98, 52, 107, 251, 50,
+  53, 159, 245, 35, 71, 191, 163, 51, 89, 255, 99, 52, 107, 251, 51, 53, 142, 247, 51, 70,
+  175, 212, 51, 87, 207, 163, 51, 88, 255, 99, 52, 105, 253, 67, 53, 123, 251, 50, 53, 124,
+  249, 51, 54, 142, 247, 51, 70, 159, 246, 51, 70, 159, 229, 51, 70, 159, 213, 51, 70, 159,
+  228, 51, 70, 159, 229, 51, 70, 159, 229, 51, 70, 159, 230, 51, 70, 142, 247, 51, 70, 141,
+  249, 51, 53, 123, 251, 50, 53, 122, 253, 67, 52, 105, 255, 99, 52, 104, 207, 147, 51, 103,
+  175, 212, 51, 71, 142, 248, 51, 70, 123, 252, 67, 53, 104, 239, 115, 52, 103, 191, 196, 51,
+  87, 141, 249, 51, 53, 121, 254, 99, 52, 103, 191, 196, 51, 87, 140, 250, 51, 53, 121, 239,
+  131, 52, 87, 158, 247, 51, 70, 121, 254, 98, 52, 103, 159, 229, 51, 70, 121, 253, 99, 52,
+  103, 159, 230, 51, 70, 121, 239, 131, 52, 103, 157, 249, 51, 53, 120, 207, 180, 51, 86, 122,
+  253, 83, 52, 103, 158, 248, 51, 69, 120, 191, 196, 51, 86, 121, 239, 131, 52, 87, 139, 252,
+  67, 52, 103, 157, 249, 51, 53, 119, 175, 231, 51, 70, 120, 191, 196, 51, 70, 120, 207, 180,
+  51, 70, 121, 207, 164, 51, 86, 121, 207, 164, 51, 87, 137, 207, 164, 51, 86, 120, 191, 180,
+  51, 70, 120, 191, 197, 51, 70, 120, 174, 232, 51, 69, 119, 156, 250, 67, 53, 104, 138, 253,
+  99, 52, 103, 137, 207, 164, 51, 70, 120, 174, 231, 51, 69, 120, 139, 252, 83, 52, 103, 137,
+  191, 180, 51, 86, 120, 156, 251, 67, 53, 103, 136, 207, 164, 51, 86, 120, 139, 251, 67, 52,
+  103, 137, 191, 198, 51, 70, 120, 138, 238, 131, 51, 87, 120, 156, 251, 67, 52, 103, 137, 174,
+  232, 51, 53, 120, 137, 190, 197, 51, 70, 120, 137, 207, 180, 51, 70, 120, 137, 206, 164, 51,
+  70, 120, 137, 207, 164, 51, 86, 120, 136, 191, 181, 51, 70, 120, 136, 174, 215, 51, 69, 119,
+  136, 156, 234, 67, 52, 103, 136, 138, 237, 131, 52, 87, 120, 137, 190, 198, 51, 69, 119, 137,
+  155, 236, 99, 52, 87, 136, 136, 174, 199, 51, 69, 119, 136, 138, 222, 148, 51, 70, 120, 136,
+  155, 235, 83, 52, 103, 136, 136, 172, 233, 67, 52, 103, 136, 137, 172, 217, 67, 52, 103, 136,
+  136, 172, 217, 67, 52, 103, 136, 153, 155, 235, 83, 52, 87, 120, 136, 138, 205, 147, 51, 86,
+  120, 136, 137, 173, 199, 51, 69, 119, 136, 136, 138, 220, 131, 52, 86, 120, 136, 136, 172, 217,
+  67, 52, 103, 136, 136, 137, 173, 199, 51, 69, 103, 136, 136, 153, 189, 182, 51, 69, 103, 136,
+  136, 137, 172, 200, 51, 53, 103, 136, 136, 136, 155, 218, 83, 52, 103, 136, 136, 136, 137, 188,
+  149, 51, 70, 120, 136, 137, 136, 155, 203, 99, 52, 86, 120, 136, 152, 136, 155, 201, 83, 52,
+  86, 120, 136, 136, 136, 155, 202, 99, 52, 87, 120, 136, 136, 136, 137, 188, 148, 51, 86, 120,
+  136, 136, 136, 136, 155, 201, 83, 52, 103, 136, 136, 152, 136, 136, 171, 184, 67, 68, 103, 136,
+  136, 152, 136, 136, 155, 202, 99, 52, 103, 120, 136, 136, 136, 136, 137, 187, 166, 51, 69, 103,
+  136, 136, 136, 136, 136, 137, 187, 149, 51, 69, 120, 136, 136, 136, 136, 136, 136, 171, 184, 67,
+  53, 103, 136, 136, 136, 136, 136, 136, 136, 171, 167, 67, 69, 103, 136, 136, 136, 136, 136, 136,
+  120, 154, 185, 100, 52, 86, 120, 136, 136, 136, 136, 136, 120, 135, 154, 186, 116, 52, 86, 120,
+  136, 136, 136, 136, 136, 136, 135, 136, 154, 168, 84, 52, 86, 120, 136, 136, 136, 136, 136, 136,
+  135, 135, 137, 170, 167, 67, 69, 103, 136, 136, 136, 136, 136, 136, 136, 120, 135, 120, 137, 170,
+  150, 67, 69, 103, 136, 136, 136, 136, 136, 136, 136, 136, 120, 120, 136, 137, 154, 167, 84, 52,
+  87, 120, 136, 136, 136, 136, 136, 120, 135, 119, 119, 120, 119, 119, 136, 153, 152, 100, 52, 86,
+  120, 136, 136, 136, 136, 136, 136, 136, 135, 135, 120, 135, 119, 136, 135, 136, 137, 153, 151, 101,
+  68, 86, 120, 136, 136, 136, 136, 136, 136, 136, 136, 135, 120, 136, 135, 135, 119, 119, 119, 136,
+  136, 136, 137, 153, 152, 101, 68, 70, 103, 136, 152, 136, 136, 137, 183, 103, 119, 138, 118, 135,
+  138, 118, 134, 138, 118, 134, 138, 118, 135, 138, 118, 134, 138, 118, 134, 138, 118, 134, 138, 118,
+  134, 137, 119, 134, 121, 119, 134, 121, 135, 118, 120, 151, 119, 120, 151, 103, 120, 167, 104, 103,
+  167, 104, 103, 151, 119, 103, 137, 118, 119, 138, 118, 134, 122, 118, 134, 121, 135, 119, 120, 152,
+  103, 104, 167, 104, 103, 152, 135, 119, 137, 118, 134, 137, 119, 119, 120, 151, 103, 120, 167, 120,
+  103, 152, 135, 119, 138, 118, 119, 121, 135, 119, 120, 167, 104, 119, 152, 135, 119, 138, 119, 119,
+  120, 152, 103, 120, 151, 119, 119, 138, 118, 119, 120, 135, 103, 119, 151, 119, 119, 138, 118, 119,
+  120, 151, 119, 119, 152, 119, 119, 137, 119, 119, 120, 151, 103, 119, 137, 118, 119, 120, 136, 119,
+  120, 152, 119, 119, 137, 135, 119, 120, 151, 119, 119, 137, 119, 119, 120, 151, 119, 119, 137, 119,
+  119, 120, 151, 119, 119, 137, 119, 119, 120, 151, 119, 119, 137, 119, 119, 119, 152, 119, 119, 121,
+  135, 119, 119, 137, 119, 119, 120, 151, 119, 119, 137, 119, 119, 120, 151, 119, 119, 120, 135, 119,
+  119, 137, 119, 119, 120, 151, 119, 119, 120, 135, 119, 119, 137, 119, 119, 119, 136, 119, 119, 120,
+  151, 119, 119, 137, 119, 119, 119, 137, 119, 119, 120, 136, 119, 119, 120, 151, 120, 119, 120, 135,
+  119, 119, 137, 119, 119, 135, 137, 119, 119, 135, 137, 135, 119, 120, 135, 119, 120, 120, 151, 119,
+  120, 120, 151, 119, 120, 136, 151, 119, 120, 120, 135, 119, 119, 136, 136, 119, 119, 120, 135, 119,
+  119, 136, 136, 119, 120, 136, 135, 119, 119, 120, 136, 119, 119, 120, 152, 119, 119, 120, 151, 119,
+  119, 120, 151, 120, 120, 120, 135, 119, 120, 120, 136, 119, 119, 136, 136, 119, 119, 135, 120, 119,
+  119, 136, 136, 135, 119, 120, 120, 135, 119, 120, 136, 136, 119, 119, 136, 136, 119, 119, 136, 136,
+  135, 119, 119, 120, 135, 119, 120, 120, 136, 119, 119, 120, 136, 135, 119, 120, 136, 136, 119, 119,
+  119, 120, 119, 119, 120, 136, 135, 119, 119, 136, 136, 119, 119, 120, 136, 135, 120, 119, 136, 136,
+  119, 135, 119, 120, 135, 119, 120, 135, 136, 136, 119, 119, 119, 136, 119, 119, 120, 136, 135, 120,
+  120, 135, 120, 119, 119, 119, 119, 120, 119, 119, 120, 136, 135, 119, 120, 120, 136, 135, 119, 119,
+  135, 136, 119, 119, 136, 136, 136, 119, 119, 119, 119, 136, 119, 119, 119, 119, 136, 119, 119, 119,
+  119, 136, 119, 119, 119, 119, 135, 119, 119, 119, 120, 135, 135, 120, 119, 119, 136, 119, 119, 119,
+  120, 136, 119, 119, 119, 135, 136, 119, 135, 119, 135, 136, 119, 135, 135, 119, 136, 135, 119, 119,
+  119, 120, 135, 119, 119, 119, 135, 136, 135, 135, 136, 136, 136, 135, 135, 119, 119, 119, 135, 119,
+  119, 119, 136, 136, 119, 119, 119, 119, 120, 135, 119, 120, 119, 135, 136, 119, 119, 119, 120, 119,
+  135, 119, 120, 119, 119, 135, 135, 136, 119, 135, 135, 136, 119, 119, 135, 119, 120, 136, 120, 119};
 
-const unsigned char invaderkilled[3377] = {
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 144, 164, 145, 111, 
-  95, 91, 100, 106, 126, 134, 108, 109, 123, 160, 158, 118, 101, 144, 189, 110, 79, 154, 202, 117, 
-  16, 96, 208, 187, 65, 100, 192, 175, 93, 0, 106, 253, 137, 17, 140, 242, 103, 1, 134, 255, 
-  134, 4, 110, 230, 118, 1, 149, 255, 89, 6, 160, 255, 110, 0, 60, 177, 255, 81, 27, 207, 
-  170, 43, 61, 200, 179, 23, 104, 245, 112, 11, 102, 210, 217, 39, 73, 237, 114, 29, 57, 173, 
-  255, 91, 0, 145, 255, 138, 10, 62, 171, 252, 84, 0, 172, 244, 46, 47, 207, 190, 74, 0, 
-  141, 255, 147, 16, 65, 191, 215, 30, 84, 224, 163, 78, 0, 128, 255, 124, 0, 149, 255, 102, 
-  0, 138, 249, 169, 63, 0, 166, 255, 62, 24, 195, 229, 33, 78, 224, 163, 70, 0, 145, 255, 
-  100, 0, 161, 255, 92, 0, 163, 255, 95, 0, 134, 246, 191, 77, 0, 125, 255, 130, 0, 88, 
-  198, 226, 95, 0, 122, 255, 158, 43, 53, 213, 178, 21, 99, 214, 200, 49, 39, 198, 214, 75, 
-  0, 131, 255, 134, 6, 104, 219, 179, 18, 105, 251, 104, 4, 106, 228, 204, 45, 51, 185, 247, 
-  76, 0, 178, 244, 39, 52, 199, 220, 85, 0, 105, 255, 182, 35, 99, 254, 96, 0, 118, 207, 
-  243, 84, 0, 137, 255, 124, 0, 140, 253, 121, 43, 19, 162, 255, 147, 15, 60, 180, 255, 62, 
-  26, 196, 222, 91, 0, 135, 255, 96, 0, 178, 255, 76, 6, 179, 255, 80, 0, 166, 255, 108, 
-  0, 110, 255, 92, 0, 122, 228, 215, 57, 24, 181, 252, 75, 0, 118, 255, 134, 1, 133, 214, 
-  188, 65, 0, 163, 255, 95, 0, 143, 255, 126, 34, 48, 193, 255, 65, 22, 208, 201, 50, 31, 
-  209, 199, 42, 70, 190, 251, 57, 11, 190, 221, 87, 0, 140, 255, 129, 27, 88, 209, 202, 54, 
-  28, 186, 251, 94, 0, 144, 255, 82, 4, 190, 255, 60, 19, 202, 220, 42, 55, 212, 186, 35, 
-  78, 221, 169, 27, 95, 213, 189, 75, 0, 146, 255, 113, 0, 169, 255, 83, 0, 118, 241, 164, 
-  25, 107, 202, 212, 79, 0, 133, 255, 153, 42, 62, 216, 164, 7, 148, 229, 154, 54, 0, 185, 
-  255, 65, 9, 197, 232, 54, 34, 189, 244, 80, 0, 113, 238, 210, 40, 90, 214, 159, 51, 2, 
-  197, 218, 59, 31, 192, 255, 70, 8, 168, 255, 122, 0, 117, 235, 92, 7, 130, 234, 188, 16, 
-  124, 229, 121, 46, 15, 178, 255, 104, 0, 142, 255, 87, 0, 156, 254, 131, 25, 100, 212, 183, 
-  64, 6, 164, 255, 107, 8, 97, 179, 255, 99, 0, 121, 229, 155, 44, 87, 214, 181, 60, 35, 
-  175, 255, 119, 15, 50, 167, 255, 98, 0, 171, 241, 113, 14, 97, 238, 127, 19, 159, 252, 91, 
-  0, 162, 251, 126, 21, 102, 212, 172, 62, 15, 174, 255, 90, 0, 163, 229, 169, 49, 14, 189, 
-  231, 78, 0, 147, 255, 127, 31, 120, 221, 148, 36, 86, 227, 127, 20, 131, 215, 195, 38, 70, 
-  205, 178, 66, 0, 167, 255, 103, 5, 139, 215, 175, 73, 0, 176, 255, 122, 15, 104, 213, 164, 
-  68, 0, 179, 255, 73, 22, 197, 245, 65, 0, 175, 255, 88, 0, 167, 242, 116, 39, 41, 198, 
-  242, 67, 12, 171, 255, 105, 0, 149, 224, 142, 29, 88, 195, 198, 63, 0, 192, 241, 66, 10, 
-  180, 255, 90, 0, 177, 250, 63, 24, 191, 236, 85, 0, 135, 247, 98, 29, 134, 222, 197, 50, 
-  52, 200, 209, 58, 19, 196, 230, 59, 20, 175, 255, 103, 0, 158, 239, 80, 0, 148, 209, 206, 
-  71, 0, 192, 234, 56, 28, 189, 255, 85, 0, 149, 237, 135, 51, 38, 174, 255, 92, 0, 145, 
-  211, 150, 63, 7, 189, 255, 61, 17, 184, 255, 119, 21, 52, 182, 240, 63, 0, 190, 245, 86, 
-  4, 126, 229, 169, 62, 55, 195, 246, 55, 13, 192, 243, 65, 0, 181, 251, 118, 42, 38, 187, 
-  255, 68, 0, 186, 255, 131, 45, 29, 182, 255, 83, 0, 148, 211, 187, 81, 0, 181, 255, 84, 
-  9, 158, 240, 91, 11, 181, 249, 99, 19, 117, 229, 107, 33, 121, 215, 206, 38, 87, 213, 153, 
-  47, 47, 211, 177, 32, 119, 225, 128, 24, 145, 236, 91, 31, 121, 208, 215, 61, 0, 181, 255, 
-  85, 2, 165, 228, 99, 28, 92, 213, 194, 39, 108, 211, 164, 66, 0, 189, 255, 109, 42, 53, 
-  202, 227, 62, 20, 179, 255, 99, 20, 97, 192, 219, 59, 1, 190, 255, 84, 23, 83, 186, 255, 
-  62, 0, 191, 236, 66, 0, 193, 242, 59, 28, 208, 212, 56, 30, 181, 255, 65, 8, 198, 221, 
-  46, 31, 204, 203, 42, 63, 213, 176, 53, 49, 194, 251, 60, 6, 167, 246, 92, 19, 133, 199, 
-  211, 60, 0, 170, 252, 126, 32, 104, 209, 149, 41, 81, 204, 192, 42, 74, 218, 159, 49, 73, 
-  193, 250, 78, 0, 170, 235, 67, 15, 177, 252, 87, 31, 126, 195, 243, 68, 0, 180, 230, 64, 
-  8, 158, 242, 130, 40, 109, 191, 223, 64, 0, 170, 228, 151, 47, 38, 200, 213, 63, 0, 152, 
-  243, 167, 39, 124, 222, 105, 54, 43, 190, 255, 57, 14, 175, 235, 142, 28, 91, 194, 171, 46, 
-  23, 201, 240, 69, 7, 143, 239, 145, 34, 157, 238, 79, 41, 86, 190, 255, 59, 0, 191, 234, 
-  112, 40, 43, 197, 248, 57, 3, 194, 255, 70, 17, 191, 232, 83, 13, 107, 209, 190, 54, 41, 
-  209, 217, 52, 25, 205, 239, 54, 20, 192, 251, 113, 29, 43, 190, 253, 52, 0, 145, 235, 165, 
-  34, 133, 224, 116, 33, 94, 212, 165, 33, 99, 230, 109, 23, 182, 233, 110, 32, 106, 218, 148, 
-  30, 128, 232, 86, 15, 191, 240, 96, 42, 73, 201, 252, 45, 6, 208, 238, 53, 0, 157, 247, 
-  130, 41, 104, 190, 243, 42, 0, 176, 222, 140, 44, 6, 201, 255, 57, 0, 169, 216, 175, 49, 
-  16, 217, 203, 32, 72, 213, 185, 45, 51, 226, 176, 36, 89, 201, 250, 69, 0, 177, 227, 53, 
-  21, 152, 245, 149, 39, 94, 200, 250, 59, 0, 134, 216, 146, 27, 144, 224, 121, 45, 46, 214, 
-  240, 31, 64, 225, 157, 40, 91, 205, 206, 43, 16, 212, 254, 75, 0, 160, 236, 78, 37, 118, 
-  215, 215, 35, 68, 209, 196, 46, 2, 209, 241, 60, 1, 174, 249, 80, 38, 139, 213, 221, 43, 
-  0, 182, 242, 134, 20, 100, 205, 161, 49, 5, 209, 255, 44, 34, 223, 219, 44, 21, 187, 255, 
-  64, 25, 136, 225, 168, 15, 134, 204, 139, 34, 36, 210, 219, 50, 6, 216, 237, 34, 58, 209, 
-  222, 53, 0, 188, 230, 140, 36, 65, 227, 142, 41, 86, 218, 211, 29, 82, 218, 165, 37, 51, 
-  206, 239, 34, 3, 220, 214, 41, 33, 203, 255, 54, 4, 172, 232, 98, 25, 145, 212, 137, 28, 
-  93, 209, 173, 42, 23, 224, 207, 27, 94, 219, 179, 50, 6, 198, 255, 97, 26, 149, 222, 92, 
-  34, 103, 212, 212, 39, 27, 211, 252, 69, 0, 160, 225, 89, 30, 132, 219, 163, 37, 75, 218, 
-  195, 39, 36, 228, 196, 32, 84, 226, 152, 25, 130, 209, 151, 39, 48, 228, 167, 40, 69, 209, 
-  251, 38, 22, 214, 224, 35, 2, 170, 241, 104, 26, 161, 204, 178, 41, 0, 207, 250, 90, 23, 
-  118, 224, 112, 33, 144, 222, 137, 51, 53, 206, 254, 55, 4, 183, 214, 132, 46, 5, 213, 255, 
-  42, 30, 172, 231, 167, 32, 45, 213, 202, 17, 86, 227, 113, 49, 85, 213, 252, 29, 32, 229, 
-  189, 40, 32, 191, 254, 83, 13, 165, 220, 73, 35, 108, 222, 208, 34, 63, 219, 213, 35, 14, 
-  195, 235, 137, 43, 0, 201, 255, 45, 34, 159, 229, 161, 30, 83, 220, 162, 41, 54, 205, 248, 
-  38, 19, 177, 224, 170, 31, 25, 226, 198, 31, 71, 215, 236, 38, 0, 206, 237, 52, 31, 216, 
-  217, 34, 22, 218, 249, 74, 16, 156, 222, 62, 28, 216, 241, 68, 17, 142, 220, 89, 19, 191, 
-  227, 81, 42, 84, 207, 255, 35, 0, 180, 207, 157, 33, 51, 223, 180, 38, 42, 226, 230, 23, 
-  63, 222, 188, 40, 9, 205, 255, 66, 45, 107, 209, 252, 26, 0, 213, 227, 84, 18, 140, 213, 
-  132, 51, 24, 208, 255, 65, 39, 213, 222, 40, 26, 115, 215, 242, 27, 21, 224, 225, 48, 11, 
-  155, 229, 123, 47, 119, 220, 168, 23, 121, 212, 129, 46, 25, 204, 255, 77, 29, 170, 206, 124, 
-  46, 24, 202, 255, 63, 37, 208, 219, 46, 17, 166, 223, 91, 35, 179, 228, 70, 41, 135, 215, 
-  214, 22, 20, 230, 192, 28, 83, 214, 191, 30, 32, 227, 207, 30, 71, 229, 169, 40, 61, 199, 
-  248, 70, 19, 153, 205, 123, 42, 78, 221, 193, 22, 104, 209, 169, 42, 6, 215, 246, 58, 41, 
-  203, 218, 46, 17, 192, 221, 73, 41, 135, 227, 154, 45, 75, 202, 242, 59, 12, 173, 201, 45, 
-  44, 149, 232, 171, 40, 72, 208, 230, 27, 10, 215, 203, 38, 45, 217, 226, 30, 31, 217, 210, 
-  36, 26, 202, 223, 134, 45, 34, 227, 213, 32, 65, 221, 194, 36, 47, 198, 231, 115, 24, 93, 
-  197, 170, 32, 54, 228, 179, 44, 56, 198, 238, 128, 44, 39, 213, 227, 23, 44, 218, 212, 46, 
-  20, 163, 220, 104, 61, 101, 212, 245, 43, 26, 106, 201, 236, 30, 15, 213, 218, 55, 46, 122, 
-  214, 203, 24, 73, 215, 163, 37, 66, 224, 174, 42, 69, 198, 235, 92, 42, 84, 200, 226, 27, 
-  23, 212, 209, 65, 38, 151, 217, 98, 45, 188, 210, 94, 61, 70, 210, 242, 65, 47, 73, 203, 
-  247, 27, 38, 145, 206, 219, 30, 16, 155, 224, 152, 44, 116, 203, 177, 37, 28, 198, 227, 82, 
-  47, 153, 199, 123, 44, 103, 219, 130, 42, 169, 197, 120, 52, 41, 188, 239, 80, 49, 181, 206, 
-  68, 45, 163, 196, 166, 35, 37, 227, 180, 41, 92, 221, 170, 41, 101, 211, 172, 46, 40, 199, 
-  223, 53, 60, 138, 218, 182, 27, 106, 201, 130, 49, 49, 188, 234, 115, 46, 137, 203, 88, 49, 
-  174, 196, 119, 53, 65, 210, 210, 31, 32, 194, 214, 72, 51, 198, 199, 50, 43, 167, 208, 79, 
-  50, 188, 205, 85, 49, 136, 193, 160, 43, 33, 217, 220, 79, 55, 103, 206, 199, 36, 49, 219, 
-  189, 41, 76, 213, 198, 36, 38, 183, 216, 99, 62, 89, 202, 234, 47, 40, 167, 198, 94, 45, 
-  182, 194, 90, 60, 69, 214, 218, 44, 77, 210, 188, 33, 45, 139, 213, 205, 36, 50, 217, 191, 
-  42, 43, 185, 215, 90, 69, 100, 204, 220, 34, 61, 208, 186, 41, 37, 168, 206, 128, 57, 113, 
-  205, 172, 41, 68, 220, 163, 50, 83, 206, 215, 48, 41, 162, 194, 124, 62, 70, 190, 224, 65, 
-  59, 205, 184, 41, 52, 208, 199, 61, 49, 145, 202, 112, 61, 147, 202, 142, 47, 105, 204, 147, 
-  45, 100, 207, 156, 47, 89, 206, 176, 33, 106, 205, 116, 64, 85, 197, 218, 62, 59, 124, 200, 
-  179, 33, 92, 207, 137, 49, 110, 194, 170, 40, 59, 219, 168, 47, 93, 206, 186, 39, 52, 149, 
-  213, 184, 37, 66, 209, 191, 45, 42, 202, 184, 50, 73, 133, 224, 186, 35, 112, 191, 150, 45, 
-  42, 201, 206, 70, 62, 160, 194, 118, 60, 105, 207, 172, 46, 67, 205, 195, 44, 72, 206, 181, 
-  44, 49, 181, 200, 107, 66, 116, 198, 174, 43, 51, 164, 216, 121, 51, 175, 179, 89, 61, 95, 
-  210, 158, 53, 100, 205, 186, 39, 51, 169, 206, 119, 65, 88, 183, 211, 59, 60, 200, 176, 59, 
-  61, 116, 203, 190, 41, 75, 212, 177, 46, 59, 197, 196, 65, 68, 164, 195, 105, 57, 168, 181, 
-  87, 66, 109, 201, 191, 40, 51, 192, 194, 120, 64, 80, 205, 203, 50, 54, 195, 182, 79, 73, 
-  99, 210, 190, 50, 83, 203, 192, 45, 56, 174, 188, 86, 65, 196, 176, 46, 79, 208, 169, 49, 
-  68, 193, 198, 100, 70, 84, 202, 199, 44, 65, 125, 207, 181, 51, 81, 200, 190, 47, 60, 172, 
-  184, 84, 67, 188, 185, 84, 65, 144, 195, 107, 73, 111, 194, 206, 60, 61, 149, 184, 111, 60, 
-  167, 177, 104, 69, 80, 206, 192, 58, 79, 199, 173, 55, 83, 140, 205, 175, 29, 47, 181, 184, 
-  78, 83, 102, 195, 204, 54, 73, 107, 198, 187, 47, 78, 144, 205, 130, 60, 94, 189, 193, 66, 
-  65, 114, 196, 152, 52, 135, 182, 137, 58, 68, 207, 196, 78, 69, 154, 182, 93, 73, 157, 187, 
-  104, 77, 103, 182, 207, 69, 72, 192, 170, 64, 63, 166, 177, 90, 85, 105, 188, 204, 67, 75, 
-  198, 171, 64, 76, 104, 198, 203, 65, 73, 121, 190, 177, 43, 72, 157, 197, 167, 50, 65, 202, 
-  164, 66, 88, 145, 210, 138, 63, 95, 184, 190, 74, 68, 111, 191, 184, 42, 71, 201, 172, 57, 
-  82, 149, 198, 174, 47, 64, 187, 180, 71, 87, 193, 159, 56, 82, 195, 173, 62, 82, 184, 179, 
-  75, 75, 156, 184, 104, 69, 148, 181, 105, 74, 116, 192, 178, 50, 72, 168, 183, 97, 76, 139, 
-  178, 150, 51, 92, 196, 153, 55, 80, 195, 183, 65, 87, 195, 147, 66, 89, 167, 191, 104, 76, 
-  108, 191, 162, 53, 82, 189, 178, 67, 79, 117, 194, 189, 48, 70, 150, 185, 116, 69, 161, 166, 
-  107, 78, 89, 196, 185, 57, 86, 192, 164, 62, 82, 169, 182, 96, 76, 157, 170, 121, 65, 114, 
-  189, 117, 78, 108, 171, 197, 116, 60, 115, 180, 125, 71, 97, 189, 181, 60, 89, 195, 162, 63, 
-  76, 149, 184, 120, 70, 162, 168, 80, 84, 155, 184, 105, 80, 110, 175, 184, 68, 83, 150, 177, 
-  152, 49, 71, 187, 175, 96, 79, 97, 184, 181, 71, 84, 170, 171, 86, 84, 131, 192, 167, 52, 
-  77, 167, 178, 111, 75, 91, 179, 185, 87, 81, 141, 179, 114, 83, 109, 173, 188, 85, 82, 112, 
-  186, 170, 55, 91, 192, 163, 60, 78, 157, 181, 109, 84, 138, 185, 149, 61, 83, 171, 182, 117, 
-  74, 88, 193, 174, 67, 86, 120, 191, 180, 52, 85, 168, 174, 90, 82, 180, 156, 85, 85, 111, 
-  193, 164, 65, 99, 173, 176, 107, 71, 96, 187, 162, 65, 98, 184, 163, 72, 90, 185, 165, 72, 
-  83, 156, 175, 123, 73, 116, 189, 133, 80, 115, 188, 159, 59, 86, 133, 197, 157, 63, 109, 182, 
-  157, 58, 82, 157, 178, 121, 75, 92, 149, 194, 131, 68, 87, 159, 182, 106, 77, 121, 179, 135, 
-  74, 107, 180, 160, 65, 91, 169, 169, 104, 78, 99, 179, 173, 73, 95, 185, 160, 74, 89, 128, 
-  182, 163, 57, 93, 190, 159, 70, 86, 175, 159, 82, 98, 146, 186, 153, 63, 83, 180, 166, 86, 
-  88, 144, 171, 121, 82, 106, 184, 164, 74, 93, 157, 171, 104, 84, 129, 181, 148, 64, 92, 138, 
-  192, 166, 55, 87, 184, 152, 70, 93, 159, 176, 105, 88, 155, 160, 114, 80, 124, 181, 122, 82, 
-  127, 179, 150, 66, 88, 173, 171, 87, 94, 151, 171, 133, 69, 106, 185, 131, 77, 103, 141, 197, 
-  137, 73, 127, 167, 132, 70, 86, 163, 177, 105, 89, 134, 171, 133, 74, 106, 186, 143, 77, 105, 
-  172, 166, 79, 88, 142, 170, 122, 80, 105, 146, 190, 135, 71, 95, 174, 156, 73, 98, 126, 186, 
-  159, 65, 90, 141, 178, 139, 75, 101, 173, 156, 74, 98, 156, 168, 123, 75, 115, 176, 143, 69, 
-  101, 185, 145, 75, 106, 183, 149, 75, 97, 160, 164, 96, 96, 167, 154, 101, 82, 140, 166, 100, 
-  100, 119, 159, 179, 92, 94, 130, 176, 155, 63, 86, 157, 164, 104, 92, 133, 175, 143, 72, 102, 
-  170, 150, 85, 99, 163, 165, 100, 91, 112, 149, 185, 117, 80, 129, 162, 111, 87, 140, 164, 111, 
-  92, 142, 163, 128, 78, 113, 176, 141, 76, 98, 173, 162, 106, 91, 114, 179, 148, 74, 105, 163, 
-  163, 100, 89, 145, 153, 99, 100, 136, 177, 127, 86, 114, 138, 184, 137, 69, 94, 163, 160, 93, 
-  99, 122, 177, 156, 72, 94, 150, 164, 109, 96, 136, 171, 131, 82, 105, 147, 175, 105, 91, 151, 
-  150, 104, 96, 107, 146, 184, 118, 88, 144, 152, 108, 95, 119, 177, 149, 72, 102, 124, 176, 165, 
-  84, 96, 136, 165, 130, 80, 108, 171, 151, 82, 104, 141, 170, 133, 83, 103, 150, 172, 130, 81, 
-  100, 169, 157, 98, 99, 113, 169, 159, 85, 107, 150, 162, 120, 87, 112, 171, 151, 77, 103, 169, 
-  144, 93, 102, 139, 178, 124, 94, 115, 133, 181, 134, 77, 102, 162, 153, 93, 95, 114, 166, 150, 
-  80, 105, 145, 163, 114, 90, 146, 147, 100, 101, 131, 171, 138, 79, 107, 128, 178, 152, 78, 95, 
-  135, 163, 130, 86, 115, 167, 143, 88, 108, 154, 158, 117, 89, 108, 170, 153, 89, 102, 152, 148, 
-  112, 99, 113, 173, 146, 90, 109, 143, 170, 121, 89, 108, 143, 171, 130, 82, 108, 170, 139, 80, 
-  107, 130, 173, 158, 85, 106, 127, 169, 153, 80, 101, 148, 154, 109, 100, 136, 160, 121, 94, 117, 
-  163, 147, 93, 105, 145, 160, 110, 100, 119, 160, 157, 96, 103, 117, 168, 147, 81, 105, 139, 165, 
-  136, 86, 103, 158, 154, 101, 105, 147, 156, 115, 98, 116, 156, 153, 91, 107, 161, 145, 93, 109, 
-  116, 147, 174, 106, 106, 118, 138, 168, 107, 95, 137, 149, 116, 96, 114, 163, 148, 93, 107, 133, 
-  163, 139, 83, 105, 160, 147, 96, 110, 153, 146, 105, 105, 117, 141, 173, 133, 84, 113, 163, 132, 
-  86, 109, 126, 165, 149, 97, 108, 127, 166, 146, 81, 108, 146, 138, 103, 107, 153, 144, 104, 109, 
-  132, 164, 130, 97, 116, 152, 149, 102, 106, 129, 164, 137, 83, 105, 141, 160, 125, 96, 110, 140, 
-  167, 121, 101, 116, 155, 145, 94, 108, 135, 159, 132, 88, 108, 138, 165, 130, 94, 118, 160, 137, 
-  91, 108, 138, 156, 130, 97, 114, 160, 143, 91, 112, 150, 141, 102, 109, 150, 145, 104, 108, 150, 
-  142, 109, 108, 127, 163, 136, 91, 110, 134, 161, 132, 96, 112, 148, 149, 111, 101, 130, 153, 125, 
-  99, 113, 137, 168, 136, 90, 108, 143, 152, 115, 106, 125, 153, 138, 93, 122, 154, 127, 99, 125, 
-  158, 119, 103, 116, 138, 167, 122, 97, 115, 149, 145, 105, 108, 136, 146, 113, 109, 118, 133, 172, 
-  133, 93, 109, 139, 150, 113, 108, 134, 147, 128, 97, 112, 151, 147, 105, 115, 126, 142, 153, 107, 
-  107, 122, 148, 147, 101, 108, 130, 153, 127, 101, 120, 148, 139, 106, 113, 127, 160, 139, 97, 109, 
-  136, 152, 123, 105, 126, 154, 138, 94, 111, 139, 149, 123, 105, 119, 152, 143, 106, 110, 135, 146, 
-  122, 105, 118, 153, 143, 108, 113, 116, 145, 145, 105, 111, 124, 153, 135, 93, 114, 150, 134, 102, 
-  117, 124, 148, 150, 109, 112, 123, 151, 138, 96, 112, 124, 152, 142, 105, 112, 125, 154, 133, 102, 
-  116, 126, 154, 145, 108, 111, 115, 141, 150, 110, 116, 122, 133, 158, 115, 111, 128};
+// 3377 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char invaderkilled[1689] = {
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  136, 136, 136, 136, 136, 136, 136, 136, 154, 150, 85, 102, 120, 102, 122, 151, 105, 182, 73, 199,
+  22, 219, 70, 202, 80, 111, 129, 143, 96, 143, 128, 110, 112, 159, 80, 175, 96, 59, 245, 28,
+  162, 60, 177, 111, 112, 109, 210, 78, 113, 58, 245, 9, 248, 3, 175, 80, 175, 34, 203, 64,
+  143, 145, 75, 209, 94, 164, 8, 247, 9, 246, 8, 250, 48, 175, 49, 206, 36, 234, 64, 159,
+  96, 175, 80, 175, 80, 143, 180, 7, 248, 5, 206, 80, 127, 146, 61, 177, 109, 195, 44, 212,
+  8, 248, 6, 219, 22, 246, 6, 236, 35, 191, 64, 191, 35, 205, 80, 111, 178, 111, 96, 124,
+  245, 8, 247, 8, 247, 33, 175, 144, 59, 243, 28, 213, 8, 246, 11, 244, 11, 245, 10, 246,
+  6, 245, 7, 237, 49, 191, 64, 127, 128, 141, 180, 10, 245, 8, 247, 35, 207, 65, 220, 49,
+  220, 36, 191, 48, 189, 80, 143, 129, 93, 195, 27, 245, 9, 245, 11, 243, 28, 210, 61, 178,
+  77, 161, 93, 180, 9, 247, 10, 245, 7, 250, 22, 205, 64, 143, 146, 61, 160, 158, 147, 11,
+  244, 12, 227, 43, 245, 7, 237, 37, 217, 48, 205, 49, 207, 64, 175, 112, 126, 80, 142, 177,
+  126, 114, 11, 246, 8, 245, 9, 248, 22, 219, 64, 175, 96, 107, 246, 7, 233, 37, 219, 50,
+  175, 112, 58, 246, 10, 247, 6, 231, 25, 245, 10, 247, 22, 218, 48, 175, 80, 174, 163, 11,
+  228, 9, 247, 23, 217, 37, 231, 24, 220, 36, 203, 64, 175, 96, 141, 164, 11, 247, 6, 218,
+  64, 191, 65, 207, 64, 175, 80, 175, 114, 44, 244, 10, 246, 9, 232, 21, 204, 48, 207, 64,
+  191, 80, 191, 49, 190, 80, 143, 97, 141, 195, 60, 211, 28, 227, 26, 246, 9, 229, 9, 220,
+  64, 206, 49, 191, 80, 158, 131, 42, 245, 9, 217, 48, 191, 49, 191, 113, 59, 243, 11, 245,
+  7, 234, 51, 207, 48, 207, 64, 191, 114, 43, 244, 11, 248, 33, 191, 80, 157, 181, 11, 245,
+  9, 245, 11, 246, 23, 230, 39, 220, 37, 217, 34, 219, 39, 232, 25, 229, 23, 221, 48, 191,
+  80, 174, 97, 93, 194, 109, 164, 11, 246, 35, 206, 49, 191, 97, 108, 211, 11, 245, 21, 191,
+  48, 190, 64, 207, 49, 221, 49, 191, 64, 205, 33, 204, 35, 219, 51, 207, 48, 175, 81, 140,
+  211, 10, 247, 38, 217, 37, 204, 36, 217, 52, 207, 64, 174, 64, 191, 81, 124, 244, 11, 228,
+  9, 248, 38, 189, 64, 174, 146, 44, 211, 9, 250, 39, 214, 50, 191, 48, 174, 129, 92, 162,
+  28, 244, 8, 233, 41, 228, 37, 191, 48, 190, 114, 44, 243, 12, 244, 27, 229, 6, 219, 50,
+  221, 49, 206, 49, 207, 113, 43, 243, 9, 234, 40, 231, 37, 218, 38, 230, 27, 230, 38, 217,
+  24, 229, 11, 246, 36, 207, 32, 222, 48, 159, 130, 107, 242, 11, 216, 32, 207, 48, 173, 163,
+  29, 194, 77, 178, 62, 178, 92, 244, 11, 227, 25, 249, 37, 207, 48, 141, 145, 158, 114, 45,
+  241, 78, 146, 92, 194, 29, 244, 10, 228, 39, 221, 36, 220, 32, 223, 48, 175, 82, 141, 210,
+  11, 248, 22, 202, 48, 223, 34, 221, 33, 191, 65, 142, 160, 140, 130, 45, 211, 13, 226, 61,
+  211, 11, 232, 36, 232, 37, 221, 21, 218, 35, 206, 32, 221, 34, 207, 48, 174, 97, 157, 129,
+  93, 162, 30, 193, 93, 179, 12, 246, 25, 213, 38, 221, 33, 223, 64, 174, 81, 141, 162, 77,
+  194, 46, 194, 94, 145, 141, 146, 62, 162, 77, 242, 29, 226, 10, 246, 26, 203, 32, 207, 81,
+  126, 114, 157, 131, 60, 243, 11, 216, 32, 223, 33, 174, 162, 45, 193, 94, 115, 93, 241, 46,
+  178, 43, 245, 10, 212, 38, 221, 35, 221, 32, 206, 130, 12, 242, 41, 234, 21, 218, 35, 207,
+  33, 190, 161, 30, 193, 77, 226, 12, 227, 29, 210, 29, 244, 25, 211, 29, 244, 24, 213, 27,
+  229, 37, 207, 32, 188, 146, 61, 178, 46, 225, 61, 178, 12, 244, 38, 223, 16, 222, 81, 141,
+  131, 29, 244, 45, 210, 23, 223, 17, 238, 48, 158, 114, 125, 161, 125, 130, 28, 244, 26, 199,
+  33, 207, 50, 221, 33, 173, 82, 190, 66, 141, 209, 30, 193, 93, 177, 46, 193, 78, 162, 60,
+  244, 25, 199, 36, 220, 22, 218, 32, 223, 50, 205, 33, 205, 66, 142, 146, 76, 243, 10, 194,
+  41, 234, 36, 222, 16, 220, 34, 222, 17, 221, 33, 205, 130, 46, 210, 77, 194, 44, 231, 21,
+  202, 35, 235, 35, 206, 130, 45, 225, 45, 210, 26, 214, 54, 223, 33, 108, 225, 13, 211, 39,
+  220, 20, 218, 36, 234, 36, 206, 82, 92, 225, 29, 212, 41, 214, 43, 213, 52, 223, 66, 76,
+  241, 41, 205, 17, 158, 146, 124, 178, 28, 229, 41, 199, 38, 216, 42, 199, 50, 190, 83, 188,
+  66, 172, 162, 46, 178, 93, 162, 109, 162, 44, 211, 56, 219, 22, 200, 51, 190, 114, 140, 83,
+  172, 115, 77, 209, 44, 212, 60, 195, 42, 212, 59, 197, 56, 202, 34, 221, 67, 108, 194, 61,
+  178, 77, 194, 43, 214, 53, 206, 34, 172, 82, 188, 83, 77, 210, 77, 178, 40, 220, 35, 219,
+  34, 189, 84, 108, 210, 61, 178, 42, 200, 55, 202, 36, 218, 53, 205, 50, 172, 115, 75, 228,
+  60, 178, 61, 195, 57, 199, 57, 200, 38, 201, 38, 201, 37, 203, 38, 199, 69, 205, 51, 124,
+  178, 92, 131, 108, 162, 61, 162, 92, 178, 57, 219, 36, 219, 34, 203, 52, 142, 178, 123, 146,
+  44, 196, 58, 199, 54, 202, 36, 204, 36, 203, 35, 188, 100, 124, 162, 58, 215, 58, 181, 53,
+  217, 54, 203, 35, 172, 116, 91, 211, 60, 179, 55, 203, 36, 219, 35, 204, 68, 172, 99, 171,
+  84, 108, 178, 60, 199, 69, 204, 51, 203, 68, 109, 179, 92, 194, 58, 181, 76, 178, 77, 163,
+  76, 198, 69, 204, 36, 124, 179, 92, 178, 58, 181, 75, 181, 73, 198, 70, 204, 51, 155, 99,
+  171, 100, 92, 195, 76, 163, 88, 202, 18, 187, 69, 108, 195, 70, 203, 36, 156, 131, 91, 196,
+  71, 201, 56, 184, 52, 204, 68, 155, 84, 155, 100, 107, 196, 76, 164, 58, 181, 86, 188, 68,
+  202, 68, 108, 196, 71, 187, 36, 156, 163, 76, 164, 89, 216, 53, 187, 68, 107, 178, 76, 163,
+  89, 202, 36, 187, 69, 201, 53, 202, 53, 187, 68, 155, 100, 155, 100, 124, 179, 74, 182, 72,
+  185, 53, 201, 53, 203, 69, 201, 69, 171, 100, 107, 163, 91, 180, 71, 203, 52, 155, 116, 170,
+  100, 92, 179, 92, 163, 90, 182, 73, 167, 71, 183, 70, 172, 115, 123, 116, 107, 179, 92, 163,
+  73, 183, 74, 165, 89, 182, 86, 171, 69, 155, 147, 75, 166, 70, 187, 69, 170, 85, 140, 163,
+  74, 182, 69, 187, 85, 139, 117, 106, 181, 87, 186, 53, 202, 52, 155, 101, 139, 147, 90, 183,
+  69, 202, 69, 123, 179, 90, 165, 91, 149, 86, 202, 70, 171, 100, 107, 164, 107, 164, 91, 164,
+  89, 167, 71, 184, 87, 185, 53, 140, 147, 107, 147, 89, 183, 69, 156, 132, 89, 182, 71, 184,
+  70, 186, 69, 170, 100, 107, 164, 91, 164, 88, 186, 53, 185, 69, 169, 86, 155, 147, 91, 165,
+  89, 167, 86, 186, 69, 154, 101, 139, 148, 88, 202, 53, 185, 69, 155, 101, 154, 117, 123, 117,
+  123, 148, 90, 165, 89, 168, 70, 184, 70, 140, 132, 122, 132, 90, 182, 88, 168, 70, 184, 70,
+  170, 69, 138, 117, 105, 184, 69, 169, 70, 123, 148, 88, 184, 70, 169, 70, 154, 116, 123, 132,
+  107, 148, 107, 148, 106, 166, 106, 150, 88, 166, 103, 155, 85, 139, 147, 89, 166, 88, 168, 70,
+  169, 86, 170, 101, 121, 183, 88, 166, 88, 166, 88, 168, 71, 184, 70, 170, 101, 123, 148, 106,
+  166, 89, 150, 104, 183, 87, 139, 132, 90, 165, 103, 185, 69, 154, 102, 138, 133, 105, 166, 89,
+  150, 102, 155, 117, 153, 101, 123, 148, 103, 186, 86, 138, 133, 106, 149, 104, 168, 86, 154, 133,
+  106, 150, 103, 169, 86, 154, 117, 122, 148, 106, 149, 104, 183, 87, 139, 132, 106, 149, 87, 169,
+  86, 154, 117, 153, 102, 138, 132, 104, 185, 69, 138, 133, 122, 133, 105, 151, 86, 169, 86, 153,
+  118, 122, 149, 104, 167, 86, 138, 133, 106, 133, 104, 169, 86, 122, 149, 105, 150, 104, 167, 87,
+  169, 86, 154, 102, 122, 150, 103, 169, 86, 138, 133, 105, 150, 105, 151, 103, 153, 86, 169, 86,
+  121, 166, 103, 138, 101, 137, 118, 122, 149, 104, 168, 86, 169, 102, 153, 102, 120, 168, 87, 168,
+  86, 122, 150, 103, 169, 86, 152, 102, 153, 102, 138, 134, 121, 150, 104, 168, 86, 138, 118, 104,
+  167, 103, 153, 86, 137, 133, 104, 168, 87, 168, 86, 137, 134, 122, 133, 121, 134, 105, 150, 105,
+  134, 103, 168, 86, 138, 134, 121, 150, 104, 151, 103, 138, 133, 104, 151, 103, 152, 87, 151, 103,
+  151, 103, 138, 118, 121, 150, 104, 151, 103, 138, 133, 104, 151, 104, 152, 103, 153, 103, 120, 150,
+  103, 153, 102, 137, 118, 121, 134, 119, 168, 102, 137, 118, 121, 133, 104, 151, 103, 152, 102, 137,
+  118, 121, 134, 119, 153, 102, 121, 133, 121, 134, 119, 153, 103, 121, 134, 119, 152, 103, 121, 134,
+  119, 153, 102, 120, 150, 119, 137, 118, 128};
 
-const unsigned char explosion[2000] = {
-  120, 119, 119, 119, 120, 120, 129, 130, 133, 129, 125, 119, 119, 119, 125, 128, 135, 137, 133, 123, 
-  109, 99, 91, 92, 101, 116, 135, 140, 143, 130, 123, 105, 96, 89, 92, 105, 115, 116, 120, 119, 
-  130, 133, 139, 149, 163, 171, 174, 173, 161, 143, 133, 115, 99, 79, 72, 75, 79, 82, 87, 103, 
-  125, 143, 139, 137, 137, 149, 163, 173, 168, 153, 133, 111, 105, 106, 109, 119, 137, 149, 140, 133, 
-  133, 143, 154, 168, 183, 187, 188, 184, 173, 163, 143, 113, 75, 39, 5, 0, 0, 3, 9, 19, 
-  46, 82, 105, 120, 135, 139, 144, 173, 195, 208, 211, 202, 191, 181, 181, 202, 236, 255, 255, 255, 
-  255, 255, 240, 212, 192, 171, 130, 85, 47, 36, 41, 37, 33, 43, 57, 51, 33, 3, 0, 0, 
-  0, 0, 5, 9, 24, 67, 120, 157, 177, 201, 222, 239, 250, 246, 236, 216, 192, 159, 101, 41, 
-  0, 0, 0, 0, 0, 0, 58, 103, 129, 161, 192, 218, 239, 242, 221, 184, 163, 157, 157, 159, 
-  163, 161, 129, 81, 37, 17, 7, 19, 41, 61, 89, 139, 178, 195, 205, 202, 184, 161, 153, 157, 
-  161, 181, 187, 177, 164, 149, 161, 197, 246, 255, 255, 255, 255, 255, 252, 226, 173, 105, 39, 0, 
-  0, 0, 19, 71, 101, 133, 168, 183, 174, 163, 139, 113, 99, 77, 47, 31, 36, 41, 39, 43, 
-  77, 125, 154, 149, 128, 95, 65, 57, 79, 99, 130, 161, 173, 192, 221, 246, 255, 235, 181, 115, 
-  48, 0, 0, 0, 19, 58, 115, 171, 216, 216, 177, 119, 67, 43, 39, 31, 24, 17, 12, 15, 
-  27, 79, 149, 226, 255, 255, 255, 255, 255, 255, 255, 240, 207, 157, 77, 3, 0, 0, 0, 0, 
-  0, 0, 41, 72, 79, 67, 67, 95, 115, 125, 128, 120, 125, 147, 188, 222, 255, 255, 255, 255, 
-  255, 255, 249, 255, 255, 255, 255, 255, 202, 140, 85, 29, 0, 0, 0, 0, 0, 46, 113, 129, 
-  113, 79, 41, 17, 27, 61, 79, 92, 103, 103, 106, 115, 125, 154, 212, 255, 255, 255, 255, 255, 
-  255, 222, 163, 115, 85, 96, 128, 163, 192, 207, 195, 143, 72, 0, 0, 0, 0, 0, 0, 0, 
-  0, 53, 135, 201, 255, 255, 255, 255, 255, 222, 183, 144, 106, 63, 0, 0, 0, 0, 0, 0, 
-  0, 29, 133, 192, 212, 207, 216, 245, 255, 255, 255, 249, 211, 205, 221, 250, 255, 255, 255, 255, 
-  212, 140, 106, 105, 135, 167, 195, 218, 216, 192, 164, 135, 115, 105, 96, 92, 95, 103, 109, 119, 
-  115, 85, 47, 15, 15, 47, 87, 115, 135, 149, 159, 188, 232, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 183, 106, 55, 17, 27, 58, 87, 129, 174, 218, 239, 215, 161, 95, 31, 0, 0, 0, 
-  2, 17, 39, 87, 129, 147, 157, 168, 183, 188, 168, 115, 65, 31, 29, 33, 29, 36, 53, 61, 
-  65, 70, 85, 92, 82, 82, 75, 58, 41, 48, 58, 72, 103, 149, 192, 229, 239, 226, 201, 164, 
-  144, 143, 147, 137, 119, 103, 87, 85, 115, 161, 221, 255, 255, 246, 236, 218, 208, 183, 150, 128, 
-  111, 101, 92, 99, 116, 135, 144, 149, 157, 163, 164, 164, 167, 159, 154, 154, 163, 173, 183, 187, 
-  187, 191, 187, 177, 167, 161, 150, 137, 119, 106, 101, 99, 99, 96, 103, 105, 99, 92, 79, 70, 
-  70, 71, 75, 77, 77, 82, 101, 123, 137, 144, 154, 163, 174, 177, 173, 173, 161, 153, 137, 111, 
-  82, 53, 29, 22, 29, 37, 58, 87, 106, 119, 133, 149, 163, 173, 174, 164, 147, 137, 135, 133, 
-  135, 139, 135, 120, 95, 72, 65, 58, 65, 75, 85, 99, 119, 130, 140, 147, 143, 135, 137, 153, 
-  168, 168, 171, 161, 139, 123, 106, 113, 135, 171, 207, 235, 255, 255, 255, 255, 255, 221, 154, 77, 
-  17, 0, 3, 46, 79, 91, 103, 120, 128, 119, 113, 92, 70, 51, 31, 17, 7, 12, 27, 48, 
-  81, 130, 187, 212, 202, 171, 139, 113, 106, 116, 119, 129, 140, 140, 153, 171, 191, 195, 173, 130, 
-  92, 57, 23, 13, 22, 36, 58, 99, 143, 177, 183, 157, 119, 85, 71, 77, 89, 91, 79, 71, 
-  71, 79, 119, 171, 216, 255, 255, 249, 236, 225, 211, 202, 191, 173, 143, 82, 19, 0, 0, 0, 
-  0, 0, 0, 46, 72, 79, 67, 70, 95, 113, 123, 123, 120, 123, 144, 178, 205, 240, 255, 255, 
-  255, 255, 246, 236, 246, 255, 255, 255, 252, 205, 150, 101, 43, 0, 0, 0, 0, 0, 48, 109, 
-  123, 105, 71, 36, 15, 24, 58, 77, 95, 103, 101, 106, 113, 128, 154, 212, 255, 255, 255, 255, 
-  255, 255, 222, 163, 115, 85, 96, 128, 163, 192, 207, 195, 143, 72, 0, 0, 0, 0, 0, 0, 
-  0, 0, 53, 135, 201, 255, 255, 255, 255, 255, 222, 183, 144, 106, 63, 0, 0, 0, 0, 0, 
-  0, 0, 29, 133, 192, 212, 207, 216, 245, 255, 255, 255, 249, 211, 205, 221, 250, 255, 255, 255, 
-  255, 212, 140, 106, 105, 135, 167, 195, 218, 216, 192, 164, 135, 115, 105, 96, 92, 95, 103, 109, 
-  119, 115, 85, 43, 13, 12, 46, 85, 115, 133, 149, 161, 188, 236, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 191, 106, 51, 13, 22, 51, 82, 125, 177, 226, 250, 225, 164, 96, 22, 0, 0, 
-  0, 0, 0, 24, 77, 125, 144, 157, 167, 183, 192, 168, 113, 53, 19, 17, 24, 19, 24, 47, 
-  57, 57, 57, 72, 81, 72, 70, 58, 33, 12, 19, 37, 57, 99, 159, 216, 255, 255, 249, 216, 
-  171, 149, 147, 147, 133, 103, 77, 55, 53, 92, 157, 240, 255, 255, 255, 255, 255, 255, 250, 208, 
-  173, 149, 123, 101, 101, 115, 135, 147, 150, 153, 149, 147, 144, 149, 140, 143, 143, 144, 140, 140, 
-  144, 140, 143, 143, 143, 143, 139, 140, 140, 140, 140, 137, 135, 137, 137, 137, 133, 130, 129, 130, 
-  129, 129, 128, 128, 125, 125, 125, 128, 128, 128, 120, 120, 119, 123, 119, 116, 120, 116, 119, 119, 
-  119, 115, 119, 116, 113, 115, 115, 115, 115, 113, 109, 106, 109, 113, 109, 109, 109, 109, 109, 109, 
-  109, 109, 109, 109, 113, 113, 111, 115, 116, 116, 115, 115, 113, 96, 77, 75, 75, 67, 71, 105, 
-  153, 183, 181, 154, 120, 87, 61, 48, 46, 48, 63, 87, 143, 212, 255, 255, 255, 255, 255, 235, 
-  143, 77, 58, 67, 92, 92, 75, 57, 37, 24, 17, 15, 9, 0, 0, 0, 0, 0, 0, 3, 
-  71, 159, 250, 255, 255, 255, 255, 240, 232, 229, 211, 171, 128, 95, 70, 55, 46, 43, 33, 3, 
-  0, 33, 81, 113, 111, 96, 77, 61, 53, 53, 57, 75, 96, 120, 149, 177, 212, 255, 255, 255, 
-  255, 255, 255, 255, 255, 183, 106, 43, 0, 0, 0, 0, 0, 0, 5, 67, 99, 105, 103, 96, 
-  89, 82, 77, 79, 77, 79, 82, 89, 92, 99, 103, 109, 111, 115, 115, 116, 101, 55, 24, 7, 
-  7, 24, 48, 75, 113, 147, 171, 202, 218, 236, 242, 255, 255, 255, 255, 255, 255, 255, 255, 250, 
-  109, 9, 0, 0, 0, 0, 0, 23, 96, 130, 120, 89, 53, 19, 3, 0, 0, 0, 0, 3, 
-  15, 24, 24, 0, 0, 9, 61, 109, 125, 120, 105, 101, 130, 178, 226, 245, 229, 198, 164, 139, 
-  116, 103, 99, 92, 95, 99, 96, 89, 61, 36, 22, 31, 87, 159, 207, 215, 202, 174, 168, 177, 
-  171, 154, 133, 129, 150, 154, 154, 157, 183, 218, 229, 225, 221, 225, 215, 178, 133, 89, 57, 29, 
-  15, 9, 12, 17, 24, 31, 41, 43, 29, 37, 51, 63, 92, 133, 154, 149, 147, 135, 125, 123, 
-  115, 113, 111, 109, 105, 106, 105, 89, 87, 115, 137, 149, 149, 144, 143, 137, 133, 129, 128, 125, 
-  125, 123, 128, 125, 128, 128, 128, 128, 130, 128, 128, 125, 125, 129, 129, 130, 133, 129, 128, 128, 
-  125, 125, 113, 113, 109, 115, 133, 143, 149, 144, 137, 135, 129, 120, 123, 113, 106, 113, 119, 119, 
-  123, 120, 120, 119, 115, 119, 116, 113, 103, 75, 58, 72, 113, 149, 164, 183, 188, 181, 163, 143, 
-  128, 116, 111, 103, 103, 103, 99, 103, 105, 105, 106, 106, 109, 109, 113, 111, 115, 116, 116, 116, 
-  119, 116, 120, 119, 119, 119, 119, 119, 119, 113, 85, 55, 29, 33, 70, 103, 125, 135, 140, 137, 
-  135, 135, 140, 171, 208, 236, 255, 255, 255, 255, 242, 202, 171, 129, 87, 71, 67, 55, 41, 48, 
-  77, 113, 120, 125, 139, 144, 135, 103, 71, 43, 24, 15, 5, 0, 0, 0, 0, 19, 37, 67, 
-  113, 174, 226, 245, 229, 211, 177, 149, 129, 111, 106, 95, 96, 99, 103, 109, 115, 119, 120, 99, 
-  71, 77, 89, 95, 101, 105, 137, 187, 240, 255, 245, 211, 184, 178, 174, 163, 153, 163, 197, 218, 
-  216, 216, 225, 225, 202, 159, 120, 95, 63, 48, 43, 39, 43, 48, 53, 61, 67, 71, 79, 85, 
-  89, 91, 92, 87, 61, 36, 19, 12, 19, 33, 71, 129, 168, 192, 198, 205, 232, 255, 255, 255, 
-  255, 255, 255, 222, 192, 171, 140, 92, 47, 17, 0, 0, 0, 0, 0, 0, 23, 63, 99, 111, 
-  109, 92, 75, 75, 103, 154, 192, 202, 188, 178, 171, 154, 163, 178, 198, 211, 184, 139, 81, 27, 
-  15, 12, 19, 53, 96, 143, 159, 154, 133, 115, 92, 67, 51, 46, 33, 23, 12, 13, 23, 39, 
-  91, 163, 226, 255, 255, 255, 255, 255, 255, 242, 205, 154, 125, 103, 95, 96, 123, 150, 161, 147, 
-  125, 109, 91, 85, 79, 79, 79, 85, 85, 91, 96, 101, 105, 109, 113, 115, 123, 120, 123, 128, 
-  130, 119, 96, 58, 36, 19, 23, 39, 63, 89, 119, 150, 174, 198, 222, 255, 255, 255, 255, 255, 
-  255, 255, 249, 168, 128, 111, 95, 101, 123, 150, 168, 154, 128, 95, 48, 2, 0, 0, 0, 0, 
-  0, 13, 57, 92, 130, 150, 149, 137, 130, 135, 120, 92, 72, 53, 41, 33, 36, 33, 22, 17, 
-  48, 91, 129, 144, 144, 149, 147, 147, 143, 140, 140, 139, 140, 143, 149, 149, 150, 153, 154, 157, 
-  157, 159, 161, 161, 161, 161, 161, 161, 157, 161, 157, 153, 153, 150, 149, 147, 144, 147, 140, 135, 
-  115, 79, 53, 31, 27, 37, 55, 77, 105, 133, 177, 232, 255, 255, 255, 255, 255, 255, 255, 212, 
-  154, 101, 65, 57, 81, 128, 174, 215, 235, 231, 197, 129, 58, 13, 0, 0, 0, 0, 0, 0, 
-  0, 0, 51, 135, 198, 249, 252, 229, 205, 188, 163, 128, 96, 70, 53, 46, 43, 46, 53, 61, 
-  57, 51, 57, 53, 51, 53, 57, 79, 125, 181, 221, 229, 225, 211, 211, 226, 255, 255, 255, 255, 
-  246, 208, 164, 130, 116, 125, 133, 133, 137, 150, 168, 168, 153, 135, 115, 105, 92, 87, 89, 89, 
-  95, 101, 103, 109, 113, 116, 115, 116, 125, 133, 133, 128, 115, 103, 111, 128, 139, 149, 150, 150, 
-  144, 144, 139, 143, 153, 163, 174, 184, 201, 202, 195, 178, 163, 150, 139, 120, 116, 113, 109, 101, 
-  103, 113, 129, 133, 133, 137, 139, 130, 119, 106, 92, 82, 65, 41, 39, 43, 57, 70, 65, 65, 
-  82, 111, 140, 168, 173, 163, 161, 159, 181, 188, 188, 191, 192, 187, 164, 137, 106, 91, 87, 87, 
-  81, 82, 103, 111, 101, 96, 95, 103, 123, 139, 140, 130, 115, 101, 106, 116, 128, 154, 195, 240, 
-  255, 255, 249, 242, 235, 211, 164, 119, 92, 65, 43, 17, 9, 5, 9, 9, 22, 41, 70, 96, 
-  116, 115, 105, 95, 81, 71, 71, 65, 63, 72, 85, 105, 144, 164, 187, 198, 208, 231, 252, 252, 
-//   239, 235, 236, 222, 195, 181, 168, 153, 116, 82, 57, 41, 27, 13, 0, 9, 29, 55, 82, 111, 
-//   119, 119, 106, 95, 95, 116, 153, 183, 191, 178, 171, 168, 154, 159, 174, 188, 195, 177, 143, 92, 
-//   51, 41, 37, 41, 63, 96, 130, 149, 144, 135, 128, 113, 91, 79, 70, 57, 46, 33, 31, 43, 
-//   58, 105, 164, 215, 245, 255, 255, 245, 235, 236, 221, 188, 144, 119, 103, 91, 96, 123, 147, 154, 
-//   143, 123, 111, 92, 87, 81, 81, 81, 85, 87, 92, 99, 103, 106, 111, 113, 116, 120, 120, 123, 
-//   128, 128, 119, 99, 61, 39, 23, 27, 41, 63, 91, 119, 149, 174, 197, 222, 255, 255, 255, 255, 
-//   255, 255, 255, 249, 168, 128, 111, 95, 101, 123, 150, 168, 154, 128, 95, 48, 2, 0, 0, 0, 
-//   0, 0, 13, 57, 92, 130, 150, 149, 137, 130, 135, 120, 92, 72, 53, 41, 33, 36, 33, 22, 
-//   17, 48, 91, 129, 144, 144, 149, 147, 147, 143, 140, 140, 139, 140, 143, 149, 149, 150, 153, 154, 
-//   157, 157, 159, 161, 161, 161, 161, 161, 161, 157, 161, 157, 153, 153, 150, 149, 147, 144, 147, 140, 
-//   135, 115, 79, 53, 31, 27, 33, 53, 75, 103, 135, 177, 232, 255, 255, 255, 255, 255, 255, 255, 
-//   215, 157, 99, 61, 55, 79, 129, 178, 218, 240, 239, 201, 125, 53, 2, 0, 0, 0, 0, 0, 
-//   0, 0, 0, 39, 137, 211, 255, 255, 240, 212, 192, 164, 125, 95, 58, 41, 31, 29, 33, 41, 
-//   51, 43, 39, 46, 37, 37, 39, 43, 70, 125, 195, 250, 255, 255, 235, 226, 240, 255, 255, 255, 
-//   255, 255, 232, 177, 135, 120, 130, 140, 140, 149, 164, 188, 191, 167, 143, 116, 99, 82, 79, 79, 
-//   77, 85, 91, 96, 103, 111, 113, 113, 115, 128, 139, 143, 144, 140, 133, 144, 150, 157, 159, 159, 
-//   154, 149, 147, 140, 143, 140, 139, 140, 137, 139, 139, 140, 140, 137, 139, 140, 139, 140, 140, 139, 
-//   135, 139, 135, 137, 137, 137, 133, 130, 129, 128, 129, 128, 125, 99, 70, 79, 103, 119, 119, 99, 
-//   87, 91, 109, 116, 119, 113, 106, 113, 144, 202, 240, 255, 255, 255, 255, 225, 168, 105, 65, 57, 
-//   53, 58, 92, 125, 133, 106, 85, 79, 67, 48, 23, 7, 0, 0, 7, 22, 43, 82, 154, 225, 
-//   255, 255, 255, 255, 255, 246, 221, 168, 119, 95, 67, 29, 0, 0, 0, 0, 0, 0, 0, 61, 
-//   125, 163, 154, 128, 91, 72, 89, 125, 144, 157, 173, 168, 171, 173, 159, 168, 191, 216, 229, 215, 
-//   168, 135, 125, 137, 137, 133, 144, 164, 171, 168, 159, 150, 140, 130, 128, 128, 129, 130, 130, 135, 
-//   140, 139, 144, 143, 144, 149, 150, 153, 154, 149, 153, 149, 149, 149, 149, 147, 147, 144, 143, 143, 
-//   140, 139, 133, 128, 123, 105, 82, 82, 96, 106, 135, 173, 197, 201, 201, 184, 168, 159, 139, 130, 
-//   140, 164, 178, 174, 153, 129, 109, 91, 79, 70, 65, 67, 63, 67, 65, 65, 75, 95, 99, 105, 
-//   105, 105, 105, 103, 103, 105, 106, 101, 105, 106, 106, 109, 111, 109, 109, 113, 115, 113, 116, 119, 
-//   116, 120, 116, 119, 120, 120, 120, 120, 120, 120, 123, 129, 128, 109, 101, 113, 128, 128, 105, 79, 
-//   51, 41, 55, 103, 154, 183, 184, 184, 195, 216, 218, 197, 163, 120, 87, 63, 51, 51, 58, 85, 
-//   140, 208, 255, 255, 255, 255, 255, 226, 164, 95, 47, 24, 5, 0, 0, 24, 67, 92, 106, 129, 
-//   149, 143, 128, 113, 87, 75, 81, 103, 120, 125, 111, 91, 72, 58, 51, 48, 47, 39, 37, 27, 
-//   13, 7, 9, 19, 43, 65, 116, 173, 222, 250, 255, 255, 250, 255, 255, 255, 255, 255, 255, 255, 
-//   255, 255, 255, 192, 135, 75, 13, 0, 0, 9, 63, 115, 161, 184, 178, 147, 111, 82, 57, 31, 
-//   13, 0, 0, 0, 0, 0, 0, 0, 0, 33, 61, 79, 95, 105, 125, 161, 195, 231, 255, 255, 
-//   250, 225, 192, 164, 143, 129, 135, 171, 226, 255, 255, 255, 255, 249, 192, 123, 63, 9, 0, 0, 
-//   0, 0, 39, 113, 183, 236, 255, 255, 235, 177, 130, 96, 77, 47, 3, 0, 0, 0, 0, 0, 
-//   0, 0, 61, 153, 205, 212, 192, 183, 195, 215, 236, 252, 235, 201, 173, 157, 135, 91, 53, 39, 
-//   37, 31, 27, 24, 29, 55, 111, 183, 255, 255, 255, 255, 255, 246, 246, 232, 197, 150, 111, 87, 
-//   58, 55, 70, 109, 174, 249, 255, 255, 255, 255, 255, 252, 208, 147, 85, 23, 0, 0, 0, 24, 
-//   72, 128, 171, 181, 168, 164, 163, 164, 167, 157, 120, 65, 13, 2, 13, 24, 29, 53, 85, 123, 
-//   140, 128, 92, 70, 77, 99, 109, 92, 71, 61, 77, 125, 183, 240, 255, 255, 255, 232, 197, 159, 
-//   150, 157, 144, 116, 91, 95, 123, 157, 197, 226, 235, 218, 178, 149, 130, 113, 103, 91, 87, 81, 
-//   81, 82, 85, 92, 99, 101, 106, 87, 55, 47, 72, 99, 109, 106, 115, 147, 191, 229, 240, 212, 
-//   178, 159, 171, 173, 159, 128, 101, 65, 51, 48, 72, 116, 144, 163, 191, 232, 255, 255, 255, 255, 
-//   212, 147, 89, 57, 57, 67, 87, 125, 167, 205, 207, 188, 168, 154, 129, 82, 27, 0, 0, 0, 
-//   13, 70, 120, 159, 171, 154, 119, 87, 43, 19, 24, 37, 31, 12, 0, 0, 0, 24, 61, 116, 
-//   173, 201, 216, 222, 208, 201, 211, 225, 245, 255, 255, 252, 229, 192, 144, 111, 71, 15, 0, 0, 
-//   0, 0, 5, 23, 72, 143, 215, 255, 255, 255, 246, 235, 236, 255, 255, 231, 181, 128, 79, 47, 
-//   27, 29, 51, 103, 174, 245, 255, 255, 255, 232, 202, 171, 129, 92, 67, 53, 65, 115, 171, 221, 
-//   255, 255, 255, 218, 147, 85, 53, 46, 58, 79, 96, 105, 103, 85, 37, 0, 0, 0, 0, 0, 
-//   0, 0, 0, 27, 51, 77, 105, 157, 205, 231, 245, 240, 229, 231, 252, 255, 255, 255, 255, 255, 
-//   255, 255, 218, 137, 72, 23, 2, 13, 65, 115, 137, 157, 183, 191, 167, 125, 77, 24, 0, 0, 
-//   22, 37, 48, 77, 123, 167, 181, 187, 197, 212, 218, 218, 208, 192, 167, 143, 99, 39, 0, 0, 
-//   0, 0, 0, 0, 19, 106, 147, 150, 130, 115, 123, 159, 191, 202, 191, 168, 159, 183, 218, 255, 
-//   255, 255, 255, 255, 255, 218, 195, 178, 154, 116, 91, 70, 46, 47, 72, 106, 125, 123, 120, 130, 
-//   144, 161, 174, 163, 133, 116, 82, 63, 72, 91, 96, 85, 63, 47, 33, 48, 87, 123, 144, 173, 
-//   208, 231, 252, 255, 255, 236, 208, 178, 150, 137, 133, 130, 143, 181, 239, 255, 255, 255, 255, 255, 
-//   207, 116, 65, 37, 17, 0, 0, 24, 63, 81, 89, 106, 119, 106, 70, 23, 0, 0, 5, 39, 
-//   55, 72, 101, 115, 109, 101, 106, 105, 91, 77, 65, 37, 9, 9, 19, 24, 31, 57, 105, 161, 
-//   208, 225, 222, 221, 221, 222, 207, 167, 116, 87, 71, 58, 72, 111, 153, 192, 225, 236, 229, 188, 
-//   159, 144, 139, 135, 115, 79, 47, 46, 71, 91, 103, 120, 128, 113, 113, 125, 139, 159, 183, 192, 
-//   184, 174, 157, 153, 174, 205, 229, 255, 255, 255, 255, 255, 255, 255, 255, 231, 187, 161, 137, 99, 
-//   77, 67, 63, 46, 13, 0, 3, 29, 46, 47, 31, 15, 0, 9, 41, 75, 95, 119, 150, 171, 
-//   192, 222, 246, 249, 232, 226, 221, 195, 161, 135, 95, 57, 17, 0, 12, 23, 36, 48, 85, 137, 
-//   184, 229, 249, 232, 197, 163, 116, 87, 82, 89, 103, 119, 129, 128, 89, 37, 0, 0, 0, 0, 
-//   0, 0, 0, 12, 63, 113, 164, 201, 225, 255, 255, 255, 255, 255, 222, 198, 178, 153, 147, 157, 
-//   173, 188, 173, 153, 130, 103, 82, 71, 47, 23, 3, 0, 9, 53, 116, 163, 188, 211, 207, 181, 
-//   163, 157, 149, 147, 167, 191, 187, 159, 125, 85, 55, 37, 37, 72, 129, 167, 181, 177, 173, 188, 
-//   198, 187, 178, 163, 129, 92, 71, 70, 57, 48, 57, 87, 123, 133, 143, 139, 130, 125, 113, 99, 
-//   109, 123, 120, 99, 67, 31, 9, 0, 0, 7, 43, 106, 174, 208, 212, 208, 216, 232, 231, 205, 
-//   168, 153, 157, 171, 192, 207, 207, 187, 143, 79, 19, 0, 0, 0, 0, 7, 58, 120, 161, 174, 
-//   188, 207, 205, 188, 168, 143, 123, 125, 130, 129, 106, 85, 81, 72, 65, 55, 48, 70, 116, 167, 
-//   195, 212, 218, 205, 202, 184, 157, 125, 95, 75, 77, 109, 159, 215, 245, 240, 231, 205, 163, 120, 
-//   99, 87, 71, 55, 43, 53, 92, 147, 197, 235, 255, 252, 215, 168, 137, 116, 103, 82, 36, 0, 
-//   0, 0, 0, 0, 12, 92, 157, 202, 211, 201, 191, 187, 187, 187, 184, 174, 163, 153, 133, 113, 
-//   77, 22, 0, 0, 0, 0, 0, 0, 33, 70, 106, 157, 221, 255, 255, 255, 252, 236, 246, 255, 
-//   255, 255, 231, 216, 201, 178, 154, 150, 153, 143, 133, 137, 168, 201, 222, 218, 192, 171, 125, 81, 
-//   46, 39, 31, 15, 22, 36, 47, 46, 61, 79, 91, 89, 99, 111, 116, 129, 137, 139, 154, 171, 
-//   192, 198, 174, 133, 85, 39, 7, 5, 36, 81, 130, 149, 150, 149, 137, 130, 128, 113, 85, 61, 
-//   43, 36, 48, 70, 101, 139, 177, 216, 235, 218, 181, 153, 144, 147, 135, 103, 77, 72, 87, 103, 
-//   109, 123, 140, 144, 139, 135, 139, 153, 161, 157, 133, 95, 47, 7, 3, 31, 67, 109, 150, 174, 
-//   183, 181, 173, 154, 154, 164, 184, 197, 187, 154, 133, 119, 109, 101, 87, 87, 103, 137, 167, 183, 
-//   164, 139, 115, 103, 109, 109, 99, 91, 91, 103, 129, 164, 205, 222, 216, 205, 205, 201, 198, 205, 
-//   192, 173, 144, 128, 128, 139, 150, 159, 184, 221, 232, 231, 225, 208, 198, 184, 153, 128, 123, 116, 
-//   113, 106, 103, 96, 61, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 67, 105, 144, 184, 
-//   205, 215, 226, 235, 235, 229, 232, 235, 231, 215, 198, 167, 120, 65, 19, 0, 0, 0, 0, 19, 
-//   65, 120, 171, 211, 226, 218, 198, 157, 123, 115, 119, 137, 147, 140, 135, 111, 75, 46, 33, 27, 
-//   33, 36, 33, 37, 57, 96, 137, 178, 208, 222, 240, 242, 226, 208, 192, 163, 130, 103, 79, 75, 
-//   85, 101, 120, 120, 129, 143, 144, 144, 140, 116, 91, 77, 79, 95, 128, 164, 183, 184, 183, 168, 
-//   144, 130, 137, 147, 161, 191, 212, 202, 177, 139, 96, 61, 36, 24, 48, 95, 135, 154, 163, 173, 
-//   195, 208, 195, 184, 167, 143, 109, 92, 85, 63, 46, 46, 67, 92, 99, 109, 116, 120, 130, 125, 
-//   116, 123, 133, 129, 106, 75, 46, 19, 3, 3, 23, 55, 113, 167, 195, 195, 188, 192, 211, 215, 
-//   195, 163, 153, 159, 177, 201, 215, 215, 197, 153, 92, 33, 0, 0, 0, 0, 22, 71, 125, 163, 
-//   174, 187, 202, 198, 183, 163, 139, 123, 128, 133, 130, 109, 85, 81, 72, 65, 55, 48, 70, 116, 
-//   167, 195, 212, 218, 205, 202, 184, 157, 125, 95, 75, 77, 109, 159, 215, 245, 240, 231, 205, 163, 
-//   120, 99, 87, 71, 55, 43, 53, 92, 147, 197, 235, 255, 252, 215, 168, 137, 116, 103, 82, 36, 
-//   0, 0, 0, 0, 0, 12, 92, 157, 202, 211, 201, 191, 187, 187, 187, 184, 174, 163, 153, 133, 
-//   113, 77, 22, 0, 0, 0, 0, 0, 0, 33, 70, 106, 157, 221, 255, 255, 255, 252, 236, 246, 
-//   255, 255, 255, 231, 216, 201, 178, 154, 150, 153, 139, 130, 139, 168, 201, 226, 221, 195, 168, 123, 
-//   77, 43, 33, 23, 9, 12, 31, 41, 43, 57, 79, 91, 87, 99, 113, 120, 135, 144, 143, 159, 
-//   173, 195, 197, 168, 119, 63, 13, 0, 0, 17, 70, 129, 149, 150, 147, 133, 111, 99, 75, 46, 
-//   19, 2, 3, 36, 70, 111, 164, 211, 255, 255, 250, 202, 167, 154, 154, 140, 111, 87, 92, 115, 
-//   125, 129, 140, 159, 157, 147, 140, 150, 163, 177, 174, 149, 106, 48, 3, 2, 33, 81, 135, 183, 
-//   201, 188, 173, 150, 129, 128, 144, 168, 188, 192, 168, 149, 139, 129, 111, 75, 55, 63, 96, 135, 
-//   159, 153, 128, 99, 85, 95, 105, 106, 113, 115, 119, 147, 198, 252, 255, 255, 255, 249, 235, 222, 
-//   215, 192, 164, 128, 105, 111, 116, 116, 113, 129, 164, 178, 181, 177, 153, 133, 116, 92, 81, 89, 
-//   103, 120, 130, 133, 119, 72, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 119, 167, 
-//   212, 235, 232, 225, 226, 222, 218, 235, 252, 255, 255, 255, 242, 187, 116, 46, 0, 0, 0, 0, 
-//   0, 0, 36, 92, 157, 216, 245, 240, 208, 168, 149, 159, 183, 183, 164, 147, 139, 133, 113, 106, 
-//   119, 147, 168, 159, 143, 133, 150, 177, 202, 216, 222, 208, 167, 123, 99, 79, 43, 2, 0, 0, 
-//   0, 0, 0, 0, 12, 77, 161, 232, 255, 255, 255, 240, 240, 255, 255, 255, 255, 235, 177, 120, 
-//   71, 47, 47, 81, 139, 198, 246, 255, 250, 221, 181, 129, 75, 23, 0, 0, 0, 24, 61, 111, 
-//   168, 212, 236, 226, 205, 188, 181, 177, 167, 137, 87, 29, 0, 0, 0, 0, 0, 19, 81, 140, 
-//   187, 198, 183, 168, 161, 143, 116, 103, 81, 71, 81, 106, 137, 149, 133, 96, 63, 29, 23, 47, 
-//   77, 103, 116, 133, 161, 212, 255, 255, 255, 255, 255, 215, 191, 181, 163, 168, 191, 215, 225, 207, 
-//   181, 167, 153, 116, 72, 39, 27, 46, 75, 106, 123, 106, 70, 23, 0, 0, 0, 0, 0, 3, 
-//   9, 29, 51, 71, 91, 129, 181, 249, 255, 255, 255, 240, 215, 205, 192, 195, 208, 218, 202, 163, 
-//   130, 111, 89, 63, 51, 63, 92, 105, 99, 70, 41, 22, 2, 5, 37, 72, 106, 144, 159, 153, 
-//   137, 125, 133, 161, 205, 236, 250, 231, 192, 159, 106, 55, 7, 0, 0, 0, 3, 19, 53, 85, 
-//   101, 111, 135, 177, 222, 255, 246, 211, 174, 149, 129, 119, 130, 154, 178, 178, 153, 113, 67, 33, 
-//   22, 48, 96, 157, 201, 207, 187, 163, 154, 135, 113, 91, 85, 105, 147, 184, 191, 181, 177, 174, 
-//   164, 144, 144, 150, 157, 171, 173, 174, 181, 171, 147, 119, 101, 106, 119, 116, 113, 103, 119, 139, 
-//   149, 149, 161, 187, 221, 252, 255, 255, 215, 147, 95, 65, 27, 0, 0, 3, 9, 9, 29, 71, 
-//   119, 171, 201, 221, 226, 218, 198, 171, 143, 113, 70, 7, 0, 0, 0, 0, 0, 0, 0, 0, 
-//   27, 67, 95, 115, 135, 171, 211, 235, 240, 236, 229, 222, 249, 255, 255, 255, 255, 255, 255, 231, 
-//   161, 129, 116, 123, 113, 109, 116, 128, 140, 128, 101, 71, 41, 3, 0, 0, 0, 2, 41, 81, 
-//   96, 87, 77, 89, 119, 154, 178, 195, 171, 147, 133, 120, 96, 75, 71, 79, 71, 63, 75, 92, 
-//   125, 144, 154, 161, 133, 105, 95, 91, 105, 119, 135, 135, 140, 140, 128, 96, 67, 63, 57, 48, 
-//   53, 53, 53, 77, 111, 135, 139, 128, 113, 113, 140, 184, 215, 216, 205, 187, 188, 201, 201, 198, 
-//   184, 188, 216, 255, 255, 255, 255, 239, 183, 129, 82, 55, 47, 41, 55, 96, 150, 211, 255, 255, 
-//   239, 212, 163, 105, 71, 51, 37, 37, 58, 85, 106, 95, 79, 61, 24, 0, 0, 0, 0, 0, 
-//   0, 2, 55, 87, 113, 137, 135, 125, 101, 79, 67, 81, 106, 130, 159, 177, 184, 195, 188, 183, 
-//   177, 153, 119, 92, 65, 48, 43, 47, 75, 125, 187, 249, 255, 255, 255, 225, 171, 130, 99, 81, 
-//   89, 103, 99, 79, 63, 63, 61, 53, 55, 81, 123, 168, 195, 192, 159, 137, 125, 106, 89, 70, 
-//   67, 96, 143, 178, 198, 218, 242, 255, 255, 231, 205, 188, 178, 178, 177, 173, 154, 116, 85, 55, 
-//   15, 0, 0, 0, 0, 3, 75, 137, 173, 178, 174, 163, 157, 177, 197, 205, 201, 192, 184, 178, 
-//   173, 174, 197, 242, 255, 255, 255, 255, 255, 255, 208, 137, 72, 17, 0, 7, 43, 82, 120, 147, 
-//   149, 120, 70, 9, 0, 0, 0, 0, 7, 5, 13, 37, 77, 95, 105, 123, 144, 161, 177, 171, 
-//   139, 113, 96, 82, 58, 24, 3, 13, 47, 87, 130, 159, 181, 188, 187, 171, 129, 96, 77, 77, 
-//   87, 101, 115, 125, 130, 130, 113, 75, 31, 9, 17, 51, 91, 113, 106, 99, 106, 133, 159, 161, 
-//   149, 137, 130, 154, 191, 218, 225, 211, 184, 164, 149, 137, 135, 139, 150, 163, 198, 252, 255, 255, 
-//   255, 255, 245, 215, 178, 137, 99, 72, 51, 57, 91, 137, 181, 216, 231, 225, 187, 119, 55, 13, 
-//   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 53, 65, 71, 87, 103, 119, 144, 174, 
-//   202, 225, 226, 201, 149, 99, 75, 51, 29, 22, 39, 53, 61, 65, 75, 103, 135, 150, 163, 184, 
-//   202, 215, 231, 232, 215, 191, 168, 174, 197, 231, 255, 255, 255, 229, 171, 109, 61, 36, 47, 82, 
-//   133, 171, 171, 174, 177, 177, 153, 113, 89, 87, 101, 125, 135, 129, 92, 57, 33, 15, 15, 46, 
-//   82, 116, 133, 149, 163, 201, 242, 255, 255, 255, 255, 255, 255, 255, 216, 150, 87, 31, 0, 0, 
-//   0, 13, 47, 91, 143, 192, 232, 255, 255, 218, 163, 119, 101, 103, 116, 113, 99, 89, 71, 41, 
-//   17, 2, 15, 53, 106, 154, 167, 157, 137, 133, 144, 147, 143, 140, 130, 123, 130, 149, 168, 183, 
-//   191, 188, 161, 105, 65, 43, 46, 67, 91, 119, 137, 144, 147, 143, 113, 79, 55, 23, 13, 23, 
-//   43, 53, 63, 75, 71, 61, 51, 47, 55, 89, 123, 154, 161, 168, 174, 184, 216, 255, 255, 255, 
-//   255, 255, 239, 225, 187, 147, 109, 89, 89, 92, 105, 116, 120, 130, 130, 130, 130, 113, 92, 71, 
-//   75, 96, 123, 143, 153, 137, 96, 47, 0, 0, 0, 0, 27, 55, 81, 101, 103, 87, 79, 92, 
-//   115, 123, 116, 92, 72, 75, 99, 137, 171, 197, 218, 215, 183, 149, 130, 111, 87, 70, 67, 71, 
-//   63, 58, 61, 51, 39, 23, 31, 61, 106, 147, 159, 154, 147, 150, 167, 171, 171, 163, 167, 191, 
-//   226, 249, 255, 255, 239, 211, 177, 149, 139, 157, 178, 183, 184, 198, 197, 184, 168, 161, 149, 125, 
-//   91, 53, 27, 29, 39, 41, 55, 79, 116, 149, 150, 139, 123, 99, 91, 99, 115, 137, 154, 161, 
-//   154, 140, 129, 130, 140, 140, 133, 147, 171, 202, 221, 207, 188, 168, 130, 91, 51, 22, 0, 0, 
-//   3, 24, 71, 129, 184, 221, 226, 216, 192, 167, 150, 144, 135, 109, 75, 43, 15, 2, 2, 24, 
-//   75, 133, 183, 222, 232, 212, 195, 178, 154, 128, 106, 103, 106, 116, 123, 123, 113, 81, 41, 2, 
-//   0, 0, 0, 15, 46, 70, 91, 119, 164, 215, 240, 252, 255, 249, 240, 242, 239, 215, 202, 197, 
-//   187, 159, 128, 101, 103, 113, 119, 123, 129, 147, 161, 173, 177, 174, 164, 140, 105, 79, 65, 51, 
-//   36, 27, 17, 7, 0, 0, 0, 17, 63, 120, 163, 174, 174, 164, 167, 191, 216, 218, 218, 218, 
-//   198, 187, 173, 147, 120, 99, 95, 105, 113, 128, 139, 137, 125, 111, 109, 120, 123, 120, 111, 109, 
-//   130, 161, 195, 208, 195, 178, 150, 115, 79, 63, 70, 87, 106, 123, 135, 123, 96, 70, 46, 12, 
-//   0, 0, 0, 0, 0, 23, 61, 101, 120, 149, 157, 159, 149, 153, 154, 153, 164, 168, 171, 181, 
-//   195, 212, 208, 192, 177, 150, 125, 115, 99, 82, 71, 63, 58, 61, 81, 106, 128, 147, 171, 183, 
-//   201, 225, 231, 216, 207, 207, 202, 191, 159, 123, 87, 55, 39, 27, 31, 55, 89, 115, 129, 139, 
-//   147, 143, 139, 137, 137, 129, 129, 130, 128, 137, 164, 197, 226, 252, 255, 246, 208, 163, 129, 101, 
-//   72, 53, 55, 63, 70, 79, 95, 111, 123, 113, 95, 81, 85, 105, 120, 129, 116, 101, 99, 91, 
-//   85, 89, 87, 99, 128, 153, 164, 157, 139, 123, 128, 137, 143, 153, 154, 147, 147, 161, 177, 187, 
-//   184, 174, 174, 168, 149, 120, 99, 82, 77, 72, 82, 105, 120, 137, 147, 144, 133, 129, 109, 91, 
-//   91, 96, 106, 109, 109, 91, 71, 53, 46, 48, 79, 115, 147, 168, 174, 171, 177, 184, 197, 192, 
-//   195, 187, 168, 150, 139, 111, 82, 57, 43, 53, 65, 87, 105, 113, 119, 123, 135, 149, 153, 143, 
-//   125, 123, 137, 144, 150, 149, 123, 82, 43, 7, 0, 0, 7, 48, 79, 111, 137, 154, 149, 144, 
-//   149, 150, 144, 130, 113, 99, 96, 119, 147, 177, 191, 198, 188, 159, 130, 111, 99, 91, 87, 89, 
-//   92, 87, 85, 85, 70, 53, 37, 31, 53, 87, 119, 137, 139, 139, 149, 163, 167, 171, 167, 173, 
-//   192, 215, 231, 239, 240, 226, 201, 167, 143, 133, 143, 153, 154, 159, 174, 173, 167, 159, 157, 154, 
-//   144, 120, 89, 61, 53, 55, 55, 63, 79, 106, 135, 130, 120, 106, 87, 85, 99, 119, 140, 159, 
-//   164, 154, 144, 133, 135, 140, 137, 129, 139, 161, 188, 201, 188, 167, 149, 115, 81, 48, 24, 12, 
-//   9, 19, 43, 87, 140, 191, 222, 226, 218, 197, 177, 159, 153, 140, 115, 85, 51, 24, 13, 12, 
-//   33, 81, 135, 183, 218, 229, 207, 192, 177, 153, 125, 105, 101, 105, 115, 119, 125, 113, 81, 46, 
-//   5, 0, 0, 0, 13, 46, 70, 89, 119, 164, 215, 240, 252, 255, 249, 240, 242, 239, 215, 202, 
-//   197, 187, 159, 128, 101, 103, 113, 119, 123, 129, 147, 161, 173, 177, 174, 164, 140, 105, 79, 65, 
-//   51, 36, 27, 17, 7, 0, 0, 0, 17, 63, 120, 163, 174, 174, 164, 167, 191, 216, 218, 218, 
-//   218, 198, 187, 173, 147, 120, 99, 95, 105, 113, 128, 139, 137, 125, 111, 109, 120, 123, 120, 111, 
-//   109, 130, 161, 195, 208, 195, 178, 150, 115, 79, 63, 70, 87, 106, 123, 137, 123, 96, 70, 43, 
-//   9, 0, 0, 0, 0, 0, 17, 57, 99, 125, 153, 163, 164, 153, 157, 159, 161, 167, 171, 171, 
-//   183, 197, 215, 207, 191, 171, 143, 119, 105, 89, 70, 51, 36, 29, 33, 57, 95, 128, 159, 188, 
-//   205, 216, 236, 239, 226, 212, 211, 207, 197, 168, 129, 85, 46, 22, 3, 12, 46, 96, 130, 154, 
-//   167, 171, 157, 143, 139, 135, 120, 111, 99, 89, 99, 137, 168, 208, 242, 255, 252, 225, 184, 159, 
-//   135, 106, 81, 71, 67, 61, 55, 58, 67, 70, 57, 46, 47, 71, 103, 128, 133, 115, 101, 101, 
-//   99, 105, 116, 123, 137, 161, 173, 173, 153, 129, 119, 123, 128, 140, 159, 161, 154, 159, 174, 192, 
-//   195, 181, 167, 164, 168, 173, 154, 130, 105, 82, 65, 61, 81, 103, 129, 149, 163, 168, 178, 168, 
-//   149, 137, 137, 149, 144, 130, 103, 77, 55, 43, 46, 70, 105, 144, 173, 174, 168, 167, 157, 135, 
-//   115, 106, 96, 79, 65, 51, 37, 15, 0, 0, 12, 36, 63, 89, 101, 105, 119, 140, 167, 195, 
-//   198, 187, 178, 178, 173, 163, 139, 103, 65, 33, 13, 12, 15, 37, 77, 111, 150, 187, 221, 235, 
-//   235, 226, 205, 173, 150, 143, 133, 133, 147, 164, 183, 174, 163, 143, 119, 91, 72, 77, 96, 119, 
-//   130, 129, 128, 130, 125, 106, 81, 55, 31, 31, 47, 67, 85, 101, 125, 143, 149, 153, 164, 174, 
-//   178, 188, 184, 184, 195, 197, 188, 167, 139, 129, 111, 99, 81, 72, 81, 95, 99, 106, 123, 144, 
-//   171, 197, 212, 205, 174, 135, 106, 99, 95, 82, 81, 77, 61, 47, 36, 37, 58, 95, 133, 161, 
-//   178, 168, 159, 149, 144, 139, 123, 105, 96, 99, 101, 101, 85, 61, 37, 17, 12, 17, 24, 46, 
-//   72, 95, 119, 150, 184, 212, 229, 231, 225, 232, 250, 255, 250, 229, 211, 192, 171, 150, 133, 139, 
-//   150, 147, 143, 147, 144, 133, 119, 113, 109, 95, 71, 41, 23, 19, 27, 39, 61, 75, 91, 105, 
-//   106, 103, 103, 116, 139, 161, 167, 159, 154, 153, 150, 147, 129, 113, 96, 81, 72, 65, 57, 47, 
-//   39, 43, 47, 63, 91, 128, 144, 154, 163, 174, 202, 226, 231, 221, 207, 201, 207, 198, 178, 153, 
-//   140, 130, 115, 106, 109, 123, 144, 164, 181, 187, 174, 150, 125, 113, 95, 71, 46, 22, 12, 22, 
-//   33, 53, 79, 96, 116, 129, 129, 129, 135, 139, 140, 150, 154, 159, 171, 183, 177, 163, 143, 130, 
-//   128, 123, 133, 143, 144, 135, 116, 96, 81, 70, 65, 71, 91, 116, 140, 163, 173, 173, 164, 149, 
-//   150, 159, 177, 192, 191, 173, 137, 106, 79, 58, 53, 67, 96, 130, 153, 163, 157, 153, 150, 135, 
-//   106, 82, 77, 82, 95, 101, 96, 95, 91, 71, 53, 39, 41, 63, 91, 109, 115, 116, 128, 144, 
-//   164, 178, 192, 198, 195, 187, 173, 159, 133, 103, 81, 61, 37, 15, 9, 12, 24, 61, 106, 154, 
-//   184, 192, 184, 178, 183, 192, 201, 198, 177, 154, 140, 129, 125, 133, 149, 163, 174, 164, 159, 157, 
-//   159, 161, 159, 159, 147, 123, 105, 95, 92, 95, 91, 79, 77, 87, 82, 81, 82, 81, 81, 87, 
-//   87, 87, 95, 106, 119, 135, 144, 153, 167, 184, 187, 184, 181, 183, 187, 187, 183, 177, 171, 149, 
-//   119, 99, 75, 48, 33, 33, 51, 81, 111, 130, 137, 130, 123, 111, 99, 105, 109, 109, 109, 106, 
-//   101, 103, 105, 99, 92, 85, 91, 113, 140, 144, 149, 140, 128, 123, 125, 139, 161, 168, 163, 159, 
-//   161, 164, 163, 153, 137, 128, 115, 106, 95, 85, 77, 71, 77, 91, 116, 149, 174, 184, 171, 147, 
-//   120, 101, 82, 89, 92, 101, 120, 135, 137, 129, 115, 111, 105, 92, 87, 91, 95, 103, 111, 115, 
-//   120, 125, 123, 128, 120, 113, 99, 91, 82, 89, 111, 140, 164, 177, 174, 168, 157, 143, 133, 115, 
-//   103, 85, 75, 71, 71, 75, 89, 119, 149, 187, 216, 231, 225, 205, 192, 177, 157, 135, 120, 120, 
-//   119, 119, 106, 96, 85, 75, 58, 48, 57, 77, 105, 123, 129, 125, 119, 115, 125, 137, 150, 164, 
-//   174, 177, 173, 174, 184, 198, 211, 216, 215, 198, 173, 153, 133, 120, 101, 75, 63, 63, 61, 71, 
-//   89, 105, 111, 106, 106, 113, 129, 140, 147, 139, 125, 113, 109, 106, 111, 115, 115, 120, 119, 115, 
-//   106, 101, 96, 109, 130, 153, 174, 184, 167, 150, 143, 128, 116, 103, 91, 95, 106, 129, 149, 154, 
-//   147, 143, 128, 109, 87, 71, 65, 70, 81, 92, 109, 133, 143, 143, 133, 128, 128, 115, 116, 111, 
-//   106, 99, 87, 81, 75, 79, 99, 123, 150, 168, 171, 173, 167, 161, 157, 144, 129, 115, 109, 99, 
-//   82, 81, 81, 81, 77, 65, 63, 67, 72, 85, 91, 96, 95, 96, 96, 105, 123, 135, 147, 163, 
-//   161, 163, 153, 144, 143, 153, 164, 183, 195, 191, 183, 178, 171, 154, 135, 116, 111, 103, 101, 111, 
-//   119, 123, 113, 106, 105, 106, 103, 99, 95, 92, 103, 123, 144, 154, 154, 153, 153, 150, 149, 153, 
-//   161, 154, 150, 149, 149, 143, 133, 128, 128, 119, 106, 95, 95, 101, 115, 130, 137, 140, 144, 139, 
-//   125, 113, 103, 99, 91, 85, 82, 77, 71, 75, 87, 91, 99, 111, 129, 140, 149, 161, 159, 154, 
-//   159, 163, 157, 150, 144, 137, 133, 130, 135, 144, 167, 187, 191, 195, 198, 198, 197, 183, 157, 130, 
-//   101, 79, 71, 75, 92, 109, 129, 139, 147, 139, 128, 99, 87, 79, 81, 79, 70, 61, 58, 70, 
-//   79, 92, 109, 130, 147, 154, 159, 153, 140, 135, 129, 128, 119, 109, 106, 106, 113, 111, 103, 103, 
-//   95, 89, 89, 91, 89, 91, 101, 111, 116, 140, 150, 157, 157, 154, 149, 137, 135, 133, 135, 137, 
-//   149, 154, 150, 140, 128, 119, 111, 106, 105, 111, 128, 137, 143, 149, 157, 159, 153, 150, 150, 150, 
-//   143, 133, 120, 119, 109, 109, 120, 135, 153, 164, 171, 173, 167, 153, 130, 111, 82, 67, 55, 48, 
-//   39, 39, 53, 67, 77, 99, 116, 135, 144, 150, 144, 130, 128, 125, 125, 125, 125, 123, 106, 95, 
-//   91, 77, 65, 58, 58, 61, 67, 79, 89, 105, 120, 133, 143, 164, 177, 183, 187, 183, 177, 178, 
-//   183, 195, 197, 192, 188, 187, 177, 157, 135, 129, 116, 106, 99, 101, 111, 120, 133, 139, 143, 135, 
-//   125, 99, 89, 85, 87, 82, 77, 67, 65, 63, 67, 71, 82, 101, 125, 147, 154, 153, 147, 144, 
-//   149, 154, 168, 174, 177, 167, 150, 139, 119, 103, 87, 81, 81, 87, 99, 106, 115, 116, 113, 113, 
-//   123, 128, 133, 130, 129, 128, 128, 139, 153, 163, 163, 167, 164, 157, 149, 144, 140, 137, 129, 119, 
-//   111, 96, 89, 89, 81, 82, 85, 87, 96, 106, 115, 111, 109, 99, 101, 103, 109, 111, 113, 111, 
-//   116, 116, 123, 133, 135, 147, 157, 164, 164, 167, 167, 164, 161, 147, 137, 129, 120, 119, 119, 125, 
-//   129, 128, 128, 125, 111, 103, 96, 95, 105, 113, 120, 125, 123, 120, 116, 105, 103, 95, 96, 106, 
-//   119, 120, 123, 115, 106, 109, 109, 113, 116, 125, 130, 129, 128, 129, 130, 130, 128, 128, 133, 137, 
-//   139, 135, 130, 129, 128, 130, 139, 153, 159, 161, 161, 154, 143, 133, 123, 116, 109, 106, 116, 129, 
-//   133, 137, 140, 144, 140, 130, 123, 116, 116, 119, 125, 128, 128, 115, 103, 91, 79, 72, 75, 82, 
-//   92, 103, 109, 120, 129, 137, 140, 150, 157, 164, 164, 157, 147, 139, 135, 125, 113, 106, 99, 101, 
-//   96, 95, 95, 99, 113, 119, 123, 129, 135, 140, 147, 149, 144, 140, 137, 129, 130, 135, 144, 159, 
-//   161, 157, 157, 147, 137, 125, 123, 123, 120, 123, 120, 116, 119, 125, 125, 125, 129, 128, 128, 123, 
-//   120, 119, 116, 111, 113, 109, 106, 109, 111, 120, 128, 129, 129, 133, 135, 143, 139, 139, 140, 137, 
-//   128, 123, 119, 113, 106, 106, 105, 105, 109, 109, 113, 119, 123, 130, 139, 140, 144, 140, 135, 135, 
-//   135, 135, 130, 129, 128, 130, 128, 129, 125, 133, 130, 125, 125, 119, 115, 116, 116, 119, 119, 115, 
-//   113, 111, 113, 116, 119, 120, 120, 116, 116, 111, 113, 115, 119, 116, 116, 115, 115, 120, 125, 128, 
-//   125, 125, 125, 130, 137, 139, 137, 135, 135, 135, 137, 140, 144, 143, 137, 130, 125, 123, 119, 115, 
-//   115, 116, 123, 123, 128, 125, 119, 115, 113, 111, 119, 128, 137, 137, 137, 135, 130, 123, 119, 120, 
-//   128, 133, 130, 130, 128, 119, 115, 116, 116, 120, 128, 129, 133, 130, 128, 125, 119, 109, 103, 101, 
-//   95, 91, 89, 96, 99, 105, 116, 129, 139, 144, 149, 144, 137, 130, 128, 120, 116, 116, 111, 105, 
-//   99, 92, 91, 85, 89, 92, 99, 105, 115, 116, 128, 133, 140, 144, 157, 164, 168, 167, 161, 154, 
-//   153, 153, 159, 161, 163, 164, 168, 163, 154, 139, 137, 125, 115, 109, 105, 109, 115, 123, 125, 130, 
-//   133, 128, 115, 109, 105, 105, 103, 99, 95, 91, 87, 89, 91, 96, 105, 119, 128, 130, 128, 125, 
-//   128, 130, 140, 153, 157, 154, 150, 143, 139, 125, 113, 103, 96, 99, 105, 111, 120, 128, 129, 128, 
-//   128, 130, 130, 133, 129, 125, 125, 123, 133, 144, 153, 154, 159, 154, 150, 143, 139, 130, 130, 123, 
-//   115, 113, 101, 92, 91, 89, 92, 95, 99, 106, 115, 116, 115, 115, 106, 109, 109, 113, 113, 115, 
-//   111, 115, 116, 120, 125, 133, 143, 150, 154, 157, 161, 161, 161, 159, 147, 137, 130, 123, 123, 123, 
-//   128, 130, 129, 129, 123, 116, 106, 101, 99, 105, 115, 119, 123, 120, 120, 120, 109, 105, 101, 103, 
-//   109, 120, 123, 125, 116, 109, 109, 111, 115, 119, 128, 130, 129, 128, 129, 130, 130, 128, 130, 133, 
-//   137, 139, 135, 130, 129, 128, 130, 139, 153, 159, 161, 161, 154, 143, 133, 123, 116, 109, 106, 116, 
-//   129, 133, 137, 140, 144, 140, 130, 123, 116, 116, 119, 125, 128, 128, 115, 103, 91, 79, 72, 75, 
-//   82, 92, 103, 109, 120, 129, 137, 140, 150, 157, 164, 164, 157, 147, 139, 135, 125, 113, 106, 99, 
-//   101, 96, 95, 95, 99, 113, 119, 123, 129, 135, 140, 147, 149, 144, 140, 137, 129, 130, 135, 144, 
-//   159, 161, 157, 157, 147, 137, 125, 123, 123, 120, 123, 120, 116, 119, 125, 125, 125, 129, 128, 128, 
-//   120, 119, 116, 115, 113, 115, 109, 106, 109, 113, 120, 128, 130, 129, 133, 135, 143, 139, 139, 137, 
-//   133, 125, 120, 115, 109, 103, 103, 103, 101, 105, 105, 106, 113, 115, 123, 135, 133, 137, 135, 128, 
-//   130, 133, 137, 139, 137, 135, 135, 130, 129, 125, 129, 129, 128, 128, 125, 125, 125, 125, 128, 129, 
-//   129, 125, 116, 115, 116, 115, 113, 111, 103, 105, 103, 105, 111, 113, 115, 116, 116, 116, 120, 133, 
-//   133, 133, 135, 135, 143, 153, 153, 149, 144, 144, 139, 137, 135, 139, 137, 129, 120, 120, 116, 111, 
-//   105, 105, 101, 106, 111, 119, 120, 119, 115, 115, 113, 119, 128, 133, 133, 129, 125, 113, 105, 99, 
-//   103, 113, 123, 133, 133, 130, 128, 116, 111, 106, 101, 99, 101, 105, 109, 111, 119, 123, 125, 125, 
-//   130, 129, 128, 128, 128, 125, 125, 129, 133, 140, 144, 149, 147, 139, 133, 123, 120, 111, 109, 103, 
-//   99, 99, 96, 99, 103, 111, 125, 137, 137, 147, 144, 144, 143, 144, 147, 147, 149, 150, 143, 135, 
-//   129, 119, 120, 116, 119, 128, 135, 144, 144, 147, 140, 140, 135, 125, 120, 109, 101, 101, 106, 109, 
-//   115, 128, 133, 135, 137, 135, 133, 133, 133, 130, 129, 125, 128, 123, 115, 109, 103, 91, 85, 79, 
-//   82, 95, 103, 113, 116, 116, 116, 119, 123, 133, 129, 130, 133, 130, 133, 137, 139, 143, 150, 153, 
-//   157, 154, 147, 139, 133, 123, 120, 120, 111, 115, 123, 129, 128, 130, 129, 128, 116, 111, 105, 105, 
-//   103, 101, 105, 103, 101, 105, 111, 119, 125, 135, 137, 137, 130, 130, 128, 128, 128, 128, 125, 125, 
-//   116, 115, 106, 105, 106, 105, 109, 109, 113, 113, 115, 116, 123, 133, 133, 137, 133, 135, 130, 135, 
-//   130, 133, 139, 137, 140, 137, 137, 128, 123, 123, 115, 109, 105, 109, 113, 123, 128, 125, 130, 129, 
-//   128, 128, 128, 128, 128, 128, 125, 125, 125, 125, 125, 129, 130, 128, 128, 125, 125, 129, 129, 130, 
-//   130, 128, 128, 125, 119, 115, 111, 106, 109, 116, 120, 123, 129, 129, 128, 125, 120, 123, 125, 128, 
-//   128, 128, 128, 125, 129, 130, 137, 137, 139, 140, 139, 139, 135, 130, 130, 128, 120, 115, 115, 111, 
-//   113, 116, 116, 128, 130, 129, 130, 133, 130, 130, 128, 128, 125, 125, 125, 125, 125, 123, 116, 116, 
-//   115, 113, 111, 115, 116, 120, 123, 125, 128, 129, 130, 133, 133, 133, 135, 133, 133, 133, 135, 133, 
-//   133, 135, 139, 137, 135, 129, 125, 123, 125, 123, 128, 125, 128, 128, 129, 130, 130, 130, 125, 125, 
-//   116, 115, 115, 115, 116, 113, 115, 115, 115, 120, 130, 129, 130, 129, 125, 128, 120, 120, 128, 128, 
-//   128, 125, 129, 129, 129, 125, 116, 113, 105, 105, 105, 103, 106, 111, 116, 123, 133, 139, 144, 143, 
-//   139, 133, 128, 125, 125, 128, 128, 128, 128, 128, 125, 125, 116, 115, 115, 113, 113, 115, 116, 120, 
-//   123, 125, 129, 129, 128, 128, 129, 129, 125, 125, 125, 116, 119, 123, 129, 128, 128, 128, 128, 128, 
-//   128, 128, 120, 120, 119, 123, 129, 128, 129, 130, 133, 139, 139, 139, 137, 130, 133, 129, 130, 125, 
-//   123, 125, 125, 116, 115, 120, 123, 129, 128, 120, 119, 119, 120, 123, 120, 123, 123, 119, 123, 119, 
-//   123, 129, 128, 128, 128, 128, 128, 128, 125, 125, 125, 125, 125, 125, 125, 119, 119, 123, 123, 129, 
-//   128, 128, 128, 128, 128, 128, 128, 128, 125, 125, 125, 125, 125, 120, 120, 120, 119, 119, 120, 123, 
-//   129, 120, 129, 128, 120, 120, 119, 119, 123, 119, 123, 119, 120, 123, 119, 120, 120, 116, 119, 120, 
-//   123, 120, 123, 129, 120, 123, 123, 123, 129, 128, 128, 128, 128, 128, 125, 125, 125, 125, 125, 125, 
-//   125, 125, 125, 125, 120, 120, 119, 123, 129, 128, 128, 128, 128, 128, 120, 119, 123, 129, 128, 128, 
-//   128, 128, 128, 128, 120, 128, 128, 128, 128, 129, 129, 129, 128, 125, 125, 125, 125, 125, 129, 129, 
-//   125, 129, 125, 125, 125, 125, 125, 125, 125, 128, 128, 116, 116, 116, 116, 119, 130, 129, 128, 128, 
-//   128, 128, 128, 116, 116, 120, 129, 128, 128, 128, 128, 128, 116, 116, 116, 116, 130, 128, 128, 128, 
-//   128, 128, 128, 128, 128, 125, 129, 129, 129, 128, 125, 125, 125, 125, 125, 129, 129, 135, 133, 129, 
-//   128, 125, 119, 116, 119, 123, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 125, 125, 
-//   125, 116, 115, 116, 116, 119, 130, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 128, 128, 125, 
-//   125, 125, 116, 119, 116, 116, 120, 116, 120, 120, 128, 129, 128, 128, 129, 129, 130, 130, 130, 129, 
-//   128, 125, 125, 125, 125, 125, 130, 130, 130, 133, 133, 129, 129, 129, 129, 128, 125, 125, 125, 125, 
-//   123, 120, 119, 119, 116, 115, 116, 113, 116, 116, 123, 125, 129, 129, 128, 128, 129, 130, 130, 130, 
-//   129, 128, 128, 125, 125, 125, 123, 128, 120, 119, 123, 119, 123, 129, 128, 128, 128, 129, 125, 129, 
-//   125, 125, 125, 123, 120, 120, 119, 119, 120, 120, 120, 120, 116, 119, 120, 128, 129, 128, 128, 128, 
-//   129, 130, 130, 133, 133, 135, 133, 133, 133, 133, 133, 133, 128, 129, 125, 123, 125, 125, 119, 125, 
-//   120, 125, 128, 128, 128, 128, 123, 123, 128, 123, 120, 119, 119, 116, 115, 115, 119, 123, 120, 130, 
-//   128, 128, 129, 129, 125, 129, 125, 125, 125, 125, 123, 120, 120, 120, 119, 116, 115, 115, 116, 119, 
-//   123, 125, 123, 129, 128, 128, 129, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 128, 125, 120, 
-//   120, 119, 119, 123, 129, 128, 128, 128, 129, 129, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 
-//   129, 125, 125, 125, 125, 125, 125, 125, 129, 125, 125, 129, 130, 130, 125, 125, 125, 125, 125, 125, 
-//   125, 129, 130, 128, 130, 128, 125, 125, 125, 125, 125, 125, 125, 125, 128, 128, 129, 130, 130, 130, 
-//   129, 128, 125, 125, 125, 123, 120, 119, 119, 123, 119, 123, 125, 129, 128, 128, 128, 123, 120, 125, 
-//   120, 120, 125, 128, 128, 128, 128, 128, 128, 128, 128, 123, 123, 120, 119, 119, 123, 125, 125, 125, 
-//   128, 128, 128, 128, 129, 130, 128, 128, 130, 128, 128, 130, 123, 125, 125, 123, 120, 120, 119, 123, 
-//   125, 125, 125, 128, 128, 128, 128, 128, 128, 128, 128, 125, 129, 129, 130, 130, 129, 129, 129, 129, 
-//   129, 129, 129, 129, 129, 129, 129, 128, 125, 125, 123, 120, 125, 120, 120, 125, 128, 128, 128, 128, 
-//   128, 128, 128, 128, 128, 123, 123, 120, 125, 120, 125, 128, 128, 128, 128, 128, 123, 120, 125, 125, 
-//   125, 128, 128, 128, 128, 128, 128, 123, 120, 119, 119, 123, 119, 120, 123, 123, 129, 128, 128, 129, 
-//   130, 130, 130, 129, 129, 129, 128, 128, 125, 125, 125, 125, 125, 125, 125, 125, 128, 128, 128, 128, 
-//   128, 128, 128, 128, 128, 123, 120, 120, 125, 128, 128, 128, 128, 128, 128, 123, 123, 128, 128, 128, 
-//   128, 128, 128, 128, 128, 125, 125, 125, 125, 125, 125, 129, 125, 125, 125, 125, 125, 123, 120, 125, 
-//   120, 125, 128, 128, 128, 129, 125, 129, 130, 128, 130
-};
+// 2000 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char explosion[1000] = {
+  119, 119, 119, 136, 136, 119, 119, 120, 136, 135, 102, 85, 103, 136, 136, 118, 101, 86, 119, 119,
+  136, 137, 170, 170, 168, 135, 100, 68, 69, 86, 120, 136, 137, 170, 169, 134, 102, 103, 137, 136,
+  136, 154, 187, 187, 170, 135, 66, 0, 0, 1, 37, 103, 136, 154, 205, 220, 187, 188, 239, 255,
+  255, 253, 202, 133, 34, 34, 34, 51, 32, 0, 0, 0, 20, 121, 188, 222, 255, 237, 201, 98,
+  0, 0, 0, 54, 138, 205, 239, 219, 169, 153, 170, 133, 33, 1, 35, 88, 188, 204, 186, 153,
+  171, 187, 169, 172, 255, 255, 255, 254, 166, 32, 0, 20, 104, 171, 170, 135, 100, 33, 34, 34,
+  71, 153, 133, 67, 70, 138, 172, 223, 254, 183, 48, 0, 19, 122, 221, 183, 66, 33, 17, 0,
+  20, 158, 255, 255, 255, 255, 201, 64, 0, 0, 0, 36, 68, 69, 119, 135, 121, 189, 255, 255,
+  255, 255, 255, 255, 200, 81, 0, 0, 2, 120, 116, 33, 19, 69, 102, 103, 121, 223, 255, 255,
+  253, 167, 86, 138, 204, 200, 64, 0, 0, 0, 3, 140, 255, 255, 253, 185, 99, 0, 0, 0,
+  1, 140, 220, 223, 255, 255, 220, 223, 255, 255, 216, 102, 138, 205, 220, 168, 118, 101, 86, 103,
+  117, 32, 2, 87, 137, 155, 239, 255, 255, 255, 255, 182, 49, 19, 88, 173, 237, 165, 16, 0,
+  1, 37, 137, 154, 187, 167, 65, 18, 18, 51, 68, 85, 85, 67, 35, 52, 105, 206, 238, 202,
+  152, 152, 118, 85, 122, 223, 255, 237, 219, 152, 102, 86, 120, 153, 154, 170, 169, 153, 170, 187,
+  187, 187, 170, 152, 118, 102, 102, 102, 101, 68, 68, 68, 69, 103, 137, 154, 171, 170, 169, 134,
+  83, 17, 18, 53, 103, 137, 170, 170, 152, 136, 136, 135, 84, 67, 68, 86, 120, 137, 136, 137,
+  170, 170, 135, 103, 138, 206, 255, 255, 253, 148, 16, 2, 69, 103, 135, 117, 67, 17, 0, 19,
+  88, 189, 202, 135, 103, 120, 136, 154, 188, 168, 83, 16, 18, 54, 139, 185, 117, 68, 85, 68,
+  68, 122, 223, 255, 238, 220, 186, 133, 16, 0, 0, 2, 68, 68, 87, 119, 119, 155, 207, 255,
+  255, 254, 255, 255, 252, 150, 32, 0, 0, 54, 118, 66, 1, 52, 86, 102, 120, 157, 255, 255,
+  255, 218, 117, 104, 172, 204, 132, 0, 0, 0, 0, 56, 207, 255, 255, 219, 150, 48, 0, 0,
+  0, 24, 205, 205, 255, 255, 253, 205, 255, 255, 253, 134, 104, 172, 221, 202, 135, 102, 85, 102,
+  119, 82, 0, 37, 120, 154, 190, 255, 255, 255, 255, 251, 99, 1, 53, 123, 239, 234, 97, 0,
+  0, 1, 71, 153, 171, 202, 115, 17, 17, 18, 51, 52, 84, 67, 32, 18, 54, 157, 255, 253,
+  169, 153, 134, 67, 53, 159, 255, 255, 255, 253, 169, 118, 103, 137, 153, 153, 153, 136, 137, 136,
+  152, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 120, 136, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 102, 103, 102, 102, 102, 102, 102, 119, 103, 119, 119, 118, 68, 68, 70,
+  155, 185, 117, 51, 35, 53, 141, 255, 255, 254, 132, 52, 85, 67, 33, 16, 0, 0, 0, 0,
+  73, 255, 255, 255, 238, 218, 133, 67, 34, 32, 2, 87, 102, 67, 51, 52, 103, 155, 223, 255,
+  255, 255, 251, 98, 0, 0, 0, 4, 102, 102, 85, 68, 68, 85, 86, 102, 103, 119, 99, 16,
+  1, 52, 121, 172, 222, 255, 255, 255, 255, 255, 96, 0, 0, 1, 104, 117, 49, 0, 0, 0,
+  1, 16, 0, 54, 119, 102, 139, 239, 236, 168, 118, 101, 86, 101, 50, 17, 89, 205, 202, 171,
+  169, 136, 153, 153, 189, 238, 222, 219, 133, 49, 0, 1, 17, 34, 18, 51, 88, 153, 152, 119,
+  119, 102, 102, 101, 87, 137, 153, 136, 136, 135, 119, 135, 136, 136, 136, 135, 120, 136, 136, 136,
+  119, 119, 103, 136, 153, 136, 135, 119, 103, 119, 119, 119, 119, 119, 100, 52, 121, 171, 187, 168,
+  135, 102, 102, 102, 102, 102, 102, 118, 119, 119, 119, 119, 119, 119, 119, 83, 18, 70, 120, 136,
+  136, 138, 222, 255, 255, 252, 168, 84, 67, 35, 71, 119, 137, 134, 66, 16, 0, 0, 1, 36,
+  122, 239, 237, 185, 134, 101, 102, 102, 119, 118, 68, 85, 102, 139, 255, 253, 187, 170, 154, 205,
+  221, 238, 201, 117, 51, 34, 35, 51, 68, 69, 85, 85, 50, 16, 18, 72, 172, 204, 239, 255,
+  255, 253, 202, 133, 33, 0, 0, 0, 19, 102, 101, 68, 105, 204, 187, 169, 171, 205, 184, 81,
+  0, 19, 104, 153, 135, 84, 50, 33, 0, 18, 90, 239, 255, 255, 255, 201, 118, 86, 121, 169,
+  118, 85, 68, 69, 85, 102, 102, 119, 119, 120, 135, 99, 33, 18, 53, 121, 172, 223, 255, 255,
+  255, 250, 134, 86, 121, 169, 133, 48, 0, 0, 0, 53, 137, 152, 136, 117, 67, 34, 34, 17,
+  53, 137, 153, 153, 136, 136, 136, 153, 153, 153, 153, 170, 170, 170, 154, 153, 153, 153, 153, 136,
+  116, 49, 18, 52, 104, 190, 255, 255, 255, 253, 150, 67, 88, 173, 238, 200, 48, 0, 0, 0,
+  0, 56, 207, 254, 203, 168, 100, 50, 34, 51, 51, 51, 51, 52, 123, 222, 237, 222, 255, 255,
+  253, 168, 119, 136, 137, 170, 152, 118, 85, 85, 86, 102, 119, 119, 120, 136, 118, 104, 137, 153,
+  153, 136, 154, 171, 204, 203, 169, 135, 119, 102, 103, 136, 136, 136, 118, 85, 66, 34, 52, 68,
+  86, 138, 170, 169, 187, 187, 203, 168, 101, 85, 85, 102, 102, 86, 120, 136, 118, 103, 137, 207,
+  255, 255, 237, 167, 84, 33, 0, 0, 18, 70, 119, 101, 84, 68, 52, 86, 154, 188, 222, 255};
+
+// 982 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char fastinvader1[491] = {
+  118, 83, 33, 0, 17, 52, 86, 137, 171, 205, 238, 255, 255, 255, 255, 255, 238, 220, 204, 187,
+  170, 152, 135, 118, 101, 84, 67, 52, 68, 85, 85, 85, 67, 50, 16, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 19, 52, 69, 103, 136, 154, 187, 204, 222, 239, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 238, 237, 220, 204,
+  187, 170, 153, 152, 136, 119, 102, 101, 85, 84, 68, 67, 33, 0, 0, 0, 0, 0, 0, 1,
+  35, 69, 102, 119, 136, 136, 136, 119, 102, 102, 85, 84, 67, 50, 33, 17, 0, 0, 0, 0,
+  1, 35, 51, 50, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 35, 52, 86,
+  120, 137, 171, 204, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 237, 204, 203, 170, 169, 152, 136,
+  136, 118, 102, 85, 66, 0, 0, 0, 0, 0, 0, 18, 52, 85, 102, 119, 119, 120, 119, 119,
+  102, 101, 84, 68, 50, 33, 16, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 35, 69, 102, 120, 154, 171, 205, 238, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 238, 221, 204, 187, 186, 169, 153, 136, 136, 119, 102, 101, 85, 66, 0, 0, 0,
+  0, 0, 1, 52, 85, 103, 136, 137, 153, 153, 152, 136, 135, 102, 85, 84, 51, 50, 33, 0,
+  0, 0, 0, 0, 1, 18, 34, 33, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 18, 52, 69, 103, 137, 154, 188, 205, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 238, 221, 204, 203, 187, 169,
+  153, 136, 136, 119, 102, 85, 85, 68, 68, 51, 50, 50, 33, 17, 17, 17, 17, 0, 0, 0,
+  0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 34, 34, 35, 51, 51, 51, 52, 68, 68,
+  68, 85, 85, 85, 102, 102, 102, 102, 119, 120, 136, 136, 136, 136, 136, 136, 136, 153, 153, 153,
+  153, 154, 154, 154, 170, 170, 170, 170, 170, 170, 170, 186, 186, 186, 171, 170, 186, 171, 171, 170,
+  186, 186, 170, 170, 170, 170, 170, 170, 170, 170, 154, 170, 153, 153, 153, 153, 153, 153, 153, 153,
+  153, 152, 152, 153, 137, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 119, 118,
+  119, 102, 118, 118, 118, 103, 103, 102, 118, 118, 102};
+
+// 1042 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char fastinvader2[521] = {
+  136, 117, 67, 17, 1, 19, 69, 104, 138, 187, 205, 239, 255, 255, 255, 255, 255, 238, 220, 203,
+  186, 169, 152, 135, 102, 85, 68, 51, 52, 69, 85, 85, 84, 67, 33, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 18, 52, 69, 103, 120, 153, 171, 188, 205, 238, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 221, 204, 203,
+  187, 170, 169, 152, 152, 136, 119, 118, 101, 85, 84, 68, 67, 51, 51, 34, 34, 17, 17, 0,
+  0, 0, 0, 0, 0, 0, 1, 35, 69, 86, 103, 136, 136, 136, 136, 136, 136, 135, 118, 102,
+  85, 84, 68, 51, 50, 33, 34, 52, 69, 85, 85, 68, 51, 33, 16, 0, 0, 0, 0, 0,
+  0, 0, 17, 35, 52, 86, 103, 136, 154, 187, 205, 238, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 237, 220,
+  204, 187, 186, 153, 152, 136, 119, 118, 101, 85, 68, 67, 51, 50, 33, 17, 17, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 51, 69, 86, 103, 119, 120, 119, 119, 102, 101, 85, 68, 51, 51,
+  33, 17, 0, 0, 0, 1, 18, 51, 51, 33, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 17, 35, 69, 86, 120, 153, 171, 188, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 238, 220, 204, 187,
+  187, 170, 153, 136, 136, 135, 102, 101, 84, 68, 51, 51, 51, 34, 33, 17, 0, 0, 0, 0,
+  0, 0, 0, 19, 69, 86, 120, 136, 136, 137, 137, 136, 136, 135, 118, 101, 85, 84, 51, 50,
+  33, 17, 17, 18, 51, 68, 68, 67, 50, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  18, 51, 69, 103, 136, 154, 171, 205, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 221, 204, 187, 186, 169, 153,
+  136, 136, 119, 102, 101, 85, 84, 68, 51, 51, 34, 33, 17, 17, 16, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 16, 17, 17, 17, 18, 18, 34, 35, 51, 51, 51, 68, 68,
+  68, 85, 85, 86, 86, 102, 103, 103, 119, 120, 136, 136, 136, 136, 152, 153, 153, 153, 153, 169,
+  169, 170, 170, 170, 170, 170, 170, 170, 171, 171, 171, 186, 187, 171, 171, 186, 171, 171, 187, 187,
+  171, 186, 186, 187, 170, 187, 170, 171, 170, 170, 170, 170, 170, 169, 153, 153, 153, 153, 153, 152,
+  137, 137, 137, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 135,
+  135, 135, 119, 119, 119, 119, 119, 118, 119, 102, 118, 118, 118, 102, 118, 118, 118, 103, 102, 102,
+  103};
 
-const unsigned char fastinvader1[982] = {
-  122, 105, 88, 60, 43, 20, 15, 9, 20, 31, 48, 65, 94, 105, 128, 144, 167, 184, 195, 218, 
-  224, 235, 240, 246, 252, 255, 252, 252, 252, 246, 246, 240, 235, 224, 218, 207, 201, 195, 184, 178, 
-  167, 161, 144, 139, 133, 122, 116, 105, 99, 88, 82, 71, 65, 54, 60, 65, 65, 77, 82, 94, 
-  94, 88, 94, 82, 71, 60, 48, 37, 26, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15, 26, 31, 48, 60, 71, 77, 94, 
-  111, 122, 128, 139, 150, 167, 178, 190, 201, 207, 218, 224, 235, 240, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 235, 235, 229, 224, 212, 212, 201, 195, 195, 
-  184, 178, 167, 161, 156, 150, 150, 139, 133, 128, 122, 116, 111, 105, 99, 94, 94, 82, 82, 77, 
-  77, 65, 65, 60, 43, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 26, 
-  43, 60, 77, 82, 99, 105, 116, 116, 128, 128, 128, 128, 128, 128, 122, 116, 111, 105, 99, 105, 
-  94, 88, 82, 77, 65, 60, 48, 43, 37, 31, 26, 20, 15, 9, 3, 3, 0, 0, 0, 3, 
-  9, 26, 37, 48, 48, 48, 48, 43, 37, 26, 15, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15, 26, 37, 48, 60, 71, 88, 105, 
-  116, 128, 139, 150, 167, 178, 195, 207, 218, 235, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 252, 240, 240, 235, 224, 212, 207, 195, 195, 184, 173, 167, 161, 156, 150, 139, 133, 133, 
-  128, 128, 116, 111, 105, 105, 94, 88, 71, 43, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 9, 26, 37, 54, 71, 82, 94, 105, 111, 116, 116, 122, 122, 122, 128, 122, 122, 116, 116, 
-  111, 111, 99, 88, 82, 77, 71, 65, 54, 43, 43, 31, 20, 15, 3, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 3, 9, 15, 20, 15, 20, 9, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-  15, 26, 43, 54, 71, 88, 99, 111, 122, 133, 150, 161, 173, 190, 201, 212, 224, 235, 246, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 246, 240, 235, 224, 218, 212, 207, 201, 190, 184, 178, 173, 167, 156, 156, 150, 
-  139, 128, 128, 128, 122, 116, 111, 105, 99, 94, 94, 88, 65, 43, 15, 0, 0, 0, 0, 0, 
-  0, 0, 0, 3, 15, 31, 48, 65, 82, 94, 105, 116, 128, 133, 139, 144, 150, 150, 144, 150, 
-  144, 139, 139, 133, 128, 116, 111, 99, 94, 82, 82, 77, 60, 54, 48, 43, 37, 26, 15, 15, 
-  9, 3, 0, 0, 0, 0, 0, 3, 15, 26, 31, 43, 43, 37, 37, 31, 20, 15, 3, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  3, 15, 31, 43, 48, 65, 77, 94, 105, 122, 128, 144, 156, 167, 184, 195, 207, 218, 229, 240, 
-  252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 252, 246, 235, 229, 224, 218, 212, 207, 201, 195, 184, 178, 178, 173, 156, 
-  150, 150, 139, 128, 128, 128, 122, 116, 111, 99, 94, 88, 88, 82, 77, 71, 71, 65, 60, 54, 
-  48, 43, 48, 43, 37, 31, 26, 31, 26, 26, 26, 26, 20, 20, 15, 15, 9, 15, 9, 15, 
-  9, 15, 9, 15, 15, 15, 9, 15, 15, 15, 20, 26, 20, 26, 20, 26, 31, 26, 31, 31, 
-  31, 31, 37, 37, 43, 43, 43, 48, 54, 48, 54, 60, 54, 60, 60, 65, 71, 65, 71, 77, 
-  71, 77, 82, 82, 88, 94, 88, 94, 99, 99, 105, 99, 105, 105, 111, 111, 116, 116, 122, 128, 
-  128, 128, 128, 128, 128, 128, 133, 128, 133, 139, 139, 133, 139, 139, 144, 150, 144, 150, 156, 150, 
-  156, 150, 156, 161, 156, 161, 156, 161, 161, 161, 161, 167, 161, 167, 173, 167, 173, 173, 173, 167, 
-  173, 173, 178, 173, 178, 173, 178, 173, 173, 178, 173, 173, 178, 173, 173, 178, 173, 178, 173, 173, 
-  178, 173, 178, 173, 167, 167, 173, 167, 173, 167, 161, 161, 167, 161, 167, 161, 161, 161, 167, 161, 
-  156, 161, 161, 161, 156, 150, 156, 156, 156, 156, 150, 156, 156, 156, 150, 144, 144, 150, 144, 150, 
-  144, 150, 144, 139, 144, 139, 144, 144, 139, 144, 139, 133, 139, 139, 139, 133, 139, 133, 133, 133, 
-  139, 133, 133, 128, 133, 128, 128, 128, 128, 128, 128, 128, 128, 128, 116, 122, 116, 122, 116, 111, 
-  116, 116, 111, 111, 116, 111, 116, 111, 116, 111, 111, 116, 111, 116, 111, 111, 116, 111, 116, 111, 
-  111, 111};
+// 1054 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char fastinvader3[527] = {
+  136, 136, 136, 135, 84, 49, 16, 17, 52, 86, 137, 171, 205, 239, 255, 255, 255, 255, 255, 254,
+  237, 220, 203, 170, 153, 136, 118, 101, 84, 68, 51, 68, 85, 85, 85, 67, 50, 16, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 35, 52, 86, 119, 137, 154, 187, 205, 222, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238,
+  237, 204, 203, 186, 170, 153, 152, 136, 119, 118, 102, 85, 84, 68, 67, 51, 33, 17, 17, 17,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 69, 104, 137,
+  154, 170, 187, 187, 187, 187, 170, 170, 153, 152, 136, 119, 102, 85, 84, 68, 69, 102, 119, 135,
+  118, 101, 84, 51, 33, 17, 0, 0, 0, 0, 1, 17, 34, 52, 69, 102, 120, 153, 171, 188,
+  222, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 238, 221, 204, 187, 186, 169, 152, 136, 119, 102, 85, 84, 68, 51,
+  51, 34, 17, 17, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 35, 69, 103, 136, 136, 153, 153, 153, 153, 136, 136, 119, 102, 101, 85, 68, 67,
+  51, 34, 35, 68, 85, 102, 85, 68, 50, 17, 0, 0, 0, 0, 0, 0, 0, 0, 17, 35,
+  52, 85, 103, 136, 154, 187, 205, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 237, 220, 204, 187, 170, 153, 153,
+  136, 135, 102, 102, 85, 84, 68, 51, 51, 34, 33, 17, 17, 16, 16, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 17, 17, 34, 34, 51, 51, 51, 52, 68, 68,
+  69, 85, 85, 86, 102, 102, 119, 119, 136, 136, 136, 136, 153, 137, 153, 153, 153, 153, 154, 170,
+  170, 170, 170, 171, 187, 171, 171, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+  187, 187, 187, 187, 171, 170, 186, 170, 170, 170, 170, 170, 170, 170, 169, 169, 153, 153, 153, 153,
+  153, 153, 152, 152, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 135, 135, 135,
+  119, 119, 119, 103, 118, 103, 102, 118, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 119, 103, 103, 118, 118, 103, 103, 119,
+  119, 119, 119, 119, 119, 119, 119, 103, 103, 119, 119, 119, 119, 119, 135, 136, 135, 136, 136, 136,
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 152, 136, 152, 136, 136, 152, 137, 152, 153,
+  137, 152, 137, 137, 152, 137, 137, 137, 137, 137, 152, 152, 136, 136, 152, 153, 137, 152, 137, 137,
+  152, 152, 137, 152, 152, 152, 136};
 
-const unsigned char fastinvader2[1042] = {
-  128, 128, 116, 94, 71, 54, 31, 20, 9, 20, 31, 48, 65, 88, 105, 128, 139, 161, 178, 190, 
-  207, 218, 229, 240, 252, 252, 252, 255, 255, 252, 252, 252, 240, 240, 229, 224, 212, 207, 201, 184, 
-  184, 173, 161, 150, 144, 128, 128, 122, 111, 99, 94, 82, 77, 65, 60, 54, 54, 71, 71, 82, 
-  88, 94, 94, 94, 82, 77, 65, 60, 37, 31, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 9, 20, 26, 43, 54, 65, 71, 88, 
-  99, 116, 122, 133, 144, 156, 167, 178, 184, 195, 207, 218, 229, 235, 246, 252, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 246, 240, 235, 224, 218, 218, 207, 201, 195, 190, 
-  184, 178, 173, 167, 161, 156, 144, 139, 144, 133, 128, 128, 122, 116, 116, 105, 105, 94, 94, 88, 
-  82, 77, 77, 65, 65, 60, 60, 54, 54, 48, 43, 43, 37, 37, 31, 31, 26, 26, 15, 3, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 37, 54, 71, 82, 94, 105, 
-  111, 122, 128, 133, 133, 139, 133, 139, 139, 139, 133, 139, 128, 128, 128, 116, 116, 111, 111, 99, 
-  88, 94, 82, 77, 71, 65, 60, 60, 48, 43, 37, 31, 37, 43, 54, 71, 77, 88, 94, 94, 
-  88, 88, 77, 71, 60, 54, 43, 31, 20, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 3, 3, 15, 20, 31, 43, 48, 60, 71, 82, 99, 111, 122, 128, 139, 150, 167, 178, 190, 
-  201, 212, 224, 235, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 240, 235, 224, 218, 218, 207, 
-  201, 195, 190, 178, 178, 167, 156, 150, 144, 139, 133, 128, 122, 116, 116, 105, 99, 94, 94, 82, 
-  71, 77, 71, 60, 54, 54, 48, 43, 37, 31, 26, 26, 26, 20, 15, 3, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 31, 48, 60, 77, 88, 94, 99, 105, 116, 
-  116, 122, 122, 128, 122, 122, 116, 116, 111, 105, 99, 94, 88, 82, 77, 65, 60, 54, 48, 48, 
-  37, 31, 26, 20, 15, 9, 3, 0, 3, 0, 9, 26, 31, 43, 48, 54, 48, 48, 43, 31, 
-  26, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 15, 20, 31, 43, 54, 65, 82, 94, 105, 122, 128, 144, 156, 167, 184, 190, 207, 
-  218, 229, 240, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 240, 235, 229, 224, 218, 207, 201, 195, 190, 184, 
-  178, 178, 167, 161, 156, 144, 139, 133, 128, 133, 128, 116, 111, 111, 105, 94, 88, 77, 71, 65, 
-  60, 60, 54, 54, 48, 48, 43, 43, 37, 31, 26, 20, 3, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 15, 26, 48, 65, 82, 94, 111, 122, 128, 128, 133, 133, 139, 139, 144, 
-  139, 144, 139, 139, 133, 128, 128, 116, 116, 111, 99, 94, 88, 82, 82, 71, 60, 54, 48, 43, 
-  37, 31, 26, 20, 26, 20, 26, 43, 48, 60, 65, 65, 65, 71, 65, 54, 48, 43, 31, 20, 
-  9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 20, 
-  26, 43, 48, 60, 77, 88, 105, 116, 128, 133, 144, 161, 173, 190, 201, 212, 218, 229, 240, 252, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 252, 246, 240, 235, 224, 218, 212, 201, 195, 184, 184, 178, 167, 161, 156, 150, 144, 
-  139, 128, 128, 128, 116, 116, 111, 99, 99, 94, 88, 82, 82, 77, 77, 65, 60, 54, 54, 48, 
-  43, 43, 37, 31, 31, 26, 20, 26, 20, 15, 15, 20, 15, 15, 15, 15, 9, 9, 9, 9, 
-  15, 9, 9, 15, 9, 3, 9, 15, 15, 9, 15, 9, 15, 15, 20, 15, 20, 26, 26, 20, 
-  31, 31, 31, 37, 31, 37, 37, 43, 43, 48, 54, 48, 54, 54, 60, 60, 65, 65, 71, 71, 
-  77, 77, 82, 82, 88, 88, 94, 99, 94, 99, 105, 105, 111, 116, 111, 116, 116, 122, 122, 128, 
-  128, 128, 133, 128, 133, 139, 133, 139, 144, 139, 144, 144, 150, 156, 156, 156, 150, 156, 161, 156, 
-  161, 156, 161, 161, 167, 167, 173, 167, 167, 173, 167, 173, 173, 167, 167, 173, 173, 178, 173, 178, 
-  173, 178, 178, 173, 178, 178, 173, 178, 173, 178, 178, 173, 173, 178, 173, 178, 184, 178, 184, 178, 
-  173, 178, 178, 173, 178, 173, 178, 178, 173, 173, 178, 178, 173, 167, 173, 178, 173, 167, 167, 173, 
-  167, 173, 167, 161, 167, 161, 161, 156, 150, 150, 156, 150, 144, 144, 150, 144, 144, 150, 144, 139, 
-  139, 144, 139, 144, 139, 144, 139, 133, 133, 133, 139, 133, 139, 133, 128, 133, 133, 128, 128, 133, 
-  128, 133, 128, 133, 128, 133, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 122, 
-  128, 122, 128, 122, 122, 122, 116, 122, 116, 116, 122, 122, 116, 122, 116, 111, 116, 116, 111, 111, 
-  116, 111, 116, 111, 116, 111, 111, 111, 116, 111, 116, 111, 116, 111, 111, 116, 111, 111, 111, 111, 
-  111, 116};
+// 1098 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char fastinvader4[549] = {
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 135, 100, 49, 16, 1, 35, 86, 136,
+  171, 205, 239, 255, 255, 255, 255, 255, 255, 238, 220, 203, 186, 153, 136, 119, 102, 85, 68, 51,
+  52, 85, 85, 101, 84, 50, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+  51, 69, 102, 120, 137, 170, 188, 221, 238, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 254, 238, 237, 204, 186, 134, 83, 34, 18, 35, 69, 86,
+  119, 136, 153, 170, 170, 169, 153, 152, 136, 119, 102, 84, 67, 34, 16, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 52, 86, 136, 154, 188, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 185, 134, 102, 102, 120, 137, 171,
+  188, 205, 222, 238, 238, 237, 220, 203, 186, 169, 136, 118, 85, 68, 50, 17, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 35, 69, 103, 136, 154, 187, 205, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 237, 220, 168, 118, 68, 68, 69, 86, 120, 137,
+  170, 187, 204, 204, 204, 203, 186, 170, 152, 136, 118, 101, 67, 50, 17, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+  52, 86, 120, 137, 171, 204, 238, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 169, 134, 85, 85, 86, 120, 153, 171,
+  188, 205, 221, 238, 220, 203, 187, 169, 152, 136, 102, 84, 67, 34, 16, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 35,
+  69, 103, 136, 154, 187, 205, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 237, 220, 203, 187, 170, 153, 152, 136, 136, 119,
+  102, 101, 85, 68, 68, 68, 51, 51, 34, 34, 34, 18, 17, 17, 17, 17, 17, 17, 17, 17,
+  34, 18, 33, 34, 34, 34, 50, 51, 51, 51, 52, 68, 68, 68, 84, 85, 85, 86, 102, 102,
+  102, 103, 119, 119, 119, 136, 136, 136, 136, 136, 137, 152, 153, 153, 153, 153, 153, 169, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 171, 171, 170, 186, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 154, 153, 153, 153, 153, 153, 153, 153, 152, 153, 153, 153, 137, 136, 137, 136,
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 119, 119, 118, 103, 103, 102, 118, 103, 103, 102,
+  118, 102, 118, 103, 103, 102, 118, 118, 103};
 
-const unsigned char fastinvader3[1054] = {
-  128, 128, 133, 133, 128, 133, 128, 116, 94, 71, 54, 31, 20, 15, 20, 31, 54, 71, 88, 111, 
-  128, 150, 161, 184, 201, 218, 224, 240, 240, 252, 255, 255, 255, 255, 255, 255, 252, 246, 246, 235, 
-  229, 218, 212, 201, 195, 184, 173, 161, 156, 144, 139, 128, 122, 111, 105, 94, 82, 77, 71, 65, 
-  54, 60, 65, 77, 82, 94, 94, 94, 88, 88, 71, 60, 48, 37, 20, 9, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 20, 31, 
-  43, 54, 60, 77, 94, 105, 116, 122, 133, 144, 156, 161, 178, 190, 195, 212, 218, 229, 240, 246, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 240, 235, 235, 
-  224, 212, 207, 201, 195, 184, 184, 173, 173, 161, 156, 150, 144, 133, 128, 128, 122, 122, 116, 105, 
-  105, 99, 94, 88, 88, 77, 77, 65, 65, 60, 60, 48, 43, 31, 31, 26, 26, 20, 26, 20, 
-  15, 20, 15, 15, 15, 9, 9, 15, 9, 9, 9, 9, 3, 3, 9, 9, 9, 3, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 37, 54, 77, 94, 111, 128, 133, 144, 
-  156, 161, 173, 173, 184, 190, 190, 184, 190, 184, 184, 184, 173, 173, 167, 167, 156, 156, 144, 133, 
-  128, 128, 122, 122, 111, 105, 94, 94, 88, 77, 71, 71, 77, 88, 99, 111, 122, 122, 128, 122, 
-  116, 111, 105, 94, 82, 71, 60, 48, 37, 31, 31, 20, 15, 9, 9, 3, 3, 3, 9, 3, 
-  15, 20, 20, 31, 37, 43, 54, 65, 77, 88, 99, 111, 122, 128, 144, 156, 161, 178, 190, 195, 
-  212, 224, 229, 240, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 246, 235, 229, 218, 212, 207, 201, 190, 190, 
-  178, 167, 161, 156, 144, 139, 128, 128, 122, 116, 111, 99, 94, 88, 82, 77, 71, 65, 60, 60, 
-  54, 48, 43, 43, 31, 31, 26, 26, 20, 15, 9, 9, 3, 0, 3, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 20, 37, 60, 77, 94, 105, 116, 128, 128, 133, 139, 144, 150, 150, 156, 
-  150, 150, 144, 144, 139, 133, 128, 128, 122, 116, 111, 105, 99, 94, 88, 82, 77, 71, 65, 60, 
-  48, 48, 43, 43, 43, 54, 65, 77, 94, 94, 99, 99, 94, 88, 77, 65, 54, 43, 31, 26, 
-  15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 9, 20, 26, 37, 48, 
-  60, 77, 82, 94, 111, 122, 128, 139, 150, 167, 178, 190, 201, 218, 229, 240, 246, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 252, 246, 240, 235, 229, 218, 212, 207, 201, 195, 184, 178, 173, 161, 156, 150, 144, 144, 
-  133, 128, 128, 116, 111, 105, 105, 99, 88, 82, 82, 77, 71, 65, 60, 54, 54, 48, 43, 43, 
-  37, 31, 31, 26, 26, 20, 20, 15, 20, 9, 9, 9, 9, 9, 3, 3, 3, 0, 0, 3, 
-  0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 9, 3, 9, 15, 9, 15, 20, 15, 20, 20, 
-  26, 31, 26, 31, 37, 43, 37, 43, 48, 54, 54, 48, 54, 60, 60, 65, 65, 71, 71, 77, 
-  77, 82, 88, 94, 88, 88, 94, 99, 105, 105, 111, 111, 116, 122, 122, 116, 128, 128, 128, 128, 
-  133, 128, 133, 139, 144, 144, 139, 144, 144, 150, 144, 150, 150, 156, 150, 156, 156, 161, 161, 167, 
-  167, 167, 167, 173, 167, 173, 173, 178, 178, 178, 173, 178, 173, 178, 184, 178, 184, 178, 184, 184, 
-  184, 190, 184, 184, 184, 184, 184, 190, 184, 190, 184, 190, 190, 184, 184, 190, 184, 190, 184, 178, 
-  178, 184, 178, 184, 184, 184, 178, 178, 173, 178, 173, 173, 178, 173, 167, 167, 173, 167, 173, 173, 
-  167, 173, 167, 161, 161, 167, 161, 167, 161, 156, 161, 156, 156, 156, 156, 150, 156, 150, 156, 150, 
-  144, 144, 150, 144, 144, 139, 144, 139, 133, 133, 139, 133, 133, 139, 133, 133, 128, 133, 128, 128, 
-  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 122, 122, 128, 122, 128, 122, 128, 122, 
-  116, 116, 122, 116, 122, 116, 111, 116, 116, 111, 111, 116, 111, 111, 116, 111, 105, 111, 111, 105, 
-  111, 105, 111, 105, 105, 105, 105, 99, 105, 99, 105, 99, 105, 99, 105, 111, 105, 111, 111, 105, 
-  105, 105, 99, 105, 105, 105, 99, 105, 105, 99, 105, 111, 105, 111, 105, 105, 111, 111, 105, 111, 
-  105, 111, 111, 111, 116, 116, 111, 116, 111, 116, 116, 111, 116, 111, 111, 116, 111, 116, 116, 116, 
-  116, 122, 116, 116, 122, 116, 122, 122, 116, 116, 122, 116, 122, 116, 111, 116, 111, 116, 116, 116, 
-  122, 122, 116, 122, 116, 122, 116, 122, 128, 122, 128, 128, 128, 122, 128, 128, 128, 128, 128, 128, 
-  128, 128, 128, 128, 128, 128, 133, 128, 133, 133, 128, 128, 133, 133, 128, 133, 139, 139, 133, 139, 
-  133, 139, 144, 139, 133, 139, 144, 139, 133, 139, 139, 139, 144, 139, 139, 144, 144, 139, 144, 144, 
-  139, 144, 144, 139, 139, 144, 139, 144, 144, 139, 139, 144, 139, 144, 139, 144, 139, 144, 139, 144, 
-  144, 139, 144, 139, 139, 139, 139, 139, 144, 139, 144, 144, 139, 144, 144, 139, 139, 144, 139, 144, 
-  144, 139, 144, 139, 139, 144, 144, 139, 144, 139, 144, 139, 139, 139};
+// 1802 samples, 4 bits each, first sample in the upper 4 bits
+const unsigned char highpitch[901] = {
+  250, 102, 32, 35, 105, 171, 174, 220, 151, 69, 16, 36, 121, 170, 191, 204, 134, 84, 1, 53,
+  137, 170, 222, 202, 116, 81, 18, 71, 154, 156, 236, 184, 86, 16, 35, 121, 170, 206, 203, 133,
+  97, 2, 71, 154, 173, 236, 167, 84, 1, 53, 122, 171, 253, 201, 86, 32, 36, 105, 170, 238,
+  202, 118, 48, 35, 104, 170, 222, 202, 118, 48, 35, 104, 170, 222, 202, 118, 48, 35, 105, 155,
+  238, 201, 102, 16, 36, 122, 157, 253, 184, 99, 1, 54, 137, 191, 220, 150, 80, 2, 87, 169,
+  238, 202, 117, 16, 37, 122, 158, 236, 167, 81, 2, 87, 154, 254, 201, 116, 1, 38, 137, 207,
+  220, 135, 32, 35, 105, 158, 253, 151, 64, 18, 88, 157, 253, 167, 81, 2, 88, 140, 253, 184,
+  97, 2, 88, 156, 253, 184, 81, 2, 104, 157, 253, 168, 48, 19, 104, 175, 236, 151, 32, 36,
+  120, 223, 218, 131, 1, 54, 139, 254, 200, 97, 2, 104, 174, 236, 151, 16, 37, 122, 239, 201,
+  97, 2, 103, 174, 236, 149, 0, 54, 124, 253, 169, 48, 20, 120, 223, 202, 113, 2, 87, 191,
+  235, 147, 2, 71, 158, 252, 165, 0, 54, 141, 252, 166, 16, 54, 141, 252, 167, 16, 54, 125,
+  252, 165, 1, 54, 142, 251, 163, 2, 70, 191, 235, 129, 3, 103, 223, 186, 64, 36, 107, 253,
+  183, 16, 70, 158, 235, 130, 3, 103, 239, 186, 32, 53, 142, 251, 146, 3, 88, 239, 185, 32,
+  69, 159, 220, 113, 4, 108, 252, 180, 3, 71, 223, 184, 32, 69, 191, 203, 48, 68, 142, 236,
+  97, 20, 125, 251, 130, 4, 108, 251, 146, 4, 92, 251, 162, 5, 92, 251, 146, 4, 109, 252,
+  113, 36, 142, 236, 64, 68, 191, 202, 32, 54, 223, 197, 3, 59, 252, 161, 4, 126, 235, 48,
+  69, 223, 196, 4, 76, 252, 96, 52, 207, 198, 19, 76, 252, 96, 68, 207, 181, 3, 108, 251,
+  48, 73, 222, 130, 20, 191, 197, 4, 108, 249, 49, 75, 252, 80, 71, 223, 130, 36, 207, 163,
+  4, 191, 180, 4, 174, 213, 20, 158, 213, 20, 141, 213, 20, 158, 196, 20, 174, 180, 20, 207,
+  147, 37, 206, 98, 57, 235, 65, 91, 247, 35, 141, 180, 21, 206, 98, 73, 248, 50, 125, 181,
+  22, 206, 81, 106, 245, 21, 175, 82, 89, 246, 37, 159, 82, 90, 245, 23, 189, 81, 140, 165,
+  41, 230, 53, 174, 81, 140, 149, 57, 229, 23, 201, 83, 174, 81, 156, 115, 107, 181, 58, 213,
+  25, 214, 40, 199, 55, 200, 55, 185, 70, 185, 70, 185, 71, 200, 56, 198, 41, 197, 43, 196,
+  75, 163, 123, 99, 172, 68, 201, 57, 181, 60, 163, 155, 83, 200, 43, 164, 108, 99, 201, 43,
+  163, 139, 69, 198, 61, 115, 215, 44, 130, 186, 57, 180, 92, 99, 200, 41, 180, 76, 114, 187,
+  53, 183, 42, 180, 76, 147, 140, 98, 172, 67, 187, 68, 186, 54, 200, 71, 184, 54, 185, 70,
+  186, 68, 187, 66, 189, 65, 157, 99, 123, 164, 58, 228, 25, 216, 68, 174, 65, 140, 164, 42,
+  230, 53, 175, 66, 123, 212, 24, 204, 81, 140, 180, 24, 219, 81, 124, 196, 22, 206, 65, 91,
+  246, 35, 159, 148, 39, 221, 81, 75, 248, 50, 125, 213, 20, 175, 163, 21, 223, 114, 38, 222,
+  82, 71, 221, 81, 72, 237, 81, 72, 237, 82, 71, 222, 98, 38, 223, 131, 20, 207, 163, 4,
+  174, 214, 19, 93, 249, 48, 74, 237, 98, 37, 223, 179, 4, 110, 250, 32, 72, 238, 146, 20,
+  174, 217, 33, 73, 237, 145, 4, 142, 234, 32, 70, 239, 180, 4, 76, 252, 129, 20, 142, 235,
+  32, 68, 223, 185, 16, 71, 239, 181, 3, 74, 237, 178, 4, 75, 252, 178, 4, 76, 252, 178,
+  4, 74, 237, 179, 3, 73, 254, 182, 17, 70, 239, 186, 0, 85, 191, 219, 64, 37, 126, 250,
+  144, 4, 89, 254, 167, 0, 70, 191, 219, 80, 20, 124, 253, 181, 1, 71, 207, 218, 80, 4,
+  123, 254, 167, 0, 70, 159, 235, 145, 4, 88, 223, 202, 80, 4, 121, 254, 169, 16, 52, 140,
+  253, 183, 0, 69, 141, 252, 166, 0, 70, 142, 252, 166, 0, 70, 141, 252, 167, 0, 69, 140,
+  253, 168, 16, 52, 137, 254, 185, 80, 20, 120, 223, 202, 128, 2, 72, 159, 235, 150, 0, 54,
+  138, 254, 185, 80, 4, 104, 191, 235, 133, 1, 70, 139, 254, 185, 96, 3, 104, 159, 235, 151,
+  0, 52, 136, 223, 218, 116, 1, 54, 138, 254, 185, 112, 2, 71, 156, 253, 184, 96, 3, 88,
+  157, 253, 183, 96, 19, 88, 157, 253, 183, 96, 3, 88, 155, 253, 184, 96, 2, 72, 154, 253,
+  201, 100, 1, 54, 137, 223, 218, 134, 0, 36, 138, 159, 236, 166, 96, 19, 88, 154, 253, 201,
+  101, 1, 53, 137, 175, 220, 150, 80, 19, 88, 169, 254, 202, 118, 16, 36, 121, 172, 253, 184,
+  100, 1, 54, 154, 175, 236, 150, 82, 2, 55, 154, 175, 220, 150, 80, 2, 71, 154, 175, 219,
+  150, 80, 2, 71, 154, 175, 220, 150, 82, 2, 71, 154, 174, 220, 167, 100, 2, 54, 138, 171,
+  252};
 
-const unsigned char fastinvader4[1098] = {
-  133, 133, 128, 133, 128, 128, 133, 133, 139, 133, 128, 133, 133, 133, 133, 133, 128, 133, 133, 128, 
-  133, 128, 133, 133, 133, 122, 99, 77, 54, 31, 20, 9, 15, 26, 43, 60, 88, 99, 128, 139, 
-  161, 184, 201, 218, 229, 240, 246, 255, 255, 255, 255, 255, 255, 255, 255, 252, 252, 240, 235, 224, 
-  218, 207, 201, 190, 184, 167, 156, 150, 133, 128, 122, 116, 105, 99, 82, 82, 71, 71, 60, 60, 
-  60, 71, 82, 94, 88, 94, 99, 88, 82, 65, 54, 43, 31, 15, 3, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15, 26, 37, 
-  54, 60, 77, 82, 99, 111, 122, 128, 139, 150, 167, 173, 190, 201, 212, 218, 229, 235, 246, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 235, 229, 224, 
-  224, 212, 201, 195, 184, 161, 133, 111, 82, 60, 43, 37, 31, 37, 43, 54, 65, 82, 94, 105, 
-  116, 122, 133, 139, 144, 150, 161, 161, 161, 167, 161, 156, 150, 150, 144, 139, 128, 128, 122, 116, 
-  105, 99, 82, 77, 65, 54, 43, 37, 26, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 
-  26, 43, 60, 77, 94, 111, 128, 139, 156, 173, 178, 195, 212, 224, 240, 252, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 252, 235, 207, 178, 150, 128, 111, 99, 99, 105, 111, 122, 128, 139, 150, 167, 178, 
-  190, 201, 201, 212, 218, 224, 224, 229, 224, 224, 224, 212, 212, 207, 201, 190, 184, 173, 161, 150, 
-  139, 128, 122, 105, 94, 88, 77, 65, 54, 43, 26, 26, 15, 0, 0, 0, 0, 0, 0, 0, 
-  0, 3, 9, 9, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
-  15, 26, 43, 60, 71, 82, 99, 116, 128, 139, 150, 161, 178, 190, 201, 212, 218, 229, 246, 252, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 246, 240, 235, 
-  224, 218, 212, 195, 173, 139, 122, 99, 77, 71, 65, 65, 71, 82, 94, 105, 116, 128, 139, 150, 
-  161, 173, 184, 190, 195, 195, 201, 195, 201, 195, 195, 190, 178, 173, 167, 161, 150, 139, 128, 128, 
-  116, 105, 99, 82, 71, 60, 48, 37, 26, 20, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 31, 43, 
-  60, 71, 94, 99, 116, 128, 139, 156, 173, 184, 195, 207, 224, 235, 246, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 
-  252, 240, 224, 207, 173, 144, 128, 105, 88, 82, 88, 82, 94, 111, 122, 128, 144, 156, 173, 178, 
-  190, 207, 207, 212, 218, 218, 224, 224, 212, 207, 201, 190, 184, 178, 167, 156, 150, 139, 128, 128, 
-  111, 99, 88, 77, 71, 54, 43, 37, 26, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  3, 9, 9, 15, 9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 26, 43, 60, 
-  71, 88, 99, 116, 128, 139, 156, 167, 178, 190, 207, 218, 229, 240, 252, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 246, 240, 229, 
-  224, 218, 212, 207, 195, 190, 184, 178, 173, 167, 156, 150, 144, 139, 133, 128, 128, 128, 122, 116, 
-  111, 105, 99, 94, 88, 82, 77, 77, 77, 71, 65, 65, 60, 60, 54, 48, 43, 43, 37, 37, 
-  43, 37, 31, 37, 31, 26, 31, 26, 31, 26, 26, 26, 26, 26, 31, 31, 31, 26, 31, 31, 
-  37, 37, 31, 37, 37, 31, 37, 43, 37, 43, 43, 43, 48, 43, 48, 54, 54, 60, 54, 60, 
-  60, 65, 71, 65, 71, 71, 77, 77, 82, 77, 82, 82, 88, 88, 94, 99, 105, 99, 105, 105, 
-  105, 111, 111, 116, 116, 116, 122, 122, 116, 122, 128, 128, 128, 133, 133, 128, 133, 133, 139, 133, 
-  139, 144, 144, 139, 144, 150, 150, 150, 156, 150, 156, 156, 156, 156, 161, 156, 161, 167, 167, 167, 
-  161, 167, 173, 173, 167, 173, 167, 173, 167, 173, 167, 173, 173, 173, 173, 178, 173, 178, 173, 173, 
-  178, 173, 173, 173, 167, 173, 173, 167, 173, 173, 173, 167, 173, 173, 173, 167, 167, 161, 167, 161, 
-  167, 161, 167, 161, 167, 161, 167, 161, 156, 161, 156, 156, 156, 150, 150, 156, 150, 156, 150, 144, 
-  144, 150, 144, 144, 144, 139, 144, 150, 150, 144, 144, 144, 139, 144, 139, 133, 139, 144, 139, 133, 
-  139, 139, 139, 133, 128, 128, 133, 128, 133, 128, 133, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-  122, 116, 116, 122, 116, 111, 111, 116, 111, 116, 111, 111, 116, 111, 111, 116, 111, 116, 111, 111, 
-  116, 111, 105, 111, 116, 111, 111, 116, 111, 116, 111, 111, 116, 111, 116, 111, 105, 116};
+// *************************** Mixer ***************************
+// Up to NVOICES clips play at once.  Each voice steps through
+// its own clip, and the voices are summed a block at a time
+// into one half of a ping-pong buffer while the Timer0A
+// interrupt plays the other half, one sample per interrupt.
+// The mixing is not done in the Timer0A interrupt: a 4 voice
+// block takes over a thousand cycles, and doing it there made
+// every 64th sample interrupt that long, delaying every other
+// interrupt at the same or lower priority.  Instead Timer0A
+// pends PendSV, which runs at the lowest priority and has the
+// 64 sample times (5.8 ms) it takes to play the other half to
+// finish.  Timer0A now does the same short job every time.
+// The clips are packed two 4-bit samples per byte (made by
+// Lab15Files/SoundConvert.c), which is all the 4-bit DAC can
+// play anyway and half the flash of 8-bit samples.  Each block
+// the mixer unpacks the next 64 samples of every voice, scales
+// them back up to 8 bits centered on 128, sums them, clips the
+// sum to 0 to 255 and shifts it down to the DAC, so a single
+// voice sounds exactly as it did with the 8-bit clips.
+#define NVOICES 4
+#define BLOCK   64                   // samples per block, 5.8 ms at 11.025 kHz
+struct Voice {
+  const unsigned char *Wave;         // clip being played
+  unsigned long Index;               // next sample in the clip, two per byte
+  unsigned long Count;               // samples left, 0 if the voice is free
+  unsigned long Priority;            // higher priority voices are not stolen
+};
+typedef struct Voice VTyp;
+volatile VTyp Voice[NVOICES];        // PendSV must see Sound_PlayPriority's stores in order
+unsigned char Buffer[2*BLOCK];       // ping-pong buffer of 4-bit DAC values
+unsigned long Out = 0;               // next sample of Buffer to play
+unsigned long MixHalf = 0;           // half of Buffer PendSV mixes next
+unsigned long IdleBlocks = 0;        // blocks in a row mixed with no voices
+unsigned long Steals = 0;            // voices cut off to make room
+unsigned long Drops = 0;             // clips not played, all voices busy and more important
 
-const unsigned char highpitch[1802] = {
-  255, 162, 102, 101, 46, 7, 47, 59, 111, 150, 160, 176, 163, 226, 220, 199, 157, 120, 74, 95, 
-  31, 13, 47, 64, 116, 155, 162, 171, 181, 246, 207, 194, 142, 102, 84, 70, 8, 31, 53, 92, 
-  138, 156, 174, 162, 223, 226, 201, 167, 124, 79, 95, 18, 18, 47, 71, 119, 154, 170, 159, 206, 
-  239, 203, 183, 136, 85, 101, 25, 9, 43, 62, 114, 155, 166, 164, 206, 239, 204, 183, 136, 87, 
-  97, 24, 10, 44, 71, 114, 153, 166, 163, 222, 233, 203, 172, 125, 89, 78, 9, 23, 48, 91, 
-  124, 163, 164, 183, 249, 212, 198, 147, 93, 96, 36, 6, 42, 64, 110, 152, 166, 168, 227, 228, 
-  203, 161, 113, 97, 58, 0, 37, 52, 104, 141, 167, 162, 221, 236, 204, 171, 116, 99, 57, 0, 
-  35, 53, 104, 139, 167, 162, 221, 236, 204, 171, 113, 101, 54, 0, 37, 54, 106, 149, 157, 176, 
-  238, 225, 202, 155, 106, 98, 22, 8, 42, 76, 117, 160, 152, 209, 248, 209, 185, 129, 107, 59, 
-  0, 31, 51, 104, 142, 156, 180, 244, 222, 201, 152, 109, 86, 10, 13, 45, 92, 123, 160, 159, 
-  234, 233, 204, 162, 119, 92, 19, 8, 43, 81, 125, 162, 155, 232, 236, 206, 166, 115, 92, 19, 
-  8, 43, 88, 127, 156, 170, 242, 227, 204, 149, 118, 71, 2, 19, 47, 102, 143, 148, 201, 252, 
-  213, 195, 128, 116, 38, 0, 36, 60, 107, 148, 149, 232, 245, 209, 153, 122, 66, 4, 22, 47, 
-  93, 139, 145, 216, 250, 212, 175, 123, 92, 16, 8, 43, 90, 131, 143, 203, 253, 215, 188, 130, 
-  102, 21, 5, 40, 86, 129, 144, 206, 253, 215, 183, 135, 85, 19, 7, 42, 97, 139, 145, 219, 
-  248, 210, 163, 143, 60, 2, 19, 54, 106, 140, 168, 243, 233, 206, 144, 126, 32, 0, 39, 77, 
-  126, 141, 210, 252, 213, 174, 143, 59, 2, 19, 59, 109, 134, 183, 250, 227, 196, 143, 99, 16, 
-  6, 44, 99, 135, 163, 236, 238, 203, 150, 116, 19, 3, 40, 91, 127, 161, 234, 241, 202, 153, 
-  110, 21, 3, 40, 96, 122, 172, 237, 238, 194, 150, 92, 9, 8, 50, 104, 126, 193, 255, 222, 
-  175, 154, 53, 0, 31, 64, 116, 140, 216, 252, 206, 164, 124, 24, 1, 47, 92, 112, 184, 252, 
-  230, 182, 151, 48, 0, 40, 64, 116, 155, 228, 247, 192, 163, 89, 9, 13, 52, 109, 132, 215, 
-  253, 202, 168, 107, 16, 5, 50, 105, 128, 211, 254, 199, 171, 113, 17, 4, 54, 108, 125, 216, 
-  253, 197, 171, 94, 13, 18, 55, 109, 142, 227, 249, 184, 169, 62, 0, 47, 70, 107, 182, 247, 
-  224, 185, 137, 28, 0, 49, 100, 125, 220, 252, 190, 172, 72, 0, 46, 68, 104, 189, 252, 213, 
-  182, 117, 21, 6, 64, 99, 157, 237, 239, 188, 140, 36, 0, 57, 98, 126, 233, 248, 185, 161, 
-  38, 0, 56, 90, 130, 229, 249, 189, 154, 33, 0, 60, 93, 139, 231, 246, 181, 148, 35, 0, 
-  67, 90, 159, 240, 223, 195, 114, 24, 11, 71, 97, 192, 255, 195, 190, 68, 0, 57, 72, 126, 
-  221, 252, 189, 138, 42, 0, 73, 87, 188, 255, 195, 191, 60, 0, 69, 69, 143, 235, 226, 199, 
-  107, 21, 30, 66, 112, 215, 255, 187, 135, 32, 1, 75, 99, 205, 255, 184, 159, 39, 0, 74, 
-  89, 204, 255, 189, 160, 38, 0, 83, 93, 206, 255, 188, 146, 36, 9, 72, 102, 217, 255, 195, 
-  113, 18, 39, 66, 134, 231, 227, 201, 66, 0, 72, 69, 181, 255, 194, 172, 44, 0, 61, 103, 
-  212, 240, 193, 87, 7, 58, 60, 176, 247, 193, 162, 31, 13, 69, 127, 224, 227, 188, 55, 0, 
-  72, 95, 209, 247, 197, 78, 4, 65, 71, 202, 253, 198, 99, 12, 61, 65, 193, 249, 199, 105, 
-  19, 60, 67, 195, 247, 200, 97, 14, 64, 77, 202, 252, 187, 80, 7, 63, 108, 206, 252, 176, 
-  60, 3, 68, 144, 219, 233, 143, 43, 30, 66, 187, 244, 195, 87, 10, 65, 109, 207, 246, 152, 
-  58, 16, 68, 180, 243, 199, 84, 12, 65, 122, 214, 240, 130, 43, 44, 76, 195, 246, 167, 63, 
-  13, 66, 178, 243, 189, 76, 12, 64, 164, 230, 209, 82, 18, 64, 147, 224, 217, 88, 17, 65, 
-  143, 222, 211, 86, 23, 64, 151, 231, 204, 79, 21, 68, 169, 236, 177, 69, 24, 74, 192, 246, 
-  146, 55, 37, 93, 206, 231, 103, 33, 59, 144, 228, 191, 74, 25, 83, 184, 251, 116, 38, 61, 
-  133, 221, 185, 79, 26, 93, 193, 238, 101, 33, 70, 155, 244, 134, 60, 45, 125, 222, 178, 84, 
-  23, 105, 192, 225, 93, 23, 96, 174, 249, 94, 28, 92, 164, 249, 95, 38, 81, 155, 250, 103, 
-  40, 88, 157, 244, 95, 35, 95, 162, 243, 89, 25, 114, 176, 219, 86, 19, 135, 207, 162, 87, 
-  38, 148, 236, 107, 59, 86, 160, 233, 87, 22, 136, 201, 157, 86, 50, 159, 233, 91, 30, 127, 
-  198, 159, 81, 55, 165, 230, 86, 23, 145, 206, 127, 63, 101, 176, 183, 80, 51, 169, 220, 81, 
-  31, 158, 216, 100, 38, 143, 199, 120, 54, 123, 197, 138, 61, 112, 185, 147, 64, 102, 190, 147, 
-  68, 106, 180, 145, 65, 113, 194, 130, 54, 132, 200, 105, 47, 158, 201, 91, 44, 181, 197, 75, 
-  66, 189, 165, 58, 121, 191, 103, 50, 171, 198, 75, 68, 194, 152, 53, 151, 188, 85, 53, 192, 
-  163, 52, 150, 183, 85, 59, 201, 141, 46, 176, 174, 68, 102, 198, 98, 50, 205, 146, 45, 188, 
-  162, 59, 141, 181, 79, 90, 199, 98, 59, 213, 116, 51, 210, 126, 46, 206, 138, 46, 187, 160, 
-  56, 150, 178, 78, 91, 198, 105, 50, 199, 140, 46, 153, 178, 68, 77, 198, 123, 37, 184, 176, 
-  62, 93, 190, 119, 46, 175, 189, 66, 75, 194, 147, 53, 135, 193, 98, 46, 171, 200, 76, 51, 
-  184, 189, 70, 79, 186, 165, 61, 102, 193, 142, 65, 115, 190, 140, 60, 109, 187, 149, 67, 99, 
-  189, 163, 72, 77, 181, 191, 78, 44, 177, 221, 78, 31, 157, 216, 106, 53, 124, 186, 167, 79, 
-  52, 173, 227, 73, 30, 150, 209, 135, 72, 71, 170, 231, 73, 29, 138, 200, 171, 77, 43, 161, 
-  233, 102, 63, 82, 163, 246, 75, 32, 116, 178, 223, 72, 21, 131, 197, 197, 82, 18, 139, 206, 
-  184, 78, 23, 134, 208, 188, 80, 21, 127, 201, 203, 77, 21, 109, 194, 236, 77, 31, 91, 177, 
-  253, 98, 46, 60, 150, 240, 147, 66, 37, 112, 212, 217, 80, 25, 78, 181, 244, 138, 51, 42, 
-  113, 209, 223, 82, 27, 70, 169, 247, 166, 56, 23, 83, 209, 246, 125, 46, 46, 102, 213, 233, 
-  93, 33, 66, 123, 220, 215, 81, 26, 70, 140, 225, 210, 81, 23, 70, 138, 226, 220, 89, 32, 
-  65, 119, 219, 232, 104, 38, 44, 98, 216, 248, 134, 50, 25, 77, 200, 246, 175, 56, 8, 73, 
-  161, 226, 216, 97, 31, 59, 88, 215, 244, 159, 53, 6, 74, 169, 229, 214, 109, 33, 45, 80, 
-  208, 248, 179, 60, 12, 72, 110, 226, 240, 160, 42, 7, 75, 143, 225, 229, 151, 33, 17, 68, 
-  160, 232, 219, 146, 32, 19, 75, 153, 234, 217, 159, 28, 10, 76, 141, 229, 227, 171, 43, 3, 
-  78, 104, 230, 245, 183, 68, 9, 67, 74, 205, 242, 194, 138, 19, 27, 71, 142, 235, 228, 182, 
-  46, 7, 76, 77, 216, 247, 189, 148, 21, 12, 79, 120, 233, 247, 186, 80, 15, 52, 69, 161, 
-  234, 222, 188, 46, 12, 73, 69, 180, 244, 201, 184, 38, 0, 78, 72, 192, 243, 206, 188, 40, 
-  5, 72, 73, 171, 236, 223, 185, 59, 9, 59, 76, 147, 241, 239, 179, 101, 18, 22, 79, 109, 
-  231, 252, 179, 164, 15, 0, 85, 86, 189, 242, 209, 183, 76, 8, 45, 80, 118, 235, 249, 174, 
-  153, 14, 2, 67, 83, 156, 240, 235, 173, 121, 14, 5, 77, 100, 186, 241, 215, 176, 93, 9, 
-  18, 74, 112, 195, 246, 208, 179, 83, 11, 24, 72, 112, 200, 246, 212, 174, 89, 12, 12, 75, 
-  115, 181, 244, 228, 173, 122, 9, 5, 69, 107, 148, 250, 238, 176, 156, 24, 0, 71, 80, 128, 
-  219, 251, 200, 174, 87, 3, 15, 73, 117, 158, 250, 233, 175, 153, 28, 0, 63, 79, 128, 199, 
-  250, 215, 176, 127, 11, 4, 65, 95, 128, 223, 251, 197, 169, 110, 6, 7, 70, 103, 133, 229, 
-  249, 193, 167, 107, 4, 8, 67, 102, 131, 222, 251, 203, 170, 117, 3, 6, 68, 94, 130, 198, 
-  249, 221, 168, 138, 19, 1, 55, 75, 133, 156, 249, 233, 178, 152, 81, 0, 18, 69, 112, 137, 
-  214, 252, 205, 169, 135, 14, 2, 46, 79, 129, 149, 249, 239, 184, 158, 104, 0, 10, 59, 97, 
-  138, 174, 253, 227, 179, 146, 89, 0, 15, 64, 105, 133, 183, 250, 227, 178, 140, 86, 0, 18, 
-  64, 102, 138, 178, 252, 227, 183, 146, 100, 0, 13, 60, 98, 138, 155, 250, 233, 187, 157, 116, 
-  11, 5, 51, 73, 135, 140, 212, 251, 213, 174, 125, 70, 0, 23, 62, 111, 141, 165, 253, 228, 
-  189, 150, 114, 15, 5, 43, 76, 124, 147, 193, 255, 219, 182, 130, 105, 0, 13, 52, 90, 140, 
-  145, 212, 250, 211, 177, 123, 100, 0, 19, 53, 92, 141, 151, 215, 249, 210, 177, 120, 103, 0, 
-  14, 56, 84, 140, 150, 188, 255, 215, 182, 139, 108, 10, 6, 43, 71, 136, 151, 162, 255, 221, 
-  195, 154, 111, 67, 0, 28, 62, 110, 142, 154, 213, 248, 210, 173, 128, 104, 11, 8, 42, 70, 
-  134, 160, 152, 253, 227, 204, 164, 107, 99, 0, 17, 51, 82, 141, 158, 164, 255, 219, 196, 150, 
-  107, 90, 0, 24, 59, 89, 139, 159, 164, 255, 219, 202, 149, 111, 91, 0, 22, 51, 83, 143, 
-  160, 157, 244, 228, 204, 169, 112, 101, 23, 6, 40, 67, 127, 154, 162, 195, 250, 210, 189, 132, 
-  99, 77, 0, 30, 60, 96, 148, 161, 164, 241, 225, 199, 159, 108, 88, 33, 6, 43, 60, 114, 
-  150, 162, 169, 255, 215, 193, 149, 106, 90, 11, 13, 45, 68, 125, 152, 166, 174, 254, 212, 191, 
-  147, 103, 91, 10, 13, 45, 68, 127, 158, 163, 174, 254, 212, 200, 154, 101, 90, 42, 5, 42, 
-  67, 119, 148, 166, 164, 238, 223, 202, 174, 112, 96, 78, 0, 34, 54, 99, 143, 160, 166, 183, 
-  250, 207};
+// Fill one block of the ping-pong buffer from all active voices
+// Output: number of voices that were active
+unsigned long Sound_Mix(unsigned char *block){
+  long sum[BLOCK];
+  unsigned long i, n, v, active = 0;
+  const unsigned char *pt;
+  for(i=0; i<BLOCK; i++){
+    sum[i] = 128;
+  }
+  for(v=0; v<NVOICES; v++){
+    n = Voice[v].Count;
+    if(n == 0){
+      continue;
+    }
+    active++;
+    if(n > BLOCK){
+      n = BLOCK;
+    }
+    pt = &Voice[v].Wave[Voice[v].Index/2]; // Index is even, blocks are even
+    for(i=0; i+1<n; i+=2){
+      sum[i] += (pt[0]&0xF0) - 128;   // first sample is the upper 4 bits
+      sum[i+1] += ((pt[0]&0x0F)<<4) - 128;
+      pt++;
+    }
+    if(n&1){                         // odd length clip, last sample
+      sum[i] += (pt[0]&0xF0) - 128;
+    }
+    Voice[v].Index += n;
+    Voice[v].Count -= n;
+  }
+  for(i=0; i<BLOCK; i++){
+    if(sum[i] < 0){
+      sum[i] = 0;                    // saturate
+    } else if(sum[i] > 255){
+      sum[i] = 255;
+    }
+    block[i] = sum[i]>>4;
+  }
+  return active;
+}
 
-unsigned long Index = 0;
-const unsigned char *Wave;
-unsigned long Count = 0;
-void Play(void){
-  if(Count){
-    DAC_Out(Wave[Index]>>4);
-    Index = Index + 1;
-    Count = Count - 1;
-  }else{
-  NVIC_DIS0_R = 1<<19;           // disable IRQ 19 in NVIC
+// Timer0A interrupt, 11.025 kHz
+// Plays one sample; after the last sample of a half, has PendSV
+// mix the next block into that half while the other half plays.
+// Play() rather than PendSV decides to stop, so it stops at the
+// same sample however late PendSV runs.
+void Play(void){ unsigned long v;
+  DAC_Out(Buffer[Out]);
+  Out = (Out+1)&(2*BLOCK-1);
+  if((Out&(BLOCK-1)) == 0){          // just finished a half
+    MixHalf = Out^BLOCK;
+    NVIC_INT_CTRL_R = NVIC_INT_CTRL_PEND_SV;
+    for(v=0; (v<NVOICES) && (Voice[v].Count == 0); v++){}
+    if(IdleBlocks && (v == NVOICES)){ // both halves will be silent
+      NVIC_DIS0_R = 1<<19;           // disable IRQ 19 in NVIC
+    }
   }
 }
-void Sound_Init(void){
+// PendSV, lowest priority, runs once per block after Play()
+// pends it; Timer0A keeps interrupting it to play samples.
+void PendSV_Handler(void){
+  if(Sound_Mix(&Buffer[MixHalf])){
+    IdleBlocks = 0;
+  } else{
+    IdleBlocks++;
+  }
+}
+void Sound_Init(void){ unsigned long i;
   DAC_Init(8);               // initialize simple 4-bit DAC
 //  Timer0B_Init(&Play, 20000); // 4 kHz
   Timer0_Init(&Play, 80000000/11025);     // 11.025 kHz
-  Index = 0;
-  Count = 0;
+  for(i=0; i<NVOICES; i++){
+    Voice[i].Count = 0;
+  }
+  for(i=0; i<2*BLOCK; i++){
+    Buffer[i] = 8;                   // silence, middle of the DAC range
+  }
+  Out = 0;
+  MixHalf = 0;
+  IdleBlocks = 0;
+  NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0xFF00FFFF)|0x00E00000; // PendSV priority 7
 //   while(1){
 //     DAC_Out(2048);
 //   }
 }
-void Sound_Play(const unsigned char *pt, unsigned long count){
-  Wave = pt;
-  Index = 0;
-  Count = count;
+// Start a clip on a free voice.  If all voices are busy, the
+// voice with the lowest priority (and then the least left to
+// play) is stolen, as long as it is not more important than
+// the new clip.  The clip starts with the next block.
+void Sound_PlayPriority(const unsigned char *pt, unsigned long count, unsigned long priority){
+  unsigned long i, v = NVOICES;
+  for(i=0; i<NVOICES; i++){
+    if(Voice[i].Count == 0){
+      v = i;                         // free voice
+      break;
+    }
+    if((Voice[i].Priority <= priority) &&
+       ((v == NVOICES) || (Voice[i].Priority < Voice[v].Priority) ||
+        ((Voice[i].Priority == Voice[v].Priority) && (Voice[i].Count < Voice[v].Count)))){
+      v = i;                         // best voice to steal so far
+    }
+  }
+  if(v == NVOICES){
+    Drops++;
+    return;
+  }
+  if(Voice[v].Count){
+    Steals++;
+  }
+  Voice[v].Count = 0;                // the mixer skips it while it changes
+  Voice[v].Wave = pt;
+  Voice[v].Index = 0;
+  Voice[v].Priority = priority;
+  Voice[v].Count = count;            // now it plays
+  IdleBlocks = 0;
   NVIC_EN0_R = 1<<19;           // 9) enable IRQ 19 in NVIC
   TIMER0_CTL_R = 0x00000001;    // 10) enable TIMER0A
 }
+void Sound_Play(const unsigned char *pt, unsigned long count){
+  Sound_PlayPriority(pt, count, 1);
+}
 void Sound_Shoot(void){
-  Sound_Play(shoot,4080);
+  Sound_PlayPriority(shoot,4080,2);
 }
 void Sound_Killed(void){
-  Sound_Play(invaderkilled,3377);
+  Sound_PlayPriority(invaderkilled,3377,2);
 }
 void Sound_Explosion(void){
-  Sound_Play(explosion,2000);
+  Sound_PlayPriority(explosion,2000,3);
 }
 void Sound_Fastinvader1(void){
-  Sound_Play(fastinvader1,982);
+  Sound_PlayPriority(fastinvader1,982,1);
 }
 void Sound_Fastinvader2(void){
-  Sound_Play(fastinvader2,1042);
+  Sound_PlayPriority(fastinvader2,1042,1);
 }
 void Sound_Fastinvader3(void){
-  Sound_Play(fastinvader3,1054);
+  Sound_PlayPriority(fastinvader3,1054,1);
 }
 void Sound_Fastinvader4(void){
-  Sound_Play(fastinvader4,1098);
+  Sound_PlayPriority(fastinvader4,1098,1);
 }
 void Sound_Highpitch(void){
-  Sound_Play(highpitch,1802);
+  Sound_PlayPriority(highpitch,1802,2);
 }
@@ -7,7 +7,12 @@
 
 
 void Sound_Init(void);
+// Clips are packed 4-bit samples, two per byte (see
+// Lab15Files/SoundConvert.c); count is the number of samples
 void Sound_Play(const unsigned char *pt, unsigned long count);
+// Start a clip at a priority; higher priority clips are not
+// cut off to make room for lower priority ones
+void Sound_PlayPriority(const unsigned char *pt, unsigned long count, unsigned long priority);
 void Sound_Shoot(void);
 void Sound_Killed(void);
 void Sound_Explosion(void);
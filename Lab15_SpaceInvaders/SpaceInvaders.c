@@ -68,17 +68,48 @@
 // SSI0Clk       (SCLK, pin 7) connected to PA2
 // back light    (LED, pin 8) not connected, consists of 4 white LEDs which draw ~80mA total
 
+#include <stdint.h>
 #include "..//tm4c123gh6pm.h"
+#include "utils/cpu_usage.h"
 #include "Nokia5110.h"
-#include "Random.h"
+#include "random.h"
 #include "TExaS.h"
+#include "Filter.h"
+#ifdef CPU_USAGE_PROFILE
+// Profile build: utils/cpu_usage.c times Timer2A, SSI0 and, with
+// Sound.c, Timer0A, and every PROFILEFRAMES frames the main loop
+// prints the table on UART0 with uartstdio, so the TExaS scope
+// (which also needs UART0) is off.
+#include "utils/uartstdio.h"
+#define DISPLAY       SSI0_Real_Nokia5110_NoScope
+#else
+#define DISPLAY       SSI0_Real_Nokia5110_Scope
+#endif
 
 void DisableInterrupts(void); // Disable interrupts
 void EnableInterrupts(void);  // Enable interrupts
 void Timer2_Init(unsigned long period);
 void Delay100ms(unsigned long count); // time delay in 0.1 seconds
-unsigned long TimerCount;
-unsigned long Semaphore;
+void Frame_Wait(void);
+unsigned long Frame_Now(void);
+volatile unsigned long TimerCount;  // written by Timer2A_Handler
+volatile unsigned long Semaphore;
+
+// *************************** Frame pacing ***************************
+// Timer2A posts a tick every FRAMEPERIOD bus cycles.  Each frame
+// the game waits for the tick, draws the next image in Screen[]
+// (the back buffer) and starts it out to the LCD with
+// Nokia5110_DisplayBufferAsync(), which sends a copy (the front
+// buffer) while the following frame is drawn.
+#define FRAMERATE   30                    // frames per second
+#define FRAMEPERIOD (80000000/FRAMERATE)  // bus cycles per frame at 80 MHz
+unsigned long FrameCount;   // frames drawn
+unsigned long FrameTime;    // bus cycles spent drawing the last frame
+unsigned long FrameTimeMax; // longest FrameTime seen
+unsigned long IdleTime;     // bus cycles spent waiting for the last tick
+unsigned long LateFrames;   // frames that were still drawing when their tick came
+unsigned long LostTicks;    // ticks skipped because a frame ran long
+unsigned long LastTick;     // TimerCount at the start of the last frame
 
 
 // *************************** Images ***************************
@@ -304,6 +335,70 @@ const unsigned char Laser1[] = {
  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF};
 
+// *************************** Sprites ***************************
+// The images drawn every frame, pre-decoded by
+// Lab15Files/SpriteConvert.c -m from the BMP arrays above so
+// Nokia5110_PrintSprite() can shift whole bytes into Screen[]
+// instead of Nokia5110_PrintBMP() decoding them pixel by pixel.
+// The mask covers the whole image, so drawing one erases what
+// was under it the same way PrintBMP does.
+
+// SmallEnemy30PointA, width=16 x height=10
+const unsigned char SmallEnemy30PointASprite[] = {
+ 16, 10, 2, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xB0, 0x78, 0x2C, 0x7E, 0x7E, 0x2C, 0x78, 0xB0, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03};
+
+// SmallEnemy20PointA, width=16 x height=10
+const unsigned char SmallEnemy20PointASprite[] = {
+ 16, 10, 2, 0x01,
+ 0x00, 0x00, 0x38, 0xBC, 0xFC, 0x6C, 0x6E, 0xBE, 0xBE, 0x6E, 0x6C, 0xFC, 0xBC, 0x38, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03};
+
+// SmallEnemy10PointA, width=16 x height=10
+const unsigned char SmallEnemy10PointASprite[] = {
+ 16, 10, 2, 0x01,
+ 0x00, 0x00, 0xE0, 0x70, 0xFA, 0x6C, 0x78, 0x78, 0x78, 0x78, 0x6C, 0xFA, 0x70, 0xE0, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03};
+
+// SmallEnemy10PointB, width=16 x height=10
+const unsigned char SmallEnemy10PointBSprite[] = {
+ 16, 10, 2, 0x01,
+ 0x00, 0x00, 0x3C, 0x70, 0xFA, 0x6C, 0x78, 0x78, 0x78, 0x78, 0x6C, 0xFA, 0x70, 0x3C, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03};
+
+// PlayerShip0, width=18 x height=8
+const unsigned char PlayerShip0Sprite[] = {
+ 18, 8, 1, 0x01,
+ 0x00, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFE, 0xFE, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+ 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+ 0xFF, 0xFF, 0xFF, 0xFF};
+
+// Bunker0, width=18 x height=5
+const unsigned char Bunker0Sprite[] = {
+ 18, 5, 1, 0x01,
+ 0x1C, 0x1E, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x1F, 0x1F,
+ 0x1E, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+ 0x1F, 0x1F, 0x1F, 0x1F};
+
+// Missile0, width=4 x height=9
+const unsigned char Missile0Sprite[] = {
+ 4, 9, 2, 0x01,
+ 0x44, 0xAA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01};
+
+// Laser0, width=2 x height=9
+const unsigned char Laser0Sprite[] = {
+ 2, 9, 2, 0x01,
+ 0xFE, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x01};
+
 // *************************** Capture image dimensions out of BMP**********
 #define BUNKERW     ((unsigned char)Bunker0[18])
 #define BUNKERH     ((unsigned char)Bunker0[22])
@@ -311,52 +406,232 @@ const unsigned char Laser1[] = {
 #define ENEMY30H    ((unsigned char)SmallEnemy30PointA[22])
 #define ENEMY20W    ((unsigned char)SmallEnemy20PointA[18])
 #define ENEMY20H    ((unsigned char)SmallEnemy20PointA[22])
-#define ENEMY10W    ((unsigned char)SmallEnemy10PointA[18])
-#define ENEMY10H    ((unsigned char)SmallEnemy10PointA[22])
+#define ENEMY10W    (SmallEnemy10PointASprite[0])
+#define ENEMY10H    (SmallEnemy10PointASprite[1])
 #define ENEMYBONUSW ((unsigned char)SmallEnemyBonus0[18])
 #define ENEMYBONUSH ((unsigned char)SmallEnemyBonus0[22])
-#define LASERW      ((unsigned char)Laser0[18])
-#define LASERH      ((unsigned char)Laser0[22])
-#define MISSILEW    ((unsigned char)Missile0[18])
-#define MISSILEH    ((unsigned char)Missile0[22])
-#define PLAYERW     ((unsigned char)PlayerShip0[18])
-#define PLAYERH     ((unsigned char)PlayerShip0[22])
+#define LASERW      (Laser0Sprite[0])
+#define LASERH      (Laser0Sprite[1])
+#define MISSILEW    (Missile0Sprite[0])
+#define MISSILEH    (Missile0Sprite[1])
+#define PLAYERW     (PlayerShip0Sprite[0])
+#define PLAYERH     (PlayerShip0Sprite[1])
+
+
+// *************************** Game ***************************
+// Game_Init() and Game_Frame() hold all of the game logic and
+// drawing.  They only use Screen[] (through the Nokia5110
+// functions), Random(), and the inputs they are handed, so the
+// board and the headless build (Headless/Headless.c) produce
+// the same frames from the same inputs.
+unsigned long GameFrame;    // frames since Game_Init
+long EnemyX, EnemyDx;       // left edge of the row of enemies, pixels per frame
+long PlayerX;               // left edge of the player's ship
+long LaserX, LaserY;        // bottom left of the laser, LaserY=0 if none
+long MissileX, MissileY;    // bottom left of the missile, MissileY=0 if none
+unsigned long LastButtons;  // buttons in the previous frame
+
+void Game_Init(void){
+  GameFrame = 0;
+  EnemyX = 0;
+  EnemyDx = 1;
+  PlayerX = 32;
+  LaserY = 0;
+  MissileY = 0;
+  LastButtons = 0;
+}
+
+// Run one frame of the game and draw it in the screen buffer
+// inputs: pot      12-bit slide pot position, 0 to 4095
+//         buttons  bit 0 is fire (PE0), bit 1 is special weapon (PE1)
+// outputs: none
+void Game_Frame(unsigned long pot, unsigned long buttons){ long i;
+  PlayerX = (pot*(SCREENW - PLAYERW))/4096;
+  if((buttons&~LastButtons&0x01) && (LaserY == 0)){ // fire pressed
+    LaserX = PlayerX + PLAYERW/2 - 1;
+    LaserY = 47 - PLAYERH;
+  }
+  LastButtons = buttons;
+  if(LaserY){
+    LaserY = LaserY - 2;
+    if(LaserY < LASERH){
+      LaserY = 0;             // off the top
+    }
+  }
+  if(MissileY){
+    MissileY = MissileY + 1;
+    if(MissileY > 47){
+      MissileY = 0;           // off the bottom
+    }
+  } else if(Random() < 16){   // an enemy drops a missile
+    MissileX = EnemyX + 16*(Random()%5) + 6;
+    MissileY = ENEMY10H - 1 + MISSILEH;
+  }
+  EnemyX = EnemyX + EnemyDx;  // march the row of enemies back and forth
+  if((EnemyX <= 0) || (EnemyX >= (SCREENW - 5*ENEMY10W))){
+    EnemyDx = -EnemyDx;
+  }
+  Nokia5110_ClearBuffer();
+  for(i=0; i<5; i=i+1){
+    Nokia5110_PrintSprite(EnemyX + 16*i, ENEMY10H - 1,
+      (GameFrame&0x10) ? SmallEnemy10PointBSprite : SmallEnemy10PointASprite);
+  }
+  Nokia5110_PrintSprite(33, 47 - PLAYERH, Bunker0Sprite);
+  Nokia5110_PrintSprite(PlayerX, 47, PlayerShip0Sprite);
+  if(LaserY){
+    Nokia5110_PrintSprite(LaserX, LaserY, Laser0Sprite);
+  }
+  if(MissileY){
+    Nokia5110_PrintSprite(MissileX, MissileY, Missile0Sprite);
+  }
+  GameFrame++;
+}
 
+#ifndef HEADLESS
+// Slide pot on PE2/AIN1 is sampled by ADC0 sequencer 3,
+// fire buttons are PE0 and PE1
+void Input_Init(void){ unsigned long volatile delay;
+  SYSCTL_RCGCGPIO_R |= 0x10;    // 1) activate clock for Port E
+  SYSCTL_RCGCADC_R |= 0x01;     // 2) activate ADC0
+  delay = SYSCTL_RCGCGPIO_R;    //    allow time for clock to stabilize
+  GPIO_PORTE_DIR_R &= ~0x07;    // 3) make PE2-0 input
+  GPIO_PORTE_AFSEL_R |= 0x04;   // 4) enable alternate function on PE2
+  GPIO_PORTE_DEN_R = (GPIO_PORTE_DEN_R&~0x04)|0x03; // 5) digital PE1-0, analog PE2
+  GPIO_PORTE_AMSEL_R |= 0x04;   // 6) enable analog functionality on PE2
+  delay = SYSCTL_RCGCADC_R;
+  ADC0_PC_R = 0x01;             // 7) configure for 125K
+  ADC0_SSPRI_R = 0x0123;        // 8) Sequencer 3 is highest priority
+  ADC0_ACTSS_R &= ~0x0008;      // 9) disable sample sequencer 3
+  ADC0_EMUX_R &= ~0xF000;       // 10) seq3 is software trigger
+  ADC0_SSMUX3_R = 1;            // 11) channel Ain1 (PE2)
+  ADC0_SSCTL3_R = 0x0006;       // 12) no TS0 D0, yes IE0 END0
+  ADC0_IM_R &= ~0x0008;         // 13) disable SS3 interrupts
+  ADC0_ACTSS_R |= 0x0008;       // 14) enable sample sequencer 3
+}
+
+// Slide pot readings are filtered once per frame, a 3 tap
+// median for glitches then a light IIR for jitter, so the ship
+// holds still without lagging far behind the pot
+MedTyp PotMedian;
+IIRTyp PotIIR;
+
+// Busy-wait analog to digital conversion of the slide pot
+// Output: 12-bit result of ADC conversion
+unsigned long Input_Pot(void){ unsigned long result;
+  ADC0_PSSI_R = 0x0008;             // 1) initiate SS3
+  while((ADC0_RIS_R&0x08)==0){};    // 2) wait for conversion done
+  result = ADC0_SSFIFO3_R&0xFFF;    // 3) read result
+  ADC0_ISC_R = 0x0008;              // 4) acknowledge completion
+  return result;
+}
+
+#ifdef CPU_USAGE_PROFILE
+// Report every 10 seconds.  Sending it takes about 0.1 s at
+// 115,200 baud, so each report makes a few frames late.
+#define PROFILEFRAMES (10*FRAMERATE)
+
+// uartstdio on UART0 (PA1-0) and the DWT cycle counter
+void Profile_Init(void){ unsigned long volatile delay;
+  SYSCTL_RCGC2_R |= 0x01;               // activate port A
+  delay = SYSCTL_RCGC2_R;
+  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1-0
+  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1-0
+                                        // configure PA1-0 as UART
+  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
+  GPIO_PORTA_AMSEL_R &= ~0x03;          // disable analog functionality on PA
+  UARTStdioConfig(0, 115200, 80000000); // also turns on UART0
+  CPUUsageProfileInit(80000000);
+}
+#endif
 
 int main(void){
-  TExaS_Init(SSI0_Real_Nokia5110_Scope);  // set system clock to 80 MHz
+  TExaS_Init(DISPLAY);         // set system clock to 80 MHz
+#ifdef CPU_USAGE_PROFILE
+  Profile_Init();
+#endif
   Random_Init(1);
   Nokia5110_Init();
+  Input_Init();
+  Median_Init(&PotMedian, 3);
+  IIR_Init(&PotIIR, 1);
   Nokia5110_ClearBuffer();
 	Nokia5110_DisplayBuffer();      // draw buffer
 
-  Nokia5110_PrintBMP(32, 47, PlayerShip0, 0); // player ship middle bottom
-  Nokia5110_PrintBMP(33, 47 - PLAYERH, Bunker0, 0);
+  Nokia5110_PrintSprite(32, 47, PlayerShip0Sprite); // player ship middle bottom
+  Nokia5110_PrintSprite(33, 47 - PLAYERH, Bunker0Sprite);
 
-  Nokia5110_PrintBMP(0, ENEMY10H - 1, SmallEnemy10PointA, 0);
-  Nokia5110_PrintBMP(16, ENEMY10H - 1, SmallEnemy20PointA, 0);
-  Nokia5110_PrintBMP(32, ENEMY10H - 1, SmallEnemy20PointA, 0);
-  Nokia5110_PrintBMP(48, ENEMY10H - 1, SmallEnemy30PointA, 0);
-  Nokia5110_PrintBMP(64, ENEMY10H - 1, SmallEnemy30PointA, 0);
+  Nokia5110_PrintSprite(0, ENEMY10H - 1, SmallEnemy10PointASprite);
+  Nokia5110_PrintSprite(16, ENEMY10H - 1, SmallEnemy20PointASprite);
+  Nokia5110_PrintSprite(32, ENEMY10H - 1, SmallEnemy20PointASprite);
+  Nokia5110_PrintSprite(48, ENEMY10H - 1, SmallEnemy30PointASprite);
+  Nokia5110_PrintSprite(64, ENEMY10H - 1, SmallEnemy30PointASprite);
   Nokia5110_DisplayBuffer();     // draw buffer
 
   Delay100ms(50);              // delay 5 sec at 50 MHz
 
-
-  Nokia5110_Clear();
-  Nokia5110_SetCursor(1, 1);
-  Nokia5110_OutString("GAME OVER");
-  Nokia5110_SetCursor(1, 2);
-  Nokia5110_OutString("Nice try,");
-  Nokia5110_SetCursor(1, 3);
-  Nokia5110_OutString("Earthling!");
-  Nokia5110_SetCursor(2, 4);
-  Nokia5110_OutUDec(1234);
+  Game_Init();
+  Timer2_Init(FRAMEPERIOD);    // 30 Hz frame tick
+  EnableInterrupts();
   while(1){
+    unsigned long start;
+    Frame_Wait();              // wait for the next frame tick
+    start = Frame_Now();
+    Game_Frame(IIR_In(&PotIIR, Median_In(&PotMedian, Input_Pot())), GPIO_PORTE_DATA_R&0x03);
+    Nokia5110_DisplayBufferAsync(0); // send it while the next frame is drawn
+    FrameTime = Frame_Now() - start; // right across any number of reloads
+    if(FrameTime > FrameTimeMax){
+      FrameTimeMax = FrameTime;
+    }
+#ifdef CPU_USAGE_PROFILE
+    if((FrameCount%PROFILEFRAMES) == 0){
+      UARTprintf("\n%u frames, %u late, longest %u cycles\n", FrameCount, LateFrames, FrameTimeMax);
+      CPUUsageProfileReport(UARTprintf);
+    }
+#endif
   }
+}
 
+// Wait for the next Timer2A frame tick and update the frame
+// statistics.  If the tick has already been posted the frame
+// ran long: it is counted as late, and any ticks that came
+// and went while it was drawing are counted as lost.
+void Frame_Wait(void){ unsigned long ticks, start;
+  if(Semaphore){
+    LateFrames++;
+    IdleTime = 0;
+  } else{
+    start = Frame_Now();
+    while(Semaphore == 0){};
+    IdleTime = Frame_Now() - start;
+  }
+  Semaphore = 0;
+  ticks = TimerCount - LastTick;
+  LastTick = TimerCount;
+  if((ticks > 1) && (FrameCount > 0)){
+    LostTicks = LostTicks + ticks - 1;
+  }
+  FrameCount++;
 }
 
+// Bus cycles since Timer2_Init(), from the ticks counted so far
+// and the down-counter.  It wraps every 53 seconds, so unsigned
+// differences of two readings are right for any shorter span.
+// The tick count is read again in case a tick lands between
+// the two reads.  If the timer has reloaded but Timer2A_Handler
+// has not run yet (interrupts disabled, or called from a higher
+// priority ISR), the timeout flag is still set and that tick is
+// added here, so the time never steps back a frame.
+unsigned long Frame_Now(void){ unsigned long ticks, left, timeout;
+  do{
+    ticks = TimerCount;
+    left = TIMER2_TAV_R;       // counts down from FRAMEPERIOD-1
+    timeout = TIMER2_RIS_R&TIMER_RIS_TATORIS;
+  } while(ticks != TimerCount);
+  if(timeout && (left >= FRAMEPERIOD/2)){ // reloaded before left was read, not just after
+    ticks++;
+  }
+  return ticks*FRAMEPERIOD + (FRAMEPERIOD - 1 - left);
+}
 
 // You can use this timer only if you learn how it works
 void Timer2_Init(unsigned long period){ 
@@ -379,9 +654,12 @@ void Timer2_Init(unsigned long period){
   TIMER2_CTL_R = 0x00000001;    // 10) enable timer2A
 }
 void Timer2A_Handler(void){ 
+  CPU_USAGE_ISR_ENTER();       // profiled if built with CPU_USAGE_PROFILE
+  CPU_USAGE_ISR_LATENCY(TIMER2_TAILR_R - TIMER2_TAV_R); // cycles since the timeout
   TIMER2_ICR_R = 0x00000001;   // acknowledge timer2A timeout
   TimerCount++;
   Semaphore = 1; // trigger
+  CPU_USAGE_ISR_EXIT();
 }
 void Delay100ms(unsigned long count){unsigned long volatile time;
   while(count>0){
@@ -392,3 +670,4 @@ void Delay100ms(unsigned long count){unsigned long volatile time;
     count--;
   }
 }
+#endif
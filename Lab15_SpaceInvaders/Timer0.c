@@ -0,0 +1,49 @@
+// Timer0.c
+// Runs on LM4F120/TM4C123
+// Use Timer0 in 32-bit periodic mode to request interrupts at a periodic rate
+// Daniel Valvano
+// March 20, 2014
+// Sound.c plays one sample per Timer0A interrupt.  The handler
+// is profiled by utils/cpu_usage.c when built with
+// CPU_USAGE_PROFILE defined.
+
+#include <stdint.h>
+#include "..//tm4c123gh6pm.h"
+#include "utils/cpu_usage.h"
+#include "Timer0.h"
+
+long StartCritical (void);    // previous I bit, disable interrupts
+void EndCritical(long sr);    // restore I bit to previous value
+void (*PeriodicTask)(void);   // user function
+
+// ***************** Timer0_Init ****************
+// Activate Timer0 interrupts to run user task periodically
+// Inputs:  task is a pointer to a user function
+//          period in units (1/clockfreq), 32 bits
+// Outputs: none
+void Timer0_Init(void(*task)(void), unsigned long period){long sr;
+  sr = StartCritical();
+  SYSCTL_RCGCTIMER_R |= 0x01;   // 0) activate TIMER0
+  PeriodicTask = task;          // user function
+  TIMER0_CTL_R = 0x00000000;    // 1) disable TIMER0A during setup
+  TIMER0_CFG_R = 0x00000000;    // 2) configure for 32-bit mode
+  TIMER0_TAMR_R = 0x00000002;   // 3) configure for periodic mode, default down-count settings
+  TIMER0_TAILR_R = period-1;    // 4) reload value
+  TIMER0_TAPR_R = 0;            // 5) bus clock resolution
+  TIMER0_ICR_R = 0x00000001;    // 6) clear TIMER0A timeout flag
+  TIMER0_IMR_R = 0x00000001;    // 7) arm timeout interrupt
+  NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x80000000; // 8) priority 4
+// interrupts enabled in the main program after all devices initialized
+// vector number 35, interrupt number 19
+  NVIC_EN0_R = 1<<19;           // 9) enable IRQ 19 in NVIC
+  TIMER0_CTL_R = 0x00000001;    // 10) enable TIMER0A
+  EndCritical(sr);
+}
+
+void Timer0A_Handler(void){
+  CPU_USAGE_ISR_ENTER();        // profiled if built with CPU_USAGE_PROFILE
+  CPU_USAGE_ISR_LATENCY(TIMER0_TAILR_R - TIMER0_TAV_R); // cycles since the timeout
+  TIMER0_ICR_R = 0x00000001;    // acknowledge timer0A timeout
+  (*PeriodicTask)();            // execute user task
+  CPU_USAGE_ISR_EXIT();
+}
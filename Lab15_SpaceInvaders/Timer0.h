@@ -0,0 +1,12 @@
+// Timer0.h
+// Runs on LM4F120/TM4C123
+// Use Timer0 in 32-bit periodic mode to request interrupts at a periodic rate
+// Daniel Valvano
+// March 20, 2014
+
+// ***************** Timer0_Init ****************
+// Activate Timer0 interrupts to run user task periodically
+// Inputs:  task is a pointer to a user function
+//          period in units (1/clockfreq), 32 bits
+// Outputs: none
+void Timer0_Init(void(*task)(void), unsigned long period);
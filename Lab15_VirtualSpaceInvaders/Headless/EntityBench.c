@@ -0,0 +1,178 @@
+// EntityBench.c
+// Runs on a PC, not on the LaunchPad
+// Steps the structure-of-arrays entity pool in SpaceInvaders.c,
+// built with HEADLESS defined, for many frames with 100+ live
+// entities of every sprite moving in every direction.  Entities
+// that leave the screen are freed and new ones are allocated to
+// keep the count up, so the free list is exercised every frame.
+//  - each frame, Entity_UpdateDraw() must draw the same Screen[]
+//    and leave the same entities alive as a reference that keeps
+//    the old array of structs with separate Move() and Draw()
+//    passes
+//  - time per frame and per entity, in CPU cycles on x86
+//    (rdtsc) and in ns, for the pool and the reference
+// The frames are drawn into the Screen[] of Lab15_SpaceInvaders'
+// Nokia5110.c, whose HEADLESS build needs no hardware.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I../.. -o EntityBench EntityBench.c ../SpaceInvaders.c ../../Lab15_SpaceInvaders/Nokia5110.c ../../Format.c
+// usage: EntityBench [-n frames] [-e entities]
+//   -n frames    frames to step (default 10000)
+//   -e entities  live entities to keep (default 120)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../Nokia5110.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+
+extern char Screen[];       // screen buffer in Nokia5110.c
+extern const unsigned char * const Sprite[][2];
+extern unsigned long Alive[];
+extern unsigned long FreeCount;
+extern unsigned long FrameCount;
+void Entity_Init(void);
+long Entity_New(unsigned char x, unsigned char y, signed char vx, signed char vy, unsigned char sprite);
+void Entity_UpdateDraw(void);
+
+#define SPRITES     8
+#define SCREENBYTES (SCREENW*SCREENH/8)
+#define MAXREF      256       // entity numbers fit in a byte
+
+// The old layout: one struct per object, moved and drawn in
+// two passes.  Indexed by entity number so both draw in the
+// same order.
+struct State{
+  long x, y, vx, vy;
+  long sprite;
+  long life;
+};
+struct State Ref[MAXREF];
+
+static unsigned long M = 1;
+unsigned long Random32(void){
+  M = (1664525*M + 1013904223)&0xFFFFFFFF;
+  return M;
+}
+
+void RefMove(long capacity){ long i, x, y;
+  const unsigned char *image;
+  for(i=0; i<capacity; i=i+1){
+    if(Ref[i].life){
+      image = Sprite[Ref[i].sprite][FrameCount];
+      x = Ref[i].x + Ref[i].vx;
+      y = Ref[i].y + Ref[i].vy;
+      if((x < 0) || ((x + image[18]) > SCREENW) ||
+         (y < (image[22] - 1)) || (y >= SCREENH)){
+        Ref[i].life = 0;
+      } else{
+        Ref[i].x = x;
+        Ref[i].y = y;
+      }
+    }
+  }
+}
+void RefDraw(long capacity){ long i;
+  for(i=0; i<capacity; i=i+1){
+    if(Ref[i].life){
+      Nokia5110_PrintBMP(Ref[i].x, Ref[i].y, Sprite[Ref[i].sprite][FrameCount], 0);
+    }
+  }
+}
+
+// allocate entities until target are alive, the same ones in
+// the pool and the reference
+void Spawn(long capacity, long target){ long i, s, x, y, vx, vy;
+  const unsigned char *image;
+  while((long)(capacity - FreeCount) < target){
+    s = Random32()%SPRITES;
+    image = Sprite[s][0];
+    x = Random32()%(SCREENW - image[18] + 1);
+    y = image[22] - 1 + Random32()%(SCREENH - image[22] + 1);
+    vx = (long)(Random32()%3) - 1;
+    vy = (long)(Random32()%3) - 1;
+    i = Entity_New(x, y, vx, vy, s);
+    if(i < 0){
+      return;
+    }
+    Ref[i].x = x;
+    Ref[i].y = y;
+    Ref[i].vx = vx;
+    Ref[i].vy = vy;
+    Ref[i].sprite = s;
+    Ref[i].life = 1;
+  }
+}
+
+int main(int argc, char **argv){ int i;
+  long frames = 10000, target = 120, capacity, n, e, live = 0, bad = 0;
+  unsigned long long c, poolc = 0, refc = 0;
+  double poolns = 0, refns = 0;
+  clock_t t;
+  char expect[SCREENBYTES];
+  for(i=1; i+1<argc; i=i+2){
+    if(strcmp(argv[i], "-n") == 0){
+      frames = atol(argv[i+1]);
+    } else if(strcmp(argv[i], "-e") == 0){
+      target = atol(argv[i+1]);
+    }
+  }
+  Nokia5110_Init();
+  Entity_Init();
+  capacity = FreeCount;
+  if(target > capacity){
+    printf("the pool holds %ld entities, not %ld\n", capacity, target);
+    return 1;
+  }
+  for(n=0; n<frames; n=n+1){
+    Spawn(capacity, target);
+    live = live + capacity - FreeCount;
+    t = clock();
+    c = CYCLES();
+    Nokia5110_ClearBuffer();
+    Entity_UpdateDraw();
+    poolc = poolc + CYCLES() - c;
+    poolns = poolns + (double)(clock() - t);
+    memcpy(expect, Screen, SCREENBYTES);
+    t = clock();
+    c = CYCLES();
+    Nokia5110_ClearBuffer();
+    RefMove(capacity);
+    RefDraw(capacity);
+    refc = refc + CYCLES() - c;
+    refns = refns + (double)(clock() - t);
+    for(e=0; e<capacity; e=e+1){
+      if(Ref[e].life != ((Alive[e/32]>>(e%32))&0x01)){
+        break;
+      }
+    }
+    if((e < capacity) || (memcmp(expect, Screen, SCREENBYTES) != 0)){
+      if(bad == 0){
+        printf("frame %ld: the pool and the reference differ\n", n);
+      }
+      bad = bad + 1;
+    }
+    FrameCount = (FrameCount+1)&0x01;
+  }
+  poolns = 1e9*poolns/CLOCKS_PER_SEC;
+  refns = 1e9*refns/CLOCKS_PER_SEC;
+  printf("%ld frames, pool of %ld, %.1f live entities per frame\n",
+         frames, capacity, (double)live/frames);
+  printf("%-22s %12s %10s %12s\n", "", "cycles/frame", "ns/frame", "cycles/entity");
+  printf("%-22s %12.0f %10.0f %12.1f\n", "Entity_UpdateDraw",
+         (double)poolc/frames, poolns/frames, (double)poolc/live);
+  printf("%-22s %12.0f %10.0f %12.1f\n", "structs, Move+Draw",
+         (double)refc/frames, refns/frames, (double)refc/live);
+  if(bad){
+    printf("%ld frames differ\n", bad);
+    return 1;
+  }
+  printf("every frame matches the reference\n");
+  return 0;
+}
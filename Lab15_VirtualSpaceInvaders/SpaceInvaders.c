@@ -53,7 +53,7 @@
 
 #include "..//tm4c123gh6pm.h"
 #include "Nokia5110.h"
-#include "Random.h"
+#include "random.h"
 #include "TExaS.h"
 
 void DisableInterrupts(void); // Disable interrupts
@@ -305,45 +305,145 @@ const unsigned char Laser1[] = {
 #define PLAYERW     ((unsigned char)PlayerShip0[18])
 #define PLAYERH     ((unsigned char)PlayerShip0[22])
 
-struct State {
-  unsigned long x;      // x coordinate
-  unsigned long y;      // y coordinate
-  const unsigned char *image[2]; // two pointers to images
-  long life;            // 0=dead, 1=alive
-};         
-typedef struct State STyp;
-STyp Enemy[4];
-void Init(void){ int i;
-  for(i=0;i<4;i++){
-    Enemy[i].x = 20*i;
-    Enemy[i].y = 10;
-    Enemy[i].image[0] = SmallEnemy30PointA;
-    Enemy[i].image[1] = SmallEnemy30PointB;
-    Enemy[i].life = 1;
-   }
+// *************************** Sprites ***************************
+// Each sprite id has two animation frames
+#define ENEMY30     0
+#define ENEMY20     1
+#define ENEMY10     2
+#define ENEMYBONUS  3
+#define PLAYER      4
+#define BUNKER      5
+#define MISSILE     6
+#define LASER       7
+const unsigned char * const Sprite[][2] = {
+  {SmallEnemy30PointA, SmallEnemy30PointB},
+  {SmallEnemy20PointA, SmallEnemy20PointB},
+  {SmallEnemy10PointA, SmallEnemy10PointB},
+  {SmallEnemyBonus0,   SmallEnemyBonus0},
+  {PlayerShip0,        PlayerShip0},
+  {Bunker0,            Bunker0},
+  {Missile0,           Missile1},
+  {Laser0,             Laser0}
+};
+
+// *************************** Entity pool ***************************
+// Every object on the screen is an entity.  The pool is a
+// structure of arrays: entity i is EntX[i], EntY[i], ... so
+// the update loop streams through small arrays instead of
+// striding over whole structs.  A set bit in Alive[] marks a
+// live entity, so whole words of dead entities are skipped.
+// Free entity numbers are kept on a stack; nothing is ever
+// allocated with malloc.
+// Room for a 5x11 wave, 4 bunkers, the player and plenty of
+// missiles and lasers; four words of Alive[]
+#define MAXENTITIES 128
+#define ALIVEWORDS  ((MAXENTITIES+31)/32)
+unsigned char EntX[MAXENTITIES];      // x coordinate, bottom left corner
+unsigned char EntY[MAXENTITIES];      // y coordinate, bottom left corner
+signed char EntVx[MAXENTITIES];       // pixels per frame to the right
+signed char EntVy[MAXENTITIES];       // pixels per frame down
+unsigned char EntSprite[MAXENTITIES]; // index into Sprite[]
+unsigned long Alive[ALIVEWORDS];      // bit i%32 of word i/32 set if entity i is alive
+unsigned char FreeList[MAXENTITIES];  // stack of unused entity numbers
+unsigned long FreeCount;              // number of entries on FreeList
+unsigned long FrameCount=0;
+
+// Empty the pool
+void Entity_Init(void){ int i;
+  for(i=0; i<ALIVEWORDS; i++){
+    Alive[i] = 0;
+  }
+  for(i=0; i<MAXENTITIES; i++){
+    FreeList[i] = MAXENTITIES-1-i;    // hand out low numbers first
+  }
+  FreeCount = MAXENTITIES;
 }
-void Move(void){ int i;
-  for(i=0;i<4;i++){
-    if(Enemy[i].x < 72){
-      Enemy[i].x += 1; // move to right
-    }else{
-      Enemy[i].life = 0;
+
+// Allocate an entity
+// inputs: x,y    bottom left corner
+//         vx,vy  velocity in pixels per frame
+//         sprite index into Sprite[]
+// outputs: entity number, or -1 if the pool is full
+long Entity_New(unsigned char x, unsigned char y, signed char vx, signed char vy, unsigned char sprite){ long i;
+  if(FreeCount == 0){
+    return -1;
+  }
+  FreeCount--;
+  i = FreeList[FreeCount];
+  EntX[i] = x;
+  EntY[i] = y;
+  EntVx[i] = vx;
+  EntVy[i] = vy;
+  EntSprite[i] = sprite;
+  Alive[i/32] |= 1UL<<(i%32);
+  return i;
+}
+
+// Return an entity to the pool
+void Entity_Free(long i){
+  if(Alive[i/32]&(1UL<<(i%32))){
+    Alive[i/32] &= ~(1UL<<(i%32));
+    FreeList[FreeCount] = i;
+    FreeCount++;
+  }
+}
+
+// Move and draw every live entity in one pass.  An entity
+// that would leave the screen is freed instead of drawn.  The
+// old Move() let an enemy keep going until x reached 72 and
+// PrintBMP clipped it for its last few steps; now any sprite
+// is freed at the first step that would clip it, so the four
+// enemies vanish at the same place but are freed 4 frames
+// sooner, and GAME OVER comes that much earlier.
+void Entity_UpdateDraw(void){ long w, i, x, y; unsigned long bits;
+  const unsigned char *image;
+  for(w=0; w<ALIVEWORDS; w++){
+    bits = Alive[w];
+    for(i=32*w; bits; i++, bits>>=1){
+      if((bits&0x01) == 0){
+        continue;
+      }
+      image = Sprite[EntSprite[i]][FrameCount];
+      x = EntX[i] + EntVx[i];
+      y = EntY[i] + EntVy[i];
+      if((x < 0) || ((x + image[18]) > SCREENW) ||
+         (y < (image[22] - 1)) || (y >= SCREENH)){
+        Entity_Free(i);               // off the screen
+        continue;
+      }
+      EntX[i] = x;
+      EntY[i] = y;
+      Nokia5110_PrintBMP(x, y, image, 0);
     }
   }
 }
-unsigned long FrameCount=0;
-void Draw(void){ int i;
-  Nokia5110_ClearBuffer();
-  for(i=0;i<4;i++){
-    if(Enemy[i].life > 0){
-     Nokia5110_PrintBMP(Enemy[i].x, Enemy[i].y, Enemy[i].image[FrameCount], 0);
+
+// Check for any live entity
+// outputs: 1 if at least one entity is alive
+int Entity_Any(void){ int w;
+  for(w=0; w<ALIVEWORDS; w++){
+    if(Alive[w]){
+      return 1;
     }
   }
+  return 0;
+}
+
+void Init(void){ int i;
+  Entity_Init();
+  for(i=0;i<4;i++){
+    Entity_New(20*i, 10, 1, 0, ENEMY30); // move to right
+  }
+}
+void Draw(void){
+  Nokia5110_ClearBuffer();
+  Entity_UpdateDraw();
   Nokia5110_DisplayBuffer();      // draw buffer
   FrameCount = (FrameCount+1)&0x01; // 0,1,0,1,...
 }
 
-int main(void){ int AnyLife = 1; int i;
+#ifndef HEADLESS
+int main(void){ int AnyLife = 1;
   TExaS_Init(NoLCD_NoScope);  // set system clock to 80 MHz
   // you cannot use both the Scope and the virtual Nokia (both need UART0)
   Random_Init(1);
@@ -370,11 +470,8 @@ int main(void){ int AnyLife = 1; int i;
   while(AnyLife){
     while(Semaphore == 0){};
     Semaphore = 0; // runs at 30 Hz
-    AnyLife = 0;
-    for(i=0; i<4 ; i++){
-      AnyLife |= Enemy[i].life;
-    }
     Draw();
+    AnyLife = Entity_Any();
   }
   Nokia5110_Clear();
   Nokia5110_SetCursor(1, 1);
@@ -415,7 +512,6 @@ void Timer2_Init(unsigned long period){
 void Timer2A_Handler(void){ 
   TIMER2_ICR_R = 0x00000001;   // acknowledge timer2A timeout
   TimerCount++;
-  Move(); 
   Semaphore = 1; // trigger
 }
 void Delay100ms(unsigned long count){unsigned long volatile time;
@@ -427,3 +523,4 @@ void Delay100ms(unsigned long count){unsigned long volatile time;
     count--;
   }
 }
+#endif
@@ -28,6 +28,7 @@
  */
 
 #include "TExaS.h"
+#include "UARTbuf.h"
 
 // Timer4A implements scope
 // Timer5A periodic interrupt implements voltmeter
@@ -465,57 +466,15 @@ void PLL_Init(void){
   SYSCTL_RCC2_R &= ~SYSCTL_RCC2_BYPASS2;
 }
 
-#define GPIO_PORTA_AFSEL_R      (*((volatile unsigned long *)0x40004420))
-#define GPIO_PORTA_DEN_R        (*((volatile unsigned long *)0x4000451C))
-#define GPIO_PORTA_AMSEL_R      (*((volatile unsigned long *)0x40004528))
-#define GPIO_PORTA_PCTL_R       (*((volatile unsigned long *)0x4000452C))
-#define UART0_FR_R              (*((volatile unsigned long *)0x4000C018))
-#define UART0_IBRD_R            (*((volatile unsigned long *)0x4000C024))
-#define UART0_FBRD_R            (*((volatile unsigned long *)0x4000C028))
-#define UART0_LCRH_R            (*((volatile unsigned long *)0x4000C02C))
-#define UART0_CTL_R             (*((volatile unsigned long *)0x4000C030))
-#define UART0_CC_R              (*((volatile unsigned long *)0x4000CFC8))
-#define UART_FR_TXFF            0x00000020  // UART Transmit FIFO Full
-#define UART_FR_RXFE            0x00000010  // UART Receive FIFO Empty
-#define UART_LCRH_WLEN_8        0x00000060  // 8 bit word length
-#define UART_LCRH_FEN           0x00000010  // UART Enable FIFOs
-#define UART_CTL_UARTEN         0x00000001  // UART Enable
-#define UART_CC_CS_M            0x0000000F  // UART Baud Clock Source
-#define UART_CC_CS_SYSCLK       0x00000000  // The system clock (default)
-#define SYSCTL_RCGC1_R          (*((volatile unsigned long *)0x400FE104))
-#define SYSCTL_RCGC2_R          (*((volatile unsigned long *)0x400FE108))
-#define SYSCTL_RCGC1_UART0      0x00000001  // UART0 Clock Gating Control
-#define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
-#define SYSCTL_PRGPIO_R         (*((volatile unsigned long *)0x400FEA08))
-#define SYSCTL_PRUART_R         (*((volatile unsigned long *)0x400FEA18))
-#define SYSCTL_PRGPIO_R0        0x00000001  // GPIO Port A Peripheral Ready
-#define SYSCTL_PRUART_R0        0x00000001  // UART Module 0 Peripheral Ready
 //------------UART0_Init------------
 // Initialize the UART for 115,200 baud rate (assuming 80 MHz UART clock),
 // 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// The rings in UARTbuf.c carry the bytes, so sending a screen to
+// TExaSdisplay no longer holds up the game for the whole transfer
 // Input: none
 // Output: none
-void UART0_Init(void){volatile unsigned long delay;
-  SYSCTL_RCGC1_R |= SYSCTL_RCGC1_UART0; // activate UART0
-  SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
-                                        // wait for clock to stabilize
-//  while((SYSCTL_PRUART_R&SYSCTL_PRUART_R0) == 0){};
-  delay =SYSCTL_RCGC2_R;
-  delay =SYSCTL_RCGC2_R;
-  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
-  UART0_IBRD_R = 43;                    // IBRD = int(80,000,000 / (16 * 115200)) = int(43.402778)
-  UART0_FBRD_R = 26;                    // FBRD = round(0.402778 * 64) = 26
-                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
-  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-  UART0_CC_R &= ~UART_CC_CS_M;          // clear baud clock control field
-  UART0_CC_R |= UART_CC_CS_SYSCLK;      // configure for system clock
-  UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
-//  while((SYSCTL_PRGPIO_R&SYSCTL_PRGPIO_R0) == 0){};
-  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1-0
-  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1-0
-                                        // configure PA1-0 as UART
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
-  GPIO_PORTA_AMSEL_R &= ~0x03;          // disable analog functionality on PA
+void UART0_Init(void){
+  UARTbuf_Init(115200, 1);              // UART0 on PA1-0, long writes by uDMA
 }
 
 //------------UART0_InChar------------
@@ -523,33 +482,32 @@ void UART0_Init(void){volatile unsigned long delay;
 // Input: none
 // Output: ASCII code for key typed
 unsigned char UART0_InChar(void){
-  while((UART0_FR_R&UART_FR_RXFE) != 0);
-  return((unsigned char)(UART0_DR_R&0xFF));
+  return UARTbuf_InChar();
 }
 //------------UART0_InCharNonBlocking------------
 // look for new serial port input
 // Input: none
 // Output: ASCII code for key typed
 //         0 if no key ready
-unsigned char UART0_InCharNonBlocking(void){
-  if((UART0_FR_R&UART_FR_RXFE) == 0){
-    return((unsigned char)(UART0_DR_R&0xFF));
+unsigned char UART0_InCharNonBlocking(void){ unsigned char data;
+  if(UARTbuf_Read(&data, 1)){
+    return data;
   }
   return 0;
 }
 //------------UART0_OutChar------------
-// Output 8-bit to serial port
+// Output 8-bit to serial port, waits only if the ring is full
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART0_OutChar(unsigned char data){
-  while((UART0_FR_R&UART_FR_TXFF) != 0);
-  UART0_DR_R = data;
+  UARTbuf_OutChar(data);
 }
 //------------UART0_OutCharNonBlock------------
 // Output 8-bit to serial port, do not wait
+// the byte is dropped if the ring is full
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART0_OutCharNonBlock(unsigned char data){
-  UART0_DR_R = data;
+  UARTbuf_Write(&data, 1);
 }
 
@@ -70,255 +70,25 @@
 // U0Rx (VCP receive) connected to PA0
 // U0Tx (VCP transmit) connected to PA1
 
-// FIFO.h
-// Runs on any computer
-// Provide functions that initialize a FIFO, put data in, get data out,
-// and return the current size.  The file includes a transmit FIFO
-// using index implementation and a receive FIFO using pointer
-// implementation.  Other index or pointer implementation FIFOs can be
-// created using the macros supplied at the end of the file.
-// Daniel Valvano
-// June 16, 2011
-
-/* This example accompanies the book
-   "Embedded Systems: Real Time Interfacing to the Arm Cortex M3",
-   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2011
-      Programs 3.7, 3.8., 3.9 and 3.10 in Section 3.7
-
- Copyright 2011 by Jonathan W. Valvano, valvano@mail.utexas.edu
-    You may use, edit, run or distribute this file
-    as long as the above copyright notice remains
- THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
- OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
- MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
- VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
- OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
- For more information about my classes, my research, and my books, see
- http://users.ece.utexas.edu/~valvano/
- */
-
-
-
-// macro to create an index FIFO
-#define AddIndexFifo(NAME,SIZE,TYPE,SUCCESS,FAIL) \
-unsigned long volatile NAME ## PutI;    \
-unsigned long volatile NAME ## GetI;    \
-TYPE static NAME ## Fifo [SIZE];        \
-void NAME ## Fifo_Init(void){ long sr;  \
-  sr = StartCritical();                 \
-  NAME ## PutI = NAME ## GetI = 0;      \
-  EndCritical(sr);                      \
-}                                       \
-int NAME ## Fifo_Put (TYPE data){       \
-  if(( NAME ## PutI - NAME ## GetI ) & ~(SIZE-1)){  \
-    return(FAIL);      \
-  }                    \
-  NAME ## Fifo[ NAME ## PutI &(SIZE-1)] = data; \
-  NAME ## PutI ## ++;  \
-  return(SUCCESS);     \
-}                      \
-int NAME ## Fifo_Get (TYPE *datapt){  \
-  if( NAME ## PutI == NAME ## GetI ){ \
-    return(FAIL);      \
-  }                    \
-  *datapt = NAME ## Fifo[ NAME ## GetI &(SIZE-1)];  \
-  NAME ## GetI ## ++;  \
-  return(SUCCESS);     \
-}                      \
-unsigned short NAME ## Fifo_Size (void){  \
- return ((unsigned short)( NAME ## PutI - NAME ## GetI ));  \
-}
-// e.g.,
-// AddIndexFifo(Tx,32,unsigned char, 1,0)
-// SIZE must be a power of two
-// creates TxFifo_Init() TxFifo_Get() and TxFifo_Put()
-
-// macro to create a pointer FIFO
-#define AddPointerFifo(NAME,SIZE,TYPE,SUCCESS,FAIL) \
-TYPE volatile *NAME ## PutPt;    \
-TYPE volatile *NAME ## GetPt;    \
-TYPE static NAME ## Fifo [SIZE];        \
-void NAME ## Fifo_Init(void){ long sr;  \
-  sr = StartCritical();                 \
-  NAME ## PutPt = NAME ## GetPt = &NAME ## Fifo[0]; \
-  EndCritical(sr);                      \
-}                                       \
-int NAME ## Fifo_Put (TYPE data){       \
-  TYPE volatile *nextPutPt;             \
-  nextPutPt = NAME ## PutPt + 1;        \
-  if(nextPutPt == &NAME ## Fifo[SIZE]){ \
-    nextPutPt = &NAME ## Fifo[0];       \
-  }                                     \
-  if(nextPutPt == NAME ## GetPt ){      \
-    return(FAIL);                       \
-  }                                     \
-  else{                                 \
-    *( NAME ## PutPt ) = data;          \
-    NAME ## PutPt = nextPutPt;          \
-    return(SUCCESS);                    \
-  }                                     \
-}                                       \
-int NAME ## Fifo_Get (TYPE *datapt){    \
-  if( NAME ## PutPt == NAME ## GetPt ){ \
-    return(FAIL);                       \
-  }                                     \
-  *datapt = *( NAME ## GetPt ## ++);    \
-  if( NAME ## GetPt == &NAME ## Fifo[SIZE]){ \
-    NAME ## GetPt = &NAME ## Fifo[0];   \
-  }                                     \
-  return(SUCCESS);                      \
-}                                       \
-unsigned short NAME ## Fifo_Size (void){\
-  if( NAME ## PutPt < NAME ## GetPt ){  \
-    return ((unsigned short)( NAME ## PutPt - NAME ## GetPt + (SIZE*sizeof(TYPE)))/sizeof(TYPE)); \
-  }                                     \
-  return ((unsigned short)( NAME ## PutPt - NAME ## GetPt )/sizeof(TYPE)); \
-}
-// e.g.,
-// AddPointerFifo(Rx,32,unsigned char, 1,0)
-// SIZE can be any size
-// creates RxFifo_Init() RxFifo_Get() and RxFifo_Put()
-
-#define NVIC_EN0_INT5           0x00000020  // Interrupt 5 enable
-#define NVIC_EN0_R              (*((volatile unsigned long *)0xE000E100))  // IRQ 0 to 31 Set Enable Register
-#define NVIC_PRI1_R             (*((volatile unsigned long *)0xE000E404))  // IRQ 4 to 7 Priority Register
-#define GPIO_PORTA_AFSEL_R      (*((volatile unsigned long *)0x40004420))
-#define GPIO_PORTA_DEN_R        (*((volatile unsigned long *)0x4000451C))
-#define GPIO_PORTA_AMSEL_R      (*((volatile unsigned long *)0x40004528))
-#define GPIO_PORTA_PCTL_R       (*((volatile unsigned long *)0x4000452C))
-#define UART0_DR_R              (*((volatile unsigned long *)0x4000C000))
-#define UART0_FR_R              (*((volatile unsigned long *)0x4000C018))
-#define UART0_IBRD_R            (*((volatile unsigned long *)0x4000C024))
-#define UART0_FBRD_R            (*((volatile unsigned long *)0x4000C028))
-#define UART0_LCRH_R            (*((volatile unsigned long *)0x4000C02C))
-#define UART0_CTL_R             (*((volatile unsigned long *)0x4000C030))
-#define UART0_IFLS_R            (*((volatile unsigned long *)0x4000C034))
-#define UART0_IM_R              (*((volatile unsigned long *)0x4000C038))
-#define UART0_RIS_R             (*((volatile unsigned long *)0x4000C03C))
-#define UART0_ICR_R             (*((volatile unsigned long *)0x4000C044))
-#define UART_FR_RXFF            0x00000040  // UART Receive FIFO Full
-#define UART_FR_TXFF            0x00000020  // UART Transmit FIFO Full
-#define UART_FR_RXFE            0x00000010  // UART Receive FIFO Empty
-#define UART_LCRH_WLEN_8        0x00000060  // 8 bit word length
-#define UART_LCRH_FEN           0x00000010  // UART Enable FIFOs
-#define UART_CTL_UARTEN         0x00000001  // UART Enable
-#define UART_IFLS_RX1_8         0x00000000  // RX FIFO >= 1/8 full
-#define UART_IFLS_TX1_8         0x00000000  // TX FIFO <= 1/8 full
-#define UART_IM_RTIM            0x00000040  // UART Receive Time-Out Interrupt
-                                            // Mask
-#define UART_IM_TXIM            0x00000020  // UART Transmit Interrupt Mask
-#define UART_IM_RXIM            0x00000010  // UART Receive Interrupt Mask
-#define UART_RIS_RTRIS          0x00000040  // UART Receive Time-Out Raw
-                                            // Interrupt Status
-#define UART_RIS_TXRIS          0x00000020  // UART Transmit Raw Interrupt
-                                            // Status
-#define UART_RIS_RXRIS          0x00000010  // UART Receive Raw Interrupt
-                                            // Status
-#define UART_ICR_RTIC           0x00000040  // Receive Time-Out Interrupt Clear
-#define UART_ICR_TXIC           0x00000020  // Transmit Interrupt Clear
-#define UART_ICR_RXIC           0x00000010  // Receive Interrupt Clear
-#define SYSCTL_RCGC1_R          (*((volatile unsigned long *)0x400FE104))
-#define SYSCTL_RCGC2_R          (*((volatile unsigned long *)0x400FE108))
-#define SYSCTL_RCGC1_UART0      0x00000001  // UART0 Clock Gating Control
-#define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
-
-void DisableInterrupts(void); // Disable interrupts
-void EnableInterrupts(void);  // Enable interrupts
-long StartCritical (void);    // previous I bit, disable interrupts
-void EndCritical(long sr);    // restore I bit to previous value
-void WaitForInterrupt(void);  // low power mode
-#define RXFIFOSIZE   16       // size of the FIFOs (must be power of 2)
-#define TXFIFOSIZE   512      // size of the FIFOs (must be power of 2)
-#define FIFOSUCCESS 1         // return value on success
-#define FIFOFAIL    0         // return value on failure
-                              // create index implementation FIFO (see FIFO.h)
-AddIndexFifo(Rx, RXFIFOSIZE, char, FIFOSUCCESS, FIFOFAIL)
-AddIndexFifo(Tx, TXFIFOSIZE, char, FIFOSUCCESS, FIFOFAIL)
+#include "UARTbuf.h"
 
 // Initialize UART0
 // Baud rate is 115200 bits/sec
+// The rings and UART0_Handler are in UARTbuf.c; a full screen
+// (504 bytes) fits in its transmit ring, so it goes out by uDMA
+// while the game keeps running
 void UART_Init(void){
-  SYSCTL_RCGC1_R |= SYSCTL_RCGC1_UART0; // activate UART0
-  SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
-  RxFifo_Init();                        // initialize empty FIFOs
-  TxFifo_Init();
-  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
-  UART0_IBRD_R = 43;                    // IBRD = int(80,000,000 / (16 * 115,200)) = int(43.4027)
-  UART0_FBRD_R = 26;                    // FBRD = round(0.4027 * 64) = 26
-                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
-  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-  UART0_IFLS_R &= ~0x3F;                // clear TX and RX interrupt FIFO level fields
-                                        // configure interrupt for TX FIFO <= 1/8 full
-                                        // configure interrupt for RX FIFO >= 1/8 full
-  UART0_IFLS_R += (UART_IFLS_TX1_8|UART_IFLS_RX1_8);
-                                        // enable TX and RX FIFO interrupts and RX time-out interrupt
-  UART0_IM_R |= (UART_IM_RXIM|UART_IM_TXIM|UART_IM_RTIM);
-  UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
-  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1-0
-  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1-0
-                                        // configure PA1-0 as UART
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
-  GPIO_PORTA_AMSEL_R = 0;               // disable analog functionality on PA
-                                        // UART0=priority 2
-  NVIC_PRI1_R = (NVIC_PRI1_R&0xFFFF00FF)|0x00004000; // bits 13-15
-  NVIC_EN0_R = NVIC_EN0_INT5;           // enable interrupt 5 in NVIC
-}
-// copy from hardware RX FIFO to software RX FIFO
-// stop when hardware RX FIFO is empty or software RX FIFO is full
-void static copyHardwareToSoftware(void){
-  char letter;
-  while(((UART0_FR_R&UART_FR_RXFE) == 0) && (RxFifo_Size() < (RXFIFOSIZE - 1))){
-    letter = UART0_DR_R;
-    RxFifo_Put(letter);
-  }
-}
-// copy from software TX FIFO to hardware TX FIFO
-// stop when software TX FIFO is empty or hardware TX FIFO is full
-void static copySoftwareToHardware(void){
-  char letter;
-  while(((UART0_FR_R&UART_FR_TXFF) == 0) && (TxFifo_Size() > 0)){
-    TxFifo_Get(&letter);
-    UART0_DR_R = letter;
-  }
+  UARTbuf_Init(115200, 1);
 }
 // input ASCII character from UART
-// spin if RxFifo is empty
+// spin if the receive ring is empty
 unsigned char UART_InChar(void){
-  char letter;
-  while(RxFifo_Get(&letter) == FIFOFAIL){};
-  return(letter);
+  return UARTbuf_InChar();
 }
 // output ASCII character to UART
-// spin if TxFifo is full
+// spin if the transmit ring is full
 void UART_OutChar(unsigned char data){
-  while(TxFifo_Put(data) == FIFOFAIL){};
-  UART0_IM_R &= ~UART_IM_TXIM;          // disable TX FIFO interrupt
-  copySoftwareToHardware();
-  UART0_IM_R |= UART_IM_TXIM;           // enable TX FIFO interrupt
-}
-// at least one of three things has happened:
-// hardware TX FIFO goes from 3 to 2 or less items
-// hardware RX FIFO goes from 1 to 2 or more items
-// UART receiver has timed out
-void UART0_Handler(void){
-  if(UART0_RIS_R&UART_RIS_TXRIS){       // hardware TX FIFO <= 2 items
-    UART0_ICR_R = UART_ICR_TXIC;        // acknowledge TX FIFO
-    // copy from software TX FIFO to hardware TX FIFO
-    copySoftwareToHardware();
-    if(TxFifo_Size() == 0){             // software TX FIFO is empty
-      UART0_IM_R &= ~UART_IM_TXIM;      // disable TX FIFO interrupt
-    }
-  }
-  if(UART0_RIS_R&UART_RIS_RXRIS){       // hardware RX FIFO >= 2 items
-    UART0_ICR_R = UART_ICR_RXIC;        // acknowledge RX FIFO
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-  if(UART0_RIS_R&UART_RIS_RTRIS){       // receiver timed out
-    UART0_ICR_R = UART_ICR_RTIC;        // acknowledge receiver time out
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
+  UARTbuf_OutChar(data);
 }
 // Maximum dimensions of the LCD
 #define MAX_X                   84
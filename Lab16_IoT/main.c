@@ -118,6 +118,7 @@ Port A, SSI0 (PA2, PA3, PA5, PA6, PA7) sends data to Nokia5110 LCD
 #include "driverlib/uart.h"
 #include "utils/uartstdio.h"
 #include "utils/cmdline.h"
+#include "utils/httpclient.h"
 #include "application_commands.h"
 #include "LED.h"
 #include "Nokia5110.h"
@@ -173,8 +174,6 @@ void LCD_Init(void){
 
 #define BAUD_RATE           115200
 #define MAX_RECV_BUFF_SIZE  1024
-#define MAX_SEND_BUFF_SIZE  512
-#define MAX_HOSTNAME_SIZE   40
 #define MAX_PASSKEY_SIZE    32
 #define MAX_SSID_SIZE       32
 
@@ -232,10 +231,6 @@ typedef struct{
  */
 struct{
   char Recvbuff[MAX_RECV_BUFF_SIZE];
-  char SendBuff[MAX_SEND_BUFF_SIZE];
-  char HostName[MAX_HOSTNAME_SIZE];
-  unsigned long DestinationIP;
-  int SockID;
 }appData;
 
 typedef enum{
@@ -257,9 +252,7 @@ UINT32  g_Status = 0;
 void WlanConnect(void);
 static int32_t configureSimpleLinkToDefaultState(char *);
 static uint32_t initializeAppVariables(void);
-static int CreateConnection(void);
 static int32_t getResult(void);   //this function get Id, Score, and Edxpost
-static int32_t GetHostIP(void);
 /*
  * STATIC FUNCTION DEFINITIONS -- End
  */
@@ -460,6 +453,8 @@ void Crash(uint32_t time){
 int main(void){
   int32_t retVal = 0;
   char *pConfig = NULL;
+  _SlNonOsStats_t mainLoop;
+  tHttpClientStats http;
   retVal = initializeAppVariables();
   stopWDT();        // Stop WDT 
   initClk();        // PLL 50 MHz
@@ -497,6 +492,11 @@ int main(void){
   }
   WlanConnect();
   LCD_OutString("Connected\n");
+  HttpClientInit();  // keeps the server's address and connection between touches
+  _SlNonOsStatsGet(&mainLoop);  // how the wait for the connection went
+  UARTprintf("Main loop: %u wake-ups, %u ms asleep, IRQ to handler %u us mean %u us max\r\n",
+    mainLoop.Wakeups, (uint32_t)(mainLoop.SleepTime/1000),
+    mainLoop.Runs ? (uint32_t)(mainLoop.LatencyTotal/mainLoop.Runs) : 0, mainLoop.LatencyMax);
 
 /* Get weather report */
   while(1){
@@ -506,6 +506,9 @@ int main(void){
       LED_GreenOn();
       UARTprintf("\r\n\r\n");
       UARTprintf(appData.Recvbuff); UARTprintf("\r\n");
+      HttpClientStatsGet(&http);  // what keeping the connection open saved
+      UARTprintf("HTTP: %u requests, %u lookups, %u connects, %u ms setup\r\n",
+        http.ui32Requests, http.ui32Lookups, http.ui32Connects, http.ui32SetupUs/1000);
       LCD_OutString(Id); LCD_OutString("\n");
       LCD_OutString(Score); LCD_OutString(" C\n");
       LCD_OutString(Edxpost);
@@ -547,7 +550,9 @@ static int32_t configureSimpleLinkToDefaultState(char *pConfig){
   if (ROLE_STA != mode){
     if (ROLE_AP == mode){
             /* If the device is in AP mode, we need to wait for this event before doing anything */
-      while(!IS_IP_AQUIRED(g_Status));
+      while(!IS_IP_AQUIRED(g_Status)){
+        _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER);
+      }
     }
 
         /* Switch to STA role and restart */
@@ -582,7 +587,9 @@ static int32_t configureSimpleLinkToDefaultState(char *pConfig){
   retVal = sl_WlanDisconnect();
   if(0 == retVal){
         /* Wait */
-     while(IS_CONNECTED(g_Status));
+     while(IS_CONNECTED(g_Status)){
+       _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER);
+     }
   }
 
     /* Enable DHCP client*/
@@ -627,68 +634,6 @@ static uint32_t initializeAppVariables(void){
 }
 
 
-/*!
-    \brief Create TCP connection with openweathermap.org
-
-    \param[in]      none
-
-    \return         Socket descriptor for success otherwise negative
-
-    \warning
-*/
-static int CreateConnection(void){
-  SlSockAddrIn_t  Addr;
-
-  INT32 sd = 0;
-  INT32 AddrSize = 0;
-  INT16 ret_val = 0;
-
-  Addr.sin_family = SL_AF_INET;
-  Addr.sin_port = sl_Htons(80);
-
-    /* Change the DestinationIP endianity, to big endian */
-  Addr.sin_addr.s_addr = sl_Htonl(appData.DestinationIP);
-
-  AddrSize = sizeof(SlSockAddrIn_t);
-
-  sd = sl_Socket(SL_AF_INET,SL_SOCK_STREAM, 0);
-  if( sd < 0 ){
-    LCD_OutString("Error creating socket\r\n");
-    return sd;
-  }
-
-  ret_val = sl_Connect(sd, ( SlSockAddr_t *)&Addr, AddrSize);
-  if( ret_val < 0 ){
-        /* error */
-    LCD_OutString("Error connecting to socket\r\n");
-    return ret_val;
-  }
-
-  return sd;
-}
-
-/*!
-    \brief This function obtains the server IP address
-
-    \param[in]      none
-
-    \return         zero for success and -1 for error
-
-    \warning
-*/
-static int32_t GetHostIP(void){
-  int32_t status = -1;
-
-  status = sl_NetAppDnsGetHostByName(appData.HostName,
-                                       strlen(appData.HostName),
-                                       &appData.DestinationIP, SL_AF_INET);
-  if (status < 0){
-    LCD_OutString("Unable to reach Host\n");
-    return status;
-  }
-  return SUCCESS;
-}
-
 //******************************************************************************
 //    \brief Connecting to a WLAN Access point
 //
@@ -715,7 +660,7 @@ void WlanConnect(void){
   sl_WlanConnect(SSID_NAME, strlen(SSID_NAME), 0, &secParams, 0);
 
   while((0 == (g_Status & CONNECTED)) || (0 == (g_Status & IP_AQUIRED))){
-    _SlNonOsMainLoopTask();
+    _SlNonOsMainLoopWait(NONOS_WAIT_FOREVER); // sleeps until the CC3100 interrupts
   }
 }
 /*!
@@ -723,27 +668,20 @@ void WlanConnect(void){
 
     \param[in]      none
 
-    \return         zero for success and -1 for error
+    \return         zero for success otherwise negative
 
     \warning
 */
 static int32_t getResult(void){uint32_t i;
   char *pt = NULL;
+  int32_t status;
 
-  memcpy(appData.HostName,SERVER,strlen(SERVER));
-  if(GetHostIP() == 0){
-    if( (appData.SockID = CreateConnection()) < 0 ) return -1;
-
-/* HTTP GET string. */
-    strcpy(appData.SendBuff,REQUEST); 
+/* HTTP GET string, sent on the connection kept open from the last time;
+   the server is only looked up and connected to again when needed */
 // 1) change Austin Texas to your city
 // 2) you can change metric to imperial if you want temperature in F
-    /* Send the HTTP GET string to the open TCP/IP socket. */
-    sl_Send(appData.SockID, appData.SendBuff, strlen(appData.SendBuff), 0);
-
-/* Receive response */
-    sl_Recv(appData.SockID, &appData.Recvbuff[0], MAX_RECV_BUFF_SIZE, 0);
-    appData.Recvbuff[strlen(appData.Recvbuff)] = '\0';
+  status = HttpClientRequest(SERVER, 80, REQUEST, appData.Recvbuff, MAX_RECV_BUFF_SIZE);
+  if(status == 0){
 
 /* find ticker name in response*/
     pt = strstr(appData.Recvbuff, "\"Id\"");
@@ -780,8 +718,9 @@ static int32_t getResult(void){uint32_t i;
       }
     }
     Edxpost[i] = 0;   
-    sl_Close(appData.SockID);
+  }else{
+    LCD_OutString("Unable to reach Host\n");
   }
 
-  return 0;
+  return status;
 }
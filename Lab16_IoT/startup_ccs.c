@@ -42,6 +42,7 @@ extern uint32_t __STACK_TOP;
 //
 //*****************************************************************************
 extern void GPIOB_intHandler(void);
+extern void WideTimer5B_Handler(void);
 extern void UARTStdioIntHandler(void);
 
 //*****************************************************************************
@@ -176,7 +177,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Wide Timer 4 subtimer A
     IntDefaultHandler,                      // Wide Timer 4 subtimer B
     IntDefaultHandler,                      // Wide Timer 5 subtimer A
-    IntDefaultHandler,                      // Wide Timer 5 subtimer B
+    WideTimer5B_Handler,                    // Wide Timer 5 subtimer B
     IntDefaultHandler,                      // FPU
     0,                                      // Reserved
     0,                                      // Reserved
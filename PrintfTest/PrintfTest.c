@@ -0,0 +1,239 @@
+// PrintfTest.c
+// Runs on a PC, not on the LaunchPad
+// Differential test of utils/ustdlib.c against the C library.
+// Random format strings in the subset ustdlib supports are
+// printed by usnprintf() and by snprintf(), with the output and
+// the return value compared for full and truncated buffers.
+// The same formats are compiled by ufmtcompile() and printed
+// with usnprintfc(), which must give the same bytes, and run
+// through uvformat() the way UARTvprintf() does (small buffer
+// flushed through a write function, pad limit 16).
+// Where ustdlib differs from the C library on purpose, the test
+// maps it:
+//   %X prints lower case              compared with %x
+//   %p prints like %x                 compared with %x
+//   %8s pads after the string         compared with %-8s
+// and the rest is checked against fixed strings: unknown
+// conversions print ERROR, a number wider than its field or a
+// pad past the limit gets no padding.
+// Then it times usnprintf, usnprintfc and snprintf on a log line.
+//
+// build (from this folder):
+//   gcc -O2 -std=c99 -I.. -o PrintfTest PrintfTest.c ../utils/ustdlib.c
+// usage: PrintfTest [-n formats] [-s seed]   (default 200000, 1)
+//
+// Every argument is passed as a 64-bit value.  On x86-64 and
+// AArch64 an int and a pointer take the same 64-bit slot in a
+// variable argument list, so one call can feed %d and %s alike.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "utils/ustdlib.h"
+
+#define MAXARGS 12
+#define A(a) a[0],a[1],a[2],a[3],a[4],a[5],a[6],a[7],a[8],a[9],a[10],a[11]
+
+static unsigned long Seed = 1;
+static unsigned long Rand(void){
+  Seed = (1664525*Seed + 1013904223)&0xFFFFFFFF;
+  return Seed>>8;
+}
+static int Errors;
+
+static const char *Strings[] = {"", "a", "cm", "Vancouver BC", "%d not a format",
+  "HTTP/1.1 200 OK\r\n", "0123456789012345678901234567890123456789"};
+static const uint32_t Edge[] = {0, 1, 9, 10, 99, 100, 999, 1000, 9999, 10000, 65535,
+  99999, 100000, 999999999, 1000000000, 0x7FFFFFFF, 0x80000000, 0x80000001,
+  0xFFFFFFFF, 0xFFFFFFFE, 0xF, 0x10, 0xFF, 0x100, 0xFFFF, 0x10000};
+
+// UARTvprintf's sink: collects what the write function is given
+static char Wire[8192];
+static int WireLen;
+static int WireWrite(const char *pcBuf, uint32_t ui32Len){
+  memcpy(&Wire[WireLen], pcBuf, ui32Len);
+  WireLen = WireLen + ui32Len;
+  return ui32Len;
+}
+static int uartlike(char *chunk, uint32_t size, const char *fmt, const tUFormat *cf, ...){
+  tUSink sink;
+  va_list arg;
+  int count;
+  sink.pcStart = chunk; sink.pcNext = chunk; sink.pcEnd = chunk + size;
+  sink.pfnWrite = WireWrite;
+  sink.ui32PadLimit = 16;
+  sink.iCount = 0;
+  WireLen = 0;
+  va_start(arg, cf);
+  count = uvformat(&sink, fmt, cf, arg);
+  va_end(arg);
+  Wire[WireLen] = 0;
+  return count;
+}
+
+static void fail(const char *what, const char *fmt, const char *want, const char *got, int wn, int gn){
+  if(Errors < 20){
+    printf("%s \"%s\": want \"%s\" (%d) got \"%s\" (%d)\n", what, fmt, want, wn, got, gn);
+  }
+  Errors = Errors + 1;
+}
+
+// Build a random format in ustdlib's syntax (u) and the matching
+// C library format (c), with its arguments.  uart limits number
+// widths to 15 so the pad limit of 16 is never reached.
+static void randomformat(char *u, char *c, uint64_t *arg, int uart){
+  int i, k, nargs = 0, w;
+  char conv, fill;
+  *u = 0; *c = 0;
+  for(k=Rand()%(MAXARGS+1); k>0; k=k-1){
+    // literal run, no %
+    for(i=Rand()%6; i>0; i=i-1){
+      char lit[2] = {"ab =:\n\r-x9"[Rand()%11], 0};
+      strcat(u, lit); strcat(c, lit);
+    }
+    conv = "cdiusxXp%"[Rand()%9];
+    w = (Rand()%3) ? 0 : Rand()%(uart ? 16 : 24);
+    fill = ((conv != 's') && (conv != 'c') && (Rand()&1)) ? '0' : 0;
+    if((conv == 'c') || (conv == '%')){
+      w = 0;                        // width is ignored by ustdlib
+      fill = 0;
+    }
+    if(w == 0) fill = 0;
+    if(w){
+      sprintf(u+strlen(u), "%%%s%d%c", fill ? "0" : "", w, conv);
+    } else{
+      sprintf(u+strlen(u), "%%%c", conv);
+    }
+    if(conv == '%'){
+      strcat(c, "%%");
+      continue;
+    }
+    if(conv == 's'){
+      sprintf(c+strlen(c), w ? "%%-%ds" : "%%s", w);
+      arg[nargs] = (uintptr_t)Strings[Rand()%(sizeof(Strings)/sizeof(Strings[0]))];
+    } else{
+      if((conv == 'X') || (conv == 'p')) conv = 'x';
+      if(w){
+        sprintf(c+strlen(c), "%%%s%d%c", fill ? "0" : "", w, conv);
+      } else{
+        sprintf(c+strlen(c), "%%%c", conv);
+      }
+      if(conv == 'c'){
+        arg[nargs] = 32 + Rand()%95;
+      } else if(Rand()&1){
+        arg[nargs] = Edge[Rand()%(sizeof(Edge)/sizeof(Edge[0]))];
+      } else{
+        arg[nargs] = (uint32_t)((Rand()<<8)^Rand()) >> (Rand()%32);
+      }
+      if((conv == 'd') || (conv == 'i')){
+        arg[nargs] = (uint64_t)(int64_t)(int32_t)arg[nargs]; // sign extended like an int
+      }
+    }
+    nargs = nargs + 1;
+  }
+  for(i=Rand()%4; i>0; i=i-1){
+    strcat(u, "."); strcat(c, ".");
+  }
+}
+
+// ustdlib output that is not the C library's
+static void quirks(void){
+  static const struct { const char *fmt; int32_t v; const char *want; int uart; } Q[] = {
+    {"%X",    0xABCDEF,   "abcdef", 0},
+    {"%p",    0x1234,     "1234", 0},
+    {"%q%d",  5,          "ERROR5", 0},
+    {"%3",    0,          "ERROR", 0},
+    {"a%",    0,          "aERROR", 0},
+    {"%2d",   12345,      "12345", 0},
+    {"%08d",  -12,        "-0000012", 0},
+    {"%8d",   -12,        "     -12", 0},
+    {"%20d",  7,          "                   7", 0},
+    {"%20d",  7,          "7", 1},       // UARTvprintf pads less than 16
+    {"%15d",  7,          "              7", 1},
+    {"%16d",  7,          "7", 1},
+    {"%c",    0x141,      "A", 0},
+    {"%d",    (int32_t)0x80000000, "-2147483648", 0},
+  };
+  char buf[64], chunk[8];
+  unsigned i;
+  int n;
+  for(i=0; i<sizeof(Q)/sizeof(Q[0]); i=i+1){
+    if(Q[i].uart){
+      n = uartlike(chunk, sizeof(chunk), Q[i].fmt, 0, Q[i].v);
+      if(strcmp(Wire, Q[i].want)) fail("quirk uart", Q[i].fmt, Q[i].want, Wire, strlen(Q[i].want), n);
+    } else{
+      n = usnprintf(buf, sizeof(buf), Q[i].fmt, Q[i].v);
+      if(strcmp(buf, Q[i].want) || (n != (int)strlen(Q[i].want))) fail("quirk", Q[i].fmt, Q[i].want, buf, strlen(Q[i].want), n);
+    }
+  }
+  n = usnprintf(buf, sizeof(buf), "%5s|", "ab");
+  if(strcmp(buf, "ab   |")) fail("quirk", "%5s|", "ab   |", buf, 6, n);
+  // a padded %s that is truncated must not write past the buffer
+  memset(buf, '#', sizeof(buf));
+  n = usnprintf(buf, 4, "%10s", "ab");
+  if(strcmp(buf, "ab ") || (n != 10) || (buf[4] != '#')) fail("truncated %s", "%10s", "ab ", buf, 10, n);
+}
+
+int main(int argc, char **argv){
+  static char u[512], c[512], want[4096], got[4096], got2[4096], chunk[13];
+  uint64_t arg[MAXARGS];
+  tUFormat cf;
+  long formats = 200000, f, i;
+  int wn, gn, n;
+  clock_t start;
+  double t[3];
+  for(i=1; i+1<argc; i=i+2){
+    if(strcmp(argv[i], "-n") == 0) formats = atol(argv[i+1]);
+    if(strcmp(argv[i], "-s") == 0) Seed = strtoul(argv[i+1], 0, 0);
+  }
+  quirks();
+  for(f=0; f<formats; f=f+1){
+    int uart = (f&3) == 3;
+    memset(arg, 0, sizeof(arg));
+    randomformat(u, c, arg, uart);
+    wn = snprintf(want, sizeof(want), c, A(arg));
+    ufmtcompile(&cf, u);
+    if(uart){                       // UARTvprintf path, chunk of 13 to force flushes
+      gn = uartlike(chunk, sizeof(chunk), u, 0, A(arg));
+      if(strcmp(want, Wire) || (wn != gn)) fail("uart", u, want, Wire, wn, gn);
+      gn = uartlike(chunk, sizeof(chunk), 0, &cf, A(arg));
+      if(strcmp(want, Wire) || (wn != gn)) fail("uart compiled", u, want, Wire, wn, gn);
+      continue;
+    }
+    gn = usnprintf(got, sizeof(got), u, A(arg));
+    if(strcmp(want, got) || (wn != gn)) fail("usnprintf", u, want, got, wn, gn);
+    gn = usnprintfc(got2, sizeof(got2), &cf, A(arg));
+    if(strcmp(want, got2) || (wn != gn)) fail("usnprintfc", u, want, got2, wn, gn);
+    // truncated to a random size, 1 byte or more
+    n = 1 + Rand()%(wn + 2);
+    memset(got, '#', n + 8);
+    wn = snprintf(want, n, c, A(arg));
+    gn = usnprintf(got, n, u, A(arg));
+    if(strcmp(want, got) || (wn != gn) || (got[n] != '#')) fail("truncated", u, want, got, wn, gn);
+  }
+  printf("%ld formats, %d errors\n", formats, Errors);
+
+  // time a typical log line
+  {
+    static const char *line = "t=%u ADC=%4d dist=%d.%03d cm %s\n";
+    long reps = 2000000;
+    volatile int sink = 0;
+    ufmtcompile(&cf, line);
+    start = clock();
+    for(i=0; i<reps; i=i+1) sink += usnprintf(got, sizeof(got), line, i, i&4095, i%3, i%1000, "ok");
+    t[0] = (double)(clock()-start)/CLOCKS_PER_SEC;
+    start = clock();
+    for(i=0; i<reps; i=i+1) sink += usnprintfc(got, sizeof(got), &cf, i, i&4095, i%3, i%1000, "ok");
+    t[1] = (double)(clock()-start)/CLOCKS_PER_SEC;
+    start = clock();
+    for(i=0; i<reps; i=i+1) sink += snprintf(got, sizeof(got), line, (unsigned)i, (int)(i&4095), (int)(i%3), (int)(i%1000), "ok");
+    t[2] = (double)(clock()-start)/CLOCKS_PER_SEC;
+    (void)sink;
+    printf("\"t=%%u ADC=%%4d dist=%%d.%%03d cm %%s\\n\"  ns/line\n");
+    printf("  usnprintf   %6.1f\n  usnprintfc  %6.1f\n  snprintf    %6.1f\n",
+           1e9*t[0]/reps, 1e9*t[1]/reps, 1e9*t[2]/reps);
+  }
+  return Errors ? 1 : 0;
+}
@@ -0,0 +1,267 @@
+// ProfileTest.c
+// Runs on a PC, not on the LaunchPad
+// Runs the interrupt and task profiler in utils/cpu_usage.c, built
+// with HEADLESS defined, against a model cycle counter and active
+// exception number, and checks that
+//   each source is charged exactly its own cycles, however its
+//     runs are nested inside and around each other (random
+//     nestings checked against a simple reference)
+//   run counts, longest run, latency and nesting are right
+//   sources beyond the table share the "other" entry and nesting
+//     deeper than the stack is charged to the frame on top
+//   the scheduler's task hooks give each task its own entry
+// and prints the report, formatted by ustdlib as UARTprintf would,
+// and the host time of an enter/exit pair.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I.. -o ProfileTest ProfileTest.c ../utils/cpu_usage.c ../utils/scheduler.c ../utils/ustdlib.c
+// usage: ProfileTest
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "utils/cpu_usage.h"
+#include "utils/scheduler.h"
+#include "utils/ustdlib.h"
+
+#define CLOCK 80000000
+
+// driverlib calls made by CPUUsageInit(), CPUUsageTick() and
+// SchedulerInit(); only the profiler is tested here
+static bool Masked;
+bool IntMasterDisable(void){ bool was = Masked; Masked = true; return was; }
+bool IntMasterEnable(void){ bool was = Masked; Masked = false; return was; }
+uint32_t TimerValueGet(uint32_t ui32Base, uint32_t ui32Timer){ (void)ui32Base; (void)ui32Timer; return 0; }
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config){ (void)ui32Base; (void)ui32Config; }
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value){ (void)ui32Base; (void)ui32Timer; (void)ui32Value; }
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer){ (void)ui32Base; (void)ui32Timer; }
+void SysCtlPeripheralClockGating(bool bEnable){ (void)bEnable; }
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral){ (void)ui32Peripheral; }
+void SysCtlPeripheralSleepDisable(uint32_t ui32Peripheral){ (void)ui32Peripheral; }
+uint32_t SysCtlClockGet(void){ return CLOCK; }
+void SysTickPeriodSet(uint32_t ui32Period){ (void)ui32Period; }
+void SysTickEnable(void){}
+void SysTickIntEnable(void){}
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+//---------------------processor model---------------------
+static uint32_t Cycles;                // wraps, as the DWT counter does
+static uint32_t Vector;                // active exception, 0 in thread mode
+uint32_t CPUUsageModelCycles(void){ return Cycles; }
+uint32_t CPUUsageModelVector(void){ return Vector; }
+uint32_t SchedulerModelCycles(void){ return Cycles; }
+
+// UARTprintf's formatting, on stdout
+static void Print(const char *pcString, ...){
+  char buf[128];
+  va_list vaArgP;
+  va_start(vaArgP, pcString);
+  uvsnprintf(buf, sizeof(buf), pcString, vaArgP);
+  va_end(vaArgP);
+  fputs(buf, stdout);
+}
+
+static uint32_t Seed = 5;
+static uint32_t Random(void){
+  Seed = Seed*1664525 + 1013904223;
+  return Seed>>8;
+}
+
+static const tCPUUsageProfile *Find(uint32_t source){
+  uint32_t i;
+  for(i = 0; i < CPUUsageProfileCount(); i++){
+    if(CPUUsageProfileGet(i)->ui16Source == source) return CPUUsageProfileGet(i);
+  }
+  return 0;
+}
+
+//---------------------a fixed nesting---------------------
+static void Fixed(void){
+  const tCPUUsageProfile *p;
+  Cycles = 0xFFFFF000;                 // the counter wraps during the test
+  CPUUsageProfileInit(CLOCK);
+  Cycles += 1000;                      // thread
+  CPUUsageTaskEnter(3);
+  Cycles += 200;                       // task 3
+  Vector = 39;  CPUUsageISREnter();    // Timer2A preempts it
+  CPUUsageISRLatency(45);
+  Cycles += 300;
+  Vector = 15;  CPUUsageISREnter();    // SysTick preempts Timer2A
+  Cycles += 50;
+  CPUUsageISRExit(); Vector = 39;
+  Cycles += 20;
+  CPUUsageISRExit(); Vector = 0;
+  Cycles += 100;                       // task 3 again
+  CPUUsageTaskExit(3);
+  Cycles += 7;                         // thread
+  Vector = 39;  CPUUsageISREnter();
+  CPUUsageISRLatency(30);
+  Cycles += 250;
+  CPUUsageISRExit(); Vector = 0;
+  Cycles += 3;
+  Print("fixed nesting:\n");
+  CPUUsageProfileReport(Print);        // charges the last 3 cycles
+
+  CHECK((p = Find(0)) && p->ui64Cycles == 1010, "thread %llu", p ? (unsigned long long)p->ui64Cycles : 0);
+  CHECK((p = Find(CPU_USAGE_SOURCE_TASK | 3)) && p->ui64Cycles == 300 &&
+        p->ui32Count == 1 && p->ui32MaxCycles == 300 && p->ui8MaxNesting == 0, "task 3");
+  CHECK((p = Find(39)) && p->ui64Cycles == 570 && p->ui32Count == 2 &&
+        p->ui32MaxCycles == 320 && p->ui32MaxLatency == 45 && p->ui8MaxNesting == 1, "Timer2A");
+  CHECK((p = Find(15)) && p->ui64Cycles == 50 && p->ui32Count == 1 &&
+        p->ui8MaxNesting == 2, "SysTick");
+}
+
+//---------------------random nestings---------------------
+#define SOURCES 20                     // more than the table holds
+static uint64_t Expect[SOURCES+1];     // [0] is thread mode
+static void Nest(int depth){
+  // runs one source at this depth, with random nested sources inside
+  uint32_t me = 1 + Random()%SOURCES, saved = Vector, n;
+  bool isr = me <= 12;                 // 1-12 are vectors 16-27, the rest tasks
+  if(isr){ Vector = 15 + me; CPUUsageISREnter(); }
+  else if(me == SOURCES) CPUUsageTaskEnter(1000); // past CPU_USAGE_PROFILE_TASKS
+  else CPUUsageTaskEnter(me);
+  for(n = Random()%4; n > 0; n--){
+    uint32_t c = Random()%1000;
+    Cycles += c;
+    Expect[me] += c;
+    if(depth < 14 && Random()%3 == 0) Nest(depth + 1);
+  }
+  if(isr){ CPUUsageISRExit(); Vector = saved; }
+  else CPUUsageTaskExit(me);
+}
+
+static void Randomized(void){
+  uint32_t i, me;
+  uint64_t total = 0, sum = 0;
+  const tCPUUsageProfile *p;
+  memset(Expect, 0, sizeof(Expect));
+  CPUUsageProfileInit(CLOCK);
+  for(i = 0; i < 20000; i++){
+    uint32_t c = Random()%500;
+    Cycles += c;
+    Expect[0] += c;
+    Nest(0);
+  }
+  // the first 14 sources get entries 1-14, the rest share entry 15;
+  // nesting past depth 9 is charged to the frame on top, so compare
+  // the totals, which every frame adds to, and each ISR's share
+  for(i = 0; i < CPUUsageProfileCount(); i++){
+    p = CPUUsageProfileGet(i);
+    sum += p->ui64Cycles;
+  }
+  for(me = 0; me <= SOURCES; me++) total += Expect[me];
+  CHECK(sum == total, "profile adds up to %llu, expected %llu",
+        (unsigned long long)sum, (unsigned long long)total);
+  CHECK(CPUUsageProfileCount() == CPU_USAGE_PROFILE_ENTRIES, "%u entries", CPUUsageProfileCount());
+  CHECK(Find(0xFFFF) != 0, "no shared entry");
+}
+
+// the same without the depth limit or the table filling, so every
+// source's own time can be checked exactly
+static void NestShallow(int depth){
+  uint32_t me = 1 + Random()%12, saved = Vector, n;
+  Vector = 15 + me; CPUUsageISREnter();
+  for(n = Random()%4; n > 0; n--){
+    uint32_t c = Random()%1000;
+    Cycles += c;
+    Expect[me] += c;
+    if(depth < 8 && Random()%3 == 0) NestShallow(depth + 1);
+  }
+  CPUUsageISRExit(); Vector = saved;
+}
+
+static void Exact(void){
+  uint32_t i, me;
+  const tCPUUsageProfile *p;
+  memset(Expect, 0, sizeof(Expect));
+  CPUUsageProfileInit(CLOCK);
+  for(i = 0; i < 20000; i++){
+    uint32_t c = Random()%500;
+    Cycles += c;
+    Expect[0] += c;
+    NestShallow(0);
+  }
+  CHECK((p = Find(0)) && p->ui64Cycles == Expect[0], "thread");
+  for(me = 1; me <= 12; me++){
+    p = Find(15 + me);
+    CHECK(p && p->ui64Cycles == Expect[me], "vector %u: %llu expected %llu", 15 + me,
+          p ? (unsigned long long)p->ui64Cycles : 0, (unsigned long long)Expect[me]);
+  }
+}
+
+//---------------------scheduler hooks---------------------
+static uint32_t TaskCost[3] = {100, 2000, 40};
+static void Task(void *pvParam){
+  uint32_t i = (uint32_t)(uintptr_t)pvParam;
+  Cycles += TaskCost[i];
+  if(i == 1){                          // SysTick lands in task 1
+    Vector = 15;
+    SchedulerSysTickIntHandler();      // profiled only with CPU_USAGE_PROFILE
+    CPUUsageISREnter();
+    Cycles += 60;
+    CPUUsageISRExit();
+    Vector = 0;
+  }
+}
+tSchedulerTask g_psSchedulerTable[3] = {
+  {Task, (void *)0, 0, 0, true},
+  {Task, (void *)1, 0, 0, true},
+  {Task, (void *)2, 0, 0, true},
+};
+uint32_t g_ui32SchedulerNumTasks = 3;
+
+static void Hooks(void){
+  const tCPUUsageProfile *p;
+  uint32_t i;
+  SchedulerInit(100);
+  SchedulerTaskHookSet(CPUUsageTaskEnter, CPUUsageTaskExit);
+  CPUUsageProfileInit(CLOCK);
+  for(i = 0; i < 1000; i++){
+    SchedulerRun();
+    Cycles += 500;
+  }
+  for(i = 0; i < 3; i++){
+    p = Find(CPU_USAGE_SOURCE_TASK | i);
+    CHECK(p && p->ui32Count == 1000 && p->ui64Cycles == 1000ull*TaskCost[i],
+          "task %u: %u runs %llu cycles", i, p ? p->ui32Count : 0,
+          p ? (unsigned long long)p->ui64Cycles : 0);
+  }
+  CHECK((p = Find(15)) && p->ui64Cycles == 60000 && p->ui8MaxNesting == 1, "SysTick in task 1");
+  Print("scheduler tasks, 1000 passes:\n");
+  CPUUsageProfileReport(Print);
+}
+
+static double Now(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+int main(void){
+  uint32_t i, n = 10000000;
+  double t;
+  Fixed();
+  Randomized();
+  Exact();
+  Hooks();
+  CPUUsageProfileInit(CLOCK);
+  Vector = 39;
+  t = Now();
+  for(i = 0; i < n; i++){
+    CPUUsageISREnter();
+    Cycles += 100;
+    CPUUsageISRExit();
+  }
+  t = Now() - t;
+  printf("host time of an enter/exit pair: %.1f ns\n", 1e9*t/n);
+  printf("%lu errors\n", Errors);
+  return Errors != 0;
+}
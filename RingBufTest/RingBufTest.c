@@ -0,0 +1,290 @@
+// RingBufTest.c
+// Runs on a PC, not on the LaunchPad
+// Checks the single-producer/single-consumer ring buffer in
+// utils/ringbuf.c and times it against the original one
+//   single thread: every call is checked against a simple model,
+//     including RingBufSPSCContigUsed/ContigFree at every wrap
+//   two threads: a producer and a consumer run flat out, each
+//     picking Write, WriteOne or Reserve/Commit (Read, ReadOne or
+//     Peek/Consume) at random, and the consumer checks that the
+//     bytes come out in order with none lost or repeated; a side
+//     that finds the ring full (empty) yields, so this also runs
+//     on one core
+//   benchmark: bytes per second through RingBufWrite/RingBufRead
+//     and RingBufSPSCWrite/RingBufSPSCRead for several block sizes,
+//     and through the WriteOne/ReadOne calls
+//
+// build (from this folder):
+//   gcc -O2 -pthread -I.. -o RingBufTest RingBufTest.c ../utils/ringbuf.c
+// usage: RingBufTest [-n megabytes]   (default 64, for the two thread test)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "utils/ringbuf.h"
+
+// the original ring buffer disables interrupts around its index
+// updates; on the PC that is a no-op
+bool IntMasterDisable(void){ return false; }
+bool IntMasterEnable(void){ return false; }
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+static uint32_t Seed = 12345;
+static uint32_t Random(uint32_t *s){
+  *s = *s*1664525 + 1013904223;
+  return *s>>8;
+}
+
+//---------------------single thread, against a model---------------------
+static void Model(void){
+  static uint8_t Buf[64], Data[200], Got[200];
+  tRingBufSPSC rb;
+  uint32_t w = 0, r = 0;               // model: bytes written and read so far
+  uint32_t size = sizeof(Buf), i, n, k, expect;
+  uint8_t *p;
+  RingBufSPSCInit(&rb, Buf, size);
+  for(i = 0; i < 200000; i++){
+    uint32_t used = w - r;
+    CHECK(RingBufSPSCUsed(&rb) == used, "used %u want %u", RingBufSPSCUsed(&rb), used);
+    CHECK(RingBufSPSCFree(&rb) == size-used, "free");
+    expect = size - (r%size);
+    if(expect > used) expect = used;
+    CHECK(RingBufSPSCContigUsed(&rb) == expect, "contig used %u want %u",
+          RingBufSPSCContigUsed(&rb), expect);
+    expect = size - (w%size);
+    if(expect > size-used) expect = size-used;
+    CHECK(RingBufSPSCContigFree(&rb) == expect, "contig free %u want %u",
+          RingBufSPSCContigFree(&rb), expect);
+    n = Random(&Seed)%(size+8);
+    switch(Random(&Seed)%7){
+      case 0:                          // bulk write
+        for(k = 0; k < n; k++) Data[k] = (uint8_t)(w+k);
+        k = RingBufSPSCWrite(&rb, Data, n);
+        CHECK(k == (n < size-used ? n : size-used), "write %u of %u", k, n);
+        w += k;
+        break;
+      case 1:                          // bulk read
+        k = RingBufSPSCRead(&rb, Got, n);
+        CHECK(k == (n < used ? n : used), "read %u of %u", k, n);
+        for(n = 0; n < k; n++) CHECK(Got[n] == (uint8_t)(r+n), "read data");
+        r += k;
+        break;
+      case 2:                          // one byte each way
+        CHECK(RingBufSPSCWriteOne(&rb, (uint8_t)w) == (used < size), "write one");
+        if(used < size) w++;
+        if(RingBufSPSCReadOne(&rb, Got)){
+          CHECK(Got[0] == (uint8_t)r, "read one data");
+          r++;
+        }else{
+          CHECK(w == r, "read one on non-empty");
+        }
+        break;
+      case 3:                          // reserve/commit
+        k = RingBufSPSCReserve(&rb, &p);
+        CHECK(p == &Buf[w%size], "reserve pointer");
+        if(n > k) n = k;
+        for(k = 0; k < n; k++) p[k] = (uint8_t)(w+k);
+        RingBufSPSCCommit(&rb, n);
+        w += n;
+        break;
+      case 4:                          // peek/consume
+        k = RingBufSPSCPeek(&rb, &p);
+        CHECK(p == &Buf[r%size], "peek pointer");
+        if(n > k) n = k;
+        for(k = 0; k < n; k++) CHECK(p[k] == (uint8_t)(r+k), "peek data");
+        RingBufSPSCConsume(&rb, n);
+        r += n;
+        break;
+      case 5:                          // consume more than is there
+        RingBufSPSCConsume(&rb, used+1+n);
+        r = w;
+        break;
+      default:
+        if(n == 0){
+          RingBufSPSCFlush(&rb);
+          r = w;
+        }
+        break;
+    }
+  }
+  // indices wrap past 2^32 without losing track
+  rb.ui32WriteIndex = rb.ui32ReadIndex = 0xFFFFFFF0;
+  w = r = 0xFFFFFFF0;
+  for(k = 0; k < 40; k++) Data[k] = (uint8_t)k;
+  CHECK(RingBufSPSCWrite(&rb, Data, 40) == 40, "write across 2^32");
+  CHECK(RingBufSPSCUsed(&rb) == 40, "used across 2^32");
+  CHECK(RingBufSPSCRead(&rb, Got, 64) == 40 && memcmp(Got, Data, 40) == 0,
+        "read across 2^32");
+  // the full size is usable
+  memset(Data, 0x5A, size);
+  CHECK(RingBufSPSCWrite(&rb, Data, size+1) == size, "fill");
+  CHECK(RingBufSPSCFree(&rb) == 0 && RingBufSPSCContigFree(&rb) == 0, "full");
+  CHECK(!RingBufSPSCWriteOne(&rb, 0), "write one when full");
+  printf("single thread model: %lu errors\n", Errors);
+}
+
+//---------------------two threads---------------------
+static tRingBufSPSC Shared;
+static uint8_t SharedBuf[256];
+static uint32_t Total;
+
+static void *Producer(void *arg){
+  uint32_t s = 777, sent = 0, n, k;
+  uint8_t data[100], *p;
+  (void)arg;
+  while(sent < Total){
+    if(RingBufSPSCFree(&Shared) == 0) sched_yield();
+    n = 1 + Random(&s)%sizeof(data);
+    if(n > Total-sent) n = Total-sent;
+    switch(Random(&s)%3){
+      case 0:
+        for(k = 0; k < n; k++) data[k] = (uint8_t)(sent+k);
+        sent += RingBufSPSCWrite(&Shared, data, n);
+        break;
+      case 1:
+        if(RingBufSPSCWriteOne(&Shared, (uint8_t)sent)) sent++;
+        break;
+      default:
+        k = RingBufSPSCReserve(&Shared, &p);
+        if(n > k) n = k;
+        for(k = 0; k < n; k++) p[k] = (uint8_t)(sent+k);
+        RingBufSPSCCommit(&Shared, n);
+        sent += n;
+        break;
+    }
+  }
+  return 0;
+}
+
+static void *Consumer(void *arg){
+  uint32_t s = 999, got = 0, n, k;
+  uint8_t data[100], *p;
+  unsigned long bad = 0;
+  (void)arg;
+  while(got < Total){
+    if(RingBufSPSCUsed(&Shared) == 0) sched_yield();
+    n = 1 + Random(&s)%sizeof(data);
+    switch(Random(&s)%3){
+      case 0:
+        n = RingBufSPSCRead(&Shared, data, n);
+        for(k = 0; k < n; k++) if(data[k] != (uint8_t)(got+k)) bad++;
+        got += n;
+        break;
+      case 1:
+        if(RingBufSPSCReadOne(&Shared, data)){
+          if(data[0] != (uint8_t)got) bad++;
+          got++;
+        }
+        break;
+      default:
+        k = RingBufSPSCPeek(&Shared, &p);
+        if(n > k) n = k;
+        for(k = 0; k < n; k++) if(p[k] != (uint8_t)(got+k)) bad++;
+        RingBufSPSCConsume(&Shared, n);
+        got += n;
+        break;
+    }
+  }
+  return (void *)bad;
+}
+
+static double Now(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+static void Threads(uint32_t megabytes){
+  pthread_t prod, cons;
+  void *bad;
+  double t;
+  Total = megabytes<<20;
+  RingBufSPSCInit(&Shared, SharedBuf, sizeof(SharedBuf));
+  t = Now();
+  pthread_create(&cons, 0, Consumer, 0);
+  pthread_create(&prod, 0, Producer, 0);
+  pthread_join(prod, 0);
+  pthread_join(cons, &bad);
+  t = Now()-t;
+  CHECK(bad == 0, "%lu bytes out of order", (unsigned long)bad);
+  CHECK(RingBufSPSCUsed(&Shared) == 0, "bytes left over");
+  printf("two threads: %u MB through a %u byte ring in %.2f s, %lu bad bytes\n",
+         megabytes, (unsigned)sizeof(SharedBuf), t, (unsigned long)bad);
+}
+
+//---------------------benchmark---------------------
+#define BENCH (64u<<20)
+static void Bench(void){
+  static uint8_t buf[1024], data[256];
+  uint32_t blocks[] = {1, 4, 16, 64, 256}, i, n, sent;
+  tRingBufObject old;
+  tRingBufSPSC spsc;
+  double t, best, bestSPSC;
+  int run;
+  printf("benchmark, 1024 byte ring, MB/s, best of 3:\n");
+  printf("  block   RingBuf   RingBufSPSC\n");
+  for(i = 0; i < sizeof(blocks)/sizeof(blocks[0]); i++){
+    n = blocks[i];
+    best = bestSPSC = 1e9;
+    for(run = 0; run < 3; run++){
+      RingBufInit(&old, buf, sizeof(buf));
+      t = Now();
+      for(sent = 0; sent < BENCH; sent += n){
+        RingBufWrite(&old, data, n);
+        RingBufRead(&old, data, n);
+      }
+      t = Now()-t;
+      if(t < best) best = t;
+      RingBufSPSCInit(&spsc, buf, sizeof(buf));
+      t = Now();
+      for(sent = 0; sent < BENCH; sent += n){
+        RingBufSPSCWrite(&spsc, data, n);
+        RingBufSPSCRead(&spsc, data, n);
+      }
+      t = Now()-t;
+      if(t < bestSPSC) bestSPSC = t;
+    }
+    printf("  %5u  %8.0f  %12.0f\n", n, BENCH/1048576.0/best,
+           BENCH/1048576.0/bestSPSC);
+  }
+  best = bestSPSC = 1e9;
+  for(run = 0; run < 3; run++){
+    RingBufInit(&old, buf, sizeof(buf));
+    t = Now();
+    for(sent = 0; sent < BENCH; sent++){
+      RingBufWriteOne(&old, (uint8_t)sent);
+      data[0] = RingBufReadOne(&old);
+    }
+    t = Now()-t;
+    if(t < best) best = t;
+    RingBufSPSCInit(&spsc, buf, sizeof(buf));
+    t = Now();
+    for(sent = 0; sent < BENCH; sent++){
+      RingBufSPSCWriteOne(&spsc, (uint8_t)sent);
+      RingBufSPSCReadOne(&spsc, data);
+    }
+    t = Now()-t;
+    if(t < bestSPSC) bestSPSC = t;
+  }
+  printf("    one  %8.0f  %12.0f   (WriteOne/ReadOne)\n", BENCH/1048576.0/best,
+         BENCH/1048576.0/bestSPSC);
+}
+
+int main(int argc, char **argv){
+  uint32_t megabytes = 64;
+  setvbuf(stdout, 0, _IONBF, 0);
+  if(argc == 3 && strcmp(argv[1], "-n") == 0) megabytes = atoi(argv[2]);
+  Model();
+  Threads(megabytes);
+  Bench();
+  printf("%lu errors\n", Errors);
+  return Errors != 0;
+}
@@ -0,0 +1,277 @@
+// SchedulerSim.c
+// Runs on a PC, not on the LaunchPad
+// Runs utils/scheduler.c, built with HEADLESS defined, on a model
+// of an 80 MHz processor with a 100 Hz SysTick.
+// With 1000 tasks, periods of 1 to 1000 ticks and random
+// priorities, it checks that the queued scheduler
+//   calls each task once per period
+//   calls the tasks due in the same pass in order of priority
+//   stops calling disabled tasks and starts again when enabled
+//   keeps each task's call count and execution time
+//   sleeps through the idle hook until the next task is due
+// and, with a task that holds the processor for 55 ticks, that
+//   a SCHEDULER_LATE_CATCH_UP task makes up every missed call
+//   a SCHEDULER_LATE_SKIP task drops them and keeps its phase
+//   every call that runs past its deadline is counted
+// Task functions only move the model clock, so the host time
+// spent in SchedulerRun() is mostly the scheduler's own dispatch
+// overhead.  It prints that overhead for the table scan and for
+// the queued scheduler.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -DSCHEDULER_MAX_TASKS=1024 -I.. -o SchedulerSim SchedulerSim.c ../utils/scheduler.c
+// usage: SchedulerSim [-t ticks]   (default 20000 simulated ticks)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "utils/scheduler.h"
+
+#define TASKS     1000
+#define CLOCK     80000000
+#define RATE      100
+#define TICK      (CLOCK/RATE)         // cycles per tick
+#define TOGGLED   100                  // tasks 0-99 are disabled for a while
+// the late policy run
+#define SLOW      0                    // holds the processor 55 ticks, once
+#define CATCHUP   1                    // 10 tick period, makes up calls
+#define SKIPPER   2                    // 10 tick period, skips calls
+#define LATE      3                    // always runs past its deadline
+
+tSchedulerTask g_psSchedulerTable[TASKS];
+uint32_t g_ui32SchedulerNumTasks;
+
+// driverlib calls made by SchedulerInit()
+uint32_t SysCtlClockGet(void){ return CLOCK; }
+void SysTickPeriodSet(uint32_t ui32Period){ (void)ui32Period; }
+void SysTickEnable(void){}
+void SysTickIntEnable(void){}
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+//---------------------processor model---------------------
+static uint64_t Cycles;                // model time
+static uint64_t NextTick = TICK;       // cycle count of the next SysTick
+static uint64_t Stamp;                 // what SchedulerModelCycles() reads
+uint32_t SchedulerModelCycles(void){ return (uint32_t)Stamp; }
+
+// let n cycles go by, taking SysTick interrupts on the way
+static void Run(uint64_t n){
+  Cycles += n;
+  while(Cycles >= NextTick){
+    Stamp = NextTick;
+    SchedulerSysTickIntHandler();
+    NextTick += TICK;
+  }
+  Stamp = Cycles;
+}
+
+//---------------------tasks---------------------
+static uint32_t Cost[TASKS];           // cycles each call takes
+static uint32_t Calls[TASKS];
+static uint32_t Seed;
+static uint32_t Random(void){
+  Seed = Seed*1664525 + 1013904223;
+  return Seed>>8;
+}
+static uint32_t Pass, LastPass, LastPriority;
+static bool Disabled;                  // tasks 0-99 are disabled
+static unsigned long DisabledCalls, OrderErrors, PassCalls;
+
+static void Task(void *pvParam){
+  uint32_t i = (uint32_t)(uintptr_t)pvParam;
+  uint32_t pri = g_psSchedulerTable[i].ui8Priority;
+  if(Pass == LastPass && pri < LastPriority) OrderErrors++;
+  LastPass = Pass;
+  LastPriority = pri;
+  if(Disabled && i < TOGGLED) DisabledCalls++;
+  Calls[i]++;
+  PassCalls++;
+  Run(Cost[i] + Random()%64);
+}
+
+static unsigned long Missed;
+static void Deadline(uint32_t ui32Index){ (void)ui32Index; Missed++; }
+
+static unsigned long Sleeps;
+static void Idle(uint32_t ui32Ticks){
+  // sleep to the tick at which the next task is due
+  Sleeps++;
+  Run(NextTick - Cycles + (uint64_t)(ui32Ticks - 1)*TICK);
+}
+
+static void Setup(uint32_t tasks){
+  uint32_t i;
+  memset(g_psSchedulerTable, 0, sizeof(g_psSchedulerTable));
+  g_ui32SchedulerNumTasks = tasks;
+  Seed = 1;
+  for(i = 0; i < tasks; i++){
+    g_psSchedulerTable[i].pfnFunction = Task;
+    g_psSchedulerTable[i].pvParam = (void *)(uintptr_t)i;
+    g_psSchedulerTable[i].ui32FrequencyTicks = 1 + Random()%1000;
+    g_psSchedulerTable[i].ui8Priority = Random()%8;
+    Cost[i] = 200 + Random()%2000;
+    Calls[i] = 0;
+  }
+}
+
+static void Start(void){
+  uint32_t i;
+  SchedulerInit(RATE);
+  for(i = 0; i < g_ui32SchedulerNumTasks; i++){
+    SchedulerTaskEnable(i, false);
+  }
+}
+
+
+static double Now(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+// run for the given number of ticks, toggling tasks 0-99 off for
+// the middle fifth if asked; returns host seconds in SchedulerRun()
+static double Simulate(uint32_t ticks, bool queued, bool toggle,
+                       unsigned long *passes){
+  uint32_t start = SchedulerTickCountGet(), i, now;
+  double host = 0, t;
+  *passes = 0;
+  while((now = SchedulerTickCountGet() - start) < ticks){
+    if(toggle && !Disabled && now >= 2*ticks/5 && now < 3*ticks/5){
+      Disabled = true;
+      for(i = 0; i < TOGGLED; i++) SchedulerTaskDisable(i);
+    }else if(toggle && Disabled && now >= 3*ticks/5){
+      Disabled = false;
+      for(i = 0; i < TOGGLED; i++) SchedulerTaskEnable(i, true);
+    }
+    Pass++;
+    PassCalls = 0;
+    t = Now();
+    SchedulerRun();
+    host += Now() - t;
+    (*passes)++;
+    if(!queued && PassCalls == 0){
+      Run(NextTick - Cycles);          // the main loop sleeps to the next tick
+    }
+  }
+  return host;
+}
+
+// host seconds one Task() call takes, to take out of the timings
+static double TaskTime(void){
+  uint32_t i, n = 1000000;
+  double t = Now();
+  for(i = 0; i < n; i++) Task((void *)(uintptr_t)(TOGGLED + i%64));
+  t = Now() - t;
+  memset(Calls, 0, sizeof(Calls));
+  return t/n;
+}
+
+static void Many(uint32_t ticks){
+  unsigned long passes, calls, scanCalls, scanPasses;
+  uint32_t i, expect, off = ticks/5;
+  double host, scan, body;
+  tSchedulerStats *s;
+
+  //----table scan, for comparison----
+  Setup(TASKS);
+  body = TaskTime();
+  Start();
+  scan = Simulate(ticks, false, true, &scanPasses);
+  for(scanCalls = 0, i = 0; i < TASKS; i++) scanCalls += Calls[i];
+
+  //----queued----
+  Setup(TASKS);
+  OrderErrors = 0;                     // the table scan ignores priority
+  Start();
+  SchedulerQueueInit();
+  SchedulerIdleHookSet(Idle);
+  host = Simulate(ticks, true, true, &passes);
+  for(calls = 0, i = 0; i < TASKS; i++){
+    uint32_t period = g_psSchedulerTable[i].ui32FrequencyTicks;
+    s = &g_psSchedulerTable[i].sStats;
+    calls += Calls[i];
+    CHECK(s->ui32Calls == Calls[i], "task %u stats count %u calls %u", i, s->ui32Calls, Calls[i]);
+    CHECK(s->ui32Misses == 0, "task %u has no deadline", i);
+    expect = ticks/period;
+    if(i < TOGGLED){
+      CHECK(Calls[i] + off/period + 2 >= expect && Calls[i] <= expect + 1,
+            "toggled task %u period %u: %u calls, expected about %u less %u",
+            i, period, Calls[i], expect, off/period);
+    }else{
+      CHECK(Calls[i] + 1 >= expect && Calls[i] <= expect,
+            "task %u period %u: %u calls, expected %u", i, period, Calls[i], expect);
+    }
+    if(Calls[i]){
+      CHECK(s->ui32MinCycles >= Cost[i] && s->ui32MaxCycles < Cost[i] + 64,
+            "task %u cycles %u-%u cost %u", i, s->ui32MinCycles, s->ui32MaxCycles, Cost[i]);
+      CHECK(s->ui32MaxLatency < TICK/4, "task %u latency %u", i, s->ui32MaxLatency);
+    }
+  }
+  CHECK(DisabledCalls == 0, "%lu calls to disabled tasks", DisabledCalls);
+  CHECK(OrderErrors == 0, "%lu calls out of priority order", OrderErrors);
+
+  printf("%u tasks, %u ticks of %u cycles\n", TASKS, ticks, TICK);
+  // take out the task bodies; what is left is dispatch overhead
+  scan -= scanCalls*body;
+  host -= calls*body;
+  printf("  dispatch overhead, task bodies (%.0f ns each) taken out:\n", 1e9*body);
+  printf("  table scan: %lu calls in %lu passes, %.2f us per tick, %.0f ns per call\n",
+         scanCalls, scanPasses, 1e6*scan/ticks, 1e9*scan/scanCalls);
+  printf("  queued:     %lu calls in %lu passes, %.2f us per tick, %.0f ns per call\n",
+         calls, passes, 1e6*host/ticks, 1e9*host/calls);
+  printf("  queued: %lu idle sleeps\n", Sleeps);
+  s = &g_psSchedulerTable[TOGGLED].sStats;
+  printf("  task %u: %u calls, %u-%u cycles, mean %llu, start jitter %u cycles\n",
+         TOGGLED, s->ui32Calls, s->ui32MinCycles, s->ui32MaxCycles,
+         (unsigned long long)(s->ui64TotalCycles/s->ui32Calls),
+         s->ui32MaxLatency - s->ui32MinLatency);
+}
+
+static void Policies(uint32_t ticks){
+  unsigned long passes;
+  Setup(4);
+  g_psSchedulerTable[SLOW].ui32FrequencyTicks = ticks/2;
+  Cost[SLOW] = 55*TICK;
+  g_psSchedulerTable[CATCHUP].ui32FrequencyTicks = 10;
+  g_psSchedulerTable[CATCHUP].ui8Flags = SCHEDULER_LATE_CATCH_UP;
+  g_psSchedulerTable[SKIPPER].ui32FrequencyTicks = 10;
+  g_psSchedulerTable[LATE].ui32FrequencyTicks = 7;
+  g_psSchedulerTable[LATE].ui32DeadlineTicks = 1;
+  Cost[LATE] = TICK + TICK/2;
+  Start();
+  SchedulerQueueInit();
+  SchedulerIdleHookSet(Idle);
+  SchedulerDeadlineHookSet(Deadline);
+  Simulate(ticks, true, false, &passes);
+  CHECK(Calls[SLOW] == 1, "slow task called %u times", Calls[SLOW]);
+  // the pass at the last tick is not run
+  CHECK(Calls[CATCHUP] == (ticks-1)/10, "catch-up task %u calls, expected %u",
+        Calls[CATCHUP], (ticks-1)/10);
+  CHECK(Calls[SKIPPER] + 4 <= (ticks-1)/10 && Calls[SKIPPER] + 6 >= (ticks-1)/10,
+        "skipping task %u calls, expected 4 to 6 fewer than %u", Calls[SKIPPER], (ticks-1)/10);
+  CHECK(g_psSchedulerTable[LATE].sStats.ui32Misses == Calls[LATE] && Calls[LATE],
+        "late task missed %u of %u", g_psSchedulerTable[LATE].sStats.ui32Misses, Calls[LATE]);
+  CHECK(g_psSchedulerTable[CATCHUP].sStats.ui32Misses == 0, "catch-up task has no deadline");
+  CHECK(Missed == Calls[LATE], "deadline hook %lu times, %u late calls", Missed, Calls[LATE]);
+  CHECK(g_psSchedulerTable[SKIPPER].sStats.ui32MaxLatency > 50u*TICK,
+        "skipping task max latency %u", g_psSchedulerTable[SKIPPER].sStats.ui32MaxLatency);
+  printf("late policies over %u ticks, one 55 tick stall:\n", ticks);
+  printf("  catch-up %u calls, skip %u calls, %lu missed deadlines of %u late calls\n",
+         Calls[CATCHUP], Calls[SKIPPER], Missed, Calls[LATE]);
+}
+
+int main(int argc, char **argv){
+  uint32_t ticks = 20000;
+  if(argc == 3 && strcmp(argv[1], "-t") == 0) ticks = atoi(argv[2]);
+  Many(ticks);
+  Policies(ticks);
+  printf("%lu errors\n", Errors);
+  return Errors != 0;
+}
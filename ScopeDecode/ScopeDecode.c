@@ -0,0 +1,204 @@
+// ScopeDecode.c
+// Runs on a PC, not on the LaunchPad
+// Decoder and recorder for the framed scope protocol sent by
+// TExaS_ScopeFramed() in TExaSscope.c (frame format in
+// TExaSscope.h).  Reads the bytes captured from the serial port,
+// finds frames by their sync bytes and CRC, undoes the delta and
+// run length coding, and writes one line per sample.  Sequence
+// numbers show where frames were lost, whether the board
+// dropped them or they were damaged on the way.
+//
+// build (from this folder):
+//   gcc -O2 -I.. -o ScopeDecode ScopeDecode.c ../driverlib/sw_crc.c
+// usage: ScopeDecode [options] capture.bin
+//   -o file   write "sample,adc,logic" lines to file
+//   -b baud   baud rate of the capture, to report samples/second
+//   -e file   compare with "sample,adc,logic" lines (from ScopeTest),
+//             every decoded sample must match its line
+// Capture on Linux with, for example
+//   stty -F /dev/ttyACM0 1000000 raw && cat /dev/ttyACM0 > capture.bin
+// seq is 16 bits, so a run of 65536 or more lost frames in a row
+// (3.5 minutes at 10 kHz) can't be told from a shorter one; the
+// report says so when a gap is that close to the limit.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../TExaSscope.h"
+#include "driverlib/sw_crc.h"
+
+unsigned char *Data;
+long Size;
+unsigned char Adc[256], Logic[256];
+unsigned char *ExpAdc, *ExpLogic;
+long ExpCount;
+
+// Undo the coding of one frame's payload
+// Output: 1 if the payload is consistent with the header
+int Decode(unsigned char flags, int n, const unsigned char *p, int len){
+  int i, j = 0, d;
+  unsigned char v;
+  if(flags&SCOPE_DELTA){
+    v = p[0];
+    Adc[0] = v;
+    for(i=1; i<n; i=i+1){
+      d = (i&1) ? (p[1+(i-1)/2]>>4) : (p[1+(i-1)/2]&0x0F);
+      if(d > 7){
+        d = d - 16;                 // 4-bit signed
+      }
+      v = v + d;
+      Adc[i] = v;
+    }
+    j = 1 + n/2;
+  } else{
+    for(i=0; i<n; i=i+1){
+      Adc[i] = p[i];
+    }
+    j = n;
+  }
+  if(flags&SCOPE_LOGIC){
+    if(flags&SCOPE_RLE){
+      for(i=0; i<n; j=j+2){
+        if((j+1 >= len) || (p[j] == 0) || (i+p[j] > n)){
+          return 0;
+        }
+        memset(&Logic[i], p[j+1], p[j]);
+        i = i + p[j];
+      }
+    } else{
+      memcpy(Logic, &p[j], n);
+      j = j + n;
+    }
+  } else{
+    memset(Logic, 0, n);
+  }
+  return j == len;
+}
+
+int main(int argc, char **argv){
+  FILE *f, *out = 0;
+  const char *input = 0, *expect = 0;
+  long i, k, frames = 0, bad = 0, lost = 0, samples = 0, payload = 0, junk = 0;
+  long frame = -1, sample, mismatch = 0, last = 0;
+  unsigned long baud = 0, s, a, l;
+  unsigned short seq = 0, now;
+  long longest = 0;
+  int n, len, arg;
+  for(arg=1; arg<argc; arg=arg+1){
+    if((argv[arg][0] == '-') && (arg+1 < argc)){
+      switch(argv[arg][1]){
+        case 'o': out = fopen(argv[arg+1], "w"); break;
+        case 'b': baud = strtoul(argv[arg+1], 0, 0); break;
+        case 'e': expect = argv[arg+1]; break;
+      }
+      arg = arg + 1;
+    } else{
+      input = argv[arg];
+    }
+  }
+  if(input == 0){
+    fprintf(stderr, "usage: ScopeDecode [-o samples.csv] [-b baud] [-e expected.csv] capture.bin\n");
+    return 2;
+  }
+  f = fopen(input, "rb");
+  if(f == NULL){
+    fprintf(stderr, "can't open %s\n", input);
+    return 2;
+  }
+  fseek(f, 0, SEEK_END);
+  Size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  Data = malloc(Size + 1);
+  if((Data == NULL) || (fread(Data, 1, Size, f) != (size_t)Size)){
+    fprintf(stderr, "can't read %s\n", input);
+    return 2;
+  }
+  fclose(f);
+  if(expect){
+    f = fopen(expect, "r");
+    if(f == NULL){
+      fprintf(stderr, "can't open %s\n", expect);
+      return 2;
+    }
+    while(fscanf(f, "%lu,%lu,%lu", &s, &a, &l) == 3){
+      if(s >= (unsigned long)ExpCount){
+        ExpCount = s + 1;
+        ExpAdc = realloc(ExpAdc, ExpCount);
+        ExpLogic = realloc(ExpLogic, ExpCount);
+      }
+      ExpAdc[s] = a;
+      ExpLogic[s] = l;
+    }
+    fclose(f);
+  }
+  i = 0;
+  while(i + SCOPEHEADER + 2 <= Size){
+    if((Data[i] != SCOPESYNC1) || (Data[i+1] != SCOPESYNC2)){
+      i = i + 1;
+      junk = junk + 1;
+      continue;
+    }
+    n = Data[i+5];
+    len = Data[i+6];
+    if((n == 0) || (i + SCOPEHEADER + len + 2 > Size) ||
+       (Crc16(0, &Data[i+2], len + 5) != (Data[i+SCOPEHEADER+len] | (Data[i+SCOPEHEADER+len+1]<<8))) ||
+       !Decode(Data[i+4], n, &Data[i+SCOPEHEADER], len)){
+      bad = bad + 1;                // not a frame, or a damaged one
+      i = i + 1;
+      continue;
+    }
+    now = Data[i+2] | (Data[i+3]<<8);
+    if(frame < 0){
+      frame = now;                  // frames before the first one seen were lost too
+      lost = frame;
+    } else{
+      k = (unsigned short)(now - seq);
+      if(k == 0){
+        k = 65536;
+      }
+      lost = lost + k - 1;
+      frame = frame + k;
+      if(k - 1 > longest){
+        longest = k - 1;
+      }
+    }
+    seq = now;
+    frames = frames + 1;
+    payload = payload + len;
+    for(k=0; k<n; k=k+1){
+      sample = frame*n + k;         // every frame has the same n
+      if(out){
+        fprintf(out, "%ld,%u,%u\n", sample, Adc[k], Logic[k]);
+      }
+      if(expect && ((sample >= ExpCount) || (ExpAdc[sample] != Adc[k]) || (ExpLogic[sample] != Logic[k]))){
+        if(mismatch == 0){
+          fprintf(stderr, "sample %ld is %u,%u, expected %d,%d\n", sample, Adc[k], Logic[k],
+                  (sample < ExpCount) ? ExpAdc[sample] : -1, (sample < ExpCount) ? ExpLogic[sample] : -1);
+        }
+        mismatch = mismatch + 1;
+      }
+    }
+    samples = samples + n;
+    last = (frame + 1)*n;
+    i = i + SCOPEHEADER + len + 2;
+  }
+  if(out){
+    fclose(out);
+  }
+  printf("%ld bytes, %ld frames, %ld lost, %ld damaged or false syncs, %ld bytes between frames\n",
+         Size, frames, lost, bad, junk);
+  printf("%ld of %ld samples, payload %ld bytes, %.2f bytes per sample on the wire\n",
+         samples, last, payload, samples ? (double)Size/samples : 0.0);
+  if(longest >= 32768){
+    printf("longest gap %ld frames: seq wraps at 65536, so it may have been 65536 longer\n", longest);
+  }
+  if(baud && Size){
+    printf("at this compression %lu baud carries %.0f samples/second\n", baud, samples*baud/(10.0*Size));
+  }
+  if(expect){
+    printf("%ld samples differ from %s\n", mismatch, expect);
+    return mismatch != 0;
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+// ScopeTest.c
+// Runs on a PC, not on the LaunchPad
+// Runs TExaSscope.c's framed mode, built with HEADLESS defined,
+// on a made-up signal and writes what the model UART puts on the
+// wire, so ScopeDecode can be checked without a board.  The ADC
+// is a slow sine with now and then a jump, the logic channel is
+// two square waves.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I.. -o ScopeTest ScopeTest.c ../TExaSscope.c ../driverlib/sw_crc.c -lm
+// usage: ScopeTest [options] wire.bin expected.csv
+//   -b baud     (default 115200)
+//   -p period   sample period, 12.5ns units (default 8000, 10 kHz)
+//   -n samples  (default 100000)
+//   -r          raw, no compression
+//   -l          no logic channel
+// then: ScopeDecode -b baud -e expected.csv wire.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "../TExaSscope.h"
+
+volatile unsigned long Port;      // stands in for a GPIO DATA register
+
+int main(int argc, char **argv){
+  unsigned long baud = 115200, period = 8000, frames, dropped, sent;
+  long samples = 100000, i, n, total = 0;
+  int compress = 1, logic = 1, arg;
+  const char *wire = 0, *expect = 0;
+  unsigned char bytes[64], adc;
+  FILE *w, *e;
+  for(arg=1; arg<argc; arg=arg+1){
+    if(argv[arg][0] == '-'){
+      switch(argv[arg][1]){
+        case 'b': baud = strtoul(argv[++arg], 0, 0); break;
+        case 'p': period = strtoul(argv[++arg], 0, 0); break;
+        case 'n': samples = atol(argv[++arg]); break;
+        case 'r': compress = 0; break;
+        case 'l': logic = 0; break;
+      }
+    } else if(wire == 0){
+      wire = argv[arg];
+    } else{
+      expect = argv[arg];
+    }
+  }
+  if((expect == 0) || ((w = fopen(wire, "wb")) == NULL) || ((e = fopen(expect, "w")) == NULL)){
+    fprintf(stderr, "usage: ScopeTest [-b baud] [-p period] [-n samples] [-r] [-l] wire.bin expected.csv\n");
+    return 2;
+  }
+  TExaS_ScopeFramed(baud, period, logic ? &Port : 0, 0x03, compress);
+  for(i=0; i<samples; i=i+1){
+    adc = 128 + 100*sin(i/50.0);
+    if((i%3000) < 20){
+      adc = adc^0x40;                 // a glitch the deltas can't follow
+    }
+    Port = ((i/40)&1) | (((i/300)&1)<<1);
+    fprintf(e, "%ld,%u,%lu\n", i, adc, logic ? Port : 0);
+    n = TExaS_ScopeModelTick(adc, bytes);
+    fwrite(bytes, 1, n, w);
+    total = total + n;
+  }
+  fclose(w);
+  fclose(e);
+  sent = TExaS_ScopeStats(&frames, &dropped);
+  printf("%ld samples, %lu frames, %lu dropped, %lu bytes queued, %ld on the wire\n",
+         samples, frames, dropped, sent, total);
+  return 0;
+}
@@ -0,0 +1,450 @@
+// SpiTest.c
+// Runs on a PC, not on the LaunchPad
+// Runs the CC3100 SPI transport in CC3100/platform/ek-tm4c123gxl/spi.c,
+// built with HEADLESS defined, against a model of SSI2 (8-deep
+// FIFOs, a shift register clocked at the configured bit rate, a
+// slave on the far side), its two uDMA channels and the processor
+// cycle counter, and checks that
+//   every byte written reaches the slave in order, and a read sends
+//     only 0xFF and returns what the slave sent, for lengths around
+//     the FIFO depth, the uDMA threshold and the 1024 byte uDMA limit
+//   chip select frames each transfer, with the bus idle and both
+//     FIFOs empty when it is released, and the receive FIFO never
+//     overruns
+//   transfers from the threshold up go by uDMA, receiving into the
+//     buffer or the sink and transmitting the buffer or the fill byte
+//   the statistics count every transfer and byte
+// then prints bytes per second and CPU time per KB for the original
+// byte at a time loop, the FIFO loop and the uDMA mode at two bit
+// rates, and spi_StatsReport() for a SimpleLink-like mix of transfers.
+// Cycle costs of register accesses and driverlib calls are estimates
+// for the TM4C123 at 50 MHz; see the COST_ defines.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -DPART_TM4C123GH6PM -I.. -I../CC3100/platform/ek-tm4c123gxl -I../CC3100/simplelink/include -I../CC3100/simplelink/source -I../CC3100/simplelink -o SpiTest SpiTest.c ../CC3100/platform/ek-tm4c123gxl/spi.c ../utils/ustdlib.c
+// usage: SpiTest
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ssi.h"
+#include "driverlib/ssi.h"
+#include "driverlib/udma.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "utils/ustdlib.h"
+#include "spi.h"
+
+#define CLOCK 50000000                 // board.c's initClk()
+
+// processor cycles charged for each access the code under test makes
+#define COST_REG        5              // a register read or write in a loop
+#define COST_CALL       14             // SSIDataPut/GetNonBlocking
+#define COST_GPIO       12             // GPIOPinWrite, for chip select
+#define COST_DMA_SETUP  24             // uDMAChannelControlSet/TransferSet
+#define COST_DMA_CALL   10             // other uDMA and SSIDMA calls
+
+static unsigned long Errors;
+#define CHECK(c, ...) do{ if(!(c)){ if(Errors++ < 10){ \
+  printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); } } }while(0)
+
+//---------------------SSI2 and uDMA model---------------------
+static unsigned long Cycles;           // processor cycles
+static unsigned long BitCycles;        // per SSI clock
+static unsigned char TxFifo[8], RxFifo[8];
+static int TxHead, TxCount, RxHead, RxCount;
+static int Shifting;                   // a byte is in the shift register
+static unsigned long ShiftDone;        // when it is all out
+static unsigned char ShiftByte;
+static unsigned long Overruns, Underruns;
+static int CsLow, SsiEnabled, SsiDma;
+
+// the slave: logs what it receives and answers from a pattern
+#define LOG_MAX 8192
+static unsigned char Mosi[LOG_MAX];
+static unsigned long MosiCount, MisoCount;
+static unsigned char MisoByte(unsigned long n){ return (unsigned char)(n*7 + 3); }
+
+typedef struct{
+  int enabled;
+  uint32_t control;
+  unsigned char *src, *dst;
+  unsigned long count;
+}Channel_t;
+static Channel_t Dma[32];
+static unsigned long DmaSetups;
+static void *ControlTable;
+static unsigned char *DrAddress = (unsigned char *)(unsigned long)(SSI2_BASE + SSI_O_DR);
+
+static void FifoPush(unsigned char *fifo, int head, int *count, unsigned char b){
+  fifo[(head + *count)%8] = b;
+  (*count)++;
+}
+static unsigned char FifoPop(unsigned char *fifo, int *head, int *count){
+  unsigned char b = fifo[*head];
+  *head = (*head + 1)%8;
+  (*count)--;
+  return b;
+}
+
+// a byte clocked out of the shift register, and the slave's answer in
+static void Exchange(void){
+  CHECK(CsLow, "byte on the bus with chip select high");
+  if(MosiCount < LOG_MAX) Mosi[MosiCount] = ShiftByte;
+  MosiCount++;
+  if(RxCount == 8) Overruns++;
+  else FifoPush(RxFifo, RxHead, &RxCount, MisoByte(MisoCount));
+  MisoCount++;
+}
+
+static void StartShift(unsigned long at){
+  if(Shifting || TxCount == 0 || !SsiEnabled) return;
+  ShiftByte = FifoPop(TxFifo, &TxHead, &TxCount);
+  Shifting = 1;
+  ShiftDone = at + 8*BitCycles;
+}
+
+// the uDMA answers the SSI's requests as soon as they are raised
+static void DmaService(unsigned long at){
+  Channel_t *rx = &Dma[12], *tx = &Dma[13];
+  while((SsiDma & SSI_DMA_RX) && rx->enabled && RxCount){
+    *rx->dst = FifoPop(RxFifo, &RxHead, &RxCount);
+    if((rx->control & UDMA_DST_INC_NONE) != UDMA_DST_INC_NONE) rx->dst++;
+    if(--rx->count == 0) rx->enabled = 0;
+  }
+  while((SsiDma & SSI_DMA_TX) && tx->enabled && TxCount < 8){
+    FifoPush(TxFifo, TxHead, &TxCount, *tx->src);
+    if((tx->control & UDMA_SRC_INC_NONE) != UDMA_SRC_INC_NONE) tx->src++;
+    if(--tx->count == 0) tx->enabled = 0;
+  }
+  StartShift(at);
+}
+
+// runs the bus up to the present cycle
+static void Advance(void){
+  while(Shifting && ShiftDone <= Cycles){
+    Shifting = 0;
+    Exchange();
+    DmaService(ShiftDone);
+  }
+  DmaService(Cycles);
+}
+
+// the registers spi.c reads and writes directly
+unsigned long SpiModelCycles(void){ return Cycles; }
+unsigned long SpiModelStatus(void){
+  Cycles += COST_REG;
+  Advance();
+  return (TxCount < 8 ? SSI_SR_TNF : 0) | (RxCount ? SSI_SR_RNE : 0) |
+         ((Shifting || TxCount) ? SSI_SR_BSY : 0) | (TxCount == 0 ? SSI_SR_TFE : 0);
+}
+void SpiModelDataPut(unsigned long ulData){
+  Cycles += COST_REG;
+  Advance();
+  if(TxCount == 8){ Overruns++; return; }   // lost, as the hardware would
+  FifoPush(TxFifo, TxHead, &TxCount, (unsigned char)ulData);
+  StartShift(Cycles);
+}
+unsigned long SpiModelDataGet(void){
+  Cycles += COST_REG;
+  Advance();
+  if(RxCount == 0){ Underruns++; return 0; }
+  return FifoPop(RxFifo, &RxHead, &RxCount);
+}
+
+// driverlib calls
+int32_t SSIDataPutNonBlocking(uint32_t ui32Base, uint32_t ui32Data){
+  (void)ui32Base;
+  Cycles += COST_CALL;
+  Advance();
+  if(TxCount == 8) return 0;
+  FifoPush(TxFifo, TxHead, &TxCount, (unsigned char)ui32Data);
+  StartShift(Cycles);
+  return 1;
+}
+int32_t SSIDataGetNonBlocking(uint32_t ui32Base, uint32_t *pui32Data){
+  (void)ui32Base;
+  Cycles += COST_CALL;
+  Advance();
+  if(RxCount == 0) return 0;
+  *pui32Data = FifoPop(RxFifo, &RxHead, &RxCount);
+  return 1;
+}
+void SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol,
+                        uint32_t ui32Mode, uint32_t ui32BitRate, uint32_t ui32DataWidth){
+  uint32_t max = ui32SSIClk/ui32BitRate, pre = 0, scr;
+  (void)ui32Base; (void)ui32Protocol; (void)ui32Mode;
+  CHECK(ui32DataWidth == 8, "data width %u", ui32DataWidth);
+  do{                                  // as driverlib picks the dividers
+    pre += 2;
+    scr = max/pre - 1;
+  }while(scr > 255);
+  BitCycles = pre*(scr + 1);
+}
+void SSIEnable(uint32_t ui32Base){ (void)ui32Base; SsiEnabled = 1; }
+void SSIDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags){
+  (void)ui32Base;
+  Cycles += COST_DMA_CALL;
+  Advance();
+  SsiDma |= ui32DMAFlags;
+}
+void SSIDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags){
+  (void)ui32Base;
+  Cycles += COST_DMA_CALL;
+  Advance();
+  SsiDma &= ~ui32DMAFlags;
+}
+void uDMAEnable(void){}
+void *uDMAControlBaseGet(void){ return ControlTable; }
+void uDMAControlBaseSet(void *pControlTable){ ControlTable = pControlTable; }
+void uDMAChannelAssign(uint32_t ui32Mapping){
+  CHECK(ui32Mapping == UDMA_CH12_SSI2RX || ui32Mapping == UDMA_CH13_SSI2TX, "mapping %x", ui32Mapping);
+}
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr){ (void)ui32ChannelNum; (void)ui32Attr; }
+void uDMAChannelAttributeEnable(uint32_t ui32ChannelNum, uint32_t ui32Attr){ (void)ui32ChannelNum; (void)ui32Attr; }
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control){
+  Cycles += COST_DMA_SETUP;
+  Dma[ui32ChannelStructIndex & 0x1f].control = ui32Control;
+}
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode,
+                            void *pvSrcAddr, void *pvDstAddr, uint32_t ui32TransferSize){
+  Channel_t *c = &Dma[ui32ChannelStructIndex & 0x1f];
+  Cycles += COST_DMA_SETUP;
+  CHECK(ui32Mode == UDMA_MODE_BASIC, "mode %u", ui32Mode);
+  CHECK(ui32TransferSize >= 1 && ui32TransferSize <= 1024, "size %u", ui32TransferSize);
+  if((ui32ChannelStructIndex & 0x1f) == 12) CHECK(pvSrcAddr == DrAddress, "rx source");
+  else CHECK(pvDstAddr == DrAddress, "tx destination");
+  c->src = pvSrcAddr;
+  c->dst = pvDstAddr;
+  c->count = ui32TransferSize;
+  DmaSetups++;
+}
+void uDMAChannelEnable(uint32_t ui32ChannelNum){
+  Cycles += COST_DMA_CALL;
+  Advance();
+  Dma[ui32ChannelNum & 0x1f].enabled = 1;
+  DmaService(Cycles);
+}
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum){
+  Cycles += COST_DMA_CALL;
+  Advance();
+  return Dma[ui32ChannelNum & 0x1f].enabled;
+}
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val){
+  Cycles += COST_GPIO;
+  Advance();
+  if(ui32Port == GPIO_PORTE_BASE && (ui8Pins & GPIO_PIN_0)){
+    if(ui8Val & GPIO_PIN_0){
+      CHECK(!Shifting && TxCount == 0 && RxCount == 0,
+            "chip select released with %d+%d+%d bytes in flight", TxCount, Shifting, RxCount);
+    }
+    CsLow = !(ui8Val & GPIO_PIN_0);
+  }
+}
+
+// the rest of spi_Open()
+uint32_t SysCtlClockGet(void){ return CLOCK; }
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral){ (void)ui32Peripheral; }
+void SysCtlDelay(uint32_t ui32Count){ Cycles += 3*ui32Count; }
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; }
+void GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; }
+void GPIOPinTypeSSI(uint32_t ui32Port, uint8_t ui8Pins){ (void)ui32Port; (void)ui8Pins; }
+void GPIOPinConfigure(uint32_t ui32PinConfig){ (void)ui32PinConfig; }
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PadType){
+  (void)ui32Port; (void)ui8Pins; (void)ui32Strength; (void)ui32PadType;
+}
+void GPIOIntTypeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32IntType){ (void)ui32Port; (void)ui8Pins; (void)ui32IntType; }
+void GPIOIntClear(uint32_t ui32Port, uint32_t ui32IntFlags){ (void)ui32Port; (void)ui32IntFlags; }
+void GPIOIntDisable(uint32_t ui32Port, uint32_t ui32IntFlags){ (void)ui32Port; (void)ui32IntFlags; }
+void IntEnable(uint32_t ui32Interrupt){ (void)ui32Interrupt; }
+bool IntMasterEnable(void){ return false; }
+void CC3100_InterruptEnable(void){}
+void CC3100_InterruptDisable(void){}
+
+// UARTprintf's formatting, on stdout
+static void Print(const char *pcString, ...){
+  char buf[128];
+  va_list vaArgP;
+  va_start(vaArgP, pcString);
+  uvsnprintf(buf, sizeof(buf), pcString, vaArgP);
+  va_end(vaArgP);
+  fputs(buf, stdout);
+}
+
+static void BusReset(void){
+  MosiCount = MisoCount = 0;
+}
+
+//---------------------the original transport---------------------
+// spi_Write() and spi_Read() as they were, one byte at a time
+static int OldWrite(unsigned char *pBuff, int len){
+  int len_to_return = len;
+  uint32_t ulDummy;
+  GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_0, 0);
+  while(len){
+    while(SSIDataPutNonBlocking(SSI2_BASE, (uint32_t)*pBuff) != 1);
+    while(SSIDataGetNonBlocking(SSI2_BASE, &ulDummy) != 1);
+    pBuff++;
+    len--;
+  }
+  GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_0, 0xFF);
+  return len_to_return;
+}
+static int OldRead(unsigned char *pBuff, int len){
+  int i;
+  uint32_t ulBuff;
+  GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_0, 0);
+  for(i = 0; i < len; i++){
+    while(SSIDataPutNonBlocking(SSI2_BASE, 0xFF) != 1);
+    while(SSIDataGetNonBlocking(SSI2_BASE, &ulBuff) != 1);
+    pBuff[i] = (unsigned char)ulBuff;
+  }
+  GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_0, 0xFF);
+  return len;
+}
+
+//---------------------checks---------------------
+static unsigned char Buf[LOG_MAX + 16];
+
+static void CheckWrite(int len, int dma){
+  unsigned long setups = DmaSetups;
+  SpiStats_t before, after;
+  int i, bad = 0;
+  spi_StatsGet(dma ? SPI_MODE_DMA : SPI_MODE_FIFO, &before);
+  for(i = 0; i < len; i++) Buf[i] = (unsigned char)(i*13 + len);
+  BusReset();
+  CHECK(spi_Write(0, Buf, len) == len, "write %d returned", len);
+  CHECK(MosiCount == (unsigned long)len, "write %d: %lu bytes on the bus", len, MosiCount);
+  for(i = 0; i < len && i < LOG_MAX; i++) bad += (Mosi[i] != Buf[i]);
+  CHECK(bad == 0, "write %d: %d bytes wrong", len, bad);
+  CHECK(DmaSetups - setups == (dma ? 2*(unsigned long)((len + 1023)/1024) : 0),
+        "write %d: %lu uDMA setups", len, DmaSetups - setups);
+  spi_StatsGet(dma ? SPI_MODE_DMA : SPI_MODE_FIFO, &after);
+  CHECK(after.ulTransfers == before.ulTransfers + 1 && after.ullBytes == before.ullBytes + len,
+        "write %d: not counted", len);
+}
+
+static void CheckRead(int len, int dma){
+  unsigned long setups = DmaSetups;
+  int i, bad = 0, notFill = 0;
+  memset(Buf, 0x5A, len + 16);
+  BusReset();
+  CHECK(spi_Read(0, Buf, len) == len, "read %d returned", len);
+  CHECK(MosiCount == (unsigned long)len, "read %d: %lu bytes on the bus", len, MosiCount);
+  for(i = 0; i < len && i < LOG_MAX; i++){
+    bad += (Buf[i] != MisoByte(i));
+    notFill += (Mosi[i] != 0xFF);
+  }
+  for(i = len; i < len + 16; i++) bad += (Buf[i] != 0x5A);
+  CHECK(bad == 0, "read %d: %d bytes wrong", len, bad);
+  CHECK(notFill == 0, "read %d: %d bytes sent were not 0xFF", len, notFill);
+  CHECK(DmaSetups - setups == (dma ? 2*(unsigned long)((len + 1023)/1024) : 0),
+        "read %d: %lu uDMA setups", len, DmaSetups - setups);
+  if(dma){
+    CHECK((Dma[12].control & UDMA_DST_INC_NONE) == UDMA_DST_INC_8, "read %d: not into the buffer", len);
+    CHECK((Dma[13].control & UDMA_SRC_INC_NONE) == UDMA_SRC_INC_NONE, "read %d: fill byte not held", len);
+  }
+}
+
+static const int Lengths[] = {1, 2, 4, 7, 8, 9, 16, 31, 32, 33, 100, 1023, 1024, 1025, 1460, 2048, 2500, 8192};
+#define LENGTHS (int)(sizeof(Lengths)/sizeof(Lengths[0]))
+
+static void Transfers(void){
+  int i;
+  printf("transfers through the FIFO loop\n");
+  spi_DmaThresholdSet(0);
+  for(i = 0; i < LENGTHS; i++){
+    CheckWrite(Lengths[i], 0);
+    CheckRead(Lengths[i], 0);
+  }
+  printf("transfers at the default threshold (%d)\n", SPI_DMA_THRESHOLD);
+  spi_DmaThresholdSet(SPI_DMA_THRESHOLD);
+  for(i = 0; i < LENGTHS; i++){
+    CheckWrite(Lengths[i], Lengths[i] >= SPI_DMA_THRESHOLD);
+    if(Lengths[i] >= SPI_DMA_THRESHOLD){
+      CHECK((Dma[12].control & UDMA_DST_INC_NONE) == UDMA_DST_INC_NONE,
+            "write %d: not into the sink", Lengths[i]);
+    }
+    CheckRead(Lengths[i], Lengths[i] >= SPI_DMA_THRESHOLD);
+  }
+  printf("transfers all by uDMA\n");
+  spi_DmaThresholdSet(1);
+  for(i = 0; i < LENGTHS; i++){
+    CheckWrite(Lengths[i], 1);
+    CheckRead(Lengths[i], 1);
+  }
+  CHECK(Overruns == 0 && Underruns == 0, "%lu overruns, %lu underruns", Overruns, Underruns);
+}
+
+//---------------------measurements---------------------
+// bytes per second and CPU cycles per KB of 1 KB reads and writes
+static void Measure(const char *name, int mode){
+  unsigned long start, total = 0, cpu = 0;
+  SpiStats_t s;
+  int i, write;
+  for(write = 0; write < 2; write++){
+    spi_StatsClear();
+    for(i = 0; i < 16; i++){
+      start = Cycles;
+      if(mode == 0) write ? OldWrite(Buf, 1024) : OldRead(Buf, 1024);
+      else if(write) spi_Write(0, Buf, 1024);
+      else spi_Read(0, Buf, 1024);
+      total += Cycles - start;
+    }
+    spi_StatsGet(mode == 2 ? SPI_MODE_DMA : SPI_MODE_FIFO, &s);
+    cpu += (mode == 0) ? 0 : (unsigned long)s.ullCpuCycles;
+  }
+  if(mode == 0) cpu = total;           // it polls throughout
+  printf("  %-10s %8.0f B/s %7lu cyc/KB %6.1f us/KB\n", name,
+         32.0*1024*CLOCK/total, cpu/32, 1e6*(cpu/32)/CLOCK);
+}
+
+static void Throughput(void){
+  static const uint32_t Rates[] = {4000000, 12500000};
+  int i;
+  for(i = 0; i < 2; i++){
+    SSIConfigSetExpClk(SSI2_BASE, CLOCK, 0, 0, Rates[i], 8);
+    printf("1 KB transfers, SSI clock %.2f MHz (wire limit %.0f B/s):\n",
+           (double)CLOCK/BitCycles/1e6, (double)CLOCK/BitCycles/8);
+    Measure("byte loop", 0);
+    spi_DmaThresholdSet(0);
+    Measure("fifo", 1);
+    spi_DmaThresholdSet(SPI_DMA_THRESHOLD);
+    Measure("udma", 2);
+  }
+  SSIConfigSetExpClk(SSI2_BASE, CLOCK, 0, 0, 4000000, 8);
+}
+
+// what the SimpleLink driver does for a 1460 byte sl_Recv: a sync
+// word, the response header, the descriptors and the payload
+static void Mix(void){
+  int i;
+  spi_StatsClear();
+  for(i = 0; i < 100; i++){
+    spi_Write(0, Buf, 4);
+    spi_Read(0, Buf, 4);
+    spi_Read(0, Buf, 4);
+    spi_Read(0, Buf, 8);
+    spi_Read(0, Buf, 1460);
+  }
+  Print("100 sl_Recv-like exchanges of 1460 bytes, threshold %u:\n", SPI_DMA_THRESHOLD);
+  spi_StatsReport(Print);
+}
+
+int main(void){
+  spi_Open(0, 0);
+  CHECK(ControlTable && ((unsigned long)ControlTable & 1023) == 0, "uDMA control table not aligned");
+  CHECK(!CsLow, "chip select low after open");
+  Transfers();
+  Throughput();
+  Mix();
+  CHECK(Overruns == 0 && Underruns == 0, "%lu overruns, %lu underruns", Overruns, Underruns);
+  spi_Close(0);
+  printf("%lu errors\n", Errors);
+  return Errors != 0;
+}
@@ -8,6 +8,13 @@
 // Uses Timer4 to copy PD3 data from ADC1 to UART0.
 // Jonathan Valvano, Daniel Valvano
 // February 18, 2015
+// TExaS_ScopeFramed() sends the samples in checked, numbered
+// frames instead, optionally compressed and with a logic channel,
+// at any baud rate; see TExaSscope.h for the frame format.
+
+#include <stdint.h>
+#include "TExaSscope.h"
+#include "driverlib/sw_crc.h"
 
 #define SYSCTL_RCGC0_R          (*((volatile unsigned long *)0x400FE100))
 #define SYSCTL_RCGC1_R          (*((volatile unsigned long *)0x400FE104))
@@ -129,6 +136,7 @@
 #define SYSCTL_RCGC1_UART0      0x00000001  // UART0 Clock Gating Control
 #define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
 
+#ifndef HEADLESS
 //------------UART_Init------------
 // Wait for new serial port input
 // Initialize the UART for 115,200 baud rate (assuming 80 MHz UART clock),
@@ -152,15 +160,25 @@ void UART_Init(void){
 }
 
 
-void TExaS_Scope(void){
+// Set the UART0 bit rate, IBRD.FBRD = 80,000,000/(16*baud)
+static void uartbaud(unsigned long baud){ unsigned long div;
+  div = (80000000*4 + baud/2)/baud;     // 64 times the divider, rounded
+  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
+  UART0_IBRD_R = div>>6;
+  UART0_FBRD_R = div&0x3F;
+  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN); // IBRD/FBRD take effect on this write
+  UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
+}
+
+// Timer4A periodic interrupts at priority 7
+static void scopetimer(unsigned long period){
   SYSCTL_RCGCTIMER_R |= 0x30;      // 0) activate timer4 and timer5
-  UART_Init(); // UART0 is connected to TExaSdisplay
   TIMER4_CTL_R = 0x00000000;       // 1) disable timer4A during setup
   TIMER4_CFG_R = 0x00000000;       // 2) configure for 32-bit mode
   TIMER4_TAMR_R = 0x00000002;      // 3) configure for periodic mode, default down-count settings
-  TIMER4_TAILR_R = 7999;           // 4) 100us reload value
+  TIMER4_TAILR_R = period-1;       // 4) reload value
   TIMER4_TAPR_R = 0;               // 5) bus clock resolution
-  TIMER4_ICR_R = 0x00000001;       // 6) clear timer5A timeout flag
+  TIMER4_ICR_R = 0x00000001;       // 6) clear timer4A timeout flag
   TIMER4_IMR_R = 0x00000001;       // 7) arm timeout interrupt
   NVIC_PRI17_R = (NVIC_PRI17_R&0xFF00FFFF)|0x00E00000; // 8) priority 7
 // interrupts enabled in the main program after all devices initialized
@@ -168,10 +186,228 @@ void TExaS_Scope(void){
   NVIC_EN2_R = 0x00000040;         // 9) enable interrupt 70 in NVIC
   TIMER4_CTL_R = 0x00000001;       // 10) enable timer4A
 }
+
+void TExaS_Scope(void){
+  UART_Init(); // UART0 is connected to TExaSdisplay
+  scopetimer(8000);                // 100us
+}
 #define UART0_DR_R              (*((volatile unsigned long *)0x4000C000))
 
+static int txfull(void){
+  return (UART0_FR_R&UART_FR_TXFF) != 0;
+}
+static void txput(unsigned char data){
+  UART0_DR_R = data;
+}
+static unsigned char adcin(void){
+  return ADC1_SSFIFO3_R>>4;
+}
+#else
+// Host model of the ADC and of UART0's 16 byte transmit FIFO
+static unsigned char ModelADC;
+static unsigned char ModelFifo[16];
+static int ModelCount;
+// UART0 sends baud/10 bytes per second (start, 8 data, stop),
+// ModelBits keeps the fraction of a byte between ticks
+static unsigned long ModelBaud, ModelPeriod;
+static unsigned long long ModelBits;   // bits times 80,000,000
+static int txfull(void){
+  return ModelCount == 16;
+}
+static void txput(unsigned char data){
+  ModelFifo[ModelCount] = data;
+  ModelCount = ModelCount + 1;
+}
+static unsigned char adcin(void){
+  return ModelADC;
+}
+#endif
+
+// Framed mode.  Timer4A_Handler collects SCOPEN samples, codes
+// them into a frame, and queues the frame in Tx[].  Every
+// interrupt tops up the UART FIFO from Tx[] without waiting, so
+// a slow UART costs whole frames, counted and numbered, instead
+// of random bytes.
+#define TXSIZE 256                      // power of 2, at least 2 frames
+static unsigned char Tx[TXSIZE];
+static unsigned long TxHead, TxTail;    // both changed only in Timer4A_Handler
+static int Framed;                      // 0 for TExaS_Scope's raw bytes
+static unsigned char Compress;
+static volatile unsigned long *LogicPort;
+static unsigned char LogicMask;
+static unsigned char AdcBuf[SCOPEN], LogicBuf[SCOPEN];
+static int Count;                       // samples in AdcBuf
+static unsigned short Seq;
+static unsigned long Frames, Dropped, Sent;
+
+void TExaS_ScopeFramed(unsigned long baud, unsigned long period,
+                       volatile unsigned long *logic, unsigned char mask,
+                       unsigned char compress){
+  LogicPort = logic;
+  LogicMask = mask;
+  Compress = compress;
+  Count = 0;
+  Seq = 0;
+  TxHead = TxTail = 0;
+  Frames = Dropped = Sent = 0;
+  Framed = 1;
+#ifdef HEADLESS
+  ModelCount = 0;
+  ModelBaud = baud;
+  ModelPeriod = period;
+  ModelBits = 0;
+#else
+  UART_Init();
+  uartbaud(baud);
+  scopetimer(period);
+#endif
+}
+
+unsigned long TExaS_ScopeStats(unsigned long *frames, unsigned long *dropped){
+  if(frames){
+    *frames = Frames;
+  }
+  if(dropped){
+    *dropped = Dropped;
+  }
+  return Sent;
+}
+
+// Delta code AdcBuf into p if every difference fits in 4 bits
+// Output: bytes used, 0 if a difference does not fit
+static int deltacode(unsigned char *p){ int i, n = 1;
+  long d;
+  p[0] = AdcBuf[0];
+  for(i=1; i<SCOPEN; i=i+1){
+    d = (long)AdcBuf[i] - AdcBuf[i-1];
+    if((d < -8) || (d > 7)){
+      return 0;
+    }
+    if(i&1){
+      p[n] = (d&0x0F)<<4;
+    } else{
+      p[n] |= d&0x0F;
+      n = n + 1;
+    }
+  }
+  return n + (SCOPEN&1 ? 0 : 1);        // count the last half-filled byte
+}
+
+// Run length code LogicBuf into p
+// Output: bytes used, 0 if it is not shorter than raw
+static int rlecode(unsigned char *p){ int i, n = 0;
+  unsigned char run = 1;
+  for(i=1; i<=SCOPEN; i=i+1){
+    if((i < SCOPEN) && (LogicBuf[i] == LogicBuf[i-1])){
+      run = run + 1;
+    } else{
+      if(n+2 >= SCOPEN){
+        return 0;
+      }
+      p[n] = run;
+      p[n+1] = LogicBuf[i-1];
+      n = n + 2;
+      run = 1;
+    }
+  }
+  return n;
+}
+
+// Code the samples into a frame and queue it, or count it as
+// dropped if Tx[] does not have room
+static void sendframe(void){ int i, n, len = 0;
+  unsigned char frame[SCOPEMAXFRAME], flags = SCOPE_ADC;
+  unsigned short crc;
+  unsigned char *payload = &frame[SCOPEHEADER];
+  n = Compress ? deltacode(payload) : 0;
+  if(n){
+    flags |= SCOPE_DELTA;
+    len = n;
+  } else{
+    for(i=0; i<SCOPEN; i=i+1){
+      payload[i] = AdcBuf[i];
+    }
+    len = SCOPEN;
+  }
+  if(LogicPort){
+    flags |= SCOPE_LOGIC;
+    n = Compress ? rlecode(&payload[len]) : 0;
+    if(n){
+      flags |= SCOPE_RLE;
+      len = len + n;
+    } else{
+      for(i=0; i<SCOPEN; i=i+1){
+        payload[len+i] = LogicBuf[i];
+      }
+      len = len + SCOPEN;
+    }
+  }
+  frame[0] = SCOPESYNC1;
+  frame[1] = SCOPESYNC2;
+  frame[2] = Seq&0xFF;
+  frame[3] = Seq>>8;
+  frame[4] = flags;
+  frame[5] = SCOPEN;
+  frame[6] = len;
+  crc = Crc16(0, &frame[2], len + 5);
+  frame[SCOPEHEADER+len] = crc&0xFF;
+  frame[SCOPEHEADER+len+1] = crc>>8;
+  Seq = Seq + 1;
+  Frames = Frames + 1;
+  n = SCOPEHEADER + len + 2;
+  if(TXSIZE - (TxHead - TxTail) < (unsigned long)n){
+    Dropped = Dropped + 1;              // the gap in seq tells the host
+    return;
+  }
+  for(i=0; i<n; i=i+1){
+    Tx[TxHead&(TXSIZE-1)] = frame[i];
+    TxHead = TxHead + 1;
+  }
+}
+
 void Timer4A_Handler(void){
-  TIMER4_ICR_R = 0x00000001;        // acknowledge timer5A timeout
-  UART0_DR_R = (ADC1_SSFIFO3_R>>4); // send ADC to TExaSdisplay
+#ifndef HEADLESS
+  TIMER4_ICR_R = 0x00000001;        // acknowledge timer4A timeout
+#endif
+  if(Framed == 0){
+    if(!txfull()){                  // a full FIFO loses this sample, not the next 16
+      txput(adcin());               // send ADC to TExaSdisplay
+    }
+    return;
+  }
+  AdcBuf[Count] = adcin();
+  LogicBuf[Count] = LogicPort ? (*LogicPort)&LogicMask : 0;
+  Count = Count + 1;
+  if(Count == SCOPEN){
+    sendframe();
+    Count = 0;
+  }
+  while((TxTail != TxHead) && !txfull()){
+    txput(Tx[TxTail&(TXSIZE-1)]);
+    TxTail = TxTail + 1;
+    Sent = Sent + 1;
+  }
 }
 
+#ifdef HEADLESS
+unsigned long TExaS_ScopeModelTick(unsigned char adc, unsigned char *wire){
+  unsigned long n = 0;
+  int i;
+  ModelBits = ModelBits + (unsigned long long)ModelBaud*ModelPeriod;
+  while((ModelBits >= 10ULL*80000000) && (ModelCount > 0) && (n < 64)){
+    wire[n] = ModelFifo[0];
+    n = n + 1;
+    for(i=1; i<ModelCount; i=i+1){
+      ModelFifo[i-1] = ModelFifo[i];
+    }
+    ModelCount = ModelCount - 1;
+    ModelBits = ModelBits - 10ULL*80000000;
+  }
+  if(ModelCount == 0){
+    ModelBits = 0;                  // an idle line does not save up time
+  }
+  ModelADC = adc;
+  Timer4A_Handler();
+  return n;
+}
+#endif
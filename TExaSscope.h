@@ -11,5 +11,61 @@
 
 // enables ADC1, Timer4 and UART0
 // call this after TExaSInit (PLL must be on)
+// sends one raw byte per 100us sample at 115200 baud, the
+// format TExaSdisplay expects
 void TExaS_Scope(void);
 
+// Framed scope protocol, decoded by ScopeDecode/ScopeDecode.c
+// Each frame carries SCOPEN samples of each channel:
+//   SCOPESYNC1 SCOPESYNC2 seq(lo) seq(hi) flags n len payload[len] crc(lo) crc(hi)
+// seq    frame number, 0 to 65535, counts frames dropped for lack of
+//        room too, so the decoder sees every gap shorter than 65536
+//        frames (3.5 minutes at 10 kHz)
+// flags  which channels are in the payload and how each is coded
+// n      samples per channel in this frame
+// len    payload bytes
+// crc    Crc16() from driverlib/sw_crc.c of seq through the payload
+// Payload: the ADC channel (8-bit samples) then the logic channel.
+//   raw    n bytes
+//   delta  (ADC) first sample, then n-1 signed 4-bit differences,
+//          two per byte, the first in the upper 4 bits
+//   RLE    (logic) pairs of run length (1 to 255) and value
+// Each channel is coded whichever way is shorter for that frame.
+#define SCOPEN          32
+#define SCOPESYNC1      0xA5
+#define SCOPESYNC2      0x5A
+#define SCOPEHEADER     7       // sync through len
+#define SCOPEMAXFRAME   (SCOPEHEADER + 2*SCOPEN + 2)
+#define SCOPE_ADC       0x01    // ADC channel is in the frame
+#define SCOPE_LOGIC     0x02    // logic channel is in the frame
+#define SCOPE_DELTA     0x04    // ADC channel is delta coded
+#define SCOPE_RLE       0x08    // logic channel is run length coded
+
+// enables ADC1, Timer4 and UART0 for the framed protocol
+// call this after TExaSInit (PLL must be on)
+// Input: baud      UART0 bit rate, up to 5,000,000
+//        period    sample period in 12.5ns units, 8000 is 10 kHz
+//        logic     GPIO DATA register to sample with the ADC,
+//                  such as &GPIO_PORTE_DATA_R, or 0 for none
+//        mask      bits of the logic port to keep
+//        compress  0 to always send raw, 1 to allow delta and RLE
+// Output: none
+void TExaS_ScopeFramed(unsigned long baud, unsigned long period,
+                       volatile unsigned long *logic, unsigned char mask,
+                       unsigned char compress);
+
+// Input: frames   frames made since TExaS_ScopeFramed
+//        dropped  frames thrown away because the UART fell behind
+//        Any pointer can be 0
+// Output: bytes sent
+unsigned long TExaS_ScopeStats(unsigned long *frames, unsigned long *dropped);
+
+#ifdef HEADLESS
+// Host model only: one Timer4A interrupt with this ADC sample.
+// The model UART sends baud/10 bytes a second from its 16 byte
+// FIFO; the bytes that went out on the wire during this sample
+// period are copied to wire.
+// Output: number of bytes copied to wire, at most 64
+unsigned long TExaS_ScopeModelTick(unsigned char adc, unsigned char *wire);
+#endif
+
@@ -0,0 +1,190 @@
+// UARTbufTest.c
+// Runs on a PC, not on the LaunchPad
+// Runs UARTbuf.c, built with HEADLESS defined, against its host
+// model of UART0 and uDMA channel 9, and checks that
+//   every byte written comes out on the wire once and in order,
+//     through the ISR and through uDMA
+//   UARTbuf_Write() reports back-pressure instead of waiting
+//   the wait counters match the time the line needs
+//   received bytes arrive in order, and bytes lost to a full
+//     ring or a full hardware FIFO are counted
+// It also prints how long a 20 character distance line holds up
+// the caller compared with spinning on TXFF.
+//
+// build (from this folder):
+//   gcc -O2 -DHEADLESS -I.. -o UARTbufTest UARTbufTest.c ../UARTbuf.c ../utils/ringbuf.c
+// usage: UARTbufTest [-b baud]   (default 115200)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "../UARTbuf.h"
+
+// ringbuf.c and UARTbuf.c disable interrupts around their index
+// updates; here that is a flag the model checks before it runs
+// UART0_Handler()
+static bool IntsOff;
+bool IntMasterDisable(void){ bool was = IntsOff;
+  IntsOff = true;
+  return was;
+}
+bool IntMasterEnable(void){ bool was = IntsOff;
+  IntsOff = false;
+  return was;
+}
+
+#define BIG 20000
+static unsigned char Out[BIG], In[BIG];
+static unsigned long Baud = 115200;
+static unsigned long ByteTime;         // 12.5ns units, what the divider really gives
+static int Errors;
+
+static void check(int ok, const char *what){
+  if(!ok){
+    printf("FAIL %s\n", what);
+    Errors = Errors + 1;
+  }
+}
+
+// collect what the model sent, ticking until the line is idle
+static unsigned long drain(unsigned char *buf, unsigned long have){ int idle;
+  for(idle=0; idle<4*(UARTBUF_TXSIZE+16); idle=idle+1){
+    UARTbuf_ModelTick(ByteTime/4);
+    have = have + UARTbuf_ModelWire(&buf[have], BIG-have);
+    if(UARTbuf_TxFree() == UARTBUF_TXSIZE-1){
+      UARTbuf_ModelTick(20*ByteTime);   // the FIFO empties
+      return have + UARTbuf_ModelWire(&buf[have], BIG-have);
+    }
+  }
+  return have;
+}
+
+// Non-blocking writes of a long message in pieces of size, the
+// caller ticking half a byte time between tries and counting
+// refusals
+static void writes(int dma, unsigned long size){ unsigned long i, sent = 0, got = 0, n, refused = 0;
+  USTyp s;
+  char name[64];
+  UARTbuf_Init(Baud, dma);
+  for(i=0; i<BIG; i=i+1){
+    Out[i] = (i*7 + i/251)&0xFF;
+  }
+  while(sent < BIG){
+    n = (BIG - sent < size) ? BIG - sent : size;
+    i = UARTbuf_Write(&Out[sent], n);
+    if(i < n){
+      refused = refused + (n - i);
+    }
+    sent = sent + i;
+    UARTbuf_ModelTick(ByteTime/2);
+    got = got + UARTbuf_ModelWire(&In[got], BIG-got);
+  }
+  got = drain(In, got);
+  UARTbuf_Stats(&s);
+  sprintf(name, "write %s, pieces of %lu", dma ? "uDMA" : "ISR", size);
+  printf("%-28s %5lu bytes, %6lu refused, %3lu uDMA transfers, %lu waits\n",
+         name, got, s.TxRefused, s.TxDMA, s.Waits);
+  check((got == BIG) && (memcmp(In, Out, BIG) == 0), "wire does not match what was written");
+  check(s.TxBytes == BIG, "TxBytes");
+  check(s.TxRefused == refused, "TxRefused does not match the short writes");
+  check(refused > 0, "the ring never pushed back");
+  check(s.Waits == 0, "non-blocking writes waited");
+  check(dma ? (s.TxDMA > 0) : (s.TxDMA == 0), "uDMA use");
+  check(UARTbuf_ModelStuck() == 0, "uDMA completion never cleared");
+}
+
+// Blocking writes of more than the ring holds with no time
+// passing between them, then a flush: the waits must add up to
+// the time the line takes to send all but what is left in the FIFO
+static void blocking(int dma){ unsigned long i, got, longest;
+  USTyp s;
+  UARTbuf_Init(Baud, dma);
+  for(i=0; i<4000; i=i+1){
+    UARTbuf_OutChar(Out[i]);
+  }
+  UARTbuf_Stats(&s);
+  longest = s.WaitMax;
+  UARTbuf_Flush();
+  UARTbuf_Stats(&s);
+  got = UARTbuf_ModelWire(In, BIG);
+  got = drain(In, got);
+  printf("OutChar %s                  %5lu bytes, %lu waits, %.2f ms waiting, longest %.3f ms\n",
+         dma ? "uDMA" : "ISR ", got, s.Waits, s.WaitTime/80000.0, longest/80000.0);
+  check((got == 4000) && (memcmp(In, Out, 4000) == 0), "OutChar wire does not match");
+  check(s.Waits > 0, "OutChar never waited");
+  check((s.WaitTime > (4000-17)*ByteTime) && (s.WaitTime < 4000*ByteTime),
+        "WaitTime is not the line time");
+  // an OutChar wait ends when the FIFO has room, or with uDMA
+  // when a transfer of up to a ring's worth finishes
+  check(longest < (dma ? UARTBUF_TXSIZE : 2)*ByteTime + 80, "WaitMax"); // waits poll every 1us
+  check(UARTbuf_ModelStuck() == 0, "uDMA completion never cleared");
+}
+
+// Receive: a message read as it comes, then a flood nobody
+// reads, then a burst while interrupts are disabled
+static void receive(void){ unsigned long i, got = 0;
+  USTyp s;
+  unsigned char c;
+  UARTbuf_Init(Baud, 0);
+  UARTbuf_ModelReceive(Out, 3000);
+  for(i=0; (i<4*3000) && (got<3000); i=i+1){
+    UARTbuf_ModelTick(ByteTime/2);
+    got = got + UARTbuf_Read(&In[got], BIG-got);
+    check(UARTbuf_RxUsed() == 0, "RxUsed after Read");
+  }
+  check(memcmp(In, Out, 3000) == 0, "received bytes do not match");
+  UARTbuf_ModelReceive(Out, 500);       // nobody reads
+  for(i=0; i<500; i=i+1){
+    UARTbuf_ModelTick(2*ByteTime);
+  }
+  UARTbuf_Stats(&s);
+  check(s.RxOverflow == 500 - (UARTBUF_RXSIZE-1), "RxOverflow");
+  check(s.RxOverrun == 0, "RxOverrun with interrupts on");
+  for(i=0; i<UARTBUF_RXSIZE-1; i=i+1){
+    c = UARTbuf_InChar();
+    check(c == Out[i], "InChar after overflow");
+  }
+  IntMasterDisable();                   // FIFO fills, the 17th byte on is lost
+  UARTbuf_ModelReceive(Out, 40);
+  for(i=0; i<100; i=i+1){
+    UARTbuf_ModelTick(ByteTime);
+  }
+  IntMasterEnable();
+  UARTbuf_ModelTick(ByteTime/8);              // pending interrupt runs
+  got = UARTbuf_Read(In, BIG);
+  UARTbuf_Stats(&s);
+  printf("receive                       %5lu bytes, %lu lost to a full ring, %lu FIFO overruns\n",
+         s.RxBytes, s.RxOverflow, s.RxOverrun);
+  check((got == 16) && (memcmp(In, Out, 16) == 0), "FIFO contents after overrun");
+  check(s.RxOverrun == 1, "RxOverrun");
+}
+
+int main(int argc, char **argv){ unsigned long i, t;
+  USTyp s;
+  const char *line = "Distance = 1.234 cm\n";
+  if((argc == 3) && (strcmp(argv[1], "-b") == 0)){
+    Baud = strtoul(argv[2], 0, 0);
+  }
+  ByteTime = 10*((80000000*4 + Baud/2)/Baud)/4;
+  writes(0, 100);
+  writes(0, 2000);
+  writes(1, 100);
+  writes(1, 2000);
+  blocking(0);
+  blocking(1);
+  receive();
+  // one distance line: queued with no waiting, vs spinning on
+  // TXFF until all but the last 16 bytes are in the FIFO
+  UARTbuf_Init(Baud, 0);
+  for(i=0; line[i]; i=i+1){
+    UARTbuf_OutChar(line[i]);
+  }
+  UARTbuf_Stats(&s);
+  t = (i > 16) ? (i - 16)*ByteTime : 0;
+  printf("%lu byte line: caller waits %.3f ms, TXFF spinning waits %.3f ms, line takes %.3f ms\n",
+         i, s.WaitTime/80000.0, t/80000.0, i*ByteTime/80000.0);
+  check(s.Waits == 0, "a short line waited");
+  printf("%s\n", Errors ? "FAILED" : "all passed");
+  return Errors ? 1 : 0;
+}
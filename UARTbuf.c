@@ -0,0 +1,502 @@
+// UARTbuf.c
+// Runs on LM4F120/TM4C123
+// Interrupt driven UART0 driver with transmit and receive ring
+// buffers, so printing a string costs a copy instead of ~87us
+// of TXFF spinning per byte at 115200 baud.
+// Transmit: writers copy into TxRing and return.  UART0_Handler
+// refills the FIFO each time it drains to 2 bytes (1/8), or, if
+// uDMA is on and at least UARTBUF_DMAMIN bytes sit in one piece
+// of the ring, hands that piece to uDMA channel 9 and takes it
+// out of the ring when the transfer is done.
+// Receive: UART0_Handler empties the FIFO into RxRing when it
+// is half full or the line has been quiet for 32 bit times.
+// The blocking calls move the rings themselves while they wait,
+// so they also work before interrupts are enabled.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "UARTbuf.h"
+#include "utils/ringbuf.h"
+#include "driverlib/interrupt.h"
+#ifndef HEADLESS
+#include "driverlib/udma.h"
+#endif
+
+static tRingBufObject TxRing, RxRing;
+static uint8_t TxBuf[UARTBUF_TXSIZE], RxBuf[UARTBUF_RXSIZE];
+static int UseDMA;
+static unsigned long DmaCount;          // bytes uDMA is sending from TxRing, 0 if idle
+static USTyp Stats;
+
+#ifndef HEADLESS
+#define DWT_CTRL_R              (*((volatile unsigned long *)0xE0001000))
+#define DWT_CYCCNT_R            (*((volatile unsigned long *)0xE0001004))
+
+// uDMA channel control table, must be 1024-byte aligned.  Only
+// used if no other driver has set one up already.
+#if defined(ewarm)
+#pragma data_alignment=1024
+static uint8_t DMAControlTable[1024];
+#elif defined(ccs)
+#pragma DATA_ALIGN(DMAControlTable, 1024)
+static uint8_t DMAControlTable[1024];
+#else
+static uint8_t DMAControlTable[1024] __attribute__ ((aligned(1024)));
+#endif
+
+// the DWT cycle counter, 80 counts per us
+static unsigned long now(void){
+  return DWT_CYCCNT_R;
+}
+static int txfull(void){
+  return (UART0_FR_R&UART_FR_TXFF) != 0;
+}
+static void txput(unsigned char data){
+  UART0_DR_R = data;
+}
+static int rxempty(void){
+  return (UART0_FR_R&UART_FR_RXFE) != 0;
+}
+static unsigned char rxget(void){
+  return UART0_DR_R&0xFF;
+}
+// read and clear the overrun flag
+static int rxoverrun(void){
+  if(UART0_RSR_R&UART_RSR_OE){
+    UART0_ECR_R = 0;
+    return 1;
+  }
+  return 0;
+}
+// The control words are set for every transfer, so it does not
+// matter if another driver moves the control table later.
+static void dmastart(uint8_t *src, unsigned long count){
+  uDMAChannelControlSet(UDMA_CHANNEL_UART0TX|UDMA_PRI_SELECT,
+                        UDMA_SIZE_8|UDMA_SRC_INC_8|UDMA_DST_INC_NONE|UDMA_ARB_4);
+  uDMAChannelTransferSet(UDMA_CHANNEL_UART0TX|UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                         src, (void *)&UART0_DR_R, count);
+  uDMAChannelEnable(UDMA_CHANNEL_UART0TX);
+}
+// a basic transfer disables the channel when it is done
+static int dmastopped(void){
+  return !uDMAChannelIsEnabled(UDMA_CHANNEL_UART0TX);
+}
+// DMACHIS bit 9 holds the UART0 interrupt on until it is cleared
+static void dmaack(void){
+  uDMAIntClear(1<<UDMA_CHANNEL_UART0TX);
+}
+#else
+// Host model of UART0 and uDMA channel 9, so the rings and
+// counters can be checked without a board
+static unsigned long ModelTime;         // 12.5ns units
+static unsigned long ModelBaud;
+static unsigned long long TxBits, RxBits; // bits times 80,000,000
+static unsigned char TxFifo[16], RxFifo[16];
+static int TxCount, RxCount;
+static int RxOE;                        // overrun flag, UART0_RSR_R bit 3
+static unsigned char Line[4096];        // bytes on their way in on U0Rx
+static unsigned long LineHead, LineTail;
+static unsigned char Wire[65536];       // bytes that went out on U0Tx
+static unsigned long WireHead, WireTail;
+static uint8_t *DmaSrc;
+static unsigned long DmaLeft;
+static int DmaDone;                     // DMACHIS bit 9, set until software clears it
+static unsigned long Stuck;             // ticks that left the handler still asserted
+static int Pending;                     // interrupt held off by IntMasterDisable()
+
+static unsigned long now(void){
+  return ModelTime;
+}
+static int txfull(void){
+  return TxCount == 16;
+}
+static void txput(unsigned char data){
+  TxFifo[TxCount] = data;
+  TxCount = TxCount + 1;
+}
+static int rxempty(void){
+  return RxCount == 0;
+}
+static unsigned char rxget(void){ int i;
+  unsigned char data = RxFifo[0];
+  for(i=1; i<RxCount; i=i+1){
+    RxFifo[i-1] = RxFifo[i];
+  }
+  RxCount = RxCount - 1;
+  return data;
+}
+static int rxoverrun(void){ int oe = RxOE;
+  RxOE = 0;
+  return oe;
+}
+// uDMA moves bytes whenever the FIFO has room
+static void dmafill(void){
+  while(DmaLeft && (TxCount < 16)){
+    txput(*DmaSrc);
+    DmaSrc = DmaSrc + 1;
+    DmaLeft = DmaLeft - 1;
+    if(DmaLeft == 0){
+      DmaDone = 1;
+    }
+  }
+}
+static void dmastart(uint8_t *src, unsigned long count){
+  DmaSrc = src;
+  DmaLeft = count;
+  dmafill();
+}
+static int dmastopped(void){
+  return DmaLeft == 0;
+}
+static void dmaack(void){
+  DmaDone = 0;
+}
+#endif
+
+// Run with interrupts disabled or from UART0_Handler
+// Take a finished uDMA transfer out of the ring
+static void txdone(void){
+  if(DmaCount && dmastopped()){
+    dmaack();
+    RingBufAdvanceRead(&TxRing, DmaCount);
+    DmaCount = 0;
+  }
+}
+
+// Run with interrupts disabled or from UART0_Handler
+static void txfill(void){ unsigned long n, i;
+  uint8_t *p;
+  if(DmaCount){
+    return;                             // uDMA owns the FIFO until it is done
+  }
+  n = RingBufContigUsed(&TxRing);
+  if(UseDMA && (n >= UARTBUF_DMAMIN)){
+    if(n > UARTBUF_DMAMAX){
+      n = UARTBUF_DMAMAX;
+    }
+    DmaCount = n;
+    Stats.TxDMA = Stats.TxDMA + 1;
+    dmastart(&TxBuf[TxRing.ui32ReadIndex], n);
+    return;
+  }
+  while(n && !txfull()){                // at most two passes, before and after the wrap
+    p = &TxBuf[TxRing.ui32ReadIndex];
+    for(i=0; (i<n) && !txfull(); i=i+1){
+      txput(p[i]);
+    }
+    RingBufAdvanceRead(&TxRing, i);
+    n = RingBufContigUsed(&TxRing);
+  }
+}
+
+// Run with interrupts disabled or from UART0_Handler
+static void rxdrain(void){ unsigned char data;
+  while(!rxempty()){
+    data = rxget();
+    if(RingBufFull(&RxRing)){
+      Stats.RxOverflow = Stats.RxOverflow + 1;
+    } else{
+      RingBufWriteOne(&RxRing, data);
+      Stats.RxBytes = Stats.RxBytes + 1;
+    }
+  }
+  if(rxoverrun()){
+    Stats.RxOverrun = Stats.RxOverrun + 1;
+  }
+}
+
+// Start the transmitter if it is idle; the ISR keeps it going
+static void kick(void){ bool off;
+  off = IntMasterDisable();
+  txfill();
+  if(!off){
+    IntMasterEnable();
+  }
+}
+
+// One pass of a blocking loop.  Moving both rings here means a
+// wait can not hang when interrupts are disabled.
+static void wait(void){ bool off;
+#ifdef HEADLESS
+  UARTbuf_ModelTick(80);                // 1us
+#endif
+  off = IntMasterDisable();
+  rxdrain();
+  txdone();
+  txfill();
+  if(!off){
+    IntMasterEnable();
+  }
+}
+static void waited(unsigned long start){ unsigned long t;
+  t = now() - start;
+  Stats.Waits = Stats.Waits + 1;
+  Stats.WaitTime = Stats.WaitTime + t;
+  if(t > Stats.WaitMax){
+    Stats.WaitMax = t;
+  }
+}
+
+//------------UARTbuf_Init------------
+// Initialize UART0 for 8 bit words, no parity, one stop bit,
+// FIFOs and interrupts enabled, assuming an 80 MHz bus clock.
+// Input: baud  bit rate, such as 115200
+//        dma   1 to send long writes by uDMA, 0 to use only the ISR
+// Output: none
+void UARTbuf_Init(unsigned long baud, int dma){ unsigned long div;
+#ifndef HEADLESS
+  volatile unsigned long delay;
+#endif
+  RingBufInit(&TxRing, TxBuf, UARTBUF_TXSIZE);
+  RingBufInit(&RxRing, RxBuf, UARTBUF_RXSIZE);
+  UseDMA = dma;
+  DmaCount = 0;
+  Stats.TxBytes = Stats.TxRefused = Stats.TxDMA = 0;
+  Stats.RxBytes = Stats.RxOverflow = Stats.RxOverrun = 0;
+  Stats.Waits = Stats.WaitTime = Stats.WaitMax = 0;
+  div = (80000000*4 + baud/2)/baud;     // 64 times IBRD.FBRD = 80,000,000/(16*baud), rounded
+#ifdef HEADLESS
+  ModelTime = 0;
+  ModelBaud = (80000000*4)/div;         // the rate the divider really gives
+  TxBits = RxBits = 0;
+  TxCount = RxCount = RxOE = 0;
+  LineHead = LineTail = WireHead = WireTail = 0;
+  DmaLeft = 0;
+  DmaDone = Pending = 0;
+  Stuck = 0;
+#else
+  SYSCTL_RCGC1_R |= SYSCTL_RCGC1_UART0; // activate UART0
+  SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
+  delay = SYSCTL_RCGC2_R;               // allow time for clock to stabilize
+  NVIC_DBG_INT_R |= 0x01000000;         // TRCENA, turn on the DWT
+  DWT_CTRL_R |= 0x00000001;             // CYCCNTENA, count bus cycles
+  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
+  UART0_IBRD_R = div>>6;
+  UART0_FBRD_R = div&0x3F;
+                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
+  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
+  UART0_IFLS_R = UART_IFLS_TX1_8|UART_IFLS_RX4_8; // interrupt at 2 bytes left to send, 8 received
+  UART0_ICR_R = 0x07F2;                 // clear old interrupts
+  UART0_IM_R = UART_IM_TXIM|UART_IM_RXIM|UART_IM_RTIM;
+  if(dma){
+    SYSCTL_RCGCDMA_R |= 0x01;           // activate uDMA
+    delay = SYSCTL_RCGCDMA_R;
+    uDMAEnable();
+    if(uDMAControlBaseGet() == 0){      // share a table another driver set up
+      uDMAControlBaseSet(DMAControlTable);
+    }
+    uDMAChannelAssign(UDMA_CH9_UART0TX);
+    uDMAChannelAttributeDisable(UDMA_CHANNEL_UART0TX, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    UART0_DMACTL_R = UART_DMACTL_TXDMAE;
+  } else{
+    UART0_DMACTL_R = 0;
+  }
+  UART0_CTL_R |= UART_CTL_UARTEN;       // enable UART
+  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1-0
+  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1-0
+                                        // configure PA1-0 as UART
+  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
+  GPIO_PORTA_AMSEL_R &= ~0x03;          // disable analog functionality on PA
+  NVIC_PRI1_R = (NVIC_PRI1_R&0xFFFF00FF)|0x0000A000; // UART0 is IRQ 5, priority 5
+  NVIC_EN0_R = 1<<5;
+#endif
+}
+
+//------------UARTbuf_Write------------
+// Queue bytes for transmission without waiting
+// Input: data   bytes to send
+//        count  number of bytes
+// Output: number of bytes taken, less than count if the ring
+//         filled up
+unsigned long UARTbuf_Write(const unsigned char *data, unsigned long count){ unsigned long n;
+  n = RingBufFree(&TxRing);
+  if(n > count){
+    n = count;
+  }
+  RingBufWrite(&TxRing, (uint8_t *)data, n);
+  Stats.TxBytes = Stats.TxBytes + n;
+  Stats.TxRefused = Stats.TxRefused + (count - n);
+  kick();
+  return n;
+}
+
+//------------UARTbuf_Read------------
+// Take received bytes without waiting
+// Input: data   where to put them
+//        count  room in data
+// Output: number of bytes copied, 0 if none have arrived
+unsigned long UARTbuf_Read(unsigned char *data, unsigned long count){ unsigned long n;
+  n = RingBufUsed(&RxRing);
+  if(n > count){
+    n = count;
+  }
+  RingBufRead(&RxRing, data, n);
+  return n;
+}
+
+//------------UARTbuf_TxFree------------
+// Input: none
+// Output: bytes UARTbuf_Write() can take right now
+unsigned long UARTbuf_TxFree(void){
+  return RingBufFree(&TxRing);
+}
+
+//------------UARTbuf_RxUsed------------
+// Input: none
+// Output: bytes UARTbuf_Read() can return right now
+unsigned long UARTbuf_RxUsed(void){
+  return RingBufUsed(&RxRing);
+}
+
+//------------UARTbuf_OutChar------------
+// Queue one byte, waiting only if the transmit ring is full
+// Input: data  8-bit ASCII character to be transferred
+// Output: none
+void UARTbuf_OutChar(unsigned char data){ unsigned long start;
+  if(RingBufFull(&TxRing)){
+    start = now();
+    while(RingBufFull(&TxRing)){
+      wait();
+    }
+    waited(start);
+  }
+  RingBufWriteOne(&TxRing, data);
+  Stats.TxBytes = Stats.TxBytes + 1;
+  kick();
+}
+
+//------------UARTbuf_InChar------------
+// Wait for a received byte
+// Input: none
+// Output: oldest byte received
+unsigned char UARTbuf_InChar(void){ unsigned long start;
+  if(RingBufEmpty(&RxRing)){
+    start = now();
+    while(RingBufEmpty(&RxRing)){
+      wait();
+    }
+    waited(start);
+  }
+  return RingBufReadOne(&RxRing);
+}
+
+//------------UARTbuf_Flush------------
+// Wait until every queued byte has left the transmit ring
+// Input: none
+// Output: none
+void UARTbuf_Flush(void){ unsigned long start;
+  if(!RingBufEmpty(&TxRing)){
+    start = now();
+    while(!RingBufEmpty(&TxRing)){
+      wait();
+    }
+    waited(start);
+  }
+}
+
+//------------UARTbuf_Stats------------
+// Copy the counters kept since UARTbuf_Init
+// Input: stats  filled in
+// Output: none
+void UARTbuf_Stats(USTyp *stats){
+  *stats = Stats;
+}
+
+void UART0_Handler(void){
+#ifndef HEADLESS
+  UART0_ICR_R = UART0_MIS_R;            // acknowledge, then empty the FIFOs
+#endif
+  rxdrain();
+  txdone();                             // uDMA completion comes on the UART0 vector
+  txfill();
+}
+
+#ifdef HEADLESS
+void UARTbuf_ModelTick(unsigned long cycles){ int i, before, irq = Pending;
+  bool off;
+  ModelTime = ModelTime + cycles;
+  // transmitter: one byte leaves the FIFO every 10 bit times
+  before = TxCount;
+  TxBits = TxBits + (unsigned long long)ModelBaud*cycles;
+  while((TxBits >= 10ULL*80000000) && (TxCount > 0)){
+    Wire[WireHead%sizeof(Wire)] = TxFifo[0];
+    WireHead = WireHead + 1;
+    for(i=1; i<TxCount; i=i+1){
+      TxFifo[i-1] = TxFifo[i];
+    }
+    TxCount = TxCount - 1;
+    TxBits = TxBits - 10ULL*80000000;
+    dmafill();
+  }
+  if(TxCount == 0){
+    TxBits = 0;                         // an idle line does not save up time
+  }
+  if((before > 2) && (TxCount <= 2)){
+    irq = 1;                            // TXRIS, FIFO drained past 1/8
+  }
+  if(DmaDone){
+    irq = 1;                            // a level, not an edge
+  }
+  // receiver: one byte arrives every 10 bit times
+  before = RxCount;
+  RxBits = RxBits + (unsigned long long)ModelBaud*cycles;
+  while((RxBits >= 10ULL*80000000) && (LineTail != LineHead)){
+    if(RxCount < 16){
+      RxFifo[RxCount] = Line[LineTail%sizeof(Line)];
+      RxCount = RxCount + 1;
+    } else{
+      RxOE = 1;                         // hardware drops it
+    }
+    LineTail = LineTail + 1;
+    RxBits = RxBits - 10ULL*80000000;
+  }
+  if(LineTail == LineHead){
+    RxBits = 0;
+    if(RxCount > 0){
+      irq = 1;                          // RTRIS, the line went quiet
+    }
+  }
+  if((before < 8) && (RxCount >= 8)){
+    irq = 1;                            // RXRIS, FIFO filled past 1/2
+  }
+  off = IntMasterDisable();             // only look at the I bit
+  if(!off){
+    IntMasterEnable();
+  }
+  Pending = irq && off;
+  if(irq && !off){
+    UART0_Handler();
+    for(i=0; DmaDone && (i<100); i=i+1){
+      UART0_Handler();                  // the NVIC takes it again right away
+    }
+    if(DmaDone){
+      Stuck = Stuck + 1;
+    }
+  }
+}
+
+unsigned long UARTbuf_ModelStuck(void){
+  return Stuck;
+}
+
+unsigned long UARTbuf_ModelReceive(const unsigned char *data, unsigned long count){ unsigned long n;
+  for(n=0; (n<count) && (LineHead-LineTail < sizeof(Line)-1); n=n+1){
+    Line[LineHead%sizeof(Line)] = data[n];
+    LineHead = LineHead + 1;
+  }
+  return n;
+}
+
+unsigned long UARTbuf_ModelWire(unsigned char *data, unsigned long max){ unsigned long n;
+  if(WireHead - WireTail > sizeof(Wire)){
+    WireTail = WireHead - sizeof(Wire); // the oldest were written over
+  }
+  for(n=0; (n<max) && (WireTail!=WireHead); n=n+1){
+    data[n] = Wire[WireTail%sizeof(Wire)];
+    WireTail = WireTail + 1;
+  }
+  return n;
+}
+#endif
@@ -0,0 +1,120 @@
+// UARTbuf.h
+// Runs on LM4F120/TM4C123
+// Interrupt driven UART0 driver with transmit and receive ring
+// buffers (utils/ringbuf.c).  Writers copy into the transmit
+// ring and return; UART0_Handler moves bytes between the rings
+// and the 16 byte hardware FIFOs whenever a FIFO crosses its
+// level, so nobody spins on TXFF.  Long writes can be sent by
+// uDMA channel 9 straight out of the transmit ring.
+// U0Rx (PA0) connected to serial port on PC
+// U0Tx (PA1) connected to serial port on PC
+
+// bytes in each ring, one is always left empty so each
+// holds one less than this
+#define UARTBUF_TXSIZE  512
+#define UARTBUF_RXSIZE  64
+// uDMA is used when at least this many bytes are waiting in one
+// piece of the transmit ring, shorter runs go through the ISR
+#define UARTBUF_DMAMIN  32
+#define UARTBUF_DMAMAX  1024    // most one uDMA transfer can move
+
+struct UARTStats {
+  unsigned long TxBytes;        // bytes taken into the transmit ring
+  unsigned long TxRefused;      // bytes UARTbuf_Write() had no room for
+  unsigned long TxDMA;          // uDMA transfers started
+  unsigned long RxBytes;        // bytes put in the receive ring
+  unsigned long RxOverflow;     // bytes lost, the receive ring was full
+  unsigned long RxOverrun;      // times bytes were lost, the hardware FIFO was full
+  unsigned long Waits;          // times a blocking call had to wait
+  unsigned long WaitTime;       // total time spent waiting, 12.5ns units
+  unsigned long WaitMax;        // longest single wait, 12.5ns units
+};
+typedef struct UARTStats USTyp;
+
+//------------UARTbuf_Init------------
+// Initialize UART0 for 8 bit words, no parity, one stop bit,
+// FIFOs and interrupts enabled, assuming an 80 MHz bus clock.
+// Interrupts must be enabled in the main program for the
+// rings to move on their own.
+// Input: baud  bit rate, such as 115200
+//        dma   1 to send long writes by uDMA, 0 to use only the ISR
+// Output: none
+void UARTbuf_Init(unsigned long baud, int dma);
+
+//------------UARTbuf_Write------------
+// Queue bytes for transmission without waiting
+// Input: data   bytes to send
+//        count  number of bytes
+// Output: number of bytes taken, less than count if the ring
+//         filled up; the caller owns the rest
+unsigned long UARTbuf_Write(const unsigned char *data, unsigned long count);
+
+//------------UARTbuf_Read------------
+// Take received bytes without waiting
+// Input: data   where to put them
+//        count  room in data
+// Output: number of bytes copied, 0 if none have arrived
+unsigned long UARTbuf_Read(unsigned char *data, unsigned long count);
+
+//------------UARTbuf_TxFree------------
+// Input: none
+// Output: bytes UARTbuf_Write() can take right now
+unsigned long UARTbuf_TxFree(void);
+
+//------------UARTbuf_RxUsed------------
+// Input: none
+// Output: bytes UARTbuf_Read() can return right now
+unsigned long UARTbuf_RxUsed(void);
+
+//------------UARTbuf_OutChar------------
+// Queue one byte, waiting only if the transmit ring is full
+// Input: data  8-bit ASCII character to be transferred
+// Output: none
+void UARTbuf_OutChar(unsigned char data);
+
+//------------UARTbuf_InChar------------
+// Wait for a received byte
+// Input: none
+// Output: oldest byte received
+unsigned char UARTbuf_InChar(void);
+
+//------------UARTbuf_Flush------------
+// Wait until every queued byte has left the transmit ring
+// Input: none
+// Output: none
+void UARTbuf_Flush(void);
+
+//------------UARTbuf_Stats------------
+// Copy the counters kept since UARTbuf_Init
+// Input: stats  filled in
+// Output: none
+void UARTbuf_Stats(USTyp *stats);
+
+// UART0 interrupt: transmit and receive FIFO levels, receive
+// time-out, and uDMA completion
+void UART0_Handler(void);
+
+#ifdef HEADLESS
+// Host model only: let cycles bus cycles (12.5ns) pass.  The
+// model UART moves baud/10 bytes a second each way between its
+// 16 byte FIFOs and the line, and calls UART0_Handler() when the
+// real one would interrupt.  Blocking calls run it while they wait.
+void UARTbuf_ModelTick(unsigned long cycles);
+
+// Host model only: bytes that start arriving on U0Rx, at most
+// 4095 not yet moved into the receive FIFO
+// Output: number of bytes queued on the line
+unsigned long UARTbuf_ModelReceive(const unsigned char *data, unsigned long count);
+
+// Host model only: copy out the bytes that have gone out on U0Tx
+// since the last call, oldest first; only the last 65536 are kept
+// Output: number of bytes copied
+unsigned long UARTbuf_ModelWire(unsigned char *data, unsigned long max);
+
+// Host model only: the uDMA completion, like DMACHIS on the board,
+// stays asserted until UART0_Handler() clears it
+// Output: number of ticks since UARTbuf_Init that ended with it
+//         still asserted after 100 handler runs in a row; on the
+//         board the handler would never let main run again
+unsigned long UARTbuf_ModelStuck(void);
+#endif
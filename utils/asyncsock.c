@@ -0,0 +1,885 @@
+//*****************************************************************************
+//
+// asyncsock.c - Non-blocking SimpleLink sockets, driven from the main loop.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "simplelink.h"
+#include "utils/asyncsock.h"
+
+//*****************************************************************************
+//
+//! \addtogroup asyncsock_api
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// The state of each connection.  A connection holds its slot from
+// AsyncSockConnect() until AsyncSockClose(), and its handle is the slot
+// index.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // One of the ASYNCSOCK_STATE_ values.
+    //
+    uint8_t ui8State;
+
+    //
+    // The SimpleLink socket, or -1 before it is opened and after it is
+    // closed.
+    //
+    int16_t i16Sd;
+
+    //
+    // The server, with the address in host order once it is known.
+    //
+    char pcHost[ASYNCSOCK_MAX_HOST];
+    uint32_t ui32Addr;
+    uint16_t ui16Port;
+
+    tAsyncSockCallback pfnCallback;
+    void *pvParam;
+
+    //
+    // The buffer being sent, from pui8Tx for ui32TxLeft more bytes of
+    // ui32TxLen, or ui32TxLen is 0 when nothing is being sent.
+    //
+    const uint8_t *pui8Tx;
+    uint32_t ui32TxLen;
+    uint32_t ui32TxLeft;
+
+    //
+    // The buffer armed for the next receive, or ui32RxSize is 0.
+    //
+    uint8_t *pui8Rx;
+    uint32_t ui32RxSize;
+}
+tAsyncSock;
+
+static tAsyncSock g_psAsyncSock[ASYNCSOCK_MAX];
+
+//*****************************************************************************
+//
+// The network processor resolves one name at a time.  The connection the
+// lookup in flight is for is g_i32AsyncSockDnsOwner; it is -1 when no lookup
+// is in flight, and ASYNCSOCK_MAX when its connection has been closed but
+// the answer must still be collected to free the driver's action object.
+//
+//*****************************************************************************
+static SlNetAppDnsRequest_t g_sAsyncSockDns;
+static int32_t g_i32AsyncSockDnsOwner = -1;
+
+static tAsyncSockStats g_sAsyncSockStats;
+
+//*****************************************************************************
+//
+// Calls a connection's callback.
+//
+//*****************************************************************************
+static void
+AsyncSockEvent(int32_t i32Sock, uint32_t ui32Event, int32_t i32Status)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+
+    if(psSock->pfnCallback)
+    {
+        psSock->pfnCallback(i32Sock, ui32Event, i32Status, psSock->pvParam);
+    }
+}
+
+//*****************************************************************************
+//
+// Closes a connection's socket after an error or the peer closing it, and
+// tells the application.  The slot stays in use until AsyncSockClose().
+//
+//*****************************************************************************
+static void
+AsyncSockFail(int32_t i32Sock, uint32_t ui32Event, int32_t i32Status)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+
+    if(psSock->i16Sd >= 0)
+    {
+        sl_Close(psSock->i16Sd);
+        g_sAsyncSockStats.ui32Commands++;
+        psSock->i16Sd = -1;
+    }
+    psSock->ui8State = ASYNCSOCK_STATE_CLOSED;
+    psSock->ui32TxLen = 0;
+    psSock->ui32RxSize = 0;
+    AsyncSockEvent(i32Sock, ui32Event, i32Status);
+}
+
+//*****************************************************************************
+//
+// Passes the answer to a lookup on to a connection waiting for it.
+//
+//*****************************************************************************
+static void
+AsyncSockResolved(int32_t i32Sock, int32_t i32Status, uint32_t ui32Addr)
+{
+    if(i32Status == 0)
+    {
+        g_psAsyncSock[i32Sock].ui32Addr = ui32Addr;
+        g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_CONNECT;
+        AsyncSockEvent(i32Sock, ASYNCSOCK_EVENT_RESOLVED, 0);
+    }
+    else
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+    }
+}
+
+//*****************************************************************************
+//
+// Collects the answer to the lookup in flight, if it has come, and starts the
+// next lookup a connection is waiting for.  Connections queued for the same
+// name take the answer too rather than each costing another round trip.
+//
+//*****************************************************************************
+static void
+AsyncSockDnsStep(void)
+{
+    char pcHost[ASYNCSOCK_MAX_HOST];
+    unsigned long ulAddr;
+    int32_t i32Status, i32Sock;
+
+    if(g_i32AsyncSockDnsOwner >= 0)
+    {
+        i32Status = sl_NetAppDnsGetHostByNameResult(&g_sAsyncSockDns, &ulAddr);
+        if(i32Status == SL_EAGAIN)
+        {
+            return;
+        }
+        i32Sock = g_i32AsyncSockDnsOwner;
+        g_i32AsyncSockDnsOwner = -1;
+
+        if((i32Sock < ASYNCSOCK_MAX) &&
+           (g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_RESOLVING))
+        {
+            //
+            // The callbacks may reuse the slot, so keep the name aside.
+            //
+            strcpy(pcHost, g_psAsyncSock[i32Sock].pcHost);
+            g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_RESOLVE;
+            for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+            {
+                if((g_psAsyncSock[i32Sock].ui8State ==
+                    ASYNCSOCK_STATE_RESOLVE) &&
+                   !strcmp(g_psAsyncSock[i32Sock].pcHost, pcHost))
+                {
+                    AsyncSockResolved(i32Sock, i32Status, ulAddr);
+                }
+            }
+        }
+    }
+
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        if(g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_RESOLVE)
+        {
+            break;
+        }
+    }
+    if((g_i32AsyncSockDnsOwner >= 0) || (i32Sock == ASYNCSOCK_MAX))
+    {
+        return;
+    }
+
+    i32Status = sl_NetAppDnsGetHostByNameAsync(
+                    g_psAsyncSock[i32Sock].pcHost,
+                    strlen(g_psAsyncSock[i32Sock].pcHost), SL_AF_INET,
+                    &g_sAsyncSockDns);
+    g_sAsyncSockStats.ui32Commands++;
+    if(i32Status == 0)
+    {
+        g_i32AsyncSockDnsOwner = i32Sock;
+        g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_RESOLVING;
+    }
+    else if(i32Status != SL_EALREADY)
+    {
+        //
+        // SL_EALREADY is a blocking lookup made elsewhere; try again on the
+        // next run.
+        //
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+    }
+}
+
+//*****************************************************************************
+//
+// Opens a nonblocking socket for a connection whose address is known and
+// starts the TCP handshake.
+//
+//*****************************************************************************
+static void
+AsyncSockOpen(int32_t i32Sock)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+    SlSockNonblocking_t sNonBlocking;
+    SlSockAddrIn_t sAddr;
+    int32_t i32Status;
+
+    i32Status = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+    g_sAsyncSockStats.ui32Commands++;
+    if(i32Status < 0)
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+        return;
+    }
+    psSock->i16Sd = i32Status;
+
+    sNonBlocking.NonblockingEnabled = 1;
+    i32Status = sl_SetSockOpt(psSock->i16Sd, SL_SOL_SOCKET,
+                              SL_SO_NONBLOCKING, &sNonBlocking,
+                              sizeof(sNonBlocking));
+    g_sAsyncSockStats.ui32Commands++;
+    if(i32Status < 0)
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+        return;
+    }
+
+    psSock->ui8State = ASYNCSOCK_STATE_CONNECTING;
+    sAddr.sin_family = SL_AF_INET;
+    sAddr.sin_port = sl_Htons(psSock->ui16Port);
+    sAddr.sin_addr.s_addr = sl_Htonl(psSock->ui32Addr);
+    i32Status = sl_Connect(psSock->i16Sd, (SlSockAddr_t *)&sAddr,
+                           sizeof(sAddr));
+    g_sAsyncSockStats.ui32Commands++;
+    if(i32Status == 0)
+    {
+        psSock->ui8State = ASYNCSOCK_STATE_OPEN;
+        AsyncSockEvent(i32Sock, ASYNCSOCK_EVENT_CONNECTED, 0);
+    }
+    else if(i32Status != SL_EALREADY)
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+    }
+}
+
+//*****************************************************************************
+//
+// Asks again whether a connection's handshake has finished.  The network
+// processor answers a nonblocking connect with SL_EALREADY until it has.
+//
+//*****************************************************************************
+static void
+AsyncSockConnectStep(int32_t i32Sock)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+    SlSockAddrIn_t sAddr;
+    int32_t i32Status;
+
+    sAddr.sin_family = SL_AF_INET;
+    sAddr.sin_port = sl_Htons(psSock->ui16Port);
+    sAddr.sin_addr.s_addr = sl_Htonl(psSock->ui32Addr);
+    i32Status = sl_Connect(psSock->i16Sd, (SlSockAddr_t *)&sAddr,
+                           sizeof(sAddr));
+    g_sAsyncSockStats.ui32Commands++;
+    if((i32Status == 0) || (i32Status == SL_EISCONN))
+    {
+        psSock->ui8State = ASYNCSOCK_STATE_OPEN;
+        AsyncSockEvent(i32Sock, ASYNCSOCK_EVENT_CONNECTED, 0);
+    }
+    else if(i32Status == SL_EALREADY)
+    {
+        g_sAsyncSockStats.ui32Polls++;
+    }
+    else
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Status);
+    }
+}
+
+//*****************************************************************************
+//
+// Hands the next part of a connection's send buffer to the network
+// processor.
+//
+//*****************************************************************************
+static void
+AsyncSockSendStep(int32_t i32Sock)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+    uint32_t ui32Burst, ui32Len;
+    int32_t i32Sent;
+
+    for(ui32Burst = 0; psSock->ui32TxLeft && (ui32Burst < ASYNCSOCK_SEND_BURST);
+        ui32Burst += i32Sent)
+    {
+        ui32Len = ASYNCSOCK_SEND_BURST - ui32Burst;
+        if(ui32Len > ASYNCSOCK_SEND_CHUNK)
+        {
+            ui32Len = ASYNCSOCK_SEND_CHUNK;
+        }
+        if(ui32Len > psSock->ui32TxLeft)
+        {
+            ui32Len = psSock->ui32TxLeft;
+        }
+        i32Sent = sl_Send(psSock->i16Sd, psSock->pui8Tx, ui32Len, 0);
+        g_sAsyncSockStats.ui32Commands++;
+        if(i32Sent == SL_EAGAIN)
+        {
+            //
+            // The network processor has no buffer free; the rest goes on a
+            // later run.
+            //
+            g_sAsyncSockStats.ui32Polls++;
+            return;
+        }
+        if(i32Sent <= 0)
+        {
+            AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR,
+                          i32Sent ? i32Sent : SL_ECLOSE);
+            return;
+        }
+        psSock->pui8Tx += i32Sent;
+        psSock->ui32TxLeft -= i32Sent;
+        g_sAsyncSockStats.ui64BytesSent += i32Sent;
+    }
+
+    if(psSock->ui32TxLeft == 0)
+    {
+        ui32Len = psSock->ui32TxLen;
+        psSock->ui32TxLen = 0;
+        AsyncSockEvent(i32Sock, ASYNCSOCK_EVENT_SENT, ui32Len);
+    }
+}
+
+//*****************************************************************************
+//
+// Reads what has arrived on a connection into its armed receive buffer.
+//
+//*****************************************************************************
+static void
+AsyncSockRecvStep(int32_t i32Sock)
+{
+    tAsyncSock *psSock = &g_psAsyncSock[i32Sock];
+    int32_t i32Len;
+
+    i32Len = sl_Recv(psSock->i16Sd, psSock->pui8Rx, psSock->ui32RxSize, 0);
+    g_sAsyncSockStats.ui32Commands++;
+    if(i32Len > 0)
+    {
+        //
+        // Disarm first, so that the callback can arm the next receive.
+        //
+        psSock->ui32RxSize = 0;
+        g_sAsyncSockStats.ui64BytesReceived += i32Len;
+        AsyncSockEvent(i32Sock, ASYNCSOCK_EVENT_RECV, i32Len);
+    }
+    else if(i32Len == SL_EAGAIN)
+    {
+        g_sAsyncSockStats.ui32Polls++;
+    }
+    else if(i32Len == 0)
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_CLOSED, 0);
+    }
+    else
+    {
+        AsyncSockFail(i32Sock, ASYNCSOCK_EVENT_ERROR, i32Len);
+    }
+}
+
+//*****************************************************************************
+//
+// Finds a free slot and fills in what every new connection starts with.
+//
+//*****************************************************************************
+static int32_t
+AsyncSockAlloc(uint16_t ui16Port, tAsyncSockCallback pfnCallback,
+               void *pvParam)
+{
+    int32_t i32Sock;
+
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        if(g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_FREE)
+        {
+            break;
+        }
+    }
+    if(i32Sock == ASYNCSOCK_MAX)
+    {
+        return(SL_ENSOCK);
+    }
+
+    memset(&g_psAsyncSock[i32Sock], 0, sizeof(tAsyncSock));
+    g_psAsyncSock[i32Sock].i16Sd = -1;
+    g_psAsyncSock[i32Sock].ui16Port = ui16Port;
+    g_psAsyncSock[i32Sock].pfnCallback = pfnCallback;
+    g_psAsyncSock[i32Sock].pvParam = pvParam;
+    return(i32Sock);
+}
+
+//*****************************************************************************
+//
+//! Initializes the non-blocking socket layer.
+//!
+//! This function frees every connection slot.  It must be called once, after
+//! sl_Start(), before any other function in this module.  Connections that
+//! were open are forgotten rather than closed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AsyncSockInit(void)
+{
+    int32_t i32Sock;
+
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_FREE;
+        g_psAsyncSock[i32Sock].i16Sd = -1;
+    }
+    g_i32AsyncSockDnsOwner = -1;
+    memset(&g_sAsyncSockStats, 0, sizeof(g_sAsyncSockStats));
+}
+
+//*****************************************************************************
+//
+//! Starts a TCP connection to a server given by name.
+//!
+//! \param pcHost is the server's host name, which is copied.
+//! \param ui16Port is the server's TCP port.
+//! \param pfnCallback is the function to call as the connection makes
+//! progress, or NULL.
+//! \param pvParam is passed to \e pfnCallback.
+//!
+//! This function only takes a connection slot.  The DNS lookup, the socket
+//! and the handshake are done by later calls to AsyncSockRun(), which reports
+//! them with the \b ASYNCSOCK_EVENT_RESOLVED and \b ASYNCSOCK_EVENT_CONNECTED
+//! events or ends them with \b ASYNCSOCK_EVENT_ERROR.  Lookups for several
+//! connections are made one after another, since the network processor
+//! resolves one name at a time; connections to the same name share one.
+//!
+//! A send and a receive may be started on the connection straight away; they
+//! wait for it to open.
+//!
+//! \return Returns the connection's handle, or \b SL_ENSOCK if
+//! \b ASYNCSOCK_MAX connections are already in use or \b SL_EINVAL if the
+//! name is too long.
+//
+//*****************************************************************************
+int32_t
+AsyncSockConnect(const char *pcHost, uint16_t ui16Port,
+                 tAsyncSockCallback pfnCallback, void *pvParam)
+{
+    int32_t i32Sock;
+
+    if(strlen(pcHost) >= ASYNCSOCK_MAX_HOST)
+    {
+        return(SL_EINVAL);
+    }
+    i32Sock = AsyncSockAlloc(ui16Port, pfnCallback, pvParam);
+    if(i32Sock >= 0)
+    {
+        strcpy(g_psAsyncSock[i32Sock].pcHost, pcHost);
+        g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_RESOLVE;
+    }
+    return(i32Sock);
+}
+
+//*****************************************************************************
+//
+//! Starts a TCP connection to a server given by address.
+//!
+//! \param ui32Addr is the server's IPv4 address, in host order as
+//! sl_NetAppDnsGetHostByName() returns it.
+//! \param ui16Port is the server's TCP port.
+//! \param pfnCallback is the function to call as the connection makes
+//! progress, or NULL.
+//! \param pvParam is passed to \e pfnCallback.
+//!
+//! This function is AsyncSockConnect() without the DNS lookup.
+//!
+//! \return Returns the connection's handle, or \b SL_ENSOCK if
+//! \b ASYNCSOCK_MAX connections are already in use.
+//
+//*****************************************************************************
+int32_t
+AsyncSockConnectAddr(uint32_t ui32Addr, uint16_t ui16Port,
+                     tAsyncSockCallback pfnCallback, void *pvParam)
+{
+    int32_t i32Sock;
+
+    i32Sock = AsyncSockAlloc(ui16Port, pfnCallback, pvParam);
+    if(i32Sock >= 0)
+    {
+        g_psAsyncSock[i32Sock].ui32Addr = ui32Addr;
+        g_psAsyncSock[i32Sock].ui8State = ASYNCSOCK_STATE_CONNECT;
+    }
+    return(i32Sock);
+}
+
+//*****************************************************************************
+//
+//! Starts sending a buffer on a connection.
+//!
+//! \param i32Sock is the connection's handle.
+//! \param pvData points to the bytes to send.
+//! \param ui32Len is the number of bytes to send.
+//!
+//! The buffer is not copied and must stay in place until the connection's
+//! callback gets \b ASYNCSOCK_EVENT_SENT.  AsyncSockRun() hands at most
+//! \b ASYNCSOCK_SEND_BURST bytes of it to the network processor on each call.
+//!
+//! \return Returns 0, \b SL_EALREADY if a send is already in progress on the
+//! connection, or \b SL_ENOTCONN if the connection has closed.
+//
+//*****************************************************************************
+int32_t
+AsyncSockSend(int32_t i32Sock, const void *pvData, uint32_t ui32Len)
+{
+    tAsyncSock *psSock;
+
+    if((i32Sock < 0) || (i32Sock >= ASYNCSOCK_MAX) ||
+       (g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_FREE) ||
+       (g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_CLOSED))
+    {
+        return(SL_ENOTCONN);
+    }
+    psSock = &g_psAsyncSock[i32Sock];
+    if(psSock->ui32TxLen)
+    {
+        return(SL_EALREADY);
+    }
+    if(ui32Len == 0)
+    {
+        return(0);
+    }
+    psSock->pui8Tx = pvData;
+    psSock->ui32TxLen = ui32Len;
+    psSock->ui32TxLeft = ui32Len;
+    return(0);
+}
+
+//*****************************************************************************
+//
+//! Arms a receive on a connection.
+//!
+//! \param i32Sock is the connection's handle.
+//! \param pvBuf points to the buffer to fill.
+//! \param ui32Size is the size of the buffer in bytes.
+//!
+//! The next data to arrive on the connection, up to \e ui32Size bytes, is
+//! placed in the buffer and reported with \b ASYNCSOCK_EVENT_RECV.  Each
+//! receive is reported once; the callback arms the next one if it wants
+//! more.  \b ASYNCSOCK_EVENT_CLOSED is reported instead when the peer closes
+//! the connection.
+//!
+//! \return Returns 0, \b SL_EALREADY if a receive is already armed, or
+//! \b SL_ENOTCONN if the connection has closed.
+//
+//*****************************************************************************
+int32_t
+AsyncSockRecv(int32_t i32Sock, void *pvBuf, uint32_t ui32Size)
+{
+    tAsyncSock *psSock;
+
+    if((i32Sock < 0) || (i32Sock >= ASYNCSOCK_MAX) ||
+       (g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_FREE) ||
+       (g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_CLOSED))
+    {
+        return(SL_ENOTCONN);
+    }
+    psSock = &g_psAsyncSock[i32Sock];
+    if(psSock->ui32RxSize)
+    {
+        return(SL_EALREADY);
+    }
+    if(ui32Size == 0)
+    {
+        return(SL_EINVAL);
+    }
+    psSock->pui8Rx = pvBuf;
+    psSock->ui32RxSize = ui32Size;
+    return(0);
+}
+
+//*****************************************************************************
+//
+//! Closes a connection and frees its handle.
+//!
+//! \param i32Sock is the connection's handle.
+//!
+//! This function may be called in any state, including from the connection's
+//! own callback.  A send or receive in progress is abandoned, and no further
+//! events are reported for the handle.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AsyncSockClose(int32_t i32Sock)
+{
+    tAsyncSock *psSock;
+
+    if((i32Sock < 0) || (i32Sock >= ASYNCSOCK_MAX))
+    {
+        return;
+    }
+    psSock = &g_psAsyncSock[i32Sock];
+    if(psSock->i16Sd >= 0)
+    {
+        sl_Close(psSock->i16Sd);
+        g_sAsyncSockStats.ui32Commands++;
+        psSock->i16Sd = -1;
+    }
+
+    //
+    // A lookup in flight still has to be collected.
+    //
+    if(g_i32AsyncSockDnsOwner == i32Sock)
+    {
+        g_i32AsyncSockDnsOwner = ASYNCSOCK_MAX;
+    }
+    psSock->ui8State = ASYNCSOCK_STATE_FREE;
+    psSock->ui32TxLen = 0;
+    psSock->ui32RxSize = 0;
+}
+
+//*****************************************************************************
+//
+//! Returns the state of a connection.
+//!
+//! \param i32Sock is the connection's handle.
+//!
+//! \return Returns one of the \b ASYNCSOCK_STATE_ values.
+//
+//*****************************************************************************
+uint32_t
+AsyncSockState(int32_t i32Sock)
+{
+    if((i32Sock < 0) || (i32Sock >= ASYNCSOCK_MAX))
+    {
+        return(ASYNCSOCK_STATE_FREE);
+    }
+    return(g_psAsyncSock[i32Sock].ui8State);
+}
+
+//*****************************************************************************
+//
+//! Returns the address of a connection's server.
+//!
+//! \param i32Sock is the connection's handle.
+//!
+//! \return Returns the IPv4 address in host order, or 0 if it is not known
+//! yet.
+//
+//*****************************************************************************
+uint32_t
+AsyncSockAddrGet(int32_t i32Sock)
+{
+    if((i32Sock < 0) || (i32Sock >= ASYNCSOCK_MAX))
+    {
+        return(0);
+    }
+    return(g_psAsyncSock[i32Sock].ui32Addr);
+}
+
+//*****************************************************************************
+//
+//! Moves every connection on as far as it can go without waiting.
+//!
+//! \param ui32WaitMs is the longest time, in milliseconds, to wait for a
+//! socket to become ready when there is nothing to do straight away.
+//!
+//! This function must be called from the application's main loop.  Each call
+//! lets the SimpleLink driver take in its events, collects a finished DNS
+//! lookup, opens sockets for connections with an address, sends, and reads
+//! the connections with a receive armed.  The connections' callbacks are
+//! called from here.
+//!
+//! With \e ui32WaitMs of 0, each connection still handshaking or waiting for
+//! data is asked directly with a nonblocking sl_Connect() or sl_Recv(), and
+//! the call returns at once.  With \e ui32WaitMs of at least
+//! \b ASYNCSOCK_SELECT_MIN_MS and nothing to send, one sl_Select() over all
+//! of them waits instead, so the processor can sleep until data arrives.
+//!
+//! \return Returns the number of connections still waiting for something.
+//! When it is 0 the application need not call again until it starts a
+//! connection, a send or a receive.
+//
+//*****************************************************************************
+uint32_t
+AsyncSockRun(uint32_t ui32WaitMs)
+{
+    tAsyncSock *psSock;
+    SlFdSet_t sReadFds, sWriteFds;
+    SlTimeval_t sTimeout;
+    uint32_t ui32Busy;
+    int32_t i32Sock, i32Max, i32Status;
+    bool bPending;
+
+    g_sAsyncSockStats.ui32Runs++;
+
+    //
+    // Let the driver handle what the network processor has sent, which in a
+    // non-OS build is otherwise only done while a SimpleLink call waits.
+    //
+#if _SL_INCLUDE_FUNC(sl_Task)
+    sl_Task();
+#endif
+
+    AsyncSockDnsStep();
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        if(g_psAsyncSock[i32Sock].ui8State == ASYNCSOCK_STATE_CONNECT)
+        {
+            AsyncSockOpen(i32Sock);
+        }
+    }
+
+    //
+    // Gather the sockets to ask about, and whether there is other work that
+    // must not wait behind a select.
+    //
+    SL_FD_ZERO(&sReadFds);
+    SL_FD_ZERO(&sWriteFds);
+    i32Max = -1;
+    bPending = (g_i32AsyncSockDnsOwner >= 0);
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        psSock = &g_psAsyncSock[i32Sock];
+        if(psSock->ui8State == ASYNCSOCK_STATE_CONNECTING)
+        {
+            SL_FD_SET(psSock->i16Sd, &sWriteFds);
+        }
+        else if(psSock->ui8State == ASYNCSOCK_STATE_OPEN)
+        {
+            if(psSock->ui32TxLen)
+            {
+                bPending = true;
+            }
+            if(psSock->ui32RxSize)
+            {
+                SL_FD_SET(psSock->i16Sd, &sReadFds);
+            }
+            else
+            {
+                continue;
+            }
+        }
+        else
+        {
+            continue;
+        }
+        if((psSock->i16Sd & BSD_SOCKET_ID_MASK) > i32Max)
+        {
+            i32Max = psSock->i16Sd & BSD_SOCKET_ID_MASK;
+        }
+    }
+
+    if((ui32WaitMs >= ASYNCSOCK_SELECT_MIN_MS) && !bPending && (i32Max >= 0))
+    {
+        sTimeout.tv_sec = ui32WaitMs / 1000;
+        sTimeout.tv_usec = (ui32WaitMs % 1000) * 1000;
+        i32Status = sl_Select(i32Max + 1, &sReadFds, &sWriteFds, 0,
+                              &sTimeout);
+        g_sAsyncSockStats.ui32Commands++;
+        g_sAsyncSockStats.ui32Selects++;
+        if(i32Status <= 0)
+        {
+            SL_FD_ZERO(&sReadFds);
+            SL_FD_ZERO(&sWriteFds);
+        }
+    }
+#ifndef SL_PLATFORM_MULTI_THREADED
+    else if(ui32WaitMs && (g_i32AsyncSockDnsOwner >= 0) && (i32Max < 0))
+    {
+        //
+        // Only a lookup to wait for; sleep until the driver takes in an
+        // event, then see if it was the answer.
+        //
+        _SlNonOsMainLoopWait(ui32WaitMs);
+        AsyncSockDnsStep();
+    }
+#endif
+
+    //
+    // Move on the sockets which are ready.  Without a select, each is asked
+    // directly.  A callback may close or start any connection, so each
+    // state is checked again just before it is used.
+    //
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        psSock = &g_psAsyncSock[i32Sock];
+        if((psSock->ui8State == ASYNCSOCK_STATE_CONNECTING) &&
+           SL_FD_ISSET(psSock->i16Sd, &sWriteFds))
+        {
+            AsyncSockConnectStep(i32Sock);
+        }
+        if((psSock->ui8State == ASYNCSOCK_STATE_OPEN) && psSock->ui32TxLen)
+        {
+            AsyncSockSendStep(i32Sock);
+        }
+        if((psSock->ui8State == ASYNCSOCK_STATE_OPEN) && psSock->ui32RxSize &&
+           SL_FD_ISSET(psSock->i16Sd, &sReadFds))
+        {
+            AsyncSockRecvStep(i32Sock);
+        }
+    }
+
+    //
+    // Count the connections with something still to come.
+    //
+    ui32Busy = 0;
+    for(i32Sock = 0; i32Sock < ASYNCSOCK_MAX; i32Sock++)
+    {
+        psSock = &g_psAsyncSock[i32Sock];
+        if(((psSock->ui8State >= ASYNCSOCK_STATE_RESOLVE) &&
+            (psSock->ui8State <= ASYNCSOCK_STATE_CONNECTING)) ||
+           ((psSock->ui8State == ASYNCSOCK_STATE_OPEN) &&
+            (psSock->ui32TxLen || psSock->ui32RxSize)))
+        {
+            ui32Busy++;
+        }
+    }
+    return(ui32Busy);
+}
+
+//*****************************************************************************
+//
+//! Reads the socket layer's counts.
+//!
+//! \param psStats points to the structure to fill in.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AsyncSockStatsGet(tAsyncSockStats *psStats)
+{
+    *psStats = g_sAsyncSockStats;
+}
+
+//*****************************************************************************
+//
+//! Zeroes the socket layer's counts.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+AsyncSockStatsClear(void)
+{
+    memset(&g_sAsyncSockStats, 0, sizeof(g_sAsyncSockStats));
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,192 @@
+//*****************************************************************************
+//
+// asyncsock.h - Prototypes for the non-blocking SimpleLink socket layer.
+//
+//*****************************************************************************
+
+#ifndef __ASYNCSOCK_H__
+#define __ASYNCSOCK_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup asyncsock_api
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// The most connections that can be in flight at once.  Each holds one
+// SimpleLink socket while it is connecting or open.
+//
+//*****************************************************************************
+#ifndef ASYNCSOCK_MAX
+#define ASYNCSOCK_MAX           SL_MAX_SOCKETS
+#endif
+
+//*****************************************************************************
+//
+// The longest host name, with its terminator, that AsyncSockConnect() takes.
+//
+//*****************************************************************************
+#define ASYNCSOCK_MAX_HOST      64
+
+//*****************************************************************************
+//
+// The network processor rounds select timeouts shorter than this up to it,
+// so AsyncSockRun() only calls sl_Select() when it may wait this long.
+//
+//*****************************************************************************
+#define ASYNCSOCK_SELECT_MIN_MS 10
+
+//*****************************************************************************
+//
+// The most bytes handed to one sl_Send() call.  sl_Send() splits a longer
+// buffer into TCP segments itself, but on a nonblocking socket it returns
+// SL_EAGAIN without saying how many of them went out, so the buffer is given
+// to it one segment at a time.
+//
+//*****************************************************************************
+#define ASYNCSOCK_SEND_CHUNK    1460
+
+//*****************************************************************************
+//
+// The most bytes handed to sl_Send() for one connection in one
+// AsyncSockRun() call, so that a large send cannot hold up the others.
+//
+//*****************************************************************************
+#ifndef ASYNCSOCK_SEND_BURST
+#define ASYNCSOCK_SEND_BURST    (4 * ASYNCSOCK_SEND_CHUNK)
+#endif
+
+//*****************************************************************************
+//
+// The events passed to a connection's callback.  The i32Status argument is:
+//   RESOLVED   0; AsyncSockAddrGet() gives the address found
+//   CONNECTED  0
+//   SENT       the length of the buffer, now all handed to the network
+//              processor
+//   RECV       the number of bytes placed in the receive buffer
+//   CLOSED     0; the peer closed the connection
+//   ERROR      the negative SimpleLink error code
+//
+//*****************************************************************************
+#define ASYNCSOCK_EVENT_RESOLVED    0x01
+#define ASYNCSOCK_EVENT_CONNECTED   0x02
+#define ASYNCSOCK_EVENT_SENT        0x04
+#define ASYNCSOCK_EVENT_RECV        0x08
+#define ASYNCSOCK_EVENT_CLOSED      0x10
+#define ASYNCSOCK_EVENT_ERROR       0x20
+
+//*****************************************************************************
+//
+// The states of a connection, as returned by AsyncSockState().
+//
+//*****************************************************************************
+#define ASYNCSOCK_STATE_FREE        0   // Not in use
+#define ASYNCSOCK_STATE_RESOLVE     1   // Waiting its turn for a DNS lookup
+#define ASYNCSOCK_STATE_RESOLVING   2   // DNS lookup in flight
+#define ASYNCSOCK_STATE_CONNECT     3   // Address known, no socket yet
+#define ASYNCSOCK_STATE_CONNECTING  4   // TCP handshake in progress
+#define ASYNCSOCK_STATE_OPEN        5   // Connected
+#define ASYNCSOCK_STATE_CLOSED      6   // Closed by the peer or failed, until
+                                        // AsyncSockClose() frees it
+
+//*****************************************************************************
+//
+// Prototype of the function called when something happens on a connection.
+// It is only ever called from AsyncSockRun(), and may call any of the
+// AsyncSock functions other than AsyncSockRun() itself.
+//
+//*****************************************************************************
+typedef void (*tAsyncSockCallback)(int32_t i32Sock, uint32_t ui32Event,
+                                   int32_t i32Status, void *pvParam);
+
+//*****************************************************************************
+//
+//! Counts kept by the socket layer, to see what driving the connections from
+//! the main loop costs.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of calls to AsyncSockRun().
+    //
+    uint32_t ui32Runs;
+
+    //
+    //! The number of SimpleLink calls made, each of which is one command to
+    //! the network processor.
+    //
+    uint32_t ui32Commands;
+
+    //
+    //! The number of those which were sl_Select() calls.
+    //
+    uint32_t ui32Selects;
+
+    //
+    //! The number of nonblocking sl_Connect() and sl_Recv() calls that found
+    //! the socket not ready yet.
+    //
+    uint32_t ui32Polls;
+
+    //
+    //! The bytes handed to sl_Send() and returned by sl_Recv().
+    //
+    uint64_t ui64BytesSent;
+    uint64_t ui64BytesReceived;
+}
+tAsyncSockStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void AsyncSockInit(void);
+extern int32_t AsyncSockConnect(const char *pcHost, uint16_t ui16Port,
+                                tAsyncSockCallback pfnCallback,
+                                void *pvParam);
+extern int32_t AsyncSockConnectAddr(uint32_t ui32Addr, uint16_t ui16Port,
+                                    tAsyncSockCallback pfnCallback,
+                                    void *pvParam);
+extern int32_t AsyncSockSend(int32_t i32Sock, const void *pvData,
+                             uint32_t ui32Len);
+extern int32_t AsyncSockRecv(int32_t i32Sock, void *pvBuf, uint32_t ui32Size);
+extern void AsyncSockClose(int32_t i32Sock);
+extern uint32_t AsyncSockState(int32_t i32Sock);
+extern uint32_t AsyncSockAddrGet(int32_t i32Sock);
+extern uint32_t AsyncSockRun(uint32_t ui32WaitMs);
+extern void AsyncSockStatsGet(tAsyncSockStats *psStats);
+extern void AsyncSockStatsClear(void);
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ASYNCSOCK_H__
@@ -23,9 +23,12 @@
 //*****************************************************************************
 #include <stdint.h>
 #include <stdbool.h>
+#include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_nvic.h"
 #include "inc/hw_types.h"
 #include "driverlib/debug.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/rom.h"
 #include "driverlib/rom_map.h"
 #include "driverlib/sysctl.h"
@@ -87,6 +90,174 @@ static uint32_t g_ui32CPUUsageTicks;
 //*****************************************************************************
 static uint32_t g_ui32CPUUsagePrevious;
 
+//*****************************************************************************
+//
+// The profiler.  Each profiled interrupt handler and scheduler task pushes a
+// frame on a stack when it starts and pops it when it finishes.  Every push
+// and pop reads the DWT cycle counter and charges the cycles since the last
+// one to the frame on top, so each source is charged only for its own time.
+// Interrupts are masked for the few instructions this takes, since a nested
+// handler updates the same stack.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The index of the profile entry for this frame.
+    //
+    uint32_t ui32Entry;
+
+    //
+    // The cycles charged to this frame so far.
+    //
+    uint32_t ui32Cycles;
+}
+tCPUUsageFrame;
+
+static tCPUUsageProfile g_psCPUUsageProfile[CPU_USAGE_PROFILE_ENTRIES];
+static uint32_t g_ui32CPUUsageEntries;
+static tCPUUsageFrame g_psCPUUsageStack[CPU_USAGE_PROFILE_DEPTH];
+static uint32_t g_ui32CPUUsageDepth;
+
+//
+// Pushes nested too deeply to fit on the stack, which have no frame to pop.
+//
+static uint32_t g_ui32CPUUsageOverflow;
+
+//
+// The cycle count at the last push or pop, and the processor clock rate.
+//
+static uint32_t g_ui32CPUUsageLast;
+static uint32_t g_ui32CPUUsageClock;
+
+//
+// The profile entry for each exception vector and each task, or 0 if it has
+// none yet.  The last entry is shared by the sources which found the table
+// full.
+//
+static uint8_t g_pui8CPUUsageVector[256];
+static uint8_t g_pui8CPUUsageTask[CPU_USAGE_PROFILE_TASKS];
+
+//*****************************************************************************
+//
+// The DWT cycle counter and the number of the exception being handled.
+//
+//*****************************************************************************
+#ifdef HEADLESS
+#define CPUUsageCycles()        CPUUsageModelCycles()
+#define CPUUsageVector()        CPUUsageModelVector()
+#else
+#define DWT_CTRL                0xE0001000  // DWT Control
+#define DWT_CYCCNT              0xE0001004  // DWT Cycle Count
+#define DWT_CTRL_CYCCNTENA      0x00000001  // Enable the cycle counter
+#define NVIC_DBG_INT_TRCENA     0x01000000  // Enable the DWT and ITM
+#define CPUUsageCycles()        HWREG(DWT_CYCCNT)
+#define CPUUsageVector()        (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M)
+#endif
+
+//*****************************************************************************
+//
+// Charges the cycles since the last push or pop to the frame on top of the
+// stack.  Interrupts must be masked.
+//
+//*****************************************************************************
+static void
+CPUUsageCharge(void)
+{
+    uint32_t ui32Now, ui32Cycles;
+    tCPUUsageFrame *psFrame;
+
+    ui32Now = CPUUsageCycles();
+    ui32Cycles = ui32Now - g_ui32CPUUsageLast;
+    g_ui32CPUUsageLast = ui32Now;
+    psFrame = &g_psCPUUsageStack[g_ui32CPUUsageDepth];
+    psFrame->ui32Cycles += ui32Cycles;
+    g_psCPUUsageProfile[psFrame->ui32Entry].ui64Cycles += ui32Cycles;
+}
+
+//*****************************************************************************
+//
+// Starts timing a profile entry, allocating it first if the source has none.
+// Interrupts must be masked.
+//
+//*****************************************************************************
+static void
+CPUUsagePush(uint8_t *pui8Entry, uint32_t ui32Source)
+{
+    tCPUUsageProfile *psProfile;
+    tCPUUsageFrame *psFrame;
+    uint32_t ui32Entry;
+
+    CPUUsageCharge();
+
+    //
+    // Nesting deeper than the stack is charged to the frame on top.
+    //
+    if(g_ui32CPUUsageDepth == (CPU_USAGE_PROFILE_DEPTH - 1))
+    {
+        g_ui32CPUUsageOverflow++;
+        return;
+    }
+
+    //
+    // Give the source a profile entry the first time it runs.  Once they
+    // have run out, sources share the last entry.
+    //
+    ui32Entry = *pui8Entry;
+    if(ui32Entry == 0)
+    {
+        ui32Entry = CPU_USAGE_PROFILE_ENTRIES - 1;
+        if(g_ui32CPUUsageEntries < ui32Entry)
+        {
+            ui32Entry = g_ui32CPUUsageEntries++;
+            g_psCPUUsageProfile[ui32Entry].ui16Source = (uint16_t)ui32Source;
+            *pui8Entry = (uint8_t)ui32Entry;
+        }
+    }
+
+    psProfile = &g_psCPUUsageProfile[ui32Entry];
+    psProfile->ui32Count++;
+    if(g_ui32CPUUsageDepth > psProfile->ui8MaxNesting)
+    {
+        psProfile->ui8MaxNesting = (uint8_t)g_ui32CPUUsageDepth;
+    }
+    psFrame = &g_psCPUUsageStack[++g_ui32CPUUsageDepth];
+    psFrame->ui32Entry = ui32Entry;
+    psFrame->ui32Cycles = 0;
+}
+
+//*****************************************************************************
+//
+// Stops timing the profile entry on top of the stack.  Interrupts must be
+// masked.
+//
+//*****************************************************************************
+static void
+CPUUsagePop(void)
+{
+    tCPUUsageProfile *psProfile;
+    tCPUUsageFrame *psFrame;
+
+    CPUUsageCharge();
+
+    //
+    // A push which was too deep did not make a frame.
+    //
+    if(g_ui32CPUUsageOverflow)
+    {
+        g_ui32CPUUsageOverflow--;
+        return;
+    }
+    ASSERT(g_ui32CPUUsageDepth);
+
+    psFrame = &g_psCPUUsageStack[g_ui32CPUUsageDepth--];
+    psProfile = &g_psCPUUsageProfile[psFrame->ui32Entry];
+    if(psFrame->ui32Cycles > psProfile->ui32MaxCycles)
+    {
+        psProfile->ui32MaxCycles = psFrame->ui32Cycles;
+    }
+}
+
 //*****************************************************************************
 //
 //! Updates the CPU usage for the new timing period.
@@ -198,6 +369,380 @@ CPUUsageInit(uint32_t ui32ClockRate, uint32_t ui32Rate, uint32_t ui32Timer)
     MAP_TimerEnable(g_pui32CPUUsageTimerBase[ui32Timer], TIMER_A);
 }
 
+//*****************************************************************************
+//
+//! Initializes the interrupt and task profiler.
+//!
+//! \param ui32ClockRate is the rate of the processor clock.
+//!
+//! This function starts the DWT cycle counter and clears the profile.  From
+//! then on, interrupt handlers that call CPUUsageISREnter() on entry and
+//! CPUUsageISRExit() on exit, or use the \b CPU_USAGE_ISR_ENTER() and
+//! \b CPU_USAGE_ISR_EXIT() macros, and tasks that are bracketed by
+//! CPUUsageTaskEnter() and CPUUsageTaskExit(), each get an entry counting
+//! their runs, cycles, longest run and deepest nesting.  A scheduler can call
+//! the task functions around each task; see SchedulerTaskHookSet().  All
+//! other time is charged to thread mode.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageProfileInit(uint32_t ui32ClockRate)
+{
+    uint32_t ui32Loop;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+
+#ifndef HEADLESS
+    //
+    // Start the cycle counter.
+    //
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+#endif
+    g_ui32CPUUsageClock = ui32ClockRate;
+
+    //
+    // Forget every source.  Entry 0 is thread mode and the last entry is
+    // shared by the sources which find the table full.
+    //
+    for(ui32Loop = 0; ui32Loop < 256; ui32Loop++)
+    {
+        g_pui8CPUUsageVector[ui32Loop] = 0;
+    }
+    for(ui32Loop = 0; ui32Loop < CPU_USAGE_PROFILE_TASKS; ui32Loop++)
+    {
+        g_pui8CPUUsageTask[ui32Loop] = 0;
+    }
+    g_psCPUUsageProfile[0].ui16Source = 0;
+    g_psCPUUsageProfile[CPU_USAGE_PROFILE_ENTRIES - 1].ui16Source = 0xFFFF;
+    g_ui32CPUUsageEntries = 1;
+
+    //
+    // Start timing thread mode.
+    //
+    g_ui32CPUUsageDepth = 0;
+    g_ui32CPUUsageOverflow = 0;
+    g_psCPUUsageStack[0].ui32Entry = 0;
+    g_psCPUUsageStack[0].ui32Cycles = 0;
+    g_ui32CPUUsageLast = CPUUsageCycles();
+
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+    CPUUsageProfileReset();
+}
+
+//*****************************************************************************
+//
+//! Clears the statistics kept by the profiler.
+//!
+//! This function starts a new profiling period.  The sources seen so far keep
+//! their entries.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageProfileReset(void)
+{
+    tCPUUsageProfile *psProfile;
+    uint32_t ui32Loop;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    CPUUsageCharge();
+    for(ui32Loop = 0; ui32Loop < CPU_USAGE_PROFILE_ENTRIES; ui32Loop++)
+    {
+        psProfile = &g_psCPUUsageProfile[ui32Loop];
+        psProfile->ui8MaxNesting = 0;
+        psProfile->ui32Count = 0;
+        psProfile->ui64Cycles = 0;
+        psProfile->ui32MaxCycles = 0;
+        psProfile->ui32MaxLatency = 0;
+    }
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Marks the entry to an interrupt handler.
+//!
+//! This function is called at the start of a profiled interrupt handler.  The
+//! handler is found from the active exception number, so the same call is
+//! used in every handler.  Each handler which calls this must call
+//! CPUUsageISRExit() before it returns.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageISREnter(void)
+{
+    uint32_t ui32Vector;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    ui32Vector = CPUUsageVector();
+    CPUUsagePush(&g_pui8CPUUsageVector[ui32Vector], ui32Vector);
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Marks the exit from an interrupt handler.
+//!
+//! This function is called at the end of a profiled interrupt handler.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageISRExit(void)
+{
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    CPUUsagePop();
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Records the latency of the interrupt being handled.
+//!
+//! \param ui32Cycles is the number of cycles from the interrupt being raised
+//! to the handler running.
+//!
+//! A handler which can tell how late it is, such as a periodic timer handler
+//! reading how far its timer has counted since the timeout, may call this
+//! after CPUUsageISREnter() to keep the longest latency in its profile.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageISRLatency(uint32_t ui32Cycles)
+{
+    tCPUUsageProfile *psProfile;
+
+    psProfile = &g_psCPUUsageProfile[
+        g_psCPUUsageStack[g_ui32CPUUsageDepth].ui32Entry];
+    if(ui32Cycles > psProfile->ui32MaxLatency)
+    {
+        psProfile->ui32MaxLatency = ui32Cycles;
+    }
+}
+
+//*****************************************************************************
+//
+//! Marks the start of a task.
+//!
+//! \param ui32Task is the index of the task.
+//!
+//! This function is called by the foreground before it runs a task it wants
+//! profiled; tasks with an index of \b CPU_USAGE_PROFILE_TASKS or more share
+//! one entry.  Each call must be followed by a call to CPUUsageTaskExit().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageTaskEnter(uint32_t ui32Task)
+{
+    static uint8_t ui8Shared = CPU_USAGE_PROFILE_ENTRIES - 1;
+    bool bMasked;
+
+    bMasked = IntMasterDisable();
+    if(ui32Task < CPU_USAGE_PROFILE_TASKS)
+    {
+        CPUUsagePush(&g_pui8CPUUsageTask[ui32Task],
+                     CPU_USAGE_SOURCE_TASK | ui32Task);
+    }
+    else
+    {
+        CPUUsagePush(&ui8Shared, 0xFFFF);
+    }
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Marks the end of a task.
+//!
+//! \param ui32Task is the index of the task.
+//!
+//! This function is called by the foreground when a task started with
+//! CPUUsageTaskEnter() returns.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageTaskExit(uint32_t ui32Task)
+{
+    bool bMasked;
+
+    (void)ui32Task;
+    bMasked = IntMasterDisable();
+    CPUUsagePop();
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+
+//*****************************************************************************
+//
+//! Returns the number of profile entries in use.
+//!
+//! \return Returns the number of entries which CPUUsageProfileGet() returns.
+//
+//*****************************************************************************
+uint32_t
+CPUUsageProfileCount(void)
+{
+    return(g_ui32CPUUsageEntries +
+           (g_psCPUUsageProfile[CPU_USAGE_PROFILE_ENTRIES - 1].ui32Count ?
+            1 : 0));
+}
+
+//*****************************************************************************
+//
+//! Returns one of the profile entries.
+//!
+//! \param ui32Index is the index of the entry, less than the value returned by
+//! CPUUsageProfileCount().  Entry 0 is thread mode outside of any task.
+//!
+//! The entry is updated while the sources it counts run.
+//!
+//! \return Returns a pointer to the profile entry.
+//
+//*****************************************************************************
+const tCPUUsageProfile *
+CPUUsageProfileGet(uint32_t ui32Index)
+{
+    ASSERT(ui32Index < CPUUsageProfileCount());
+
+    if(ui32Index >= g_ui32CPUUsageEntries)
+    {
+        ui32Index = CPU_USAGE_PROFILE_ENTRIES - 1;
+    }
+    return(&g_psCPUUsageProfile[ui32Index]);
+}
+
+//*****************************************************************************
+//
+//! Prints the profile.
+//!
+//! \param pfnPrintf is the function to print with, for example UARTprintf().
+//!
+//! This function prints a line for each profile entry with the number of
+//! runs, the share of the processor time since the profile was cleared, the
+//! mean and longest run and the longest latency in cycles, and the deepest
+//! nesting.  Interrupts are masked only while each entry is copied, not while
+//! it is printed.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+CPUUsageProfileReport(tCPUUsagePrintf pfnPrintf)
+{
+    tCPUUsageProfile sProfile;
+    uint64_t ui64Total;
+    uint32_t ui32Loop, ui32Count, ui32Source, ui32Share, ui32Mean;
+    bool bMasked;
+
+    //
+    // Bring the profile up to date and add up the time it covers.
+    //
+    bMasked = IntMasterDisable();
+    CPUUsageCharge();
+    ui32Count = CPUUsageProfileCount();
+    ui64Total = 0;
+    for(ui32Loop = 0; ui32Loop < ui32Count; ui32Loop++)
+    {
+        ui64Total += CPUUsageProfileGet(ui32Loop)->ui64Cycles;
+    }
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+    if(ui64Total == 0)
+    {
+        ui64Total = 1;
+    }
+
+    pfnPrintf("CPU profile over %u.%03u s\n",
+              (uint32_t)(ui64Total / g_ui32CPUUsageClock),
+              (uint32_t)(((ui64Total % g_ui32CPUUsageClock) * 1000) /
+                         g_ui32CPUUsageClock));
+    pfnPrintf("source          runs     cpu     mean      max  latency "
+              "nest\n");
+    for(ui32Loop = 0; ui32Loop < ui32Count; ui32Loop++)
+    {
+        bMasked = IntMasterDisable();
+        sProfile = *CPUUsageProfileGet(ui32Loop);
+        if(!bMasked)
+        {
+            IntMasterEnable();
+        }
+
+        //
+        // Name the source.
+        //
+        ui32Source = sProfile.ui16Source;
+        if(ui32Source == 0)
+        {
+            pfnPrintf("thread    ");
+        }
+        else if(ui32Source == 0xFFFF)
+        {
+            pfnPrintf("other     ");
+        }
+        else if(ui32Source & CPU_USAGE_SOURCE_TASK)
+        {
+            pfnPrintf("task %3u  ", ui32Source & ~CPU_USAGE_SOURCE_TASK);
+        }
+        else if(ui32Source == FAULT_SYSTICK)
+        {
+            pfnPrintf("SysTick   ");
+        }
+        else
+        {
+            pfnPrintf("vector %3u", ui32Source);
+        }
+
+        //
+        // Print the share of the time in tenths of a percent.
+        //
+        ui32Share = (uint32_t)(((sProfile.ui64Cycles * 1000) +
+                                (ui64Total / 2)) / ui64Total);
+        ui32Mean = (sProfile.ui32Count ?
+                    (uint32_t)(sProfile.ui64Cycles / sProfile.ui32Count) : 0);
+        pfnPrintf("%10u %4u.%u%% %8u %8u %8u %4u\n", sProfile.ui32Count,
+                  ui32Share / 10, ui32Share % 10, ui32Mean,
+                  sProfile.ui32MaxCycles, sProfile.ui32MaxLatency,
+                  sProfile.ui8MaxNesting);
+    }
+}
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
@@ -36,6 +36,97 @@ extern "C"
 {
 #endif
 
+//*****************************************************************************
+//
+// The number of interrupt vectors and scheduler tasks the profiler can keep
+// statistics for, and the deepest nesting of them it follows.  Each entry
+// takes 24 bytes of RAM.
+//
+//*****************************************************************************
+#ifndef CPU_USAGE_PROFILE_ENTRIES
+#define CPU_USAGE_PROFILE_ENTRIES       16
+#endif
+#ifndef CPU_USAGE_PROFILE_TASKS
+#define CPU_USAGE_PROFILE_TASKS         32
+#endif
+#ifndef CPU_USAGE_PROFILE_DEPTH
+#define CPU_USAGE_PROFILE_DEPTH         10
+#endif
+
+//*****************************************************************************
+//
+// The ui16Source of a profile entry is an exception vector number, or this
+// flag and the index of a scheduler task.  Entry 0 has source 0 and counts
+// the time spent in thread mode outside of any profiled task.
+//
+//*****************************************************************************
+#define CPU_USAGE_SOURCE_TASK           0x0100
+
+//*****************************************************************************
+//
+//! The statistics the profiler keeps for an interrupt vector or a task.
+//! Times are in processor cycles and count only the time spent in the source
+//! itself, not in the interrupts which preempted it.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The vector number, or \b CPU_USAGE_SOURCE_TASK and the task index.
+    //
+    uint16_t ui16Source;
+
+    //
+    //! The most profiled sources this one has been nested inside.
+    //
+    uint8_t ui8MaxNesting;
+
+    //
+    //! The number of times the source has run.
+    //
+    uint32_t ui32Count;
+
+    //
+    //! The total time spent in the source.
+    //
+    uint64_t ui64Cycles;
+
+    //
+    //! The longest single run of the source.
+    //
+    uint32_t ui32MaxCycles;
+
+    //
+    //! The longest latency passed to CPUUsageISRLatency() for this source.
+    //
+    uint32_t ui32MaxLatency;
+}
+tCPUUsageProfile;
+
+//*****************************************************************************
+//
+// The prototype of the function the profile report is printed with, for
+// example UARTprintf().
+//
+//*****************************************************************************
+typedef void (*tCPUUsagePrintf)(const char *pcString, ...);
+
+//*****************************************************************************
+//
+// Interrupt handlers mark their entry and exit with these macros, which call
+// the profiler only when CPU_USAGE_PROFILE is defined.
+//
+//*****************************************************************************
+#ifdef CPU_USAGE_PROFILE
+#define CPU_USAGE_ISR_ENTER()           CPUUsageISREnter()
+#define CPU_USAGE_ISR_EXIT()            CPUUsageISRExit()
+#define CPU_USAGE_ISR_LATENCY(c)        CPUUsageISRLatency(c)
+#else
+#define CPU_USAGE_ISR_ENTER()
+#define CPU_USAGE_ISR_EXIT()
+#define CPU_USAGE_ISR_LATENCY(c)
+#endif
+
 //*****************************************************************************
 //
 // Prototypes for the CPU utilization routines.
@@ -44,6 +135,25 @@ extern "C"
 extern uint32_t CPUUsageTick(void);
 extern void CPUUsageInit(uint32_t ui32ClockRate, uint32_t ui32Rate,
                          uint32_t ui32Timer);
+extern void CPUUsageProfileInit(uint32_t ui32ClockRate);
+extern void CPUUsageProfileReset(void);
+extern void CPUUsageISREnter(void);
+extern void CPUUsageISRExit(void);
+extern void CPUUsageISRLatency(uint32_t ui32Cycles);
+extern void CPUUsageTaskEnter(uint32_t ui32Task);
+extern void CPUUsageTaskExit(uint32_t ui32Task);
+extern uint32_t CPUUsageProfileCount(void);
+extern const tCPUUsageProfile *CPUUsageProfileGet(uint32_t ui32Index);
+extern void CPUUsageProfileReport(tCPUUsagePrintf pfnPrintf);
+
+#ifdef HEADLESS
+//
+// Host model only: the processor cycle count and the active exception
+// number, supplied by the model.
+//
+extern uint32_t CPUUsageModelCycles(void);
+extern uint32_t CPUUsageModelVector(void);
+#endif
 
 //*****************************************************************************
 //
@@ -0,0 +1,641 @@
+//*****************************************************************************
+//
+// httpclient.c - A blocking HTTP/1.1 client that keeps its connections open
+//                and remembers the addresses of the servers it talks to.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "simplelink.h"
+#include "utils/ustdlib.h"
+#include "utils/httpclient.h"
+
+//*****************************************************************************
+//
+//! \addtogroup httpclient_api
+//! @{
+//
+//*****************************************************************************
+
+#if HTTPCLIENT_DNS_TTL_MS > 4294000
+#error "HTTPCLIENT_DNS_TTL_MS is longer than sl_NonOsTimeUs() can measure"
+#endif
+
+//*****************************************************************************
+//
+// The microsecond count the DNS cache ages its entries by.  Without one,
+// addresses are kept until a connection to them fails.
+//
+//*****************************************************************************
+#ifdef sl_NonOsTimeUs
+#define HttpClientNowUs()       sl_NonOsTimeUs()
+#else
+#define HttpClientNowUs()       0
+#endif
+
+//*****************************************************************************
+//
+// What HttpClientRead() returns when the server closed the connection before
+// sending any of the response, as it does to a connection it has let idle.
+//
+//*****************************************************************************
+#define HTTPCLIENT_STALE        (-32768)
+
+//*****************************************************************************
+//
+// What the client knows about each server.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The server's name, or an empty string if the entry is free.
+    //
+    char pcHost[HTTPCLIENT_MAX_HOST];
+
+    //
+    // The server's address in host order, and the sl_NonOsTimeUs() count
+    // when it was looked up.  The address is 0 when it must be looked up.
+    //
+    uint32_t ui32Addr;
+    uint32_t ui32ResolvedUs;
+
+    //
+    // The connection kept open to the server and the port it is to, or -1.
+    //
+    int16_t i16Sd;
+    uint16_t ui16Port;
+
+    //
+    // The value of g_ui32HttpClientUses when the entry was last used, to
+    // pick the entry a new server takes over.
+    //
+    uint32_t ui32Used;
+}
+tHttpClientHost;
+
+static tHttpClientHost g_psHttpClientHost[HTTPCLIENT_MAX_HOSTS];
+static uint32_t g_ui32HttpClientUses;
+static tHttpClientStats g_sHttpClientStats;
+
+//*****************************************************************************
+//
+// Closes the connection kept open to a server, if there is one.
+//
+//*****************************************************************************
+static void
+HttpClientDrop(tHttpClientHost *psHost)
+{
+    if(psHost->i16Sd >= 0)
+    {
+        sl_Close(psHost->i16Sd);
+        psHost->i16Sd = -1;
+    }
+}
+
+//*****************************************************************************
+//
+// Finds a server's entry, or gives it the free entry or the one used longest
+// ago.
+//
+//*****************************************************************************
+static tHttpClientHost *
+HttpClientFind(const char *pcHost)
+{
+    tHttpClientHost *psHost, *psOldest;
+    uint32_t ui32Idx, ui32Age, ui32Oldest;
+
+    psOldest = 0;
+    ui32Oldest = 0;
+    for(ui32Idx = 0; ui32Idx < HTTPCLIENT_MAX_HOSTS; ui32Idx++)
+    {
+        psHost = &g_psHttpClientHost[ui32Idx];
+        if(!strcmp(psHost->pcHost, pcHost))
+        {
+            psHost->ui32Used = ++g_ui32HttpClientUses;
+            return(psHost);
+        }
+        ui32Age = (psHost->pcHost[0] == 0) ? 0xFFFFFFFF :
+                  (g_ui32HttpClientUses - psHost->ui32Used);
+        if(!psOldest || (ui32Age > ui32Oldest))
+        {
+            psOldest = psHost;
+            ui32Oldest = ui32Age;
+        }
+    }
+
+    HttpClientDrop(psOldest);
+    strcpy(psOldest->pcHost, pcHost);
+    psOldest->ui32Addr = 0;
+    psOldest->ui32Used = ++g_ui32HttpClientUses;
+    return(psOldest);
+}
+
+//*****************************************************************************
+//
+// Makes sure there is a connection open to a server, on the given port.
+//
+// Returns 1 if the connection left open by an earlier request is to be used,
+// 0 if a new one was opened, or a negative SimpleLink error.
+//
+//*****************************************************************************
+static int32_t
+HttpClientOpen(tHttpClientHost *psHost, uint16_t ui16Port)
+{
+    SlSockAddrIn_t sAddr;
+    SlTimeval_t sTimeout;
+    unsigned long ulAddr;
+    uint32_t ui32Start;
+    int32_t i32Status, i32Sd;
+    bool bCached;
+
+    if(psHost->i16Sd >= 0)
+    {
+        if(psHost->ui16Port == ui16Port)
+        {
+            g_sHttpClientStats.ui32Reuses++;
+            return(1);
+        }
+        HttpClientDrop(psHost);
+    }
+
+    ui32Start = HttpClientNowUs();
+    for(;;)
+    {
+        //
+        // Look the name up, unless the answer from last time is still good.
+        //
+        bCached = (psHost->ui32Addr != 0) &&
+                  ((ui32Start - psHost->ui32ResolvedUs) <
+                   (HTTPCLIENT_DNS_TTL_MS * 1000));
+        if(bCached)
+        {
+            g_sHttpClientStats.ui32CacheHits++;
+        }
+        else
+        {
+            i32Status = sl_NetAppDnsGetHostByName((char *)psHost->pcHost,
+                                                  strlen(psHost->pcHost),
+                                                  &ulAddr, SL_AF_INET);
+            g_sHttpClientStats.ui32Lookups++;
+            g_sHttpClientStats.ui32RoundTrips++;
+            if(i32Status < 0)
+            {
+                break;
+            }
+            psHost->ui32Addr = ulAddr;
+            psHost->ui32ResolvedUs = HttpClientNowUs();
+        }
+
+        i32Status = i32Sd = sl_Socket(SL_AF_INET, SL_SOCK_STREAM, 0);
+        if(i32Sd < 0)
+        {
+            break;
+        }
+        sTimeout.tv_sec = HTTPCLIENT_TIMEOUT_MS / 1000;
+        sTimeout.tv_usec = (HTTPCLIENT_TIMEOUT_MS % 1000) * 1000;
+        sl_SetSockOpt(i32Sd, SL_SOL_SOCKET, SL_SO_RCVTIMEO, &sTimeout,
+                      sizeof(sTimeout));
+
+        sAddr.sin_family = SL_AF_INET;
+        sAddr.sin_port = sl_Htons(ui16Port);
+        sAddr.sin_addr.s_addr = sl_Htonl(psHost->ui32Addr);
+        i32Status = sl_Connect(i32Sd, (SlSockAddr_t *)&sAddr, sizeof(sAddr));
+        g_sHttpClientStats.ui32Connects++;
+        g_sHttpClientStats.ui32RoundTrips++;
+        if(i32Status >= 0)
+        {
+            psHost->i16Sd = i32Sd;
+            psHost->ui16Port = ui16Port;
+            break;
+        }
+        sl_Close(i32Sd);
+
+        //
+        // The server may have moved since the address was cached; look it
+        // up again, once.
+        //
+        psHost->ui32Addr = 0;
+        if(!bCached)
+        {
+            break;
+        }
+    }
+
+    g_sHttpClientStats.ui32SetupUs += HttpClientNowUs() - ui32Start;
+    return((i32Status < 0) ? i32Status : 0);
+}
+
+//*****************************************************************************
+//
+// Finds a header line in a response header, which ends with an empty line,
+// and returns its value, or NULL if it is not there.
+//
+//*****************************************************************************
+static const char *
+HttpClientHeader(const char *pcHead, const char *pcName)
+{
+    uint32_t ui32Len = strlen(pcName);
+
+    for(pcHead = strstr(pcHead, "\r\n"); pcHead && (pcHead[2] != '\r');
+        pcHead = strstr(pcHead + 2, "\r\n"))
+    {
+        if(!ustrncasecmp(pcHead + 2, pcName, ui32Len) &&
+           (pcHead[ui32Len + 2] == ':'))
+        {
+            for(pcHead += ui32Len + 3; *pcHead == ' '; pcHead++)
+            {
+            }
+            return(pcHead);
+        }
+    }
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Reads one response from a connection.
+//
+// pcBuf holds ui32Room bytes, and its first *pui32Have bytes have already
+// been received, after the end of the last response.  The response is placed
+// there, cut short to fit if it must be, and followed by a terminator; the
+// rest of a longer body is read and dropped so that the connection stays in
+// step.  Any bytes of the next response that came with it follow the
+// terminator, and *pui32Have is set to their count.  *pbKeep is set if the
+// server will take more requests on the connection.
+//
+// Returns the length of the response as stored, HTTPCLIENT_STALE, or a
+// negative SimpleLink error.
+//
+//*****************************************************************************
+static int32_t
+HttpClientRead(int16_t i16Sd, char *pcBuf, uint32_t ui32Room,
+               uint32_t *pui32Have, bool *pbKeep)
+{
+    static char pcDiscard[256];
+    const char *pcValue, *pcEnd;
+    uint32_t ui32Have, ui32Head, ui32Total, ui32Dropped, ui32Len, ui32Code;
+    int32_t i32Len;
+    bool bLength;
+
+    ui32Have = *pui32Have;
+    ui32Head = 0;
+    ui32Total = 0;
+    ui32Dropped = 0;
+    bLength = false;
+    *pbKeep = false;
+    if(ui32Room == 0)
+    {
+        return(SL_ENOBUFS);
+    }
+
+    for(;;)
+    {
+        //
+        // Once the whole header is in, work out where the response ends.
+        //
+        pcBuf[ui32Have] = 0;
+        if(!ui32Head && ((pcEnd = strstr(pcBuf, "\r\n\r\n")) != 0))
+        {
+            ui32Head = pcEnd + 4 - pcBuf;
+            if(strncmp(pcBuf, "HTTP/1.", 7))
+            {
+                return(SL_EPROTONOSUPPORT);
+            }
+            pcValue = HttpClientHeader(pcBuf, "Connection");
+            *pbKeep = (pcBuf[7] == '1') ?
+                      !(pcValue && !ustrncasecmp(pcValue, "close", 5)) :
+                      (pcValue && !ustrncasecmp(pcValue, "keep-alive", 10));
+            ui32Code = ustrtoul(pcBuf + 9, 0, 10);
+            if(HttpClientHeader(pcBuf, "Transfer-Encoding"))
+            {
+                return(SL_EOPNOTSUPP);
+            }
+            if((ui32Code < 200) || (ui32Code == 204) || (ui32Code == 304))
+            {
+                bLength = true;
+                ui32Total = ui32Head;
+            }
+            else if((pcValue = HttpClientHeader(pcBuf,
+                                                "Content-Length")) != 0)
+            {
+                bLength = true;
+                ui32Total = ui32Head + ustrtoul(pcValue, 0, 10);
+            }
+            else
+            {
+                //
+                // The body runs until the server closes the connection.
+                //
+                *pbKeep = false;
+            }
+        }
+        if(bLength && ((ui32Have + ui32Dropped) >= ui32Total))
+        {
+            break;
+        }
+
+        //
+        // Read more, but never past the end of a response of known length,
+        // and into the discard buffer once the caller's is full.
+        //
+        if(ui32Have < (ui32Room - 1))
+        {
+            ui32Len = ui32Room - 1 - ui32Have;
+            if(bLength && (ui32Len > (ui32Total - ui32Have)))
+            {
+                ui32Len = ui32Total - ui32Have;
+            }
+            i32Len = sl_Recv(i16Sd, pcBuf + ui32Have, ui32Len, 0);
+        }
+        else if(!ui32Head)
+        {
+            return(SL_ENOBUFS);
+        }
+        else
+        {
+            ui32Len = sizeof(pcDiscard);
+            if(bLength && (ui32Len > (ui32Total - ui32Have - ui32Dropped)))
+            {
+                ui32Len = ui32Total - ui32Have - ui32Dropped;
+            }
+            i32Len = sl_Recv(i16Sd, pcDiscard, ui32Len, 0);
+            if(i32Len > 0)
+            {
+                ui32Dropped += i32Len;
+                continue;
+            }
+        }
+
+        if(i32Len > 0)
+        {
+            ui32Have += i32Len;
+        }
+        else if((i32Len == 0) && ui32Head && !bLength)
+        {
+            break;
+        }
+        else if(i32Len == SL_EAGAIN)
+        {
+            return(SL_ETIMEDOUT);
+        }
+        else if((ui32Have == 0) && (ui32Dropped == 0))
+        {
+            return(HTTPCLIENT_STALE);
+        }
+        else
+        {
+            return((i32Len < 0) ? i32Len : SL_ENOTCONN);
+        }
+    }
+
+    //
+    // Terminate the response, moving any of the next one up to make room.
+    //
+    ui32Len = (bLength && (ui32Have > ui32Total)) ? ui32Total : ui32Have;
+    memmove(pcBuf + ui32Len + 1, pcBuf + ui32Len, ui32Have - ui32Len);
+    pcBuf[ui32Len] = 0;
+    *pui32Have = ui32Have - ui32Len;
+    return(ui32Len);
+}
+
+//*****************************************************************************
+//
+//! Initializes the HTTP client.
+//!
+//! This function forgets every server, without closing connections.  It must
+//! be called once after sl_Start(), before any other function in this module.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HttpClientInit(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < HTTPCLIENT_MAX_HOSTS; ui32Idx++)
+    {
+        g_psHttpClientHost[ui32Idx].pcHost[0] = 0;
+        g_psHttpClientHost[ui32Idx].i16Sd = -1;
+    }
+    memset(&g_sHttpClientStats, 0, sizeof(g_sHttpClientStats));
+}
+
+//*****************************************************************************
+//
+//! Sends a request to a server and reads its response.
+//!
+//! \param pcHost is the server's host name.
+//! \param ui16Port is the server's TCP port.
+//! \param pcRequest is the whole request, header and body.
+//! \param pcResponse points to the buffer for the response.
+//! \param ui32Size is the size of the buffer in bytes.
+//!
+//! This function is HttpClientPipeline() with a single request.
+//!
+//! \return Returns 0 once the response is in \e pcResponse, or a negative
+//! SimpleLink error.
+//
+//*****************************************************************************
+int32_t
+HttpClientRequest(const char *pcHost, uint16_t ui16Port,
+                  const char *pcRequest, char *pcResponse, uint32_t ui32Size)
+{
+    char *pcStart;
+    int32_t i32Status;
+
+    i32Status = HttpClientPipeline(pcHost, ui16Port, &pcRequest, 1,
+                                   pcResponse, ui32Size, &pcStart);
+    return((i32Status < 0) ? i32Status : 0);
+}
+
+//*****************************************************************************
+//
+//! Sends several requests to a server at once and reads their responses.
+//!
+//! \param pcHost is the server's host name.
+//! \param ui16Port is the server's TCP port.
+//! \param ppcRequests is an array of \e ui32Count requests, each the whole
+//! request, header and body.
+//! \param ui32Count is the number of requests.
+//! \param pcBuf points to the buffer for the responses.
+//! \param ui32Size is the size of the buffer in bytes.
+//! \param ppcResponses is an array that is filled with \e ui32Count pointers
+//! to the responses in \e pcBuf.
+//!
+//! The requests must be HTTP/1.1 requests that are safe to send again, such
+//! as GETs, since they are sent again on a new connection if the server
+//! closes the one they went out on before answering them.  They are all sent
+//! back to back on one connection, and the server answers them in order, so
+//! that the batch costs one round trip rather than one for each.
+//!
+//! The connection is kept open afterwards, for the next request to the same
+//! server and port, unless the server says it will close it.  A connection
+//! is only opened when there is none, and then the server's address is
+//! looked up only if the one found last time is older than
+//! \b HTTPCLIENT_DNS_TTL_MS.  A kept-open connection that the server has
+//! since closed is opened again, and a cached address that cannot be
+//! connected to is looked up again.
+//!
+//! Each response, header and body, is placed in \e pcBuf after the one
+//! before it and terminated with a 0.  A response that does not fit is cut
+//! short, and those after it get no room; the buffer must be large enough for
+//! the header of each response that is wanted.
+//!
+//! \return Returns the number of responses read, which is \e ui32Count unless
+//! an error stopped the batch, or a negative SimpleLink error if there were
+//! none.
+//
+//*****************************************************************************
+int32_t
+HttpClientPipeline(const char *pcHost, uint16_t ui16Port,
+                   const char * const *ppcRequests, uint32_t ui32Count,
+                   char *pcBuf, uint32_t ui32Size, char **ppcResponses)
+{
+    tHttpClientHost *psHost;
+    uint32_t ui32Done, ui32Idx, ui32Pos, ui32Have;
+    int32_t i32Status, i32Len;
+    bool bKeep, bRetry;
+
+    if((strlen(pcHost) >= HTTPCLIENT_MAX_HOST) || (ui32Size == 0))
+    {
+        return(SL_EINVAL);
+    }
+    psHost = HttpClientFind(pcHost);
+    g_sHttpClientStats.ui32Requests += ui32Count;
+
+    ui32Done = 0;
+    ui32Pos = 0;
+    i32Status = 0;
+    bRetry = true;
+    while(ui32Done < ui32Count)
+    {
+        i32Status = HttpClientOpen(psHost, ui16Port);
+        if(i32Status < 0)
+        {
+            break;
+        }
+
+        //
+        // Send every request still unanswered before reading any response.
+        //
+        for(ui32Idx = ui32Done; ui32Idx < ui32Count; ui32Idx++)
+        {
+            i32Len = strlen(ppcRequests[ui32Idx]);
+            i32Status = sl_Send(psHost->i16Sd, ppcRequests[ui32Idx], i32Len,
+                                0);
+            if(i32Status != i32Len)
+            {
+                i32Status = (i32Status < 0) ? i32Status : SL_ENOTCONN;
+                break;
+            }
+        }
+        g_sHttpClientStats.ui32RoundTrips++;
+
+        //
+        // Read the responses in the order the requests went out.
+        //
+        ui32Have = 0;
+        while((ui32Idx == ui32Count) && (ui32Done < ui32Count))
+        {
+            i32Status = HttpClientRead(psHost->i16Sd, pcBuf + ui32Pos,
+                                       ui32Size - ui32Pos, &ui32Have, &bKeep);
+            if(i32Status < 0)
+            {
+                break;
+            }
+            ppcResponses[ui32Done++] = pcBuf + ui32Pos;
+            ui32Pos += i32Status + 1;
+            bRetry = true;
+            if(!bKeep)
+            {
+                HttpClientDrop(psHost);
+                break;
+            }
+        }
+        if(i32Status >= 0)
+        {
+            continue;
+        }
+
+        //
+        // The connection is no good now.  If the server closed it before
+        // answering, as it does one left idle too long, open another and
+        // send the rest again, once for each response.
+        //
+        HttpClientDrop(psHost);
+        if(((i32Status == HTTPCLIENT_STALE) || (ui32Idx < ui32Count)) &&
+           bRetry)
+        {
+            g_sHttpClientStats.ui32Reconnects++;
+            bRetry = false;
+            continue;
+        }
+        if(i32Status == HTTPCLIENT_STALE)
+        {
+            i32Status = SL_ENOTCONN;
+        }
+        break;
+    }
+
+    return(ui32Done ? (int32_t)ui32Done : i32Status);
+}
+
+//*****************************************************************************
+//
+//! Closes every connection kept open.
+//!
+//! This function should be called before sl_Stop().  The cached addresses
+//! are kept.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HttpClientClose(void)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < HTTPCLIENT_MAX_HOSTS; ui32Idx++)
+    {
+        HttpClientDrop(&g_psHttpClientHost[ui32Idx]);
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads the client's counts.
+//!
+//! \param psStats points to the structure to fill in.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HttpClientStatsGet(tHttpClientStats *psStats)
+{
+    *psStats = g_sHttpClientStats;
+}
+
+//*****************************************************************************
+//
+//! Zeroes the client's counts.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+HttpClientStatsClear(void)
+{
+    memset(&g_sHttpClientStats, 0, sizeof(g_sHttpClientStats));
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,148 @@
+//*****************************************************************************
+//
+// httpclient.h - Prototypes for the keep-alive HTTP/1.1 client.
+//
+//*****************************************************************************
+
+#ifndef __HTTPCLIENT_H__
+#define __HTTPCLIENT_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+//! \addtogroup httpclient_api
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// The most servers remembered at once.  Each has a DNS cache entry and may
+// hold one SimpleLink socket open between requests; the one used longest ago
+// makes way for a new server.
+//
+//*****************************************************************************
+#ifndef HTTPCLIENT_MAX_HOSTS
+#define HTTPCLIENT_MAX_HOSTS    2
+#endif
+
+//*****************************************************************************
+//
+// The longest host name, with its terminator, that is cached.
+//
+//*****************************************************************************
+#define HTTPCLIENT_MAX_HOST     64
+
+//*****************************************************************************
+//
+// How long, in milliseconds, an address found by DNS is used before it is
+// looked up again.  The network processor does not pass on the TTL of the
+// answer, so this stands in for it.  The age is measured with the
+// microsecond count from sl_NonOsTimeUs(), which limits it to 71 minutes.
+//
+//*****************************************************************************
+#ifndef HTTPCLIENT_DNS_TTL_MS
+#define HTTPCLIENT_DNS_TTL_MS   300000
+#endif
+
+//*****************************************************************************
+//
+// How long, in milliseconds, to wait for each part of a response before
+// giving up on the server.
+//
+//*****************************************************************************
+#ifndef HTTPCLIENT_TIMEOUT_MS
+#define HTTPCLIENT_TIMEOUT_MS   5000
+#endif
+
+//*****************************************************************************
+//
+//! Counts kept by the client, to see how much connection setup keeping
+//! connections open saves.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of responses asked for.
+    //
+    uint32_t ui32Requests;
+
+    //
+    //! The number of DNS lookups made, and the number of times an address
+    //! was taken from the cache instead.
+    //
+    uint32_t ui32Lookups;
+    uint32_t ui32CacheHits;
+
+    //
+    //! The number of TCP connections opened, and the number of times a
+    //! connection kept open from an earlier request was used instead.
+    //
+    uint32_t ui32Connects;
+    uint32_t ui32Reuses;
+
+    //
+    //! The number of kept-open connections that turned out to have been
+    //! closed by the server, and were opened again for the same requests.
+    //
+    uint32_t ui32Reconnects;
+
+    //
+    //! The number of round trips to the network: each DNS lookup, each TCP
+    //! handshake, and each batch of requests sent before reading the
+    //! responses.
+    //
+    uint32_t ui32RoundTrips;
+
+    //
+    //! The time, in microseconds, spent on DNS lookups and TCP handshakes.
+    //
+    uint32_t ui32SetupUs;
+}
+tHttpClientStats;
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void HttpClientInit(void);
+extern int32_t HttpClientRequest(const char *pcHost, uint16_t ui16Port,
+                                 const char *pcRequest, char *pcResponse,
+                                 uint32_t ui32Size);
+extern int32_t HttpClientPipeline(const char *pcHost, uint16_t ui16Port,
+                                  const char * const *ppcRequests,
+                                  uint32_t ui32Count, char *pcBuf,
+                                  uint32_t ui32Size, char **ppcResponses);
+extern void HttpClientClose(void);
+extern void HttpClientStatsGet(tHttpClientStats *psStats);
+extern void HttpClientStatsClear(void);
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __HTTPCLIENT_H__
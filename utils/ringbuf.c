@@ -24,6 +24,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "inc/hw_types.h"
 #include "driverlib/debug.h"
 #include "driverlib/interrupt.h"
@@ -704,6 +705,512 @@ RingBufInit(tRingBufObject *psRingBuf, uint8_t *pui8Buf,
     psRingBuf->ui32WriteIndex = psRingBuf->ui32ReadIndex = 0;
 }
 
+//*****************************************************************************
+//
+// Single-producer/single-consumer ring buffers.
+//
+// One context (for example the foreground) only writes and another (for
+// example an interrupt handler) only reads.  Each index is then stored by
+// just one side, so no read/modify/write has to be protected and interrupts
+// are never disabled.  The indices run freely and are masked when the buffer
+// is accessed, which needs a power-of-two size and lets the buffer be
+// completely full: used is write - read, and free is size - used.
+//
+// The data must be in memory before the other side sees the new index.
+// SPSC_LOAD reads an index with acquire ordering and SPSC_STORE writes one
+// with release ordering; on a Cortex-M a DMB does both for the CPU and for
+// other bus masters such as the uDMA.
+//
+//*****************************************************************************
+#if defined(__GNUC__)
+#define SPSC_LOAD(x)            __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define SPSC_STORE(x, v)        __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#elif defined(__CC_ARM)
+#define SPSC_LOAD(x)            SPSCLoad(&(x))
+#define SPSC_STORE(x, v)        do { __dmb(0xF); (x) = (v); } while(0)
+static __inline uint32_t
+SPSCLoad(volatile uint32_t *pui32Index)
+{
+    uint32_t ui32Value;
+
+    ui32Value = *pui32Index;
+    __dmb(0xF);
+    return(ui32Value);
+}
+#elif defined(__ICCARM__)
+#include <intrinsics.h>
+#define SPSC_LOAD(x)            SPSCLoad(&(x))
+#define SPSC_STORE(x, v)        do { __DMB(); (x) = (v); } while(0)
+static inline uint32_t
+SPSCLoad(volatile uint32_t *pui32Index)
+{
+    uint32_t ui32Value;
+
+    ui32Value = *pui32Index;
+    __DMB();
+    return(ui32Value);
+}
+#else
+//
+// Volatile index accesses stay in program order, which is enough on a
+// single Cortex-M core as long as the compiler does not move the buffer
+// accesses across them.
+//
+#define SPSC_LOAD(x)            (x)
+#define SPSC_STORE(x, v)        ((x) = (v))
+#endif
+
+//*****************************************************************************
+//
+//! Initializes a single-producer/single-consumer ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to be initialized.
+//! \param pui8Buf points to the data buffer to be used for the ring buffer.
+//! \param ui32Size is the size of the buffer in bytes, a power of two.
+//!
+//! This function initializes a ring buffer that is written by one context
+//! and read by another without ever disabling interrupts.  Only the
+//! producer may call RingBufSPSCWrite(), RingBufSPSCWriteOne(),
+//! RingBufSPSCReserve(), RingBufSPSCCommit(), RingBufSPSCFree() and
+//! RingBufSPSCContigFree(); only the consumer may call RingBufSPSCRead(),
+//! RingBufSPSCReadOne(), RingBufSPSCPeek(), RingBufSPSCConsume(),
+//! RingBufSPSCFlush(), RingBufSPSCUsed() and RingBufSPSCContigUsed().
+//! All \e ui32Size bytes can hold data.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RingBufSPSCInit(tRingBufSPSC *psRingBuf, uint8_t *pui8Buf, uint32_t ui32Size)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT(pui8Buf != NULL);
+    ASSERT((ui32Size != 0) && ((ui32Size & (ui32Size - 1)) == 0));
+
+    //
+    // Initialize the ring buffer object.
+    //
+    psRingBuf->ui32Mask = ui32Size - 1;
+    psRingBuf->pui8Buf = pui8Buf;
+    psRingBuf->ui32WriteIndex = psRingBuf->ui32ReadIndex = 0;
+}
+
+//*****************************************************************************
+//
+//! Returns number of bytes stored in an SPSC ring buffer.
+//!
+//! \param psRingBuf is the ring buffer object to check.
+//!
+//! This function is called by the consumer.
+//!
+//! \return Returns the number of bytes stored in the ring buffer.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCUsed(tRingBufSPSC *psRingBuf)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    return(SPSC_LOAD(psRingBuf->ui32WriteIndex) - psRingBuf->ui32ReadIndex);
+}
+
+//*****************************************************************************
+//
+//! Returns number of bytes available in an SPSC ring buffer.
+//!
+//! \param psRingBuf is the ring buffer object to check.
+//!
+//! This function is called by the producer.
+//!
+//! \return Returns the number of bytes available in the ring buffer.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCFree(tRingBufSPSC *psRingBuf)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    return((psRingBuf->ui32Mask + 1) -
+           (psRingBuf->ui32WriteIndex - SPSC_LOAD(psRingBuf->ui32ReadIndex)));
+}
+
+//*****************************************************************************
+//
+//! Returns number of contiguous bytes of data stored in an SPSC ring buffer
+//! ahead of the current read pointer.
+//!
+//! \param psRingBuf is the ring buffer object to check.
+//!
+//! This function returns the largest block of data, starting at the read
+//! pointer, which does not straddle the buffer wrap, the same as
+//! RingBufContigUsed().  It is called by the consumer.
+//!
+//! \return Returns the number of contiguous bytes available.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCContigUsed(tRingBufSPSC *psRingBuf)
+{
+    uint32_t ui32Used, ui32ToEnd;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    ui32Used = SPSC_LOAD(psRingBuf->ui32WriteIndex) - psRingBuf->ui32ReadIndex;
+    ui32ToEnd = (psRingBuf->ui32Mask + 1) -
+                (psRingBuf->ui32ReadIndex & psRingBuf->ui32Mask);
+    return((ui32Used < ui32ToEnd) ? ui32Used : ui32ToEnd);
+}
+
+//*****************************************************************************
+//
+//! Returns number of contiguous free bytes available in an SPSC ring buffer.
+//!
+//! \param psRingBuf is the ring buffer object to check.
+//!
+//! This function returns the largest block of free space, starting at the
+//! write pointer, which does not straddle the buffer wrap, the same as
+//! RingBufContigFree().  It is called by the producer.
+//!
+//! \return Returns the number of contiguous bytes available in the ring
+//! buffer.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCContigFree(tRingBufSPSC *psRingBuf)
+{
+    uint32_t ui32Free, ui32ToEnd;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    ui32Free = RingBufSPSCFree(psRingBuf);
+    ui32ToEnd = (psRingBuf->ui32Mask + 1) -
+                (psRingBuf->ui32WriteIndex & psRingBuf->ui32Mask);
+    return((ui32Free < ui32ToEnd) ? ui32Free : ui32ToEnd);
+}
+
+//*****************************************************************************
+//
+//! Reserves contiguous space in an SPSC ring buffer for the producer to
+//! fill in place.
+//!
+//! \param psRingBuf points to the ring buffer to be written to.
+//! \param ppui8Data is set to where the data should be put.
+//!
+//! This function lets the producer write straight into the ring buffer, for
+//! example with the uDMA or a driver that fills a block, instead of copying
+//! from a buffer of its own.  Once the bytes are written, call
+//! RingBufSPSCCommit() with the number written.
+//!
+//! \return Returns the number of bytes that may be written at
+//! \e *ppui8Data, 0 if the buffer is full.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCReserve(tRingBufSPSC *psRingBuf, uint8_t **ppui8Data)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT(ppui8Data != NULL);
+
+    *ppui8Data = &psRingBuf->pui8Buf[psRingBuf->ui32WriteIndex &
+                                     psRingBuf->ui32Mask];
+    return(RingBufSPSCContigFree(psRingBuf));
+}
+
+//*****************************************************************************
+//
+//! Adds bytes written in place to an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to which bytes have been added.
+//! \param ui32NumBytes is the number of bytes added, no more than the last
+//! RingBufSPSCReserve() returned.
+//!
+//! This function makes the bytes visible to the consumer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RingBufSPSCCommit(tRingBufSPSC *psRingBuf, uint32_t ui32NumBytes)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT(ui32NumBytes <= RingBufSPSCFree(psRingBuf));
+
+    SPSC_STORE(psRingBuf->ui32WriteIndex,
+               psRingBuf->ui32WriteIndex + ui32NumBytes);
+}
+
+//*****************************************************************************
+//
+//! Returns the contiguous data at the read pointer of an SPSC ring buffer
+//! without removing it.
+//!
+//! \param psRingBuf points to the ring buffer to be read from.
+//! \param ppui8Data is set to the first byte of data.
+//!
+//! This function lets the consumer use the data where it is, for example as
+//! the source of a uDMA transfer, instead of copying it out.  Call
+//! RingBufSPSCConsume() when it is no longer needed.
+//!
+//! \return Returns the number of bytes that may be read at \e *ppui8Data,
+//! 0 if the buffer is empty.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCPeek(tRingBufSPSC *psRingBuf, uint8_t **ppui8Data)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT(ppui8Data != NULL);
+
+    *ppui8Data = &psRingBuf->pui8Buf[psRingBuf->ui32ReadIndex &
+                                     psRingBuf->ui32Mask];
+    return(RingBufSPSCContigUsed(psRingBuf));
+}
+
+//*****************************************************************************
+//
+//! Removes bytes from an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer from which bytes are to be
+//! removed.
+//! \param ui32NumBytes is the number of bytes to be removed.
+//!
+//! This function frees the space for the producer.  If \e ui32NumBytes is
+//! larger than the number of bytes in the buffer, the buffer is emptied.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RingBufSPSCConsume(tRingBufSPSC *psRingBuf, uint32_t ui32NumBytes)
+{
+    uint32_t ui32Used;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    ui32Used = RingBufSPSCUsed(psRingBuf);
+    if(ui32NumBytes > ui32Used)
+    {
+        ui32NumBytes = ui32Used;
+    }
+    SPSC_STORE(psRingBuf->ui32ReadIndex,
+               psRingBuf->ui32ReadIndex + ui32NumBytes);
+}
+
+//*****************************************************************************
+//
+//! Empties an SPSC ring buffer.
+//!
+//! \param psRingBuf is the ring buffer object to empty.
+//!
+//! This function discards all data in the ring buffer.  It is called by the
+//! consumer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+RingBufSPSCFlush(tRingBufSPSC *psRingBuf)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    SPSC_STORE(psRingBuf->ui32ReadIndex, SPSC_LOAD(psRingBuf->ui32WriteIndex));
+}
+
+//*****************************************************************************
+//
+//! Writes data to an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to be written to.
+//! \param pui8Data points to the data to be written.
+//! \param ui32Length is the number of bytes to be written.
+//!
+//! This function copies as much of the data as there is room for, in at most
+//! two blocks, one up to the buffer wrap and one from the start of the
+//! buffer.  It is called by the producer.
+//!
+//! \return Returns the number of bytes written.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCWrite(tRingBufSPSC *psRingBuf, const uint8_t *pui8Data,
+                 uint32_t ui32Length)
+{
+    uint32_t ui32Free, ui32Write, ui32First;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT((pui8Data != NULL) || (ui32Length == 0));
+
+    ui32Free = RingBufSPSCFree(psRingBuf);
+    if(ui32Length > ui32Free)
+    {
+        ui32Length = ui32Free;
+    }
+    ui32Write = psRingBuf->ui32WriteIndex & psRingBuf->ui32Mask;
+    ui32First = (psRingBuf->ui32Mask + 1) - ui32Write;
+    if(ui32First > ui32Length)
+    {
+        ui32First = ui32Length;
+    }
+    memcpy(&psRingBuf->pui8Buf[ui32Write], pui8Data, ui32First);
+    if(ui32Length != ui32First)
+    {
+        memcpy(psRingBuf->pui8Buf, pui8Data + ui32First,
+               ui32Length - ui32First);
+    }
+    SPSC_STORE(psRingBuf->ui32WriteIndex,
+               psRingBuf->ui32WriteIndex + ui32Length);
+    return(ui32Length);
+}
+
+//*****************************************************************************
+//
+//! Reads data from an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to be read from.
+//! \param pui8Data points to where the data should be stored.
+//! \param ui32Length is the most bytes to be read.
+//!
+//! This function copies out as much of the requested data as the buffer
+//! holds, in at most two blocks.  It is called by the consumer.
+//!
+//! \return Returns the number of bytes read.
+//
+//*****************************************************************************
+uint32_t
+RingBufSPSCRead(tRingBufSPSC *psRingBuf, uint8_t *pui8Data,
+                uint32_t ui32Length)
+{
+    uint32_t ui32Used, ui32Read, ui32First;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT((pui8Data != NULL) || (ui32Length == 0));
+
+    ui32Used = RingBufSPSCUsed(psRingBuf);
+    if(ui32Length > ui32Used)
+    {
+        ui32Length = ui32Used;
+    }
+    ui32Read = psRingBuf->ui32ReadIndex & psRingBuf->ui32Mask;
+    ui32First = (psRingBuf->ui32Mask + 1) - ui32Read;
+    if(ui32First > ui32Length)
+    {
+        ui32First = ui32Length;
+    }
+    memcpy(pui8Data, &psRingBuf->pui8Buf[ui32Read], ui32First);
+    if(ui32Length != ui32First)
+    {
+        memcpy(pui8Data + ui32First, psRingBuf->pui8Buf,
+               ui32Length - ui32First);
+    }
+    SPSC_STORE(psRingBuf->ui32ReadIndex,
+               psRingBuf->ui32ReadIndex + ui32Length);
+    return(ui32Length);
+}
+
+//*****************************************************************************
+//
+//! Writes a single byte of data to an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to be written to.
+//! \param ui8Data is the byte to be written.
+//!
+//! This function is called by the producer.
+//!
+//! \return Returns \b true if the byte was written or \b false if the buffer
+//! is full.
+//
+//*****************************************************************************
+bool
+RingBufSPSCWriteOne(tRingBufSPSC *psRingBuf, uint8_t ui8Data)
+{
+    uint32_t ui32Write;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+
+    ui32Write = psRingBuf->ui32WriteIndex;
+    if((ui32Write - SPSC_LOAD(psRingBuf->ui32ReadIndex)) >
+       psRingBuf->ui32Mask)
+    {
+        return(false);
+    }
+    psRingBuf->pui8Buf[ui32Write & psRingBuf->ui32Mask] = ui8Data;
+    SPSC_STORE(psRingBuf->ui32WriteIndex, ui32Write + 1);
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Reads a single byte of data from an SPSC ring buffer.
+//!
+//! \param psRingBuf points to the ring buffer to be read from.
+//! \param pui8Data points to where the byte should be stored.
+//!
+//! This function is called by the consumer.
+//!
+//! \return Returns \b true if a byte was read or \b false if the buffer is
+//! empty.
+//
+//*****************************************************************************
+bool
+RingBufSPSCReadOne(tRingBufSPSC *psRingBuf, uint8_t *pui8Data)
+{
+    uint32_t ui32Read;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(psRingBuf != NULL);
+    ASSERT(pui8Data != NULL);
+
+    ui32Read = psRingBuf->ui32ReadIndex;
+    if(SPSC_LOAD(psRingBuf->ui32WriteIndex) == ui32Read)
+    {
+        return(false);
+    }
+    *pui8Data = psRingBuf->pui8Buf[ui32Read & psRingBuf->ui32Mask];
+    SPSC_STORE(psRingBuf->ui32ReadIndex, ui32Read + 1);
+    return(true);
+}
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
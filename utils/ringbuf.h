@@ -67,6 +67,39 @@ typedef struct
 }
 tRingBufObject;
 
+//*****************************************************************************
+//
+// The structure used for a single-producer/single-consumer ring buffer.  The
+// indices run freely and are masked with ui32Mask, so the size must be a
+// power of two.  Each index is written by only one side, so neither side
+// has to disable interrupts.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The ring buffer size minus one.
+    //
+    uint32_t ui32Mask;
+
+    //
+    // The ring buffer write index, written only by the producer.
+    //
+    volatile uint32_t ui32WriteIndex;
+
+    //
+    // The ring buffer read index, written only by the consumer.
+    //
+    volatile uint32_t ui32ReadIndex;
+
+    //
+    // The ring buffer.
+    //
+    uint8_t *pui8Buf;
+
+}
+tRingBufSPSC;
+
 //*****************************************************************************
 //
 // API Function prototypes
@@ -92,6 +125,26 @@ extern void RingBufAdvanceRead(tRingBufObject *psRingBuf,
                                 uint32_t ui32NumBytes);
 extern void RingBufInit(tRingBufObject *psRingBuf, uint8_t *pui8Buf,
                         uint32_t ui32Size);
+extern void RingBufSPSCInit(tRingBufSPSC *psRingBuf, uint8_t *pui8Buf,
+                            uint32_t ui32Size);
+extern uint32_t RingBufSPSCUsed(tRingBufSPSC *psRingBuf);
+extern uint32_t RingBufSPSCFree(tRingBufSPSC *psRingBuf);
+extern uint32_t RingBufSPSCContigUsed(tRingBufSPSC *psRingBuf);
+extern uint32_t RingBufSPSCContigFree(tRingBufSPSC *psRingBuf);
+extern uint32_t RingBufSPSCReserve(tRingBufSPSC *psRingBuf,
+                                   uint8_t **ppui8Data);
+extern void RingBufSPSCCommit(tRingBufSPSC *psRingBuf, uint32_t ui32NumBytes);
+extern uint32_t RingBufSPSCPeek(tRingBufSPSC *psRingBuf, uint8_t **ppui8Data);
+extern void RingBufSPSCConsume(tRingBufSPSC *psRingBuf,
+                               uint32_t ui32NumBytes);
+extern void RingBufSPSCFlush(tRingBufSPSC *psRingBuf);
+extern uint32_t RingBufSPSCWrite(tRingBufSPSC *psRingBuf,
+                                 const uint8_t *pui8Data,
+                                 uint32_t ui32Length);
+extern uint32_t RingBufSPSCRead(tRingBufSPSC *psRingBuf, uint8_t *pui8Data,
+                                uint32_t ui32Length);
+extern bool RingBufSPSCWriteOne(tRingBufSPSC *psRingBuf, uint8_t ui8Data);
+extern bool RingBufSPSCReadOne(tRingBufSPSC *psRingBuf, uint8_t *pui8Data);
 
 //*****************************************************************************
 //
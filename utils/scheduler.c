@@ -26,10 +26,12 @@
 #include <stdint.h>
 #include "inc/hw_types.h"
 #include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
 #include "driverlib/systick.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/debug.h"
+#include "utils/cpu_usage.h"
 #include "utils/scheduler.h"
 
 //*****************************************************************************
@@ -41,6 +43,406 @@
 
 static volatile uint32_t g_ui32SchedulerTickCount;
 
+//*****************************************************************************
+//
+// The processor cycles in one tick, and the cycle count at the most recent
+// tick.  The queued scheduler uses these to time task calls from the moment
+// each task became due.
+//
+//*****************************************************************************
+static uint32_t g_ui32SchedulerTickCycles;
+static volatile uint32_t g_ui32SchedulerTickStamp;
+
+//*****************************************************************************
+//
+// The queued scheduler keeps two binary heaps of task indices.  The timer
+// heap holds tasks waiting for their due tick, earliest first.  The ready
+// heap holds the tasks found due at the start of a SchedulerRun() pass,
+// highest priority first.  Each active task is in one of them, so the next
+// task to call or to wait for is always at the top of a heap.
+//
+//*****************************************************************************
+#define SCHEDULER_TIMERS        0
+#define SCHEDULER_READY         1
+#define SCHEDULER_NOT_QUEUED    0xFFFF
+
+typedef struct
+{
+    uint32_t ui32Count;
+    uint16_t pui16Task[SCHEDULER_MAX_TASKS];
+}
+tSchedulerHeap;
+
+static bool g_bSchedulerQueued;
+static tSchedulerHeap g_psSchedulerHeap[2];
+
+//
+// For each task, the heap it is in (bit 15) and its position in that heap,
+// or SCHEDULER_NOT_QUEUED.
+//
+static uint16_t g_pui16SchedulerSlot[SCHEDULER_MAX_TASKS];
+
+//
+// The tick at which each task is next due.
+//
+static uint32_t g_pui32SchedulerDue[SCHEDULER_MAX_TASKS];
+
+static tSchedulerIdleHook g_pfnSchedulerIdle;
+static tSchedulerDeadlineHook g_pfnSchedulerDeadline;
+static tSchedulerTaskHook g_pfnSchedulerTaskStart;
+static tSchedulerTaskHook g_pfnSchedulerTaskEnd;
+
+//*****************************************************************************
+//
+// Calls a task function, and the task hooks around it if they are set.
+//
+//*****************************************************************************
+static void
+SchedulerTaskCall(uint32_t ui32Task)
+{
+    if(g_pfnSchedulerTaskStart)
+    {
+        g_pfnSchedulerTaskStart(ui32Task);
+    }
+    g_psSchedulerTable[ui32Task].pfnFunction(
+        g_psSchedulerTable[ui32Task].pvParam);
+    if(g_pfnSchedulerTaskEnd)
+    {
+        g_pfnSchedulerTaskEnd(ui32Task);
+    }
+}
+
+//*****************************************************************************
+//
+// The DWT cycle counter, which counts processor clocks once enabled.
+//
+//*****************************************************************************
+#ifdef HEADLESS
+#define SchedulerCycles()       SchedulerModelCycles()
+#else
+#define DWT_CTRL                0xE0001000  // DWT Control
+#define DWT_CYCCNT              0xE0001004  // DWT Cycle Count
+#define DWT_CTRL_CYCCNTENA      0x00000001  // Enable the cycle counter
+#define NVIC_DBG_INT_TRCENA     0x01000000  // Enable the DWT and ITM
+#define SchedulerCycles()       HWREG(DWT_CYCCNT)
+#endif
+
+//*****************************************************************************
+//
+// Returns true if task ui32A belongs above task ui32B in the given heap.
+// Due ticks are compared as a signed difference so the order survives the
+// tick counter wrapping.  Ties are broken by priority and then by index,
+// which keeps the calling order deterministic.
+//
+//*****************************************************************************
+static bool
+SchedulerBefore(uint32_t ui32Heap, uint32_t ui32A, uint32_t ui32B)
+{
+    int32_t i32Diff;
+    uint32_t ui32PriA, ui32PriB;
+
+    ui32PriA = g_psSchedulerTable[ui32A].ui8Priority;
+    ui32PriB = g_psSchedulerTable[ui32B].ui8Priority;
+    if((ui32Heap == SCHEDULER_READY) && (ui32PriA != ui32PriB))
+    {
+        return(ui32PriA < ui32PriB);
+    }
+    i32Diff = (int32_t)(g_pui32SchedulerDue[ui32A] - g_pui32SchedulerDue[ui32B]);
+    if(i32Diff != 0)
+    {
+        return(i32Diff < 0);
+    }
+    if(ui32PriA != ui32PriB)
+    {
+        return(ui32PriA < ui32PriB);
+    }
+    return(ui32A < ui32B);
+}
+
+//*****************************************************************************
+//
+// Stores a task at a position in a heap and records where it is.
+//
+//*****************************************************************************
+static void
+SchedulerHeapPut(uint32_t ui32Heap, uint32_t ui32Pos, uint32_t ui32Task)
+{
+    g_psSchedulerHeap[ui32Heap].pui16Task[ui32Pos] = (uint16_t)ui32Task;
+    g_pui16SchedulerSlot[ui32Task] = (uint16_t)((ui32Heap << 15) | ui32Pos);
+}
+
+//*****************************************************************************
+//
+// Moves the task at a position in a heap up or down until the heap is in
+// order again.
+//
+//*****************************************************************************
+static void
+SchedulerHeapFix(uint32_t ui32Heap, uint32_t ui32Pos)
+{
+    tSchedulerHeap *psHeap;
+    uint32_t ui32Task, ui32Next;
+
+    psHeap = &g_psSchedulerHeap[ui32Heap];
+    ui32Task = psHeap->pui16Task[ui32Pos];
+
+    //
+    // Move the task up past any parent it belongs above.
+    //
+    while(ui32Pos != 0)
+    {
+        ui32Next = (ui32Pos - 1) >> 1;
+        if(!SchedulerBefore(ui32Heap, ui32Task, psHeap->pui16Task[ui32Next]))
+        {
+            break;
+        }
+        SchedulerHeapPut(ui32Heap, ui32Pos, psHeap->pui16Task[ui32Next]);
+        ui32Pos = ui32Next;
+    }
+
+    //
+    // Move the task down past any child which belongs above it.
+    //
+    while((ui32Next = (ui32Pos << 1) + 1) < psHeap->ui32Count)
+    {
+        if(((ui32Next + 1) < psHeap->ui32Count) &&
+           SchedulerBefore(ui32Heap, psHeap->pui16Task[ui32Next + 1],
+                           psHeap->pui16Task[ui32Next]))
+        {
+            ui32Next++;
+        }
+        if(!SchedulerBefore(ui32Heap, psHeap->pui16Task[ui32Next], ui32Task))
+        {
+            break;
+        }
+        SchedulerHeapPut(ui32Heap, ui32Pos, psHeap->pui16Task[ui32Next]);
+        ui32Pos = ui32Next;
+    }
+    SchedulerHeapPut(ui32Heap, ui32Pos, ui32Task);
+}
+
+//*****************************************************************************
+//
+// Adds a task to one of the heaps.
+//
+//*****************************************************************************
+static void
+SchedulerQueueInsert(uint32_t ui32Heap, uint32_t ui32Task)
+{
+    tSchedulerHeap *psHeap;
+
+    psHeap = &g_psSchedulerHeap[ui32Heap];
+    ASSERT(psHeap->ui32Count < SCHEDULER_MAX_TASKS);
+    SchedulerHeapPut(ui32Heap, psHeap->ui32Count, ui32Task);
+    psHeap->ui32Count++;
+    SchedulerHeapFix(ui32Heap, psHeap->ui32Count - 1);
+}
+
+//*****************************************************************************
+//
+// Takes a task out of whichever heap it is in, if any.
+//
+//*****************************************************************************
+static void
+SchedulerQueueRemove(uint32_t ui32Task)
+{
+    tSchedulerHeap *psHeap;
+    uint32_t ui32Heap, ui32Pos;
+
+    if(g_pui16SchedulerSlot[ui32Task] == SCHEDULER_NOT_QUEUED)
+    {
+        return;
+    }
+    ui32Heap = g_pui16SchedulerSlot[ui32Task] >> 15;
+    ui32Pos = g_pui16SchedulerSlot[ui32Task] & 0x7FFF;
+    psHeap = &g_psSchedulerHeap[ui32Heap];
+    g_pui16SchedulerSlot[ui32Task] = SCHEDULER_NOT_QUEUED;
+
+    //
+    // Fill the hole with the last task in the heap.
+    //
+    psHeap->ui32Count--;
+    if(ui32Pos != psHeap->ui32Count)
+    {
+        SchedulerHeapPut(ui32Heap, ui32Pos,
+                         psHeap->pui16Task[psHeap->ui32Count]);
+        SchedulerHeapFix(ui32Heap, ui32Pos);
+    }
+}
+
+//*****************************************************************************
+//
+// Records the timing of one call of a task and checks its deadline.
+//
+//*****************************************************************************
+static void
+SchedulerTaskStatsUpdate(uint32_t ui32Task, uint32_t ui32Latency,
+                         uint32_t ui32Cycles)
+{
+    tSchedulerTask *psTask;
+    tSchedulerStats *psStats;
+
+    psTask = &g_psSchedulerTable[ui32Task];
+    psStats = &psTask->sStats;
+    psStats->ui32Calls++;
+    psStats->ui64TotalCycles += ui32Cycles;
+    if(ui32Cycles < psStats->ui32MinCycles)
+    {
+        psStats->ui32MinCycles = ui32Cycles;
+    }
+    if(ui32Cycles > psStats->ui32MaxCycles)
+    {
+        psStats->ui32MaxCycles = ui32Cycles;
+    }
+    if(ui32Latency < psStats->ui32MinLatency)
+    {
+        psStats->ui32MinLatency = ui32Latency;
+    }
+    if(ui32Latency > psStats->ui32MaxLatency)
+    {
+        psStats->ui32MaxLatency = ui32Latency;
+    }
+
+    //
+    // The call missed its deadline if it returned more than the deadline
+    // after the tick at which the task was due.
+    //
+    if(psTask->ui32DeadlineTicks &&
+       (((uint64_t)ui32Latency + ui32Cycles) >
+        ((uint64_t)psTask->ui32DeadlineTicks * g_ui32SchedulerTickCycles)))
+    {
+        psStats->ui32Misses++;
+        if(g_pfnSchedulerDeadline)
+        {
+            g_pfnSchedulerDeadline(ui32Task);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Works out when a task that has just been called is next due.
+//
+//*****************************************************************************
+static uint32_t
+SchedulerNextDue(uint32_t ui32Task, uint32_t ui32Now)
+{
+    tSchedulerTask *psTask;
+    uint32_t ui32Due, ui32Late;
+
+    psTask = &g_psSchedulerTable[ui32Task];
+    ui32Due = g_pui32SchedulerDue[ui32Task] + psTask->ui32FrequencyTicks;
+
+    //
+    // A task with no period is due again on the next pass, and a restarting
+    // task one period after this call, which is how the table scan behaves.
+    //
+    if((psTask->ui32FrequencyTicks == 0) ||
+       (psTask->ui8Flags & SCHEDULER_LATE_RESTART))
+    {
+        return(ui32Now + psTask->ui32FrequencyTicks);
+    }
+
+    //
+    // Unless the missed calls are to be made up, skip any whole periods that
+    // have already gone by so the task keeps its phase.
+    //
+    if(!(psTask->ui8Flags & SCHEDULER_LATE_CATCH_UP) &&
+       ((int32_t)(ui32Now - ui32Due) >= 0))
+    {
+        ui32Late = ui32Now - ui32Due;
+        ui32Due += ((ui32Late / psTask->ui32FrequencyTicks) + 1) *
+                   psTask->ui32FrequencyTicks;
+    }
+    return(ui32Due);
+}
+
+//*****************************************************************************
+//
+// One pass of the queued scheduler.  Every task due at the start of the pass
+// is called once, in order of priority, so a task that is more than one
+// period behind catches up by one call per pass.  If nothing is left to do,
+// the idle hook is called with the ticks until the next task is due.
+//
+//*****************************************************************************
+static void
+SchedulerQueueRun(void)
+{
+    tSchedulerHeap *psTimers, *psReady;
+    tSchedulerTask *psTask;
+    uint32_t ui32Task, ui32Now, ui32Stamp, ui32Start, ui32Latency, ui32Ticks;
+
+    psTimers = &g_psSchedulerHeap[SCHEDULER_TIMERS];
+    psReady = &g_psSchedulerHeap[SCHEDULER_READY];
+
+    //
+    // Move the tasks that are due to the ready heap.
+    //
+    ui32Now = g_ui32SchedulerTickCount;
+    while(psTimers->ui32Count &&
+          ((int32_t)(ui32Now - g_pui32SchedulerDue[psTimers->pui16Task[0]]) >=
+           0))
+    {
+        ui32Task = psTimers->pui16Task[0];
+        SchedulerQueueRemove(ui32Task);
+        SchedulerQueueInsert(SCHEDULER_READY, ui32Task);
+    }
+
+    //
+    // Call them, highest priority first.
+    //
+    while(psReady->ui32Count)
+    {
+        ui32Task = psReady->pui16Task[0];
+        SchedulerQueueRemove(ui32Task);
+        psTask = &g_psSchedulerTable[ui32Task];
+
+        //
+        // Read the tick count and the cycle count at that tick together.
+        //
+        do
+        {
+            ui32Now = g_ui32SchedulerTickCount;
+            ui32Stamp = g_ui32SchedulerTickStamp;
+        }
+        while(ui32Now != g_ui32SchedulerTickCount);
+
+        //
+        // Call the task function and time it.
+        //
+        psTask->ui32LastCall = ui32Now;
+        ui32Start = SchedulerCycles();
+        SchedulerTaskCall(ui32Task);
+        ui32Latency = (((ui32Now - g_pui32SchedulerDue[ui32Task]) *
+                        g_ui32SchedulerTickCycles) + (ui32Start - ui32Stamp));
+        SchedulerTaskStatsUpdate(ui32Task, ui32Latency,
+                                 SchedulerCycles() - ui32Start);
+
+        //
+        // Queue the next call, unless the task disabled itself or was
+        // requeued by SchedulerTaskEnable() while it ran.
+        //
+        if(psTask->bActive &&
+           (g_pui16SchedulerSlot[ui32Task] == SCHEDULER_NOT_QUEUED))
+        {
+            g_pui32SchedulerDue[ui32Task] = SchedulerNextDue(ui32Task, ui32Now);
+            SchedulerQueueInsert(SCHEDULER_TIMERS, ui32Task);
+        }
+    }
+
+    //
+    // Let the application sleep until the next task is due.
+    //
+    if(g_pfnSchedulerIdle)
+    {
+        ui32Ticks = SchedulerNextDueGet();
+        if(ui32Ticks)
+        {
+            g_pfnSchedulerIdle(ui32Ticks);
+        }
+    }
+}
+
 //*****************************************************************************
 //
 //! Handles the SysTick interrupt on behalf of the scheduler module.
@@ -54,7 +456,10 @@ static volatile uint32_t g_ui32SchedulerTickCount;
 void
 SchedulerSysTickIntHandler(void)
 {
+    CPU_USAGE_ISR_ENTER();
+    g_ui32SchedulerTickStamp = SchedulerCycles();
     g_ui32SchedulerTickCount++;
+    CPU_USAGE_ISR_EXIT();
 }
 
 //*****************************************************************************
@@ -88,7 +493,8 @@ SchedulerInit(uint32_t ui32TicksPerSecond)
     //
     // Configure SysTick for a periodic interrupt.
     //
-    SysTickPeriodSet(SysCtlClockGet() / ui32TicksPerSecond);
+    g_ui32SchedulerTickCycles = SysCtlClockGet() / ui32TicksPerSecond;
+    SysTickPeriodSet(g_ui32SchedulerTickCycles);
     SysTickEnable();
     SysTickIntEnable();
 }
@@ -107,6 +513,10 @@ SchedulerInit(uint32_t ui32TicksPerSecond)
 //! functions configured in \e g_psSchedulerTable are made in the context of
 //! SchedulerRun().
 //!
+//! Once SchedulerQueueInit() has been called, each call runs the queued
+//! scheduler instead of scanning the table: the tasks that are due are called
+//! in order of priority and, if nothing else is due, the idle hook is called.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -116,6 +526,12 @@ SchedulerRun(void)
     uint32_t ui32Loop;
     tSchedulerTask *pi16Task;
 
+    if(g_bSchedulerQueued)
+    {
+        SchedulerQueueRun();
+        return;
+    }
+
     //
     // Loop through each task in the task table.
     //
@@ -141,7 +557,7 @@ SchedulerRun(void)
             //
             // Call the task function, passing the provided parameter.
             //
-            pi16Task->pfnFunction(pi16Task->pvParam);
+            SchedulerTaskCall(ui32Loop);
         }
     }
 }
@@ -200,6 +616,18 @@ SchedulerTaskEnable(uint32_t ui32Index, bool bRunNow)
             g_psSchedulerTable[ui32Index].ui32LastCall =
                 g_ui32SchedulerTickCount;
         }
+
+        //
+        // Move the task to its new place in the queue.
+        //
+        if(g_bSchedulerQueued)
+        {
+            SchedulerQueueRemove(ui32Index);
+            g_pui32SchedulerDue[ui32Index] =
+                (g_psSchedulerTable[ui32Index].ui32LastCall +
+                 g_psSchedulerTable[ui32Index].ui32FrequencyTicks);
+            SchedulerQueueInsert(SCHEDULER_TIMERS, ui32Index);
+        }
     }
 }
 
@@ -229,6 +657,14 @@ SchedulerTaskDisable(uint32_t ui32Index)
         // Yes - mark the task as inactive.
         //
         g_psSchedulerTable[ui32Index].bActive = false;
+
+        //
+        // Take the task out of the queue.
+        //
+        if(g_bSchedulerQueued)
+        {
+            SchedulerQueueRemove(ui32Index);
+        }
     }
 }
 
@@ -302,6 +738,300 @@ SchedulerElapsedTicksCalc(uint32_t ui32TickStart, uint32_t ui32TickEnd)
            ((0xFFFFFFFF - ui32TickStart) + ui32TickEnd + 1));
 }
 
+//*****************************************************************************
+//
+//! Switches the scheduler to the priority queue.
+//!
+//! This function puts the active tasks in \e g_psSchedulerTable into a pair of
+//! heaps ordered by due tick and by priority.  From then on SchedulerRun()
+//! looks only at the tasks which are due rather than scanning the whole
+//! table, calls them in order of \e ui8Priority, keeps their phase or makes up
+//! missed calls as chosen by \e ui8Flags, checks \e ui32DeadlineTicks, and
+//! keeps execution time and start latency statistics in \e sStats, measured
+//! with the DWT cycle counter.  The table may hold up to
+//! \b SCHEDULER_MAX_TASKS tasks.
+//!
+//! Call this after SchedulerInit() and after any tasks have been enabled.
+//! Each active task is first due one period after its \e ui32LastCall.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerQueueInit(void)
+{
+    uint32_t ui32Loop;
+
+    ASSERT(g_ui32SchedulerNumTasks <= SCHEDULER_MAX_TASKS);
+
+#ifndef HEADLESS
+    //
+    // Start the cycle counter.
+    //
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+#endif
+    g_ui32SchedulerTickStamp = SchedulerCycles();
+
+    //
+    // Queue each active task.
+    //
+    g_psSchedulerHeap[SCHEDULER_TIMERS].ui32Count = 0;
+    g_psSchedulerHeap[SCHEDULER_READY].ui32Count = 0;
+    for(ui32Loop = 0; ui32Loop < g_ui32SchedulerNumTasks; ui32Loop++)
+    {
+        g_pui16SchedulerSlot[ui32Loop] = SCHEDULER_NOT_QUEUED;
+        SchedulerTaskStatsReset(ui32Loop);
+        if(g_psSchedulerTable[ui32Loop].bActive)
+        {
+            g_pui32SchedulerDue[ui32Loop] =
+                (g_psSchedulerTable[ui32Loop].ui32LastCall +
+                 g_psSchedulerTable[ui32Loop].ui32FrequencyTicks);
+            SchedulerQueueInsert(SCHEDULER_TIMERS, ui32Loop);
+        }
+    }
+    g_bSchedulerQueued = true;
+}
+
+//*****************************************************************************
+//
+//! Returns the number of ticks until the next task is due.
+//!
+//! This function looks at the top of the queued scheduler's heaps, so it
+//! takes the same time however many tasks there are.
+//!
+//! \return Returns 0 if a task is due now or the scheduler is not queued,
+//! 0xFFFFFFFF if no task is active, or otherwise the number of ticks until
+//! the earliest task is due.
+//
+//*****************************************************************************
+uint32_t
+SchedulerNextDueGet(void)
+{
+    tSchedulerHeap *psTimers;
+    int32_t i32Ticks;
+
+    psTimers = &g_psSchedulerHeap[SCHEDULER_TIMERS];
+    if(!g_bSchedulerQueued || g_psSchedulerHeap[SCHEDULER_READY].ui32Count)
+    {
+        return(0);
+    }
+    if(psTimers->ui32Count == 0)
+    {
+        return(0xFFFFFFFF);
+    }
+    i32Ticks = (int32_t)(g_pui32SchedulerDue[psTimers->pui16Task[0]] -
+                         g_ui32SchedulerTickCount);
+    return((i32Ticks > 0) ? (uint32_t)i32Ticks : 0);
+}
+
+//*****************************************************************************
+//
+//! Sets the function the queued scheduler calls when no task is due.
+//!
+//! \param pfnIdle is the idle hook, or \b NULL for none.
+//!
+//! At the end of each SchedulerRun() pass in which no task is left due, the
+//! hook is called with the number of ticks until the next task is due.  It
+//! may sleep for up to that long; SchedulerTicklessIdle() does so with the
+//! SysTick interrupt held off for the whole time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerIdleHookSet(tSchedulerIdleHook pfnIdle)
+{
+    g_pfnSchedulerIdle = pfnIdle;
+}
+
+//*****************************************************************************
+//
+//! Sets the function the queued scheduler calls when a task misses its
+//! deadline.
+//!
+//! \param pfnDeadline is the deadline hook, or \b NULL for none.
+//!
+//! The hook is called, with the index of the task, after a call which
+//! returned more than \e ui32DeadlineTicks after the task was due.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerDeadlineHookSet(tSchedulerDeadlineHook pfnDeadline)
+{
+    g_pfnSchedulerDeadline = pfnDeadline;
+}
+
+//*****************************************************************************
+//
+//! Sets the functions the scheduler calls around each task.
+//!
+//! \param pfnStart is called with the task index just before the task
+//! function, or is \b NULL.
+//! \param pfnEnd is called with the task index just after the task function
+//! returns, or is \b NULL.
+//!
+//! Passing CPUUsageTaskEnter() and CPUUsageTaskExit() gives each task its
+//! own entry in the CPU usage profile.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerTaskHookSet(tSchedulerTaskHook pfnStart, tSchedulerTaskHook pfnEnd)
+{
+    g_pfnSchedulerTaskStart = pfnStart;
+    g_pfnSchedulerTaskEnd = pfnEnd;
+}
+
+//*****************************************************************************
+//
+//! Clears the runtime statistics of a task.
+//!
+//! \param ui32Index is the index of the task in the global
+//! \e g_psSchedulerTable array.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerTaskStatsReset(uint32_t ui32Index)
+{
+    tSchedulerStats *psStats;
+
+    if(ui32Index < g_ui32SchedulerNumTasks)
+    {
+        psStats = &g_psSchedulerTable[ui32Index].sStats;
+        psStats->ui32Calls = 0;
+        psStats->ui32Misses = 0;
+        psStats->ui32MinCycles = 0xFFFFFFFF;
+        psStats->ui32MaxCycles = 0;
+        psStats->ui64TotalCycles = 0;
+        psStats->ui32MinLatency = 0xFFFFFFFF;
+        psStats->ui32MaxLatency = 0;
+    }
+}
+
+#ifndef HEADLESS
+//*****************************************************************************
+//
+//! Sleeps until the next task is due without taking SysTick interrupts.
+//!
+//! \param ui32Ticks is the most ticks to sleep.
+//!
+//! This function may be passed to SchedulerIdleHookSet().  It stretches the
+//! current SysTick period to end when the next task is due, sleeps, and then
+//! adds the ticks that went by to the tick count and puts SysTick back in
+//! step.  If another interrupt wakes the processor first, only the whole
+//! ticks that have passed are counted.  The 24-bit SysTick counter limits
+//! one sleep to 0xFFFFFF processor cycles.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SchedulerTicklessIdle(uint32_t ui32Ticks)
+{
+    uint32_t ui32Max, ui32Reload, ui32Elapsed, ui32Whole, ui32Next;
+    bool bMasked;
+
+    ASSERT(g_ui32SchedulerTickCycles);
+
+    //
+    // SysTick interrupts are held off from here on; one which has already
+    // happened is counted before sleeping.
+    //
+    bMasked = IntMasterDisable();
+    ui32Next = SchedulerNextDueGet();
+    if(ui32Ticks > ui32Next)
+    {
+        ui32Ticks = ui32Next;
+    }
+    ui32Max = NVIC_ST_RELOAD_M / g_ui32SchedulerTickCycles;
+    if(ui32Ticks > ui32Max)
+    {
+        ui32Ticks = ui32Max;
+    }
+    if((ui32Ticks < 2) ||
+       (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET))
+    {
+        if(!bMasked)
+        {
+            IntMasterEnable();
+        }
+        if(ui32Ticks)
+        {
+            SysCtlSleep();
+        }
+        return;
+    }
+
+    //
+    // Stretch what is left of this tick by the rest of the ticks to sleep.
+    //
+    SysTickDisable();
+    ui32Reload = (SysTickValueGet() +
+                  ((ui32Ticks - 1) * g_ui32SchedulerTickCycles));
+    HWREG(NVIC_ST_RELOAD) = ui32Reload - 1;
+    HWREG(NVIC_ST_CURRENT) = 0;
+    SysTickEnable();
+
+    //
+    // The processor wakes on any interrupt, even while they are masked.
+    //
+    SysCtlSleep();
+    SysTickDisable();
+
+    if(HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET)
+    {
+        //
+        // The whole sleep went by.  The pending SysTick interrupt counts the
+        // last tick; the counter has started the long period over, so what
+        // it has counted since belongs to the next tick.
+        //
+        g_ui32SchedulerTickCount += ui32Ticks - 1;
+        ui32Elapsed = ui32Reload - SysTickValueGet();
+        ui32Next = ((ui32Elapsed < g_ui32SchedulerTickCycles) ?
+                    (g_ui32SchedulerTickCycles - ui32Elapsed) :
+                    g_ui32SchedulerTickCycles);
+    }
+    else
+    {
+        //
+        // Another interrupt woke the processor early.  The sleep started
+        // ui32Ticks whole ticks before the counter would have reached zero,
+        // so count the tick boundaries passed since then.
+        //
+        ui32Elapsed = ((ui32Ticks * g_ui32SchedulerTickCycles) -
+                       SysTickValueGet());
+        ui32Whole = ui32Elapsed / g_ui32SchedulerTickCycles;
+        ui32Elapsed -= ui32Whole * g_ui32SchedulerTickCycles;
+        g_ui32SchedulerTickCount += ui32Whole;
+        g_ui32SchedulerTickStamp = SchedulerCycles() - ui32Elapsed;
+        ui32Next = g_ui32SchedulerTickCycles - ui32Elapsed;
+    }
+
+    //
+    // Run to the next tick boundary, then go back to the normal period.
+    //
+    if(ui32Next < 2)
+    {
+        ui32Next = 2;
+    }
+    HWREG(NVIC_ST_RELOAD) = ui32Next - 1;
+    HWREG(NVIC_ST_CURRENT) = 0;
+    SysTickEnable();
+    HWREG(NVIC_ST_RELOAD) = g_ui32SchedulerTickCycles - 1;
+
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+}
+#endif
+
 //*****************************************************************************
 //
 // Close the Doxygen group.
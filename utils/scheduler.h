@@ -49,6 +49,85 @@ extern "C"
 //*****************************************************************************
 typedef void (*tSchedulerFunction)(void *pvParam);
 
+//*****************************************************************************
+//
+// Prototypes of the hooks that the queued scheduler calls.  The idle hook is
+// passed the number of ticks until the next task is due (0xFFFFFFFF if no
+// task is queued) and the deadline hook the index of the task that finished
+// late.
+//
+//*****************************************************************************
+typedef void (*tSchedulerIdleHook)(uint32_t ui32Ticks);
+typedef void (*tSchedulerDeadlineHook)(uint32_t ui32Index);
+
+//*****************************************************************************
+//
+// Prototype of the hooks called with the task index just before and just
+// after each task function, such as CPUUsageTaskEnter() and
+// CPUUsageTaskExit().
+//
+//*****************************************************************************
+typedef void (*tSchedulerTaskHook)(uint32_t ui32Index);
+
+//*****************************************************************************
+//
+// The most tasks the queued scheduler can order.  The heaps it uses take
+// ten bytes of RAM per task.
+//
+//*****************************************************************************
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS     32
+#endif
+
+//*****************************************************************************
+//
+// Values for the ui8Flags field of tSchedulerTask, which choose what the
+// queued scheduler does when a task is called more than one period late.
+//
+//*****************************************************************************
+#define SCHEDULER_LATE_SKIP     0x00    // Drop the missed calls, keep phase
+#define SCHEDULER_LATE_CATCH_UP 0x01    // Make every missed call, one per run
+#define SCHEDULER_LATE_RESTART  0x02    // Next call one period after this one
+
+//*****************************************************************************
+//
+//! Runtime statistics kept for each task by the queued scheduler.  Times are
+//! in processor cycles.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    //! The number of times the task has been called.
+    //
+    uint32_t ui32Calls;
+
+    //
+    //! The number of calls which finished after the task's deadline.
+    //
+    uint32_t ui32Misses;
+
+    //
+    //! The shortest and longest time the task function took to return.
+    //
+    uint32_t ui32MinCycles;
+    uint32_t ui32MaxCycles;
+
+    //
+    //! The total time spent in the task function.  The mean execution time
+    //! is this divided by ui32Calls.
+    //
+    uint64_t ui64TotalCycles;
+
+    //
+    //! The shortest and longest time from the tick at which the task was due
+    //! to the start of the call.  Their difference is the start jitter.
+    //
+    uint32_t ui32MinLatency;
+    uint32_t ui32MaxLatency;
+}
+tSchedulerStats;
+
 //*****************************************************************************
 //
 //! The structure defining a function which the scheduler will call
@@ -87,6 +166,31 @@ typedef struct
     //! disabled and will not be called.
     //
     bool bActive;
+
+    //
+    //! The priority of the task in the queued scheduler, 0 being the highest.
+    //! When several tasks are due, the queued scheduler calls them in order
+    //! of priority.
+    //
+    uint8_t ui8Priority;
+
+    //
+    //! What the queued scheduler does when the task is late, one of
+    //! \b SCHEDULER_LATE_SKIP, \b SCHEDULER_LATE_CATCH_UP or
+    //! \b SCHEDULER_LATE_RESTART.
+    //
+    uint8_t ui8Flags;
+
+    //
+    //! The number of ticks after the task is due by which each call must
+    //! have returned, or 0 if the task has no deadline.
+    //
+    uint32_t ui32DeadlineTicks;
+
+    //
+    //! Runtime statistics.  This field is updated by the queued scheduler.
+    //
+    tSchedulerStats sStats;
 }
 tSchedulerTask;
 
@@ -127,6 +231,21 @@ extern uint32_t SchedulerTickCountGet(void);
 extern uint32_t SchedulerElapsedTicksGet(uint32_t ui32TickCount);
 extern uint32_t SchedulerElapsedTicksCalc(uint32_t ui32TickStart,
                                                uint32_t ui32TickEnd);
+extern void SchedulerQueueInit(void);
+extern uint32_t SchedulerNextDueGet(void);
+extern void SchedulerIdleHookSet(tSchedulerIdleHook pfnIdle);
+extern void SchedulerDeadlineHookSet(tSchedulerDeadlineHook pfnDeadline);
+extern void SchedulerTaskHookSet(tSchedulerTaskHook pfnStart,
+                                 tSchedulerTaskHook pfnEnd);
+extern void SchedulerTaskStatsReset(uint32_t ui32Index);
+extern void SchedulerTicklessIdle(uint32_t ui32Ticks);
+
+#ifdef HEADLESS
+//
+// Host model only: the processor cycle count, supplied by the model.
+//
+extern uint32_t SchedulerModelCycles(void);
+#endif
 
 //*****************************************************************************
 //
@@ -35,7 +35,9 @@
 #include "driverlib/rom_map.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
+#include "utils/cpu_usage.h"
 #include "utils/uartstdio.h"
+#include "utils/ustdlib.h"
 
 //*****************************************************************************
 //
@@ -127,11 +129,11 @@ static uint32_t g_ui32Base = 0;
 
 //*****************************************************************************
 //
-// A mapping from an integer between 0 and 15 to its ASCII character
-// equivalent.
+// The size of the buffer that UARTvprintf() collects its output in, so that
+// UARTwrite() is called once per buffer rather than once per piece.
 //
 //*****************************************************************************
-static const char * const g_pcHex = "0123456789abcdef";
+#define UART_PRINTF_BUFFER      64
 
 //*****************************************************************************
 //
@@ -861,6 +863,29 @@ UARTgetc(void)
 #endif
 }
 
+//*****************************************************************************
+//
+// Formats into a buffer on the stack that is passed to UARTwrite() when it
+// fills and at the end.  Numbers are padded only to widths that fit the
+// 16 character conversion buffer this function used to have, so the output
+// is the same as before.
+//
+//*****************************************************************************
+static void
+uartformat(const char *pcString, const tUFormat *psFormat, va_list vaArgP)
+{
+    tUSink sSink;
+    char pcBuf[UART_PRINTF_BUFFER];
+
+    sSink.pcStart = pcBuf;
+    sSink.pcNext = pcBuf;
+    sSink.pcEnd = pcBuf + sizeof(pcBuf);
+    sSink.pfnWrite = UARTwrite;
+    sSink.ui32PadLimit = 16;
+    sSink.iCount = 0;
+    uvformat(&sSink, pcString, psFormat, vaArgP);
+}
+
 //*****************************************************************************
 //
 //! A simple UART based vprintf function supporting \%c, \%d, \%p, \%s, \%u,
@@ -902,395 +927,33 @@ UARTgetc(void)
 void
 UARTvprintf(const char *pcString, va_list vaArgP)
 {
-    uint32_t ui32Idx, ui32Value, ui32Pos, ui32Count, ui32Base, ui32Neg;
-    char *pcStr, pcBuf[16], cFill;
-
-    //
     // Check the arguments.
-    //
     ASSERT(pcString != 0);
 
-    //
-    // Loop while there are more characters in the string.
-    //
-    while(*pcString)
-    {
-        //
-        // Find the first non-% character, or the end of the string.
-        //
-        for(ui32Idx = 0;
-            (pcString[ui32Idx] != '%') && (pcString[ui32Idx] != '\0');
-            ui32Idx++)
-        {
-        }
-
-        //
-        // Write this portion of the string.
-        //
-        UARTwrite(pcString, ui32Idx);
-
-        //
-        // Skip the portion of the string that was written.
-        //
-        pcString += ui32Idx;
-
-        //
-        // See if the next character is a %.
-        //
-        if(*pcString == '%')
-        {
-            //
-            // Skip the %.
-            //
-            pcString++;
-
-            //
-            // Set the digit count to zero, and the fill character to space
-            // (in other words, to the defaults).
-            //
-            ui32Count = 0;
-            cFill = ' ';
-
-            //
-            // It may be necessary to get back here to process more characters.
-            // Goto's aren't pretty, but effective.  I feel extremely dirty for
-            // using not one but two of the beasts.
-            //
-again:
-
-            //
-            // Determine how to handle the next character.
-            //
-            switch(*pcString++)
-            {
-                //
-                // Handle the digit characters.
-                //
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                {
-                    //
-                    // If this is a zero, and it is the first digit, then the
-                    // fill character is a zero instead of a space.
-                    //
-                    if((pcString[-1] == '0') && (ui32Count == 0))
-                    {
-                        cFill = '0';
-                    }
-
-                    //
-                    // Update the digit count.
-                    //
-                    ui32Count *= 10;
-                    ui32Count += pcString[-1] - '0';
-
-                    //
-                    // Get the next character.
-                    //
-                    goto again;
-                }
-
-                //
-                // Handle the %c command.
-                //
-                case 'c':
-                {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ui32Value = va_arg(vaArgP, uint32_t);
-
-                    //
-                    // Print out the character.
-                    //
-                    UARTwrite((char *)&ui32Value, 1);
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
-
-                //
-                // Handle the %d and %i commands.
-                //
-                case 'd':
-                case 'i':
-                {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ui32Value = va_arg(vaArgP, uint32_t);
-
-                    //
-                    // Reset the buffer position.
-                    //
-                    ui32Pos = 0;
-
-                    //
-                    // If the value is negative, make it positive and indicate
-                    // that a minus sign is needed.
-                    //
-                    if((int32_t)ui32Value < 0)
-                    {
-                        //
-                        // Make the value positive.
-                        //
-                        ui32Value = -(int32_t)ui32Value;
-
-                        //
-                        // Indicate that the value is negative.
-                        //
-                        ui32Neg = 1;
-                    }
-                    else
-                    {
-                        //
-                        // Indicate that the value is positive so that a minus
-                        // sign isn't inserted.
-                        //
-                        ui32Neg = 0;
-                    }
-
-                    //
-                    // Set the base to 10.
-                    //
-                    ui32Base = 10;
-
-                    //
-                    // Convert the value to ASCII.
-                    //
-                    goto convert;
-                }
-
-                //
-                // Handle the %s command.
-                //
-                case 's':
-                {
-                    //
-                    // Get the string pointer from the varargs.
-                    //
-                    pcStr = va_arg(vaArgP, char *);
-
-                    //
-                    // Determine the length of the string.
-                    //
-                    for(ui32Idx = 0; pcStr[ui32Idx] != '\0'; ui32Idx++)
-                    {
-                    }
-
-                    //
-                    // Write the string.
-                    //
-                    UARTwrite(pcStr, ui32Idx);
-
-                    //
-                    // Write any required padding spaces
-                    //
-                    if(ui32Count > ui32Idx)
-                    {
-                        ui32Count -= ui32Idx;
-                        while(ui32Count--)
-                        {
-                            UARTwrite(" ", 1);
-                        }
-                    }
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
-
-                //
-                // Handle the %u command.
-                //
-                case 'u':
-                {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ui32Value = va_arg(vaArgP, uint32_t);
-
-                    //
-                    // Reset the buffer position.
-                    //
-                    ui32Pos = 0;
-
-                    //
-                    // Set the base to 10.
-                    //
-                    ui32Base = 10;
-
-                    //
-                    // Indicate that the value is positive so that a minus sign
-                    // isn't inserted.
-                    //
-                    ui32Neg = 0;
-
-                    //
-                    // Convert the value to ASCII.
-                    //
-                    goto convert;
-                }
-
-                //
-                // Handle the %x and %X commands.  Note that they are treated
-                // identically; in other words, %X will use lower case letters
-                // for a-f instead of the upper case letters it should use.  We
-                // also alias %p to %x.
-                //
-                case 'x':
-                case 'X':
-                case 'p':
-                {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ui32Value = va_arg(vaArgP, uint32_t);
-
-                    //
-                    // Reset the buffer position.
-                    //
-                    ui32Pos = 0;
-
-                    //
-                    // Set the base to 16.
-                    //
-                    ui32Base = 16;
-
-                    //
-                    // Indicate that the value is positive so that a minus sign
-                    // isn't inserted.
-                    //
-                    ui32Neg = 0;
-
-                    //
-                    // Determine the number of digits in the string version of
-                    // the value.
-                    //
-convert:
-                    for(ui32Idx = 1;
-                        (((ui32Idx * ui32Base) <= ui32Value) &&
-                         (((ui32Idx * ui32Base) / ui32Base) == ui32Idx));
-                        ui32Idx *= ui32Base, ui32Count--)
-                    {
-                    }
-
-                    //
-                    // If the value is negative, reduce the count of padding
-                    // characters needed.
-                    //
-                    if(ui32Neg)
-                    {
-                        ui32Count--;
-                    }
-
-                    //
-                    // If the value is negative and the value is padded with
-                    // zeros, then place the minus sign before the padding.
-                    //
-                    if(ui32Neg && (cFill == '0'))
-                    {
-                        //
-                        // Place the minus sign in the output buffer.
-                        //
-                        pcBuf[ui32Pos++] = '-';
-
-                        //
-                        // The minus sign has been placed, so turn off the
-                        // negative flag.
-                        //
-                        ui32Neg = 0;
-                    }
-
-                    //
-                    // Provide additional padding at the beginning of the
-                    // string conversion if needed.
-                    //
-                    if((ui32Count > 1) && (ui32Count < 16))
-                    {
-                        for(ui32Count--; ui32Count; ui32Count--)
-                        {
-                            pcBuf[ui32Pos++] = cFill;
-                        }
-                    }
-
-                    //
-                    // If the value is negative, then place the minus sign
-                    // before the number.
-                    //
-                    if(ui32Neg)
-                    {
-                        //
-                        // Place the minus sign in the output buffer.
-                        //
-                        pcBuf[ui32Pos++] = '-';
-                    }
-
-                    //
-                    // Convert the value into a string.
-                    //
-                    for(; ui32Idx; ui32Idx /= ui32Base)
-                    {
-                        pcBuf[ui32Pos++] =
-                            g_pcHex[(ui32Value / ui32Idx) % ui32Base];
-                    }
-
-                    //
-                    // Write the string.
-                    //
-                    UARTwrite(pcBuf, ui32Pos);
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
-
-                //
-                // Handle the %% command.
-                //
-                case '%':
-                {
-                    //
-                    // Simply write a single %.
-                    //
-                    UARTwrite(pcString - 1, 1);
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
+    uartformat(pcString, 0, vaArgP);
+}
 
-                //
-                // Handle all other commands.
-                //
-                default:
-                {
-                    //
-                    // Indicate an error.
-                    //
-                    UARTwrite("ERROR", 5);
+//*****************************************************************************
+//
+//! A UART based vprintf function for a format compiled by ufmtcompile().
+//!
+//! \param psFormat is the compiled format.
+//! \param vaArgP is a variable argument list pointer whose content will depend
+//! upon the format.
+//!
+//! The output is exactly what UARTvprintf() sends for the string that was
+//! compiled, without parsing it again.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UARTvprintfc(const tUFormat *psFormat, va_list vaArgP)
+{
+    // Check the arguments.
+    ASSERT(psFormat != 0);
 
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
-            }
-        }
-    }
+    uartformat(0, psFormat, vaArgP);
 }
 
 //*****************************************************************************
@@ -1349,6 +1012,40 @@ UARTprintf(const char *pcString, ...)
     va_end(vaArgP);
 }
 
+//*****************************************************************************
+//
+//! A UART based printf function for a format compiled by ufmtcompile().
+//!
+//! \param psFormat is the compiled format.
+//! \param ... are the optional arguments, which depend on the contents of the
+//! format.
+//!
+//! The output is exactly what UARTprintf() sends for the string that was
+//! compiled, without parsing it again.  For example
+//!
+//! \verbatim
+//! static tUFormat sLine;
+//! ufmtcompile(&sLine, "%4d.%03d cm\n");    // once
+//! UARTprintfc(&sLine, ui32Whole, ui32Frac);  // every sample
+//! \endverbatim
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+UARTprintfc(const tUFormat *psFormat, ...)
+{
+    va_list vaArgP;
+
+    // Start the varargs processing.
+    va_start(vaArgP, psFormat);
+
+    UARTvprintfc(psFormat, vaArgP);
+
+    // We're finished with the varargs now.
+    va_end(vaArgP);
+}
+
 //*****************************************************************************
 //
 //! Returns the number of bytes available in the receive buffer.
@@ -1597,6 +1294,8 @@ UARTStdioIntHandler(void)
     int32_t i32Char;
     static bool bLastWasCR = false;
 
+    CPU_USAGE_ISR_ENTER();
+
     //
     // Get and clear the current interrupt source(s)
     //
@@ -1752,6 +1451,8 @@ UARTStdioIntHandler(void)
         UARTPrimeTransmit(g_ui32Base);
         MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
     }
+
+    CPU_USAGE_ISR_EXIT();
 }
 #endif
 
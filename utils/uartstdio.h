@@ -26,6 +26,7 @@
 #define __UARTSTDIO_H__
 
 #include <stdarg.h>
+#include "utils/ustdlib.h"
 
 //*****************************************************************************
 //
@@ -64,6 +65,8 @@ extern int UARTgets(char *pcBuf, uint32_t ui32Len);
 extern unsigned char UARTgetc(void);
 extern void UARTprintf(const char *pcString, ...);
 extern void UARTvprintf(const char *pcString, va_list vaArgP);
+extern void UARTprintfc(const tUFormat *psFormat, ...);
+extern void UARTvprintfc(const tUFormat *psFormat, va_list vaArgP);
 extern int UARTwrite(const char *pcBuf, uint32_t ui32Len);
 #ifdef UART_BUFFERED
 extern int UARTPeek(unsigned char ucChar);
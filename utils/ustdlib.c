@@ -105,585 +105,589 @@ ustrncpy(char * restrict s1, const char * restrict s2, size_t n)
 
 //*****************************************************************************
 //
-//! A simple vsnprintf function supporting \%c, \%d, \%p, \%s, \%u, \%x, and
-//! \%X.
-//!
-//! \param s points to the buffer where the converted string is stored.
-//! \param n is the size of the buffer.
-//! \param format is the format string.
-//! \param arg is the list of optional arguments, which depend on the
-//! contents of the format string.
-//!
-//! This function is very similar to the C library <tt>vsnprintf()</tt>
-//! function.  Only the following formatting characters are supported:
-//!
-//! - \%c to print a character
-//! - \%d or \%i to print a decimal value
-//! - \%s to print a string
-//! - \%u to print an unsigned decimal value
-//! - \%x to print a hexadecimal value using lower case letters
-//! - \%X to print a hexadecimal value using lower case letters (not upper case
-//! letters as would typically be used)
-//! - \%p to print a pointer as a hexadecimal value
-//! - \%\% to print out a \% character
-//!
-//! For \%d, \%i, \%p, \%s, \%u, \%x, and \%X, an optional number may reside
-//! between the \% and the format character, which specifies the minimum number
-//! of characters to use for that value; if preceded by a 0 then the extra
-//! characters will be filled with zeros instead of spaces.  For example,
-//! ``\%8d'' will use eight characters to print the decimal value with spaces
-//! added to reach eight; ``\%08d'' will use eight characters as well but will
-//! add zeroes instead of spaces.
-//!
-//! The type of the arguments after \e format must match the requirements of
-//! the format string.  For example, if an integer was passed where a string
-//! was expected, an error of some kind will most likely occur.
-//!
-//! The \e n parameter limits the number of characters that will be
-//! stored  in the buffer pointed to by \e s to prevent the possibility of
-//! a buffer  overflow.  The buffer size should be large enough to hold the
-//! expected converted output string, including the null termination character.
-//!
-//! The function will return the number of characters that would be converted
-//! as if there were no limit on the buffer size.  Therefore it is possible for
-//! the function to return a count that is greater than the specified buffer
-//! size.  If this happens, it means that the output was truncated.
-//!
-//! \return Returns the number of characters that were to be stored, not
-//! including the NULL termination character, regardless of space in the
-//! buffer.
+// The two digit pairs "00" through "99", so that a decimal conversion makes
+// one pass for every two digits.
 //
 //*****************************************************************************
-int
-uvsnprintf(char * restrict s, size_t n, const char * restrict format,
-           va_list arg)
-{
-    unsigned long ulIdx, ulValue, ulCount, ulBase, ulNeg;
-    char *pcStr, cFill;
-    int iConvertCount = 0;
+static const char g_pcDigits2[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
 
-    //
-    // Check the arguments.
-    //
-    ASSERT(s);
-    ASSERT(n);
-    ASSERT(format);
+//*****************************************************************************
+//
+// Converts a value to ASCII in base 10 or 16, placing the digits so that the
+// last one is immediately before pcEnd, and returns the number of digits.
+// Hexadecimal is done with shifts.  For decimal, n / 100 is computed as
+// (n * 0x51EB851F) >> 37, which is exact for every 32-bit n because
+// 0x51EB851F * 100 = 2^37 + 28 and 28 * 2^32 < 2^37; the remainder then
+// selects two digits from g_pcDigits2.  There is no divide instruction.
+//
+//*****************************************************************************
+static uint32_t
+uconvert(char *pcEnd, uint32_t ui32Value, uint32_t ui32Base)
+{
+    char *pcDigit;
+    const char *pcPair;
+    uint32_t ui32Quot;
 
-    //
-    // Adjust buffer size limit to allow one space for null termination.
-    //
-    if(n)
+    pcDigit = pcEnd;
+    if(ui32Base == 16)
     {
-        n--;
+        do
+        {
+            *--pcDigit = g_pcHex[ui32Value & 15];
+            ui32Value >>= 4;
+        }
+        while(ui32Value);
     }
+    else
+    {
+        while(ui32Value >= 100)
+        {
+            ui32Quot = (uint32_t)(((uint64_t)ui32Value * 0x51EB851F) >> 37);
+            pcPair = &g_pcDigits2[2 * (ui32Value - (100 * ui32Quot))];
+            *--pcDigit = pcPair[1];
+            *--pcDigit = pcPair[0];
+            ui32Value = ui32Quot;
+        }
+        if(ui32Value >= 10)
+        {
+            *--pcDigit = g_pcDigits2[(2 * ui32Value) + 1];
+            *--pcDigit = g_pcDigits2[2 * ui32Value];
+        }
+        else
+        {
+            *--pcDigit = '0' + ui32Value;
+        }
+    }
+    return(pcEnd - pcDigit);
+}
 
-    //
-    // Initialize the count of characters converted.
-    //
-    iConvertCount = 0;
+//*****************************************************************************
+//
+// Splits off the next item of a format string: the run of literal characters
+// up to the next %, and the conversion that follows it, if any.  Returns a
+// pointer to the first character after the item.
+//
+//*****************************************************************************
+static const char *
+uparse(const char *pcFormat, tUFormatItem *psItem)
+{
+    const char *pcRun;
 
     //
-    // Loop while there are more characters in the format string.
+    // Find the first % character, or the end of the string.  The whole run
+    // is later written with a single copy.
     //
-    while(*format)
+    for(pcRun = pcFormat; (*pcRun != '%') && (*pcRun != '\0'); pcRun++)
+    {
+    }
+    psItem->pcLiteral = pcFormat;
+    psItem->ui32Length = pcRun - pcFormat;
+    psItem->ui32Width = 0;
+    psItem->cFill = ' ';
+    psItem->cConv = 0;
+
+    if(*pcRun == '%')
     {
         //
-        // Find the first non-% character, or the end of the string.
+        // Collect the field width.  A leading zero selects zero fill.
         //
-        for(ulIdx = 0; (format[ulIdx] != '%') && (format[ulIdx] != '\0');
-            ulIdx++)
+        for(pcRun++; (*pcRun >= '0') && (*pcRun <= '9'); pcRun++)
         {
+            if((*pcRun == '0') && (psItem->ui32Width == 0))
+            {
+                psItem->cFill = '0';
+            }
+            psItem->ui32Width = (psItem->ui32Width * 10) + (*pcRun - '0');
         }
 
         //
-        // Write this portion of the string to the output buffer.  If there are
-        // more characters to write than there is space in the buffer, then
-        // only write as much as will fit in the buffer.
+        // A % at the very end of the string is reported as an error like any
+        // other unknown conversion, but nothing past the end is read.
         //
-        if(ulIdx > n)
+        if(*pcRun == '\0')
         {
-            ustrncpy(s, format, n);
-            s += n;
-            n = 0;
+            psItem->cConv = '?';
         }
         else
         {
-            ustrncpy(s, format, ulIdx);
-            s += ulIdx;
-            n -= ulIdx;
+            psItem->cConv = *pcRun++;
         }
+    }
+    return(pcRun);
+}
 
-        //
-        // Update the conversion count.  This will be the number of characters
-        // that should have been written, even if there was not room in the
-        // buffer.
-        //
-        iConvertCount += ulIdx;
+//*****************************************************************************
+//
+// Appends characters to a sink.  When the buffer fills, a sink with a write
+// function is flushed through it, and a run that is bigger than the whole
+// buffer is passed straight to it; a sink without one keeps what fits.
+//
+//*****************************************************************************
+static void
+usinkflush(tUSink *psSink)
+{
+    if(psSink->pcNext != psSink->pcStart)
+    {
+        psSink->pfnWrite(psSink->pcStart, psSink->pcNext - psSink->pcStart);
+        psSink->pcNext = psSink->pcStart;
+    }
+}
+
+static void
+usinkwrite(tUSink *psSink, const char *pcBuf, uint32_t ui32Len)
+{
+    uint32_t ui32Room;
+    char *pcNext;
+
+    psSink->iCount += ui32Len;
+    pcNext = psSink->pcNext;
+    ui32Room = psSink->pcEnd - pcNext;
+    if(ui32Len > ui32Room)
+    {
+        if(psSink->pfnWrite)
+        {
+            usinkflush(psSink);
+            pcNext = psSink->pcNext;
+            ui32Room = psSink->pcEnd - pcNext;
+            if(ui32Len > ui32Room)
+            {
+                psSink->pfnWrite(pcBuf, ui32Len);
+                return;
+            }
+        }
+        else
+        {
+            ui32Len = ui32Room;
+        }
+    }
+    psSink->pcNext = pcNext + ui32Len;
+    while(ui32Len--)
+    {
+        *pcNext++ = *pcBuf++;
+    }
+}
+
+static void
+usinkfill(tUSink *psSink, char cFill, uint32_t ui32Len)
+{
+    psSink->iCount += ui32Len;
+    while(ui32Len)
+    {
+        if(psSink->pcNext == psSink->pcEnd)
+        {
+            if(psSink->pfnWrite == 0)
+            {
+                return;
+            }
+            usinkflush(psSink);
+        }
+        *psSink->pcNext++ = cFill;
+        ui32Len--;
+    }
+}
 
+//*****************************************************************************
+//
+//! Formats a string into a sink, the engine shared by the printf functions.
+//!
+//! \param psSink is the output, set up by the caller.
+//! \param format is the format string, or 0 if \e psFormat is used.
+//! \param psFormat is a format compiled by ufmtcompile(), or 0.
+//! \param arg is the list of optional arguments, which depend on the
+//! contents of the format.
+//!
+//! The formatting is described at uvsnprintf().  Literal runs are written
+//! with one copy each, numbers are converted without division, and a
+//! compiled format skips the parsing altogether.
+//!
+//! The sink collects output in the buffer from \e pcStart to \e pcEnd.  If
+//! \e pfnWrite is not 0, the buffer is passed to it whenever it fills and
+//! once more at the end; otherwise output that does not fit is dropped.
+//! Numbers are padded only if the number of padding characters plus one is
+//! less than \e ui32PadLimit.
+//!
+//! \return Returns the number of characters that were to be output, also
+//! left in \e iCount.
+//
+//*****************************************************************************
+int
+uvformat(tUSink *psSink, const char *format, const tUFormat *psFormat,
+         va_list arg)
+{
+    tUFormatItem sItem;
+    const tUFormatItem *psItem;
+    uint32_t ui32Item, ui32Value, ui32Base, ui32Neg, ui32Len, ui32Pad;
+    char *pcStr, pcNum[32];
+
+    ui32Item = 0;
+    while(1)
+    {
         //
-        // Skip the portion of the format string that was written.
+        // Take the next item from the compiled format, or parse it from the
+        // format string.  Whatever did not fit in the compiled format is
+        // parsed from its tail.
         //
-        format += ulIdx;
+        if(psFormat && (ui32Item < psFormat->ui32Items))
+        {
+            psItem = &psFormat->psItems[ui32Item++];
+        }
+        else
+        {
+            if(psFormat)
+            {
+                format = psFormat->pcTail;
+                psFormat = 0;
+            }
+            if((format == 0) || (*format == '\0'))
+            {
+                break;
+            }
+            format = uparse(format, &sItem);
+            psItem = &sItem;
+        }
 
         //
-        // See if the next character is a %.
+        // Write the literal run.
         //
-        if(*format == '%')
+        if(psItem->ui32Length)
         {
-            //
-            // Skip the %.
-            //
-            format++;
+            usinkwrite(psSink, psItem->pcLiteral, psItem->ui32Length);
+        }
 
+        switch(psItem->cConv)
+        {
             //
-            // Set the digit count to zero, and the fill character to space
-            // (that is, to the defaults).
+            // The end of the format string, only the literal run.
             //
-            ulCount = 0;
-            cFill = ' ';
+            case 0:
+            {
+                break;
+            }
 
             //
-            // It may be necessary to get back here to process more characters.
-            // Goto's aren't pretty, but effective.  I feel extremely dirty for
-            // using not one but two of the beasts.
+            // Handle the %c command.
             //
-again:
+            case 'c':
+            {
+                pcNum[0] = (char)va_arg(arg, uint32_t);
+                usinkwrite(psSink, pcNum, 1);
+                break;
+            }
 
             //
-            // Determine how to handle the next character.
+            // Handle the %d and %i commands.
             //
-            switch(*format++)
+            case 'd':
+            case 'i':
             {
-                //
-                // Handle the digit characters.
-                //
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
+                ui32Value = va_arg(arg, uint32_t);
+                ui32Neg = ((int32_t)ui32Value < 0);
+                if(ui32Neg)
                 {
-                    //
-                    // If this is a zero, and it is the first digit, then the
-                    // fill character is a zero instead of a space.
-                    //
-                    if((format[-1] == '0') && (ulCount == 0))
-                    {
-                        cFill = '0';
-                    }
-
-                    //
-                    // Update the digit count.
-                    //
-                    ulCount *= 10;
-                    ulCount += format[-1] - '0';
-
-                    //
-                    // Get the next character.
-                    //
-                    goto again;
+                    ui32Value = -ui32Value;
                 }
+                ui32Base = 10;
+                goto convert;
+            }
 
-                //
-                // Handle the %c command.
-                //
-                case 'c':
+            //
+            // Handle the %s command.  The padding goes after the string.
+            //
+            case 's':
+            {
+                pcStr = va_arg(arg, char *);
+                for(ui32Len = 0; pcStr[ui32Len] != '\0'; ui32Len++)
                 {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ulValue = va_arg(arg, unsigned long);
-
-                    //
-                    // Copy the character to the output buffer, if there is
-                    // room.  Update the buffer size remaining.
-                    //
-                    if(n != 0)
-                    {
-                        *s++ = (char)ulValue;
-                        n--;
-                    }
-
-                    //
-                    // Update the conversion count.
-                    //
-                    iConvertCount++;
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
                 }
-
-                //
-                // Handle the %d and %i commands.
-                //
-                case 'd':
-                case 'i':
+                usinkwrite(psSink, pcStr, ui32Len);
+                if(psItem->ui32Width > ui32Len)
                 {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ulValue = va_arg(arg, unsigned long);
-
-                    //
-                    // If the value is negative, make it positive and indicate
-                    // that a minus sign is needed.
-                    //
-                    if((long)ulValue < 0)
-                    {
-                        //
-                        // Make the value positive.
-                        //
-                        ulValue = -(long)ulValue;
-
-                        //
-                        // Indicate that the value is negative.
-                        //
-                        ulNeg = 1;
-                    }
-                    else
-                    {
-                        //
-                        // Indicate that the value is positive so that a
-                        // negative sign isn't inserted.
-                        //
-                        ulNeg = 0;
-                    }
-
-                    //
-                    // Set the base to 10.
-                    //
-                    ulBase = 10;
-
-                    //
-                    // Convert the value to ASCII.
-                    //
-                    goto convert;
+                    usinkfill(psSink, ' ', psItem->ui32Width - ui32Len);
                 }
+                break;
+            }
 
-                //
-                // Handle the %s command.
-                //
-                case 's':
-                {
-                    //
-                    // Get the string pointer from the varargs.
-                    //
-                    pcStr = va_arg(arg, char *);
-
-                    //
-                    // Determine the length of the string.
-                    //
-                    for(ulIdx = 0; pcStr[ulIdx] != '\0'; ulIdx++)
-                    {
-                    }
-
-                    //
-                    // Update the convert count to include any padding that
-                    // should be necessary (regardless of whether we have space
-                    // to write it or not).
-                    //
-                    if(ulCount > ulIdx)
-                    {
-                        iConvertCount += (ulCount - ulIdx);
-                    }
+            //
+            // Handle the %u command.
+            //
+            case 'u':
+            {
+                ui32Value = va_arg(arg, uint32_t);
+                ui32Neg = 0;
+                ui32Base = 10;
+                goto convert;
+            }
 
-                    //
-                    // Copy the string to the output buffer.  Only copy as much
-                    // as will fit in the buffer.  Update the output buffer
-                    // pointer and the space remaining.
-                    //
-                    if(ulIdx > n)
-                    {
-                        ustrncpy(s, pcStr, n);
-                        s += n;
-                        n = 0;
-                    }
-                    else
-                    {
-                        ustrncpy(s, pcStr, ulIdx);
-                        s += ulIdx;
-                        n -= ulIdx;
-
-                        //
-                        // Write any required padding spaces assuming there is
-                        // still space in the buffer.
-                        //
-                        if(ulCount > ulIdx)
-                        {
-                            ulCount -= ulIdx;
-                            if(ulCount > n)
-                            {
-                                ulCount = n;
-                            }
-                            n = -ulCount;
-
-                            while(ulCount--)
-                            {
-                                *s++ = ' ';
-                            }
-                        }
-                    }
+            //
+            // Handle the %x and %X commands.  Note that they are treated
+            // identically; that is, %X will use lower case letters for a-f
+            // instead of the upper case letters is should use.  We also
+            // alias %p to %x.
+            //
+            case 'x':
+            case 'X':
+            case 'p':
+            {
+                ui32Value = va_arg(arg, uint32_t);
+                ui32Neg = 0;
+                ui32Base = 16;
 
-                    //
-                    // Update the conversion count.  This will be the number of
-                    // characters that should have been written, even if there
-                    // was not room in the buffer.
-                    //
-                    iConvertCount += ulIdx;
-
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
+convert:
+                ui32Len = uconvert(pcNum + sizeof(pcNum), ui32Value, ui32Base);
 
                 //
-                // Handle the %u command.
+                // Padding to reach the field width.  The width is unsigned,
+                // so a number wider than the field wraps around and gets no
+                // padding, and neither does a width at or past the limit.
                 //
-                case 'u':
-                {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ulValue = va_arg(arg, unsigned long);
-
-                    //
-                    // Set the base to 10.
-                    //
-                    ulBase = 10;
-
-                    //
-                    // Indicate that the value is positive so that a minus sign
-                    // isn't inserted.
-                    //
-                    ulNeg = 0;
-
-                    //
-                    // Convert the value to ASCII.
-                    //
-                    goto convert;
-                }
+                ui32Pad = psItem->ui32Width - ui32Len - ui32Neg + 1;
+                ui32Pad = ((ui32Pad > 1) && (ui32Pad < psSink->ui32PadLimit)) ?
+                          ui32Pad - 1 : 0;
 
                 //
-                // Handle the %x and %X commands.  Note that they are treated
-                // identically; that is, %X will use lower case letters for a-f
-                // instead of the upper case letters is should use.  We also
-                // alias %p to %x.
+                // The minus sign goes before zeros and after spaces.  The
+                // padding and sign are put in front of the digits so the
+                // whole number is written at once, unless the padding is
+                // too wide for the buffer.
                 //
-                case 'x':
-                case 'X':
-                case 'p':
+                pcStr = pcNum + sizeof(pcNum) - ui32Len;
+                if(ui32Pad <= (sizeof(pcNum) - 11))
                 {
-                    //
-                    // Get the value from the varargs.
-                    //
-                    ulValue = va_arg(arg, unsigned long);
-
-                    //
-                    // Set the base to 16.
-                    //
-                    ulBase = 16;
-
-                    //
-                    // Indicate that the value is positive so that a minus sign
-                    // isn't inserted.
-                    //
-                    ulNeg = 0;
-
-                    //
-                    // Determine the number of digits in the string version of
-                    // the value.
-                    //
-convert:
-                    for(ulIdx = 1;
-                        (((ulIdx * ulBase) <= ulValue) &&
-                         (((ulIdx * ulBase) / ulBase) == ulIdx));
-                        ulIdx *= ulBase, ulCount--)
+                    if(ui32Neg && (psItem->cFill != '0'))
                     {
+                        *--pcStr = '-';
                     }
-
-                    //
-                    // If the value is negative, reduce the count of padding
-                    // characters needed.
-                    //
-                    if(ulNeg)
+                    for(; ui32Pad; ui32Pad--)
                     {
-                        ulCount--;
+                        *--pcStr = psItem->cFill;
                     }
-
-                    //
-                    // If the value is negative and the value is padded with
-                    // zeros, then place the minus sign before the padding.
-                    //
-                    if(ulNeg && (n != 0) && (cFill == '0'))
+                    if(ui32Neg && (psItem->cFill == '0'))
                     {
-                        //
-                        // Place the minus sign in the output buffer.
-                        //
-                        *s++ = '-';
-                        n--;
-
-                        //
-                        // Update the conversion count.
-                        //
-                        iConvertCount++;
-
-                        //
-                        // The minus sign has been placed, so turn off the
-                        // negative flag.
-                        //
-                        ulNeg = 0;
+                        *--pcStr = '-';
                     }
-
-                    //
-                    // See if there are more characters in the specified field
-                    // width than there are in the conversion of this value.
-                    //
-                    if((ulCount > 1) && (ulCount < 65536))
+                }
+                else
+                {
+                    if(ui32Neg && (psItem->cFill == '0'))
                     {
-                        //
-                        // Loop through the required padding characters.
-                        //
-                        for(ulCount--; ulCount; ulCount--)
-                        {
-                            //
-                            // Copy the character to the output buffer if there
-                            // is room.
-                            //
-                            if(n != 0)
-                            {
-                                *s++ = cFill;
-                                n--;
-                            }
-
-                            //
-                            // Update the conversion count.
-                            //
-                            iConvertCount++;
-                        }
+                        usinkwrite(psSink, "-", 1);
+                        ui32Neg = 0;
                     }
-
-                    //
-                    // If the value is negative, then place the minus sign
-                    // before the number.
-                    //
-                    if(ulNeg && (n != 0))
+                    usinkfill(psSink, psItem->cFill, ui32Pad);
+                    if(ui32Neg)
                     {
-                        //
-                        // Place the minus sign in the output buffer.
-                        //
-                        *s++ = '-';
-                        n--;
-
-                        //
-                        // Update the conversion count.
-                        //
-                        iConvertCount++;
+                        usinkwrite(psSink, "-", 1);
                     }
+                }
+                usinkwrite(psSink, pcStr, pcNum + sizeof(pcNum) - pcStr);
+                break;
+            }
 
-                    //
-                    // Convert the value into a string.
-                    //
-                    for(; ulIdx; ulIdx /= ulBase)
-                    {
-                        //
-                        // Copy the character to the output buffer if there is
-                        // room.
-                        //
-                        if(n != 0)
-                        {
-                            *s++ = g_pcHex[(ulValue / ulIdx) % ulBase];
-                            n--;
-                        }
-
-                        //
-                        // Update the conversion count.
-                        //
-                        iConvertCount++;
-                    }
+            //
+            // Handle the %% command.
+            //
+            case '%':
+            {
+                usinkwrite(psSink, "%", 1);
+                break;
+            }
 
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
+            //
+            // Handle all other commands.
+            //
+            default:
+            {
+                usinkwrite(psSink, "ERROR", 5);
+                break;
+            }
+        }
+    }
 
-                //
-                // Handle the %% command.
-                //
-                case '%':
-                {
-                    //
-                    // Simply write a single %.
-                    //
-                    if(n != 0)
-                    {
-                        *s++ = format[-1];
-                        n--;
-                    }
+    //
+    // Send whatever is left in the buffer.
+    //
+    if(psSink->pfnWrite)
+    {
+        usinkflush(psSink);
+    }
+    return(psSink->iCount);
+}
 
-                    //
-                    // Update the conversion count.
-                    //
-                    iConvertCount++;
+//*****************************************************************************
+//
+//! Compiles a format string for repeated use.
+//!
+//! \param psFormat is the compiled format to fill in.
+//! \param format is the format string, as described at uvsnprintf().
+//!
+//! This function splits the format string into its literal runs and
+//! conversions once, so that usnprintfc(), uvsnprintfc() and UARTprintfc()
+//! can print it without looking at it character by character again.  Use it
+//! for lines that are printed often.  The compiled format points into
+//! \e format, so the string must not change or go away while the compiled
+//! format is in use; a string literal is ideal.  A format with more than
+//! \b UFORMAT_MAX_ITEMS conversions still works, the rest of it is
+//! interpreted at run time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+ufmtcompile(tUFormat *psFormat, const char *format)
+{
+    uint32_t ui32Item;
 
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
+    ASSERT(psFormat);
+    ASSERT(format);
 
-                //
-                // Handle all other commands.
-                //
-                default:
-                {
-                    //
-                    // Indicate an error.
-                    //
-                    if(n >= 5)
-                    {
-                        ustrncpy(s, "ERROR", 5);
-                        s += 5;
-                        n -= 5;
-                    }
-                    else
-                    {
-                        ustrncpy(s, "ERROR", n);
-                        s += n;
-                        n = 0;
-                    }
+    for(ui32Item = 0; (*format != '\0') && (ui32Item < UFORMAT_MAX_ITEMS);
+        ui32Item++)
+    {
+        format = uparse(format, &psFormat->psItems[ui32Item]);
+    }
+    psFormat->ui32Items = ui32Item;
+    psFormat->pcTail = format;
+}
 
-                    //
-                    // Update the conversion count.
-                    //
-                    iConvertCount += 5;
+//*****************************************************************************
+//
+// Formats into a caller buffer of n bytes, see uvsnprintf().
+//
+//*****************************************************************************
+static int
+uvsnformat(char *s, size_t n, const char *format, const tUFormat *psFormat,
+           va_list arg)
+{
+    tUSink sSink;
 
-                    //
-                    // This command has been handled.
-                    //
-                    break;
-                }
-            }
-        }
+    //
+    // Adjust buffer size limit to allow one space for null termination.
+    //
+    if(n)
+    {
+        n--;
     }
+    sSink.pcStart = s;
+    sSink.pcNext = s;
+    sSink.pcEnd = s + n;
+    sSink.pfnWrite = 0;
+    sSink.ui32PadLimit = 65536;
+    sSink.iCount = 0;
+    uvformat(&sSink, format, psFormat, arg);
 
     //
     // Null terminate the string in the buffer.
     //
-    *s = 0;
+    *sSink.pcNext = 0;
+    return(sSink.iCount);
+}
+
+//*****************************************************************************
+//
+//! A simple vsnprintf function supporting \%c, \%d, \%p, \%s, \%u, \%x, and
+//! \%X.
+//!
+//! \param s points to the buffer where the converted string is stored.
+//! \param n is the size of the buffer.
+//! \param format is the format string.
+//! \param arg is the list of optional arguments, which depend on the
+//! contents of the format string.
+//!
+//! This function is very similar to the C library <tt>vsnprintf()</tt>
+//! function.  Only the following formatting characters are supported:
+//!
+//! - \%c to print a character
+//! - \%d or \%i to print a decimal value
+//! - \%s to print a string
+//! - \%u to print an unsigned decimal value
+//! - \%x to print a hexadecimal value using lower case letters
+//! - \%X to print a hexadecimal value using lower case letters (not upper case
+//! letters as would typically be used)
+//! - \%p to print a pointer as a hexadecimal value
+//! - \%\% to print out a \% character
+//!
+//! For \%d, \%i, \%p, \%s, \%u, \%x, and \%X, an optional number may reside
+//! between the \% and the format character, which specifies the minimum number
+//! of characters to use for that value; if preceded by a 0 then the extra
+//! characters will be filled with zeros instead of spaces.  For example,
+//! ``\%8d'' will use eight characters to print the decimal value with spaces
+//! added to reach eight; ``\%08d'' will use eight characters as well but will
+//! add zeroes instead of spaces.  Strings are padded with spaces after the
+//! string.
+//!
+//! The type of the arguments after \e format must match the requirements of
+//! the format string.  For example, if an integer was passed where a string
+//! was expected, an error of some kind will most likely occur.
+//!
+//! The \e n parameter limits the number of characters that will be
+//! stored  in the buffer pointed to by \e s to prevent the possibility of
+//! a buffer  overflow.  The buffer size should be large enough to hold the
+//! expected converted output string, including the null termination character.
+//!
+//! The function will return the number of characters that would be converted
+//! as if there were no limit on the buffer size.  Therefore it is possible for
+//! the function to return a count that is greater than the specified buffer
+//! size.  If this happens, it means that the output was truncated.
+//!
+//! \return Returns the number of characters that were to be stored, not
+//! including the NULL termination character, regardless of space in the
+//! buffer.
+//
+//*****************************************************************************
+int
+uvsnprintf(char * restrict s, size_t n, const char * restrict format,
+           va_list arg)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(s);
+    ASSERT(n);
+    ASSERT(format);
+
+    return(uvsnformat(s, n, format, 0, arg));
+}
 
+//*****************************************************************************
+//
+//! A vsnprintf function for a format compiled by ufmtcompile().
+//!
+//! \param s points to the buffer where the converted string is stored.
+//! \param n is the size of the buffer.
+//! \param psFormat is the compiled format.
+//! \param arg is the list of optional arguments, which depend on the
+//! contents of the format.
+//!
+//! The output is exactly what uvsnprintf() gives for the string that was
+//! compiled, without parsing it again.
+//!
+//! \return Returns the number of characters that were to be stored, not
+//! including the NULL termination character, regardless of space in the
+//! buffer.
+//
+//*****************************************************************************
+int
+uvsnprintfc(char * restrict s, size_t n, const tUFormat *psFormat,
+            va_list arg)
+{
     //
-    // Return the number of characters in the full converted string.
+    // Check the arguments.
     //
-    return(iConvertCount);
+    ASSERT(s);
+    ASSERT(n);
+    ASSERT(psFormat);
+
+    return(uvsnformat(s, n, 0, psFormat, arg));
 }
 
 //*****************************************************************************
@@ -832,6 +836,51 @@ usnprintf(char * restrict s, size_t n, const char * restrict format, ...)
     return(ret);
 }
 
+//*****************************************************************************
+//
+//! A snprintf function for a format compiled by ufmtcompile().
+//!
+//! \param s is the buffer where the converted string is stored.
+//! \param n is the size of the buffer.
+//! \param psFormat is the compiled format.
+//! \param ... are the optional arguments, which depend on the contents of the
+//! format.
+//!
+//! The output is exactly what usnprintf() gives for the string that was
+//! compiled, without parsing it again.
+//!
+//! \return Returns the number of characters that were to be stored, not
+//! including the NULL termination character, regardless of space in the
+//! buffer.
+//
+//*****************************************************************************
+int
+usnprintfc(char * restrict s, size_t n, const tUFormat *psFormat, ...)
+{
+    va_list arg;
+    int ret;
+
+    //
+    // Start the varargs processing.
+    //
+    va_start(arg, psFormat);
+
+    //
+    // Call vsnprintfc to perform the conversion.
+    //
+    ret = uvsnprintfc(s, n, psFormat, arg);
+
+    //
+    // End the varargs processing.
+    //
+    va_end(arg);
+
+    //
+    // Return the conversion count.
+    //
+    return(ret);
+}
+
 //*****************************************************************************
 //
 // This array contains the number of days in a year at the beginning of each
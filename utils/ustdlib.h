@@ -31,6 +31,7 @@
 //
 //*****************************************************************************
 #include <stdarg.h>
+#include <stdint.h>
 #include <time.h>
 
 //*****************************************************************************
@@ -44,6 +45,113 @@ extern "C"
 {
 #endif
 
+//*****************************************************************************
+//
+// The most conversions a format compiled by ufmtcompile() holds; the rest of
+// a longer format is interpreted at run time.
+//
+//*****************************************************************************
+#define UFORMAT_MAX_ITEMS       8
+
+//*****************************************************************************
+//
+// One item of a compiled format: a run of literal characters and the
+// conversion that follows it.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The literal characters, which point into the format string.
+    //
+    const char *pcLiteral;
+
+    //
+    // The number of literal characters.
+    //
+    uint32_t ui32Length;
+
+    //
+    // The minimum field width.
+    //
+    uint32_t ui32Width;
+
+    //
+    // The fill character, ' ' or '0'.
+    //
+    char cFill;
+
+    //
+    // The conversion character, or 0 if the item is only literal characters.
+    //
+    char cConv;
+}
+tUFormatItem;
+
+//*****************************************************************************
+//
+// A format string compiled by ufmtcompile().
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The items, in order.
+    //
+    tUFormatItem psItems[UFORMAT_MAX_ITEMS];
+
+    //
+    // The number of items used.
+    //
+    uint32_t ui32Items;
+
+    //
+    // The part of the format string that did not fit in the items.
+    //
+    const char *pcTail;
+}
+tUFormat;
+
+//*****************************************************************************
+//
+// Where uvformat() puts its output.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The start of the output buffer.
+    //
+    char *pcStart;
+
+    //
+    // The next free character in the output buffer.
+    //
+    char *pcNext;
+
+    //
+    // One past the last character of the output buffer that can be used.
+    //
+    char *pcEnd;
+
+    //
+    // Called with the buffer contents when it fills and at the end, or 0 to
+    // drop output that does not fit.
+    //
+    int (*pfnWrite)(const char *pcBuf, uint32_t ui32Len);
+
+    //
+    // Numbers are padded only if the padding plus one is less than this.
+    //
+    uint32_t ui32PadLimit;
+
+    //
+    // The number of characters output so far, including dropped ones.
+    //
+    int iCount;
+}
+tUSink;
+
 //*****************************************************************************
 //
 // Prototypes for the APIs.
@@ -69,6 +177,13 @@ extern unsigned long int ustrtoul(const char * restrict nptr,
                                   const char ** restrict endptr, int base);
 extern int uvsnprintf(char * restrict s, size_t n,
                       const char * restrict format, va_list arg);
+extern void ufmtcompile(tUFormat *psFormat, const char *format);
+extern int usnprintfc(char * restrict s, size_t n, const tUFormat *psFormat,
+                      ...);
+extern int uvsnprintfc(char * restrict s, size_t n, const tUFormat *psFormat,
+                       va_list arg);
+extern int uvformat(tUSink *psSink, const char *format,
+                    const tUFormat *psFormat, va_list arg);
 
 //*****************************************************************************
 //